@@ -11,22 +11,43 @@
 
 #pragma once
 
-#include "LRU.h"
 #include "utils/Log.h"
 
 #include <atomic>
+#include <list>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace cache {
 
+constexpr size_t DEFAULT_SHARD_NUM = 16;
+
+struct CacheStatistics {
+    uint64_t hit_count_ = 0;
+    uint64_t miss_count_ = 0;
+    uint64_t eviction_count_ = 0;
+    uint64_t item_count_ = 0;
+    int64_t usage_ = 0;
+};
+
+// The cache is split into shards by key hash, each shard has its own lock, so lookups of different
+// keys don't contend. Capacity is shared by all shards and counted in bytes.
+//
+// Items are managed by a segmented LRU: a new item enters the probation segment and is promoted to
+// the protected segment when it is hit again. Eviction takes the least recently used probation item
+// of all shards first, so a one-off scan only replaces other probation items and leaves the hot
+// working set in the protected segment. Pinned items are never evicted until they are unpinned or erased.
 template <typename ItemObj>
 class Cache {
  public:
     // mem_capacity, units:GB
-    Cache(int64_t capacity_gb, int64_t cache_max_count, const std::string& header = "");
+    Cache(int64_t capacity_gb, int64_t cache_max_count, const std::string& header = "",
+          size_t shard_num = DEFAULT_SHARD_NUM);
     ~Cache() = default;
 
     int64_t
@@ -34,6 +55,12 @@ class Cache {
         return usage_;
     }
 
+    // unit: BYTE
+    int64_t
+    protected_usage() const {
+        return protected_usage_;
+    }
+
     // unit: BYTE
     int64_t
     capacity() const {
@@ -75,6 +102,19 @@ class Cache {
     bool
     reserve(const int64_t size);
 
+    bool
+    pin(const std::string& key);
+
+    bool
+    unpin(const std::string& key);
+
+    std::vector<CacheStatistics>
+    statistics() const;
+
+    // keys of all items with their access count, most frequently accessed first
+    std::vector<std::pair<std::string, uint64_t>>
+    hot_items() const;
+
     void
     print();
 
@@ -82,23 +122,78 @@ class Cache {
     clear();
 
  private:
+    enum class Segment { PROBATION, PROTECTED, PINNED };
+
+    struct Entry {
+        std::string key_;
+        ItemObj item_;
+        int64_t size_;
+        uint64_t access_count_;
+        uint64_t tick_;  // last access time, compared among shards to find the least recently used item
+        Segment segment_;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    struct Shard {
+        mutable std::mutex mutex_;
+        EntryList probation_;
+        EntryList protected_;
+        EntryList pinned_;
+        std::unordered_map<std::string, typename EntryList::iterator> entries_;
+        int64_t usage_ = 0;
+
+        std::atomic<uint64_t> hit_count_{0};
+        std::atomic<uint64_t> miss_count_{0};
+        std::atomic<uint64_t> eviction_count_{0};
+
+        EntryList&
+        list(Segment segment) {
+            switch (segment) {
+                case Segment::PROTECTED:
+                    return protected_;
+                case Segment::PINNED:
+                    return pinned_;
+                default:
+                    return probation_;
+            }
+        }
+    };
+
+    Shard&
+    shard(const std::string& key) const;
+
+    void
+    insert_internal(const std::string& key, const ItemObj& item, bool only_if_not_exist);
+
+    void
+    erase_internal(Shard& shard, const std::string& key);
+
     void
-    insert_internal(const std::string& key, const ItemObj& item);
+    move_internal(Shard& shard, typename EntryList::iterator it, Segment segment);
 
     void
-    erase_internal(const std::string& key);
+    demote_protected_internal();
+
+    int64_t
+    evict_one_internal();
 
     void
-    free_memory_internal(const int64_t target_size);
+    free_memory_internal(const int64_t target_size, const int64_t incoming_size = 0);
 
  private:
     std::string header_;
-    int64_t usage_;
-    int64_t capacity_;
+    std::atomic<int64_t> usage_;
+    std::atomic<int64_t> capacity_;
+    std::atomic<int64_t> protected_usage_;
+    std::atomic<int64_t> pinned_usage_;
+    std::atomic<uint64_t> item_count_;
+    std::atomic<uint64_t> tick_;
+    int64_t max_count_;
     double freemem_percent_;
 
-    LRU<std::string, ItemObj> lru_;
-    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::mutex evict_mutex_;  // only one thread evicts at a time
 };
 
 }  // namespace cache
@@ -9,24 +9,37 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+
 namespace milvus {
 namespace cache {
 
 constexpr double DEFAULT_THRESHOLD_PERCENT = 0.7;
+constexpr double PROTECTED_PERCENT = 0.8;
 
 template <typename ItemObj>
-Cache<ItemObj>::Cache(int64_t capacity, int64_t cache_max_count, const std::string& header)
+Cache<ItemObj>::Cache(int64_t capacity, int64_t cache_max_count, const std::string& header, size_t shard_num)
     : header_(header),
       usage_(0),
       capacity_(capacity),
-      freemem_percent_(DEFAULT_THRESHOLD_PERCENT),
-      lru_(cache_max_count) {
+      protected_usage_(0),
+      pinned_usage_(0),
+      item_count_(0),
+      tick_(0),
+      max_count_(cache_max_count),
+      freemem_percent_(DEFAULT_THRESHOLD_PERCENT) {
+    shard_num = std::max<size_t>(1, shard_num);
+    for (size_t i = 0; i < shard_num; ++i) {
+        shards_.emplace_back(std::make_unique<Shard>());
+    }
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::set_capacity(int64_t capacity) {
-    std::lock_guard<std::mutex> lock(mutex_);
     if (capacity > 0) {
         capacity_ = capacity;
         free_memory_internal(capacity);
@@ -36,58 +49,68 @@ Cache<ItemObj>::set_capacity(int64_t capacity) {
 template <typename ItemObj>
 size_t
 Cache<ItemObj>::size() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.size();
+    return item_count_;
 }
 
 template <typename ItemObj>
 bool
 Cache<ItemObj>::exists(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.exists(key);
+    auto& cache_shard = shard(key);
+    std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+    return cache_shard.entries_.find(key) != cache_shard.entries_.end();
 }
 
 template <typename ItemObj>
 ItemObj
 Cache<ItemObj>::get(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!lru_.exists(key)) {
-        return nullptr;
+    auto& cache_shard = shard(key);
+    ItemObj item;
+    {
+        std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+        auto iter = cache_shard.entries_.find(key);
+        if (iter == cache_shard.entries_.end()) {
+            cache_shard.miss_count_++;
+            return nullptr;
+        }
+
+        cache_shard.hit_count_++;
+        auto entry = iter->second;
+        entry->access_count_++;
+        if (entry->segment_ != Segment::PINNED) {
+            move_internal(cache_shard, entry, Segment::PROTECTED);
+        }
+        item = entry->item_;
     }
-    return lru_.get(key);
+    demote_protected_internal();
+    return item;
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::insert(const std::string& key, const ItemObj& item) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    insert_internal(key, item);
+    insert_internal(key, item, false);
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::insert_if_not_exist(const std::string& key, const ItemObj& item) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (lru_.exists(key) == true) {
-        return ;
-    }
-    insert_internal(key, item);
+    insert_internal(key, item, true);
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::erase(const std::string& key) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    erase_internal(key);
+    auto& cache_shard = shard(key);
+    std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+    erase_internal(cache_shard, key);
 }
 
 template <typename ItemObj>
 bool
 Cache<ItemObj>::reserve(const int64_t item_size) {
-    std::lock_guard<std::mutex> lock(mutex_);
     if (item_size > capacity_) {
         LOG_SERVER_ERROR_ << header_ << " item size " << (item_size >> 20) << "MB too big to insert into cache capacity"
-                         << (capacity_ >> 20) << "MB";
+                          << (capacity_ >> 20) << "MB";
         return false;
     }
     if (item_size > capacity_ - usage_) {
@@ -96,105 +119,331 @@ Cache<ItemObj>::reserve(const int64_t item_size) {
     return true;
 }
 
+template <typename ItemObj>
+bool
+Cache<ItemObj>::pin(const std::string& key) {
+    auto& cache_shard = shard(key);
+    std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+    auto iter = cache_shard.entries_.find(key);
+    if (iter == cache_shard.entries_.end()) {
+        return false;
+    }
+
+    auto entry = iter->second;
+    if (entry->segment_ == Segment::PINNED) {
+        return true;
+    }
+
+    // leave room for the unpinned items
+    if (pinned_usage_ + entry->size_ > (int64_t)(capacity_ * freemem_percent_)) {
+        LOG_SERVER_WARNING_ << header_ << " Failed to pin " << key << ", pinned usage " << (pinned_usage_ >> 20)
+                            << "MB is too high for capacity " << (capacity_ >> 20) << "MB";
+        return false;
+    }
+
+    move_internal(cache_shard, entry, Segment::PINNED);
+    LOG_SERVER_DEBUG_ << header_ << " Pin " << key << ", pinned usage: " << (pinned_usage_ >> 20) << "MB";
+    return true;
+}
+
+template <typename ItemObj>
+bool
+Cache<ItemObj>::unpin(const std::string& key) {
+    auto& cache_shard = shard(key);
+    {
+        std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+        auto iter = cache_shard.entries_.find(key);
+        if (iter == cache_shard.entries_.end() || iter->second->segment_ != Segment::PINNED) {
+            return false;
+        }
+
+        move_internal(cache_shard, iter->second, Segment::PROTECTED);
+    }
+    demote_protected_internal();
+    LOG_SERVER_DEBUG_ << header_ << " Unpin " << key << ", pinned usage: " << (pinned_usage_ >> 20) << "MB";
+    return true;
+}
+
+template <typename ItemObj>
+std::vector<CacheStatistics>
+Cache<ItemObj>::statistics() const {
+    std::vector<CacheStatistics> shard_statistics;
+    for (auto& cache_shard : shards_) {
+        std::lock_guard<std::mutex> lock(cache_shard->mutex_);
+        CacheStatistics statistics;
+        statistics.hit_count_ = cache_shard->hit_count_;
+        statistics.miss_count_ = cache_shard->miss_count_;
+        statistics.eviction_count_ = cache_shard->eviction_count_;
+        statistics.item_count_ = cache_shard->entries_.size();
+        statistics.usage_ = cache_shard->usage_;
+        shard_statistics.emplace_back(statistics);
+    }
+    return shard_statistics;
+}
+
+template <typename ItemObj>
+std::vector<std::pair<std::string, uint64_t>>
+Cache<ItemObj>::hot_items() const {
+    std::vector<std::pair<std::string, uint64_t>> items;
+    for (auto& cache_shard : shards_) {
+        std::lock_guard<std::mutex> lock(cache_shard->mutex_);
+        for (auto& pair : cache_shard->entries_) {
+            items.emplace_back(pair.first, pair.second->access_count_);
+        }
+    }
+    std::sort(items.begin(), items.end(),
+              [](const std::pair<std::string, uint64_t>& a, const std::pair<std::string, uint64_t>& b) {
+                  return a.second > b.second;
+              });
+    return items;
+}
+
 template <typename ItemObj>
 void
 Cache<ItemObj>::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    lru_.clear();
-    usage_ = 0;
+    for (auto& cache_shard : shards_) {
+        std::lock_guard<std::mutex> lock(cache_shard->mutex_);
+        for (auto& entry : cache_shard->protected_) {
+            protected_usage_ -= entry.size_;
+        }
+        for (auto& entry : cache_shard->pinned_) {
+            pinned_usage_ -= entry.size_;
+        }
+        usage_ -= cache_shard->usage_;
+        item_count_ -= cache_shard->entries_.size();
+
+        cache_shard->probation_.clear();
+        cache_shard->protected_.clear();
+        cache_shard->pinned_.clear();
+        cache_shard->entries_.clear();
+        cache_shard->usage_ = 0;
+    }
     LOG_SERVER_DEBUG_ << header_ << " Clear cache !";
 }
 
-
 template <typename ItemObj>
 void
 Cache<ItemObj>::print() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    size_t cache_count = lru_.size();
-    // for (auto it = lru_.begin(); it != lru_.end(); ++it) {
-    //     LOG_SERVER_DEBUG_ << it->first;
-    // }
-    LOG_SERVER_DEBUG_ << header_ << " [item count]: " << cache_count << ", [usage] " << (usage_ >> 20)
-                     << "MB, [capacity] " << (capacity_ >> 20) << "MB";
+    uint64_t hit_count = 0, miss_count = 0, eviction_count = 0;
+    for (auto& statistics : this->statistics()) {
+        hit_count += statistics.hit_count_;
+        miss_count += statistics.miss_count_;
+        eviction_count += statistics.eviction_count_;
+    }
+
+    LOG_SERVER_DEBUG_ << header_ << " [item count]: " << item_count_ << ", [usage] " << (usage_ >> 20)
+                      << "MB, [protected] " << (protected_usage_ >> 20) << "MB, [pinned] " << (pinned_usage_ >> 20)
+                      << "MB, [capacity] " << (capacity_ >> 20) << "MB";
+    LOG_SERVER_DEBUG_ << header_ << " [hit]: " << hit_count << ", [miss]: " << miss_count
+                      << ", [eviction]: " << eviction_count;
+}
+
+template <typename ItemObj>
+typename Cache<ItemObj>::Shard&
+Cache<ItemObj>::shard(const std::string& key) const {
+    return *shards_[std::hash<std::string>()(key) % shards_.size()];
 }
 
 template <typename ItemObj>
 void
-Cache<ItemObj>::insert_internal(const std::string& key, const ItemObj& item) {
+Cache<ItemObj>::insert_internal(const std::string& key, const ItemObj& item, bool only_if_not_exist) {
     if (item == nullptr) {
         return;
     }
 
-    size_t item_size = item->Size();
+    int64_t item_size = item->Size();
+    auto& cache_shard = shard(key);
+    auto segment = Segment::PROBATION;
 
-    // if key already exist, subtract old item size
-    if (lru_.exists(key)) {
-        const ItemObj& old_item = lru_.get(key);
-        usage_ -= old_item->Size();
-    }
+    // if key already exist, remove the old item, the new one inherits its segment
+    auto remove_old_item = [&]() -> bool {
+        auto iter = cache_shard.entries_.find(key);
+        if (iter == cache_shard.entries_.end()) {
+            return true;
+        }
+        if (only_if_not_exist) {
+            return false;
+        }
+        segment = iter->second->segment_;
+        erase_internal(cache_shard, key);
+        return true;
+    };
 
-    // plus new item size
-    usage_ += item_size;
+    {
+        std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+        if (!remove_old_item()) {
+            return;
+        }
+    }
 
-    // if usage exceed capacity, free some items
-    if (usage_ > capacity_) {
-        LOG_SERVER_DEBUG_ << header_ << " Current usage " << (usage_ >> 20) << "MB is too high for capacity "
-                         << (capacity_ >> 20) << "MB, start free memory";
-        free_memory_internal(capacity_);
+    // if usage exceed capacity, free some items before insertion, so the new item is never the victim
+    if (usage_ + item_size > capacity_ || (int64_t)item_count_ + 1 > max_count_) {
+        LOG_SERVER_DEBUG_ << header_ << " Current usage " << ((usage_ + item_size) >> 20)
+                          << "MB is too high for capacity " << (capacity_ >> 20) << "MB, start free memory";
+        free_memory_internal(capacity_, item_size);
     }
 
     // insert new item
-    lru_.put(key, item);
+    {
+        std::lock_guard<std::mutex> lock(cache_shard.mutex_);
+        if (!remove_old_item()) {
+            return;
+        }
+        cache_shard.probation_.push_front(Entry{key, item, item_size, 1, ++tick_, Segment::PROBATION});
+        cache_shard.entries_[key] = cache_shard.probation_.begin();
+        cache_shard.usage_ += item_size;
+        usage_ += item_size;
+        item_count_++;
+        if (segment != Segment::PROBATION) {
+            move_internal(cache_shard, cache_shard.probation_.begin(), segment);
+        }
+    }
+    if (segment == Segment::PROTECTED) {
+        demote_protected_internal();
+    }
+
     LOG_SERVER_DEBUG_ << header_ << " Insert " << key << " size: " << (item_size >> 20) << "MB into cache";
-    LOG_SERVER_DEBUG_ << header_ << " Count: " << lru_.size() << ", Usage: " << (usage_ >> 20) << "MB, Capacity: "
-                     << (capacity_ >> 20) << "MB";
+    LOG_SERVER_DEBUG_ << header_ << " Count: " << item_count_ << ", Usage: " << (usage_ >> 20) << "MB, Capacity: "
+                      << (capacity_ >> 20) << "MB";
 }
 
 template <typename ItemObj>
 void
-Cache<ItemObj>::erase_internal(const std::string& key) {
-    if (!lru_.exists(key)) {
+Cache<ItemObj>::erase_internal(Shard& cache_shard, const std::string& key) {
+    auto iter = cache_shard.entries_.find(key);
+    if (iter == cache_shard.entries_.end()) {
         return;
     }
 
-    const ItemObj& item = lru_.get(key);
-    size_t item_size = item->Size();
-
-    lru_.erase(key);
-
+    auto entry = iter->second;
+    int64_t item_size = entry->size_;
+    if (entry->segment_ == Segment::PROTECTED) {
+        protected_usage_ -= item_size;
+    } else if (entry->segment_ == Segment::PINNED) {
+        pinned_usage_ -= item_size;
+    }
+    cache_shard.list(entry->segment_).erase(entry);
+    cache_shard.entries_.erase(iter);
+    cache_shard.usage_ -= item_size;
     usage_ -= item_size;
+    item_count_--;
+
     LOG_SERVER_DEBUG_ << header_ << " Erase " << key << " size: " << (item_size >> 20) << "MB from cache";
-    LOG_SERVER_DEBUG_ << header_ << " Count: " << lru_.size() << ", Usage: " << (usage_ >> 20) << "MB, Capacity: "
-                     << (capacity_ >> 20) << "MB";
+    LOG_SERVER_DEBUG_ << header_ << " Count: " << item_count_ << ", Usage: " << (usage_ >> 20) << "MB, Capacity: "
+                      << (capacity_ >> 20) << "MB";
 }
 
 template <typename ItemObj>
 void
-Cache<ItemObj>::free_memory_internal(const int64_t target_size) {
-    int64_t threshold = std::min((int64_t)(capacity_ * freemem_percent_), target_size);
-    int64_t delta_size = usage_ - threshold;
-    if (delta_size <= 0) {
-        delta_size = 1;  // ensure at least one item erased
+Cache<ItemObj>::move_internal(Shard& cache_shard, typename EntryList::iterator entry, Segment segment) {
+    if (entry->segment_ == Segment::PROTECTED) {
+        protected_usage_ -= entry->size_;
+    } else if (entry->segment_ == Segment::PINNED) {
+        pinned_usage_ -= entry->size_;
+    }
+    if (segment == Segment::PROTECTED) {
+        protected_usage_ += entry->size_;
+    } else if (segment == Segment::PINNED) {
+        pinned_usage_ += entry->size_;
     }
 
-    std::set<std::string> key_array;
-    int64_t released_size = 0;
+    auto& target_list = cache_shard.list(segment);
+    target_list.splice(target_list.begin(), cache_shard.list(entry->segment_), entry);
+    entry->segment_ = segment;
+    entry->tick_ = ++tick_;
+}
 
-    auto it = lru_.rbegin();
-    while (it != lru_.rend() && released_size < delta_size) {
-        auto& key = it->first;
-        auto& obj_ptr = it->second;
+template <typename ItemObj>
+void
+Cache<ItemObj>::demote_protected_internal() {
+    // the protected segment is bounded by its usage over all shards, the least recently used protected items
+    // go back to probation until it fits, the last protected item always stays
+    auto protected_capacity = (int64_t)(capacity_ * PROTECTED_PERCENT);
+    while (protected_usage_ > protected_capacity) {
+        Shard* victim_shard = nullptr;
+        uint64_t oldest_tick = std::numeric_limits<uint64_t>::max();
+        size_t protected_count = 0;
+        for (auto& cache_shard : shards_) {
+            std::lock_guard<std::mutex> lock(cache_shard->mutex_);
+            protected_count += cache_shard->protected_.size();
+            if (!cache_shard->protected_.empty() && cache_shard->protected_.back().tick_ < oldest_tick) {
+                oldest_tick = cache_shard->protected_.back().tick_;
+                victim_shard = cache_shard.get();
+            }
+        }
+        if (victim_shard == nullptr || protected_count <= 1) {
+            break;
+        }
 
-        key_array.emplace(key);
-        released_size += obj_ptr->Size();
-        ++it;
+        std::lock_guard<std::mutex> lock(victim_shard->mutex_);
+        auto& protected_list = victim_shard->protected_;
+        if (protected_list.empty() || protected_list.back().tick_ != oldest_tick) {
+            continue;  // the item is accessed or erased by others, search again
+        }
+        auto last = std::prev(protected_list.end());
+        protected_usage_ -= last->size_;
+        victim_shard->probation_.splice(victim_shard->probation_.begin(), protected_list, last);
+        last->segment_ = Segment::PROBATION;
+        last->tick_ = ++tick_;
     }
+}
 
-    LOG_SERVER_DEBUG_ << header_ << " To be released memory size: " << (released_size >> 20) << "MB";
+template <typename ItemObj>
+int64_t
+Cache<ItemObj>::evict_one_internal() {
+    // the least recently used probation item of all shards, protected items only when probation is empty
+    for (auto segment : {Segment::PROBATION, Segment::PROTECTED}) {
+        while (true) {
+            Shard* victim_shard = nullptr;
+            uint64_t oldest_tick = std::numeric_limits<uint64_t>::max();
+            for (auto& cache_shard : shards_) {
+                std::lock_guard<std::mutex> lock(cache_shard->mutex_);
+                auto& entry_list = cache_shard->list(segment);
+                if (!entry_list.empty() && entry_list.back().tick_ < oldest_tick) {
+                    oldest_tick = entry_list.back().tick_;
+                    victim_shard = cache_shard.get();
+                }
+            }
+            if (victim_shard == nullptr) {
+                break;
+            }
 
-    for (auto& key : key_array) {
-        erase_internal(key);
+            std::lock_guard<std::mutex> lock(victim_shard->mutex_);
+            auto& entry_list = victim_shard->list(segment);
+            if (entry_list.empty()) {
+                continue;  // the items are erased by others, search again
+            }
+            auto key = entry_list.back().key_;
+            auto item_size = entry_list.back().size_;
+            erase_internal(*victim_shard, key);
+            victim_shard->eviction_count_++;
+            return item_size;
+        }
     }
+    return -1;
+}
+
+template <typename ItemObj>
+void
+Cache<ItemObj>::free_memory_internal(const int64_t target_size, const int64_t incoming_size) {
+    std::lock_guard<std::mutex> lock(evict_mutex_);
+    int64_t threshold = std::min((int64_t)(capacity_ * freemem_percent_), target_size);
+    int64_t delta_size = usage_ + incoming_size - threshold;
+    if (delta_size <= 0) {
+        delta_size = 1;  // ensure at least one item erased
+    }
+    int64_t incoming_count = incoming_size > 0 ? 1 : 0;
+
+    int64_t released_size = 0;
+    while (released_size < delta_size || (int64_t)item_count_ + incoming_count > max_count_) {
+        auto item_size = evict_one_internal();
+        if (item_size < 0) {
+            break;
+        }
+        released_size += item_size;
+    }
+
+    LOG_SERVER_DEBUG_ << header_ << " Released memory size: " << (released_size >> 20) << "MB";
 }
 
 }  // namespace cache
@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace cache {
@@ -45,6 +47,12 @@ class CacheMgr {
     virtual bool
     Reserve(const int64_t size);
 
+    virtual bool
+    PinItem(const std::string& key);
+
+    virtual bool
+    UnpinItem(const std::string& key);
+
     virtual void
     PrintInfo();
 
@@ -60,6 +68,12 @@ class CacheMgr {
     void
     SetCapacity(int64_t capacity);
 
+    std::vector<CacheStatistics>
+    Statistics() const;
+
+    std::vector<std::pair<std::string, uint64_t>>
+    HotItems() const;
+
  protected:
     CacheMgr();
 
@@ -94,6 +94,26 @@ CacheMgr<ItemObj>::Reserve(const int64_t size) {
     return cache_->reserve(size);
 }
 
+template <typename ItemObj>
+bool
+CacheMgr<ItemObj>::PinItem(const std::string& key) {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return false;
+    }
+    return cache_->pin(key);
+}
+
+template <typename ItemObj>
+bool
+CacheMgr<ItemObj>::UnpinItem(const std::string& key) {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return false;
+    }
+    return cache_->unpin(key);
+}
+
 template <typename ItemObj>
 void
 CacheMgr<ItemObj>::PrintInfo() {
@@ -144,5 +164,25 @@ CacheMgr<ItemObj>::SetCapacity(int64_t capacity) {
     cache_->set_capacity(capacity);
 }
 
+template <typename ItemObj>
+std::vector<CacheStatistics>
+CacheMgr<ItemObj>::Statistics() const {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return {};
+    }
+    return cache_->statistics();
+}
+
+template <typename ItemObj>
+std::vector<std::pair<std::string, uint64_t>>
+CacheMgr<ItemObj>::HotItems() const {
+    if (cache_ == nullptr) {
+        LOG_SERVER_ERROR_ << "Cache doesn't exist";
+        return {};
+    }
+    return cache_->hot_items();
+}
+
 }  // namespace cache
 }  // namespace milvus
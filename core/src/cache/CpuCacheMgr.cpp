@@ -23,6 +23,9 @@ namespace cache {
 
 const char* BloomFilter_Suffix = ".bloomfilter";
 const char* Blacklist_Suffix = ".blacklist";
+const char* UidIndex_Suffix = ".uid_index";
+const char* Attrs_Suffix = ".attrs";
+const char* ZoneMaps_Suffix = ".zone_maps";
 
 CpuCacheMgr::CpuCacheMgr() {
     // All config values have been checked in Config::ValidateConfig()
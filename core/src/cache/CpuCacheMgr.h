@@ -24,6 +24,9 @@ namespace cache {
 // Define cache key suffix
 extern const char* BloomFilter_Suffix;
 extern const char* Blacklist_Suffix;
+extern const char* UidIndex_Suffix;
+extern const char* Attrs_Suffix;
+extern const char* ZoneMaps_Suffix;
 
 class CpuCacheMgr : public CacheMgr<DataObjPtr>, public server::CacheConfigHandler {
  private:
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "AttrsFormat.h"
 #include "DeletedDocsFormat.h"
 #include "IdBloomFilterFormat.h"
 #include "IdIndexFormat.h"
@@ -39,6 +40,9 @@ class Codec {
 
     virtual IdBloomFilterFormatPtr
     GetIdBloomFilterFormat() = 0;
+
+    virtual AttrsFormatPtr
+    GetAttrsFormat() = 0;
 };
 
 }  // namespace codec
@@ -40,6 +40,10 @@ class VectorsFormat {
     virtual void
     read_vectors(const storage::FSHandlerPtr& fs_ptr, off_t offset, size_t num_bytes,
                  std::vector<uint8_t>& raw_vectors) = 0;
+
+    virtual void
+    read_shared_vectors(const storage::FSHandlerPtr& fs_ptr, std::shared_ptr<uint8_t[]>& raw_vectors,
+                        size_t& num_bytes) = 0;
 };
 
 using VectorsFormatPtr = std::shared_ptr<VectorsFormat>;
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "codecs/default/DefaultAttrsFormat.h"
+
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/Exception.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+
+namespace milvus {
+namespace codec {
+
+segment::AttrPtr
+DefaultAttrsFormat::read_attr(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
+                              const std::string& name, bool with_values) {
+    if (!fs_ptr->reader_ptr_->open(file_path.c_str())) {
+        std::string err_msg = "Failed to open file: " + file_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_OPEN_FILE, err_msg);
+    }
+
+    int32_t type;
+    size_t count, null_count;
+    segment::ZoneMap zone_map;
+    fs_ptr->reader_ptr_->read(&type, sizeof(int32_t));
+    fs_ptr->reader_ptr_->read(&count, sizeof(size_t));
+    fs_ptr->reader_ptr_->read(&null_count, sizeof(size_t));
+    fs_ptr->reader_ptr_->read(&zone_map.int_min_, sizeof(int64_t));
+    fs_ptr->reader_ptr_->read(&zone_map.int_max_, sizeof(int64_t));
+    fs_ptr->reader_ptr_->read(&zone_map.float_min_, sizeof(double));
+    fs_ptr->reader_ptr_->read(&zone_map.float_max_, sizeof(double));
+
+    auto attr = std::make_shared<segment::Attr>(name, (engine::DataType)type);
+    if (attr->GetNbytes() == 0) {
+        fs_ptr->reader_ptr_->close();
+        std::string err_msg = "Unsupported attribute type " + std::to_string(type) + " in file: " + file_path;
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+
+    std::vector<segment::offset_t> nulls;
+    std::vector<uint8_t> data;
+    if (with_values) {
+        nulls.resize(null_count);
+        fs_ptr->reader_ptr_->read(nulls.data(), null_count * sizeof(segment::offset_t));
+        data.resize(count * attr->GetNbytes());
+        fs_ptr->reader_ptr_->read(data.data(), data.size());
+    }
+    fs_ptr->reader_ptr_->close();
+
+    attr->SetContent(count, null_count, std::move(data), std::move(nulls), zone_map);
+    return attr;
+}
+
+void
+DefaultAttrsFormat::read_internal(const storage::FSHandlerPtr& fs_ptr, segment::AttrsPtr& attrs_read,
+                                  bool with_values) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& dir_path = fs_ptr->operation_ptr_->GetDirectory();
+    if (!boost::filesystem::is_directory(dir_path)) {
+        std::string err_msg = "Directory: " + dir_path + "does not exist";
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_INVALID_ARGUMENT, err_msg);
+    }
+
+    attrs_read = std::make_shared<segment::Attrs>();
+    std::vector<std::string> file_paths;
+    fs_ptr->operation_ptr_->ListDirectory(file_paths);
+    for (const auto& file_path : file_paths) {
+        boost::filesystem::path path{file_path};
+        if (path.extension().string() == attr_extension_) {
+            attrs_read->AddAttr(read_attr(fs_ptr, path.string(), path.stem().string(), with_values));
+        }
+    }
+}
+
+void
+DefaultAttrsFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::AttrsPtr& attrs_read) {
+    read_internal(fs_ptr, attrs_read, true);
+}
+
+void
+DefaultAttrsFormat::read_zone_maps(const storage::FSHandlerPtr& fs_ptr, segment::AttrsPtr& attrs_read) {
+    read_internal(fs_ptr, attrs_read, false);
+}
+
+void
+DefaultAttrsFormat::write(const storage::FSHandlerPtr& fs_ptr, const segment::AttrsPtr& attrs) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& dir_path = fs_ptr->operation_ptr_->GetDirectory();
+
+    TimeRecorder rc("write attrs");
+
+    for (auto& pair : attrs->GetAttrs()) {
+        auto& attr = pair.second;
+        const std::string file_path = dir_path + "/" + attr->GetName() + attr_extension_;
+        if (!fs_ptr->writer_ptr_->open(file_path.c_str())) {
+            std::string err_msg = "Failed to open file: " + file_path + ", error: " + std::strerror(errno);
+            LOG_ENGINE_ERROR_ << err_msg;
+            throw Exception(SERVER_CANNOT_CREATE_FILE, err_msg);
+        }
+
+        int32_t type = (int32_t)attr->GetType();
+        size_t count = attr->GetCount();
+        size_t null_count = attr->GetNullCount();
+        auto zone_map = attr->GetZoneMap();
+        fs_ptr->writer_ptr_->write(&type, sizeof(int32_t));
+        fs_ptr->writer_ptr_->write(&count, sizeof(size_t));
+        fs_ptr->writer_ptr_->write(&null_count, sizeof(size_t));
+        fs_ptr->writer_ptr_->write(&zone_map.int_min_, sizeof(int64_t));
+        fs_ptr->writer_ptr_->write(&zone_map.int_max_, sizeof(int64_t));
+        fs_ptr->writer_ptr_->write(&zone_map.float_min_, sizeof(double));
+        fs_ptr->writer_ptr_->write(&zone_map.float_max_, sizeof(double));
+        fs_ptr->writer_ptr_->write((void*)attr->GetNulls().data(), null_count * sizeof(segment::offset_t));
+        fs_ptr->writer_ptr_->write((void*)attr->GetData().data(), attr->GetData().size());
+        fs_ptr->writer_ptr_->close();
+    }
+
+    rc.RecordSection("write " + std::to_string(attrs->GetAttrs().size()) + " attributes done");
+}
+
+}  // namespace codec
+}  // namespace milvus
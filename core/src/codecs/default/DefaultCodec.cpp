@@ -19,6 +19,7 @@
 
 #include <memory>
 
+#include "DefaultAttrsFormat.h"
 #include "DefaultDeletedDocsFormat.h"
 #include "DefaultIdBloomFilterFormat.h"
 #include "DefaultVectorIndexFormat.h"
@@ -32,6 +33,7 @@ DefaultCodec::DefaultCodec() {
     vector_index_format_ptr_ = std::make_shared<DefaultVectorIndexFormat>();
     deleted_docs_format_ptr_ = std::make_shared<DefaultDeletedDocsFormat>();
     id_bloom_filter_format_ptr_ = std::make_shared<DefaultIdBloomFilterFormat>();
+    attrs_format_ptr_ = std::make_shared<DefaultAttrsFormat>();
 }
 
 VectorsFormatPtr
@@ -54,5 +56,10 @@ DefaultCodec::GetIdBloomFilterFormat() {
     return id_bloom_filter_format_ptr_;
 }
 
+AttrsFormatPtr
+DefaultCodec::GetAttrsFormat() {
+    return attrs_format_ptr_;
+}
+
 }  // namespace codec
 }  // namespace milvus
@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "utils/Exception.h"
 #include "utils/Log.h"
@@ -34,11 +36,9 @@ namespace milvus {
 namespace codec {
 
 // for compatibility with version 1.0.0
-constexpr unsigned int BLOOM_FILTER_CAPACITY = 500000;
-constexpr double BLOOM_FILTER_ERROR_RATE = 0.01;
-
-// the magic num is converted from string "bloom_0"
-constexpr int64_t BLOOM_FILTER_MAGIC_NUM = 0x305F6D6F6F6C62;
+// the dablooms filter of older versions used 0x305F6D6F6F6C62, such a file is reported as unreadable
+// and the filter is rebuilt from the uids of the segment
+constexpr int64_t BLOOM_FILTER_MAGIC_NUM = 0x315F6B636F6C62;
 
 void
 DefaultIdBloomFilterFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
@@ -46,7 +46,7 @@ DefaultIdBloomFilterFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::I
 
     auto& dir_path = fs_ptr->operation_ptr_->GetDirectory();
     const std::string bloom_filter_file_path = dir_path + "/" + bloom_filter_filename_;
-    scaling_bloom_t* bloom_filter{nullptr};
+    std::shared_ptr<segment::IdBloomFilter> bloom_filter;
     do {
         if (!fs_ptr->operation_ptr_->CacheGet(bloom_filter_file_path)) {
             LOG_ENGINE_ERROR_ << "Fail to cache get bloom filter: " << bloom_filter_file_path;
@@ -57,43 +57,35 @@ DefaultIdBloomFilterFormat::read(const storage::FSHandlerPtr& fs_ptr, segment::I
             break;
         }
 
-        unsigned int capacity = 0;
-        double error_rate = 0;
-        size_t bitmap_bytes = 0;
-
         int64_t magic_num = 0;
+        int64_t block_num = 0;
+        int64_t file_length = fs_ptr->reader_ptr_->length();
         fs_ptr->reader_ptr_->read(&magic_num, sizeof(magic_num));
-        if (magic_num != BLOOM_FILTER_MAGIC_NUM) {
-            capacity = BLOOM_FILTER_CAPACITY;
-            error_rate = BLOOM_FILTER_ERROR_RATE;
-            bitmap_bytes = static_cast<size_t>(fs_ptr->reader_ptr_->length());
-            fs_ptr->reader_ptr_->seekg(0);
-        } else {
-            fs_ptr->reader_ptr_->read(&capacity, sizeof(capacity));
-            fs_ptr->reader_ptr_->read(&error_rate, sizeof(error_rate));
-            fs_ptr->reader_ptr_->read(&bitmap_bytes, sizeof(bitmap_bytes));
-        }
+        fs_ptr->reader_ptr_->read(&block_num, sizeof(block_num));
 
-        bitmap_t* bitmap = new_bitmap(bitmap_bytes);
-        if (bitmap != nullptr) {
-            fs_ptr->reader_ptr_->read(bitmap->array, bitmap_bytes);
-            bloom_filter = new_scaling_bloom_from_bitmap(capacity, error_rate, bitmap);
-            if (bloom_filter == nullptr) {
-                free_bitmap(bitmap);
-            }
+        int64_t blocks_bytes = block_num * segment::IdBloomFilter::WORDS_PER_BLOCK * sizeof(uint64_t);
+        if (magic_num != BLOOM_FILTER_MAGIC_NUM || block_num <= 0 ||
+            file_length != (int64_t)(sizeof(magic_num) + sizeof(block_num)) + blocks_bytes) {
+            LOG_ENGINE_WARNING_ << "Bloom filter of unknown format: " << bloom_filter_file_path;
+            fs_ptr->reader_ptr_->close();
+            break;
         }
 
+        std::vector<uint64_t> blocks(block_num * segment::IdBloomFilter::WORDS_PER_BLOCK);
+        fs_ptr->reader_ptr_->read(blocks.data(), blocks_bytes);
+        bloom_filter = std::make_shared<segment::IdBloomFilter>(std::move(blocks));
+
         fs_ptr->reader_ptr_->close();
     } while (0);
 
-    fiu_do_on("bloom_filter_nullptr", (free_scaling_bloom(bloom_filter) || (bloom_filter = nullptr)));
+    fiu_do_on("bloom_filter_nullptr", bloom_filter = nullptr);
     if (bloom_filter == nullptr) {
         std::string err_msg =
             "Failed to read bloom filter from file: " + bloom_filter_file_path + ". " + std::strerror(errno);
         LOG_ENGINE_ERROR_ << err_msg;
         throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
     }
-    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(bloom_filter);
+    id_bloom_filter_ptr = bloom_filter;
 }
 
 void
@@ -108,21 +100,20 @@ DefaultIdBloomFilterFormat::write(const storage::FSHandlerPtr& fs_ptr,
     bool exists = boost::filesystem::exists(bloom_filter_file_path);
     const std::string* file_path = exists ? &temp_bloom_filter_file_path : &bloom_filter_file_path;
 
-    int del_fd = open(file_path->c_str(), O_RDWR | O_CREAT, 00664);
+    int del_fd = open(file_path->c_str(), O_RDWR | O_CREAT | O_TRUNC, 00664);
     if (del_fd == -1) {
         std::string err_msg = "Failed to write bloom filter to file: " + *file_path + ". " + std::strerror(errno);
         LOG_ENGINE_ERROR_ << err_msg;
         throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
     }
 
-    auto bloom_filter = id_bloom_filter_ptr->GetBloomFilter();
+    auto& blocks = id_bloom_filter_ptr->GetBlocks();
 
     int64_t magic_num = BLOOM_FILTER_MAGIC_NUM;
+    int64_t block_num = blocks.size() / segment::IdBloomFilter::WORDS_PER_BLOCK;
     ::write(del_fd, &magic_num, sizeof(magic_num));
-    ::write(del_fd, &bloom_filter->capacity, sizeof(bloom_filter->capacity));
-    ::write(del_fd, &bloom_filter->error_rate, sizeof(bloom_filter->error_rate));
-    ::write(del_fd, &bloom_filter->bitmap->bytes, sizeof(bloom_filter->bitmap->bytes));
-    ::write(del_fd, bloom_filter->bitmap->array, bloom_filter->bitmap->bytes);
+    ::write(del_fd, &block_num, sizeof(block_num));
+    ::write(del_fd, blocks.data(), blocks.size() * sizeof(uint64_t));
 
     if (::close(del_fd) == -1) {
         std::string err_msg = "Failed to close file: " + *file_path + ", error: " + std::strerror(errno);
@@ -139,14 +130,13 @@ DefaultIdBloomFilterFormat::write(const storage::FSHandlerPtr& fs_ptr,
     fs_ptr->operation_ptr_->CachePut(bloom_filter_file_path);
 }
 
-void 
+void
 DefaultIdBloomFilterFormat::create(int64_t capacity, segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
     int64_t safe_capacity = capacity;
     if (safe_capacity <= 0) {
         safe_capacity = 1024;
     }
-    scaling_bloom_t* bloom_filter = new_scaling_bloom(safe_capacity, BLOOM_FILTER_ERROR_RATE);
-    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(bloom_filter);
+    id_bloom_filter_ptr = std::make_shared<segment::IdBloomFilter>(safe_capacity);
 }
 
 }  // namespace codec
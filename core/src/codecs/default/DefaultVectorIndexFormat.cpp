@@ -24,6 +24,8 @@
 #include "knowhere/index/vector_index/VecIndex.h"
 #include "knowhere/index/vector_index/VecIndexFactory.h"
 #include "segment/VectorIndex.h"
+#include "storage/disk/DiskIOReader.h"
+#include "storage/disk/MmapIOReader.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
@@ -37,52 +39,57 @@ DefaultVectorIndexFormat::read_internal(const storage::FSHandlerPtr& fs_ptr, con
     knowhere::BinarySet load_data_list;
 
     recorder.RecordSection("Start");
-    if (!fs_ptr->reader_ptr_->open(path)) {
+    // an index file on local disk is mapped, its blobs are handed to the index deserialization straight from the
+    // page cache instead of being read into heap buffers first; the other segment files keep the buffered reader
+    storage::IOReaderPtr reader_ptr = fs_ptr->reader_ptr_;
+    if (std::dynamic_pointer_cast<storage::DiskIOReader>(reader_ptr) != nullptr) {
+        reader_ptr = std::make_shared<storage::MmapIOReader>();
+    }
+
+    if (!reader_ptr->open(path)) {
         LOG_ENGINE_ERROR_ << "Fail to open vector index: " << path;
         return nullptr;
     }
 
-    int64_t length = fs_ptr->reader_ptr_->length();
+    int64_t length = reader_ptr->length();
     if (length <= 0) {
         LOG_ENGINE_ERROR_ << "Invalid vector index length: " << path;
         return nullptr;
     }
 
     int64_t rp = 0;
-    fs_ptr->reader_ptr_->seekg(0);
+    reader_ptr->seekg(0);
 
     int32_t current_type = 0;
-    fs_ptr->reader_ptr_->read(&current_type, sizeof(current_type));
+    reader_ptr->read(&current_type, sizeof(current_type));
     rp += sizeof(current_type);
-    fs_ptr->reader_ptr_->seekg(rp);
+    reader_ptr->seekg(rp);
 
     LOG_ENGINE_DEBUG_ << "Start to read_index(" << path << ") length: " << length << " bytes";
     while (rp < length) {
         size_t meta_length;
-        fs_ptr->reader_ptr_->read(&meta_length, sizeof(meta_length));
+        reader_ptr->read(&meta_length, sizeof(meta_length));
         rp += sizeof(meta_length);
-        fs_ptr->reader_ptr_->seekg(rp);
+        reader_ptr->seekg(rp);
 
         auto meta = new char[meta_length];
-        fs_ptr->reader_ptr_->read(meta, meta_length);
+        reader_ptr->read(meta, meta_length);
         rp += meta_length;
-        fs_ptr->reader_ptr_->seekg(rp);
+        reader_ptr->seekg(rp);
 
         size_t bin_length;
-        fs_ptr->reader_ptr_->read(&bin_length, sizeof(bin_length));
+        reader_ptr->read(&bin_length, sizeof(bin_length));
         rp += sizeof(bin_length);
-        fs_ptr->reader_ptr_->seekg(rp);
+        reader_ptr->seekg(rp);
 
-        auto bin = new uint8_t[bin_length];
-        fs_ptr->reader_ptr_->read(bin, bin_length);
+        auto binptr = reader_ptr->read_shared(bin_length);
         rp += bin_length;
-        fs_ptr->reader_ptr_->seekg(rp);
+        reader_ptr->seekg(rp);
 
-        std::shared_ptr<uint8_t[]> binptr(bin);
         load_data_list.Append(std::string(meta, meta_length), binptr, bin_length);
         delete[] meta;
     }
-    fs_ptr->reader_ptr_->close();
+    reader_ptr->close();
 
     double span = recorder.RecordSection("End");
     double rate = length * 1000000.0 / span / 1024 / 1024;
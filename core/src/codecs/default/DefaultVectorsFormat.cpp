@@ -54,6 +54,22 @@ DefaultVectorsFormat::read_vectors_internal(const storage::FSHandlerPtr& fs_ptr,
     fs_ptr->reader_ptr_->close();
 }
 
+void
+DefaultVectorsFormat::read_shared_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
+                                                   std::shared_ptr<uint8_t[]>& raw_vectors, size_t& num_bytes) {
+    if (!fs_ptr->reader_ptr_->open(file_path.c_str())) {
+        std::string err_msg = "Failed to open file: " + file_path + ", error: " + std::strerror(errno);
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_CANNOT_OPEN_FILE, err_msg);
+    }
+
+    num_bytes = 0;
+    fs_ptr->reader_ptr_->read(&num_bytes, sizeof(size_t));
+    raw_vectors = fs_ptr->reader_ptr_->read_shared(num_bytes);
+
+    fs_ptr->reader_ptr_->close();
+}
+
 void
 DefaultVectorsFormat::read_uids_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                                          std::vector<segment::doc_id_t>& uids) {
@@ -178,5 +194,30 @@ DefaultVectorsFormat::read_vectors(const storage::FSHandlerPtr& fs_ptr, off_t of
     }
 }
 
+void
+DefaultVectorsFormat::read_shared_vectors(const storage::FSHandlerPtr& fs_ptr, std::shared_ptr<uint8_t[]>& raw_vectors,
+                                          size_t& num_bytes) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& dir_path = fs_ptr->operation_ptr_->GetDirectory();
+    if (!boost::filesystem::is_directory(dir_path)) {
+        std::string err_msg = "Directory: " + dir_path + "does not exist";
+        LOG_ENGINE_ERROR_ << err_msg;
+        throw Exception(SERVER_INVALID_ARGUMENT, err_msg);
+    }
+
+    raw_vectors = nullptr;
+    num_bytes = 0;
+
+    std::vector<std::string> file_paths;
+    fs_ptr->operation_ptr_->ListDirectory(file_paths);
+    auto it = std::find_if(file_paths.begin(), file_paths.end(), [this](const std::string& path) {
+        return boost::algorithm::ends_with(path, raw_vector_extension_);
+    });
+    if (it != file_paths.end()) {
+        read_shared_vectors_internal(fs_ptr, *it, raw_vectors, num_bytes);
+    }
+}
+
 }  // namespace codec
 }  // namespace milvus
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -44,6 +45,10 @@ class DefaultVectorsFormat : public VectorsFormat {
     read_vectors(const storage::FSHandlerPtr& fs_ptr, off_t offset, size_t num_bytes,
                  std::vector<uint8_t>& raw_vectors) override;
 
+    void
+    read_shared_vectors(const storage::FSHandlerPtr& fs_ptr, std::shared_ptr<uint8_t[]>& raw_vectors,
+                        size_t& num_bytes) override;
+
     // No copy and move
     DefaultVectorsFormat(const DefaultVectorsFormat&) = delete;
     DefaultVectorsFormat(DefaultVectorsFormat&&) = delete;
@@ -58,6 +63,10 @@ class DefaultVectorsFormat : public VectorsFormat {
     read_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path, off_t offset, size_t num,
                           std::vector<uint8_t>& raw_vectors);
 
+    void
+    read_shared_vectors_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
+                                 std::shared_ptr<uint8_t[]>& raw_vectors, size_t& num_bytes);
+
     void
     read_uids_internal(const storage::FSHandlerPtr& fs_ptr, const std::string& file_path,
                        std::vector<segment::doc_id_t>& uids);
@@ -112,6 +112,10 @@ const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION = "preload_collection";
 const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT = "";
+const char* CONFIG_CACHE_WARMUP_ENABLE = "warmup_enable";
+const char* CONFIG_CACHE_WARMUP_ENABLE_DEFAULT = "true";
+const char* CONFIG_CACHE_WARMUP_INTERVAL = "warmup_interval";
+const char* CONFIG_CACHE_WARMUP_INTERVAL_DEFAULT = "300";
 
 /* metric config */
 const char* CONFIG_METRIC = "metric";
@@ -138,6 +142,14 @@ const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ = "search_combine_nq";
 const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT = "64";
 const char* CONFIG_ENGINE_MAX_PARTITION_NUM = "max_partition_num";
 const char* CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT = "4096";
+const char* CONFIG_ENGINE_DQL_WORKER_NUM = "dql_worker_num";
+const char* CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT = "0";
+const char* CONFIG_ENGINE_SEARCH_EXECUTOR_NUM = "search_executor_num";
+const char* CONFIG_ENGINE_SEARCH_EXECUTOR_NUM_DEFAULT = "0";
+const char* CONFIG_ENGINE_SEARCH_LOADER_NUM = "search_loader_num";
+const char* CONFIG_ENGINE_SEARCH_LOADER_NUM_DEFAULT = "2";
+const char* CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH = "search_prefetch_depth";
+const char* CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH_DEFAULT = "4";
 /* fpga resource config */
 const char* CONFIG_FPGA_RESOURCE = "fpga";
 const char* CONFIG_FPGA_RESOURCE_ENABLE = "enable";
@@ -191,6 +203,13 @@ const int64_t CONFIG_WAL_BUFFER_SIZE_MIN = 67108864;
 const int64_t CONFIG_WAL_BUFFER_SIZE_MAX = 4294967296;
 const char* CONFIG_WAL_WAL_PATH = "path";
 const char* CONFIG_WAL_WAL_PATH_DEFAULT = "/tmp/milvus/wal";
+const char* CONFIG_WAL_SYNC_ENABLE = "sync_enable";
+const char* CONFIG_WAL_SYNC_ENABLE_DEFAULT = "true";
+const char* CONFIG_WAL_SYNC_INTERVAL = "sync_interval";
+const char* CONFIG_WAL_SYNC_INTERVAL_DEFAULT = "1";
+const int64_t CONFIG_WAL_SYNC_INTERVAL_MAX = 1000;
+const char* CONFIG_WAL_SYNC_BATCH_SIZE = "sync_batch_size";
+const char* CONFIG_WAL_SYNC_BATCH_SIZE_DEFAULT = "1MB";
 
 /* logs config */
 const char* CONFIG_LOGS = "logs";
@@ -410,6 +429,12 @@ Config::ValidateConfig() {
     std::string cache_preload_collection;
     STATUS_CHECK(GetCacheConfigPreloadCollection(cache_preload_collection));
 
+    bool cache_warmup_enable;
+    STATUS_CHECK(GetCacheConfigWarmUpEnable(cache_warmup_enable));
+
+    int64_t cache_warmup_interval;
+    STATUS_CHECK(GetCacheConfigWarmUpInterval(cache_warmup_interval));
+
     /* engine config */
     int64_t engine_use_blas_threshold;
     STATUS_CHECK(GetEngineConfigUseBlasThreshold(engine_use_blas_threshold));
@@ -423,6 +448,18 @@ Config::ValidateConfig() {
     int64_t max_partition_num;
     STATUS_CHECK(GetEngineConfigMaxPartitionNum(max_partition_num));
 
+    int64_t dql_worker_num;
+    STATUS_CHECK(GetEngineConfigDqlWorkerNum(dql_worker_num));
+
+    int64_t search_executor_num;
+    STATUS_CHECK(GetEngineConfigSearchExecutorNum(search_executor_num));
+
+    int64_t search_loader_num;
+    STATUS_CHECK(GetEngineConfigSearchLoaderNum(search_loader_num));
+
+    int64_t search_prefetch_depth;
+    STATUS_CHECK(GetEngineConfigSearchPrefetchDepth(search_prefetch_depth));
+
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
     bool gpu_resource_enable;
@@ -467,6 +504,15 @@ Config::ValidateConfig() {
     std::string wal_path;
     STATUS_CHECK(GetWalConfigWalPath(wal_path));
 
+    bool sync_enable;
+    STATUS_CHECK(GetWalConfigSyncEnable(sync_enable));
+
+    int64_t sync_interval;
+    STATUS_CHECK(GetWalConfigSyncInterval(sync_interval));
+
+    int64_t sync_batch_size;
+    STATUS_CHECK(GetWalConfigSyncBatchSize(sync_batch_size));
+
     /* logs config */
     std::string logs_level;
     STATUS_CHECK(GetLogsLevel(logs_level));
@@ -539,6 +585,8 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetCacheConfigInsertBufferSize(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT));
     STATUS_CHECK(SetCacheConfigCacheInsertData(CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT));
     STATUS_CHECK(SetCacheConfigPreloadCollection(CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT));
+    STATUS_CHECK(SetCacheConfigWarmUpEnable(CONFIG_CACHE_WARMUP_ENABLE_DEFAULT));
+    STATUS_CHECK(SetCacheConfigWarmUpInterval(CONFIG_CACHE_WARMUP_INTERVAL_DEFAULT));
 
     /* engine config */
     STATUS_CHECK(SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT));
@@ -546,6 +594,10 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetEngineConfigSimdType(CONFIG_ENGINE_SIMD_TYPE_DEFAULT));
     STATUS_CHECK(SetEngineSearchCombineMaxNq(CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT));
     STATUS_CHECK(SetEngineConfigMaxPartitionNum(CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigDqlWorkerNum(CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigSearchExecutorNum(CONFIG_ENGINE_SEARCH_EXECUTOR_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigSearchLoaderNum(CONFIG_ENGINE_SEARCH_LOADER_NUM_DEFAULT));
+    STATUS_CHECK(SetEngineConfigSearchPrefetchDepth(CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH_DEFAULT));
 
     /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
@@ -563,6 +615,9 @@ Config::ResetDefaultConfig() {
     STATUS_CHECK(SetWalConfigRecoveryErrorIgnore(CONFIG_WAL_RECOVERY_ERROR_IGNORE_DEFAULT));
     STATUS_CHECK(SetWalConfigBufferSize(CONFIG_WAL_BUFFER_SIZE_DEFAULT));
     STATUS_CHECK(SetWalConfigWalPath(CONFIG_WAL_WAL_PATH_DEFAULT));
+    STATUS_CHECK(SetWalConfigSyncEnable(CONFIG_WAL_SYNC_ENABLE_DEFAULT));
+    STATUS_CHECK(SetWalConfigSyncInterval(CONFIG_WAL_SYNC_INTERVAL_DEFAULT));
+    STATUS_CHECK(SetWalConfigSyncBatchSize(CONFIG_WAL_SYNC_BATCH_SIZE_DEFAULT));
 
     /* logs config */
     STATUS_CHECK(SetLogsLevel(CONFIG_LOGS_LEVEL_DEFAULT));
@@ -675,6 +730,10 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetCacheConfigInsertBufferSize(value);
         } else if (child_key == CONFIG_CACHE_PRELOAD_COLLECTION) {
             status = SetCacheConfigPreloadCollection(value);
+        } else if (child_key == CONFIG_CACHE_WARMUP_ENABLE) {
+            status = SetCacheConfigWarmUpEnable(value);
+        } else if (child_key == CONFIG_CACHE_WARMUP_INTERVAL) {
+            status = SetCacheConfigWarmUpInterval(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -689,6 +748,14 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetEngineSearchCombineMaxNq(value);
         } else if (child_key == CONFIG_ENGINE_MAX_PARTITION_NUM) {
             status = SetEngineConfigMaxPartitionNum(value);
+        } else if (child_key == CONFIG_ENGINE_DQL_WORKER_NUM) {
+            status = SetEngineConfigDqlWorkerNum(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_EXECUTOR_NUM) {
+            status = SetEngineConfigSearchExecutorNum(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_LOADER_NUM) {
+            status = SetEngineConfigSearchLoaderNum(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH) {
+            status = SetEngineConfigSearchPrefetchDepth(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -727,6 +794,12 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             status = SetWalConfigBufferSize(value);
         } else if (child_key == CONFIG_WAL_WAL_PATH) {
             status = SetWalConfigWalPath(value);
+        } else if (child_key == CONFIG_WAL_SYNC_ENABLE) {
+            status = SetWalConfigSyncEnable(value);
+        } else if (child_key == CONFIG_WAL_SYNC_INTERVAL) {
+            status = SetWalConfigSyncInterval(value);
+        } else if (child_key == CONFIG_WAL_SYNC_BATCH_SIZE) {
+            status = SetWalConfigSyncBatchSize(value);
         } else {
             status = Status(SERVER_UNEXPECTED_ERROR, invalid_node_str);
         }
@@ -863,10 +936,11 @@ Config::UpdateFileConfigFromMem(const std::string& parent_key, const std::string
 
     // convert value string to standard string stored in yaml file
     std::string value_str;
-    if (child_key == CONFIG_CACHE_CACHE_INSERT_DATA ||
+    if (child_key == CONFIG_CACHE_CACHE_INSERT_DATA || child_key == CONFIG_CACHE_WARMUP_ENABLE ||
         // child_key == CONFIG_STORAGE_S3_ENABLE ||
         child_key == CONFIG_METRIC_ENABLE_MONITOR || child_key == CONFIG_GPU_RESOURCE_ENABLE ||
-        child_key == CONFIG_WAL_ENABLE || child_key == CONFIG_WAL_RECOVERY_ERROR_IGNORE) {
+        child_key == CONFIG_WAL_ENABLE || child_key == CONFIG_WAL_RECOVERY_ERROR_IGNORE ||
+        child_key == CONFIG_WAL_SYNC_ENABLE) {
         bool ok = false;
         STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(value, ok));
         value_str = ok ? "true" : "false";
@@ -1617,6 +1691,30 @@ Config::CheckCacheConfigPreloadCollection(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigWarmUpEnable(const std::string& value) {
+    fiu_return_on("check_config_cache_warmup_enable_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid cache warm-up enable option: " + value +
+                          ". Possible reason: cache.warmup_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckCacheConfigWarmUpInterval(const std::string& value) {
+    fiu_return_on("check_config_cache_warmup_interval_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid cache warm-up interval: " + value +
+                          ". Possible reason: cache.warmup_interval is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::CheckEngineConfigUseBlasThreshold(const std::string& value) {
@@ -1684,6 +1782,81 @@ Config::CheckEngineConfigMaxPartitionNum(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigDqlWorkerNum(const std::string& value) {
+    fiu_return_on("check_config_dql_worker_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid dql worker num: " + value +
+                          ". Possible reason: engine_config.dql_worker_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t worker_num = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (worker_num > sys_thread_cnt) {
+        std::string msg = "Invalid dql worker num: " + value +
+                          ". Possible reason: engine_config.dql_worker_num exceeds system cpu cores.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchExecutorNum(const std::string& value) {
+    fiu_return_on("check_config_search_executor_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search executor num: " + value +
+                          ". Possible reason: engine_config.search_executor_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t executor_num = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (executor_num > sys_thread_cnt) {
+        std::string msg = "Invalid search executor num: " + value +
+                          ". Possible reason: engine_config.search_executor_num exceeds system cpu cores.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchLoaderNum(const std::string& value) {
+    fiu_return_on("check_config_search_loader_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search loader num: " + value +
+                          ". Possible reason: engine_config.search_loader_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t loader_num = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (loader_num < 1 || loader_num > sys_thread_cnt) {
+        std::string msg = "Invalid search loader num: " + value +
+                          ". Possible reason: engine_config.search_loader_num is not in range [1, system cpu cores].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchPrefetchDepth(const std::string& value) {
+    fiu_return_on("check_config_search_prefetch_depth_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search prefetch depth: " + value +
+                          ". Possible reason: engine_config.search_prefetch_depth is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 /* gpu resource config */
@@ -1942,6 +2115,52 @@ Config::CheckWalConfigWalPath(const std::string& value) {
     return ValidationUtil::ValidateStoragePath(value);
 }
 
+Status
+Config::CheckWalConfigSyncEnable(const std::string& value) {
+    auto exist_error = !ValidationUtil::ValidateStringIsBool(value).ok();
+    fiu_do_on("check_config_wal_sync_enable_fail", exist_error = true);
+
+    if (exist_error) {
+        std::string msg = "Invalid wal config: " + value + ". Possible reason: wal.sync_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckWalConfigSyncInterval(const std::string& value) {
+    fiu_return_on("check_config_wal_sync_interval_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid wal sync interval: " + value +
+                          ". Possible reason: wal.sync_interval is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t sync_interval = std::stoll(value);
+    if (sync_interval > CONFIG_WAL_SYNC_INTERVAL_MAX) {
+        std::string msg = "Invalid wal sync interval: " + value + ". Possible reason: wal.sync_interval exceeds " +
+                          std::to_string(CONFIG_WAL_SYNC_INTERVAL_MAX) + " milliseconds.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckWalConfigSyncBatchSize(const std::string& value) {
+    std::string err;
+    auto batch_size = parse_bytes(value, err);
+    auto exist_error = not err.empty();
+    fiu_do_on("check_config_wal_sync_batch_size_fail", exist_error = true);
+
+    if (exist_error || batch_size <= 0) {
+        std::string msg = "Invalid wal sync batch size: " + value +
+                          ". Possible reason: wal.sync_batch_size is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* logs config */
 Status
 Config::CheckLogsLevel(const std::string& value) {
@@ -2469,6 +2688,22 @@ Config::GetCacheConfigPreloadCollection(std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigWarmUpEnable(bool& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_WARMUP_ENABLE, CONFIG_CACHE_WARMUP_ENABLE_DEFAULT);
+    STATUS_CHECK(CheckCacheConfigWarmUpEnable(str));
+    STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(str, value));
+    return Status::OK();
+}
+
+Status
+Config::GetCacheConfigWarmUpInterval(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_WARMUP_INTERVAL, CONFIG_CACHE_WARMUP_INTERVAL_DEFAULT);
+    STATUS_CHECK(CheckCacheConfigWarmUpInterval(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::GetEngineConfigUseBlasThreshold(int64_t& value) {
@@ -2511,6 +2746,41 @@ Config::GetEngineConfigMaxPartitionNum(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigDqlWorkerNum(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_DQL_WORKER_NUM, CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigDqlWorkerNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchExecutorNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_EXECUTOR_NUM, CONFIG_ENGINE_SEARCH_EXECUTOR_NUM_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigSearchExecutorNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchLoaderNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_LOADER_NUM, CONFIG_ENGINE_SEARCH_LOADER_NUM_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigSearchLoaderNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchPrefetchDepth(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH, CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH_DEFAULT);
+    STATUS_CHECK(CheckEngineConfigSearchPrefetchDepth(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 
@@ -2675,6 +2945,31 @@ Config::GetWalConfigWalPath(std::string& wal_path) {
     return Status::OK();
 }
 
+Status
+Config::GetWalConfigSyncEnable(bool& sync_enable) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_SYNC_ENABLE, CONFIG_WAL_SYNC_ENABLE_DEFAULT);
+    STATUS_CHECK(CheckWalConfigSyncEnable(str));
+    STATUS_CHECK(StringHelpFunctions::ConvertToBoolean(str, sync_enable));
+    return Status::OK();
+}
+
+Status
+Config::GetWalConfigSyncInterval(int64_t& sync_interval) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_SYNC_INTERVAL, CONFIG_WAL_SYNC_INTERVAL_DEFAULT);
+    STATUS_CHECK(CheckWalConfigSyncInterval(str));
+    sync_interval = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetWalConfigSyncBatchSize(int64_t& sync_batch_size) {
+    std::string str = GetConfigStr(CONFIG_WAL, CONFIG_WAL_SYNC_BATCH_SIZE, CONFIG_WAL_SYNC_BATCH_SIZE_DEFAULT);
+    STATUS_CHECK(CheckWalConfigSyncBatchSize(str));
+    std::string err;
+    sync_batch_size = parse_bytes(str, err);
+    return Status::OK();
+}
+
 /* logs config */
 Status
 Config::GetLogsLevel(std::string& value) {
@@ -2958,6 +3253,18 @@ Config::SetCacheConfigPreloadCollection(const std::string& value) {
     return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_PRELOAD_COLLECTION, cor_value);
 }
 
+Status
+Config::SetCacheConfigWarmUpEnable(const std::string& value) {
+    STATUS_CHECK(CheckCacheConfigWarmUpEnable(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_WARMUP_ENABLE, value);
+}
+
+Status
+Config::SetCacheConfigWarmUpInterval(const std::string& value) {
+    STATUS_CHECK(CheckCacheConfigWarmUpInterval(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_WARMUP_INTERVAL, value);
+}
+
 /* engine config */
 Status
 Config::SetEngineConfigUseBlasThreshold(const std::string& value) {
@@ -2991,6 +3298,30 @@ Config::SetEngineConfigMaxPartitionNum(const std::string& value) {
     return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_MAX_PARTITION_NUM, value);
 }
 
+Status
+Config::SetEngineConfigDqlWorkerNum(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigDqlWorkerNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_DQL_WORKER_NUM, value);
+}
+
+Status
+Config::SetEngineConfigSearchExecutorNum(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigSearchExecutorNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_EXECUTOR_NUM, value);
+}
+
+Status
+Config::SetEngineConfigSearchLoaderNum(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigSearchLoaderNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_LOADER_NUM, value);
+}
+
+Status
+Config::SetEngineConfigSearchPrefetchDepth(const std::string& value) {
+    STATUS_CHECK(CheckEngineConfigSearchPrefetchDepth(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH, value);
+}
+
 /* gpu resource config */
 #ifdef MILVUS_GPU_VERSION
 
@@ -3079,6 +3410,24 @@ Config::SetWalConfigWalPath(const std::string& value) {
     return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_WAL_PATH, value);
 }
 
+Status
+Config::SetWalConfigSyncEnable(const std::string& value) {
+    STATUS_CHECK(CheckWalConfigSyncEnable(value));
+    return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_SYNC_ENABLE, value);
+}
+
+Status
+Config::SetWalConfigSyncInterval(const std::string& value) {
+    STATUS_CHECK(CheckWalConfigSyncInterval(value));
+    return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_SYNC_INTERVAL, value);
+}
+
+Status
+Config::SetWalConfigSyncBatchSize(const std::string& value) {
+    STATUS_CHECK(CheckWalConfigSyncBatchSize(value));
+    return SetConfigValueInMem(CONFIG_WAL, CONFIG_WAL_SYNC_BATCH_SIZE, value);
+}
+
 /* logs config */
 Status
 Config::SetLogsLevel(const std::string& value) {
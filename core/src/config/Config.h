@@ -84,6 +84,10 @@ extern const char* CONFIG_CACHE_CACHE_INSERT_DATA;
 extern const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION;
 extern const char* CONFIG_CACHE_PRELOAD_COLLECTION_DEFAULT;
+extern const char* CONFIG_CACHE_WARMUP_ENABLE;
+extern const char* CONFIG_CACHE_WARMUP_ENABLE_DEFAULT;
+extern const char* CONFIG_CACHE_WARMUP_INTERVAL;
+extern const char* CONFIG_CACHE_WARMUP_INTERVAL_DEFAULT;
 
 /* metric config */
 extern const char* CONFIG_METRIC;
@@ -106,6 +110,14 @@ extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ;
 extern const char* CONFIG_ENGINE_SEARCH_COMBINE_MAX_NQ_DEFAULT;
 extern const char* CONFIG_ENGINE_MAX_PARTITION_NUM;
 extern const char* CONFIG_ENGINE_MAX_PARTITION_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_DQL_WORKER_NUM;
+extern const char* CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_SEARCH_EXECUTOR_NUM;
+extern const char* CONFIG_ENGINE_SEARCH_EXECUTOR_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_SEARCH_LOADER_NUM;
+extern const char* CONFIG_ENGINE_SEARCH_LOADER_NUM_DEFAULT;
+extern const char* CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH;
+extern const char* CONFIG_ENGINE_SEARCH_PREFETCH_DEPTH_DEFAULT;
 /* fpga resource config*/
 extern const char* CONFIG_FPGA_RESOURCE;
 extern const char* CONFIG_FPGA_RESOURCE_ENABLE;
@@ -153,6 +165,13 @@ extern const int64_t CONFIG_WAL_BUFFER_SIZE_MIN;
 extern const int64_t CONFIG_WAL_BUFFER_SIZE_MAX;
 extern const char* CONFIG_WAL_WAL_PATH;
 extern const char* CONFIG_WAL_WAL_PATH_DEFAULT;
+extern const char* CONFIG_WAL_SYNC_ENABLE;
+extern const char* CONFIG_WAL_SYNC_ENABLE_DEFAULT;
+extern const char* CONFIG_WAL_SYNC_INTERVAL;
+extern const char* CONFIG_WAL_SYNC_INTERVAL_DEFAULT;
+extern const int64_t CONFIG_WAL_SYNC_INTERVAL_MAX;
+extern const char* CONFIG_WAL_SYNC_BATCH_SIZE;
+extern const char* CONFIG_WAL_SYNC_BATCH_SIZE_DEFAULT;
 
 /* logs config */
 extern const char* CONFIG_LOGS;
@@ -293,6 +312,10 @@ class Config {
     CheckCacheConfigCacheInsertData(const std::string& value);
     Status
     CheckCacheConfigPreloadCollection(const std::string& value);
+    Status
+    CheckCacheConfigWarmUpEnable(const std::string& value);
+    Status
+    CheckCacheConfigWarmUpInterval(const std::string& value);
 
     /* engine config */
     Status
@@ -305,6 +328,14 @@ class Config {
     CheckEngineSearchCombineMaxNq(const std::string& value);
     Status
     CheckEngineConfigMaxPartitionNum(const std::string& value);
+    Status
+    CheckEngineConfigDqlWorkerNum(const std::string& value);
+    Status
+    CheckEngineConfigSearchExecutorNum(const std::string& value);
+    Status
+    CheckEngineConfigSearchLoaderNum(const std::string& value);
+    Status
+    CheckEngineConfigSearchPrefetchDepth(const std::string& value);
 #ifdef MILVUS_FPGA_VERSION
     Status
     GetFpgaResourceConfigCacheThreshold(float& value);
@@ -346,6 +377,12 @@ class Config {
     CheckWalConfigBufferSize(const std::string& value);
     Status
     CheckWalConfigWalPath(const std::string& value);
+    Status
+    CheckWalConfigSyncEnable(const std::string& value);
+    Status
+    CheckWalConfigSyncInterval(const std::string& value);
+    Status
+    CheckWalConfigSyncBatchSize(const std::string& value);
 
     /* logs config */
     Status
@@ -456,6 +493,10 @@ class Config {
     GetCacheConfigCacheInsertData(bool& value);
     Status
     GetCacheConfigPreloadCollection(std::string& value);
+    Status
+    GetCacheConfigWarmUpEnable(bool& value);
+    Status
+    GetCacheConfigWarmUpInterval(int64_t& value);
 
     /* engine config */
     Status
@@ -468,6 +509,14 @@ class Config {
     GetEngineSearchCombineMaxNq(int64_t& value);
     Status
     GetEngineConfigMaxPartitionNum(int64_t& value);
+    Status
+    GetEngineConfigDqlWorkerNum(int64_t& value);
+    Status
+    GetEngineConfigSearchExecutorNum(int64_t& value);
+    Status
+    GetEngineConfigSearchLoaderNum(int64_t& value);
+    Status
+    GetEngineConfigSearchPrefetchDepth(int64_t& value);
 #ifdef MILVUS_FPGA_VERSION
 
     Status
@@ -506,6 +555,12 @@ class Config {
     GetWalConfigBufferSize(int64_t& value);
     Status
     GetWalConfigWalPath(std::string& value);
+    Status
+    GetWalConfigSyncEnable(bool& value);
+    Status
+    GetWalConfigSyncInterval(int64_t& value);
+    Status
+    GetWalConfigSyncBatchSize(int64_t& value);
 
     /* logs config */
     Status
@@ -599,6 +654,10 @@ class Config {
     SetCacheConfigCacheInsertData(const std::string& value);
     Status
     SetCacheConfigPreloadCollection(const std::string& value);
+    Status
+    SetCacheConfigWarmUpEnable(const std::string& value);
+    Status
+    SetCacheConfigWarmUpInterval(const std::string& value);
 
     /* engine config */
     Status
@@ -611,6 +670,14 @@ class Config {
     SetEngineSearchCombineMaxNq(const std::string& value);
     Status
     SetEngineConfigMaxPartitionNum(const std::string& value);
+    Status
+    SetEngineConfigDqlWorkerNum(const std::string& value);
+    Status
+    SetEngineConfigSearchExecutorNum(const std::string& value);
+    Status
+    SetEngineConfigSearchLoaderNum(const std::string& value);
+    Status
+    SetEngineConfigSearchPrefetchDepth(const std::string& value);
 #ifdef MILVUS_GPU_VERSION
 
     /* gpu resource config */
@@ -643,6 +710,12 @@ class Config {
     SetWalConfigBufferSize(const std::string& value);
     Status
     SetWalConfigWalPath(const std::string& value);
+    Status
+    SetWalConfigSyncEnable(const std::string& value);
+    Status
+    SetWalConfigSyncInterval(const std::string& value);
+    Status
+    SetWalConfigSyncBatchSize(const std::string& value);
 
     /* logs config */
     Status
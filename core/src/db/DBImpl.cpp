@@ -17,8 +17,11 @@
 #include <algorithm>
 #include <boost/filesystem.hpp>
 #include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <limits>
 #include <mutex>
@@ -38,16 +41,19 @@
 #include "index/knowhere/knowhere/index/vector_index/helpers/BuilderSuspend.h"
 #include "index/thirdparty/faiss/utils/distances.h"
 #include "insert/MemManagerFactory.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
 #include "meta/SqliteMetaImpl.h"
 #include "metrics/Metrics.h"
+#include "query/AttrFilter.h"
 #include "scheduler/Definition.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/job/BuildIndexJob.h"
 #include "scheduler/job/SearchJob.h"
 #include "segment/SegmentReader.h"
 #include "segment/SegmentWriter.h"
+#include "utils/CommonUtil.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
 #include "utils/StringHelpFunctions.h"
@@ -62,6 +68,10 @@ namespace {
 constexpr uint64_t BACKGROUND_METRIC_INTERVAL = 1;
 constexpr uint64_t BACKGROUND_INDEX_INTERVAL = 1;
 constexpr uint64_t WAIT_BUILD_INDEX_INTERVAL = 5;
+constexpr uint64_t CACHE_WARMUP_THREAD_NUM = 4;
+constexpr int64_t INSERT_BUFFER_MAX_WAIT_MS = 1000;
+
+constexpr const char* CACHE_MANIFEST_NAME = "cache_manifest";
 
 constexpr const char* JSON_ROW_COUNT = "row_count";
 constexpr const char* JSON_PARTITIONS = "partitions";
@@ -78,6 +88,10 @@ static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown
 DBImpl::DBImpl(const DBOptions& options)
     : options_(options), initialized_(false), merge_thread_pool_(1, 1), index_thread_pool_(1, 1) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
+    if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
+        snapshot_meta_ptr_ = std::make_shared<meta::SnapshotMetaImpl>(meta_ptr_);
+        meta_ptr_ = snapshot_meta_ptr_;
+    }
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
     merge_mgr_ptr_ = MergeManagerFactory::Build(meta_ptr_, options_);
 
@@ -87,6 +101,9 @@ DBImpl::DBImpl(const DBOptions& options)
         // 2 buffers in the WAL
         mxlog_config.buffer_size = options_.buffer_size_ / 2;
         mxlog_config.mxlog_path = options_.mxlog_path_;
+        mxlog_config.sync_enable = options_.wal_sync_enable_;
+        mxlog_config.sync_interval = options_.wal_sync_interval_;
+        mxlog_config.sync_batch_size = options_.wal_sync_batch_size_;
         wal_mgr_ = std::make_shared<wal::WalManager>(mxlog_config);
     }
 
@@ -136,17 +153,24 @@ DBImpl::Start() {
             throw Exception(error_code, "Wal init error!");
         }
 
-        // recovery
+        // recovery, the next wal file is read while the records of the previous one are being applied
+        std::future<Status> apply_future;
         while (1) {
-            wal::MXLogRecord record;
-            auto error_code = wal_mgr_->GetNextRecovery(record);
+            auto batch = std::make_shared<wal::MXLogRecordBatch>();
+            auto error_code = wal_mgr_->GetNextRecoveryBatch(*batch);
+            if (apply_future.valid()) {
+                auto status = apply_future.get();
+                if (!status.ok()) {
+                    throw Exception(status.code(), "Wal recovery error! " + status.message());
+                }
+            }
             if (error_code != WAL_SUCCESS) {
                 throw Exception(error_code, "Wal recovery error!");
             }
-            if (record.type == wal::MXLogType::None) {
+            if (batch->records.empty()) {
                 break;
             }
-            ExecWalRecord(record);
+            apply_future = std::async(std::launch::async, [this, batch]() { return ExecWalRecordBatch(*batch); });
         }
 
         // for distribute version, some nodes are read only
@@ -168,6 +192,11 @@ DBImpl::Start() {
         bg_index_thread_ = std::thread(&DBImpl::BackgroundIndexThread, this);
     }
 
+    // background cache warm-up thread, reload the hot files recorded before last shutdown
+    if (options_.cache_warmup_enable_) {
+        bg_warmup_thread_ = std::thread(&DBImpl::BackgroundWarmUpThread, this);
+    }
+
     // background metric thread
     fiu_do_on("options_metric_enable", options_.metric_enable_ = true);
     if (options_.metric_enable_) {
@@ -209,6 +238,12 @@ DBImpl::Stop() {
         meta_ptr_->CleanUpShadowFiles();
     }
 
+    // wait warm-up thread exit, the hot files are recorded before it exits
+    if (options_.cache_warmup_enable_) {
+        swn_warmup_.Notify();
+        bg_warmup_thread_.join();
+    }
+
     // wait metric thread exit
     if (options_.metric_enable_) {
         swn_metric_.Notify();
@@ -484,6 +519,10 @@ DBImpl::PreloadCollection(const std::shared_ptr<server::Context>& context, const
                 LOG_ENGINE_DEBUG_ << "Pre-load cancelled since cache is almost full";
                 return Status(SERVER_CACHE_FULL, "Cache is full");
             }
+
+            // pre-loaded files are never evicted by the queries of other collections until released,
+            // a file over the room of a cancelled pre-load stays evictable
+            cache::CpuCacheMgr::GetInstance()->PinItem(file.location_);
         } catch (std::exception& ex) {
             std::string msg = "Pre-load collection encounter exception: " + std::string(ex.what());
             LOG_ENGINE_ERROR_ << msg;
@@ -728,18 +767,23 @@ DBImpl::InsertVectors(const std::string& collection_id, const std::string& parti
         return SHUTDOWN_ERROR;
     }
 
+    // flow control, hold the writer until the insert buffer has room
+    Status status = WaitInsertBuffer();
+    if (!status.ok()) {
+        return status;
+    }
+
     // insert vectors into target collection
     // (zhiru): generate ids
     if (vectors.id_array_.empty()) {
         SafeIDGenerator& id_generator = SafeIDGenerator::GetInstance();
-        Status status = id_generator.GetNextIDNumbers(vectors.vector_count_, vectors.id_array_);
+        status = id_generator.GetNextIDNumbers(vectors.vector_count_, vectors.id_array_);
         if (!status.ok()) {
             LOG_ENGINE_ERROR_ << LogOut("[%s][%ld] Get next id number fail: %s", "insert", 0, status.message().c_str());
             return status;
         }
     }
 
-    Status status;
     if (options_.wal_enable_) {
         std::string target_collection_name;
         status = GetPartitionByTag(collection_id, partition_tag, target_collection_name);
@@ -748,12 +792,22 @@ DBImpl::InsertVectors(const std::string& collection_id, const std::string& parti
             return status;
         }
 
-        if (!vectors.float_data_.empty()) {
-            wal_mgr_->Insert(collection_id, partition_tag, vectors.id_array_, vectors.float_data_);
+        ErrorCode wal_rst = WAL_SUCCESS;
+        uint64_t lsn = 0;
+        if (!vectors.attr_data_.empty()) {
+            wal_rst = wal_mgr_->InsertEntities(collection_id, partition_tag, vectors, &lsn);
+        } else if (!vectors.float_data_.empty()) {
+            wal_rst = wal_mgr_->Insert(collection_id, partition_tag, vectors.id_array_, vectors.float_data_, &lsn);
         } else if (!vectors.binary_data_.empty()) {
-            wal_mgr_->Insert(collection_id, partition_tag, vectors.id_array_, vectors.binary_data_);
+            wal_rst = wal_mgr_->Insert(collection_id, partition_tag, vectors.id_array_, vectors.binary_data_, &lsn);
         }
         swn_wal_.Notify();
+        if (wal_rst == WAL_SYNC_ERROR) {
+            return Status(DB_ERROR, "Failed to sync wal, the entities may still be inserted");
+        } else if (wal_rst != WAL_SUCCESS) {
+            return Status(DB_ERROR, "Failed to write wal");
+        }
+        vectors.lsn_ = lsn;
     } else {
         wal::MXLogRecord record;
         record.lsn = 0;  // need to get from meta ?
@@ -761,7 +815,13 @@ DBImpl::InsertVectors(const std::string& collection_id, const std::string& parti
         record.partition_tag = partition_tag;
         record.ids = vectors.id_array_.data();
         record.length = vectors.vector_count_;
-        if (vectors.binary_data_.empty()) {
+        std::vector<uint8_t> entities_data;
+        if (!vectors.attr_data_.empty()) {
+            record.type = wal::MXLogType::Entity;
+            wal::WalManager::SerializeEntities(vectors, 0, vectors.vector_count_, entities_data);
+            record.data = entities_data.data();
+            record.data_size = entities_data.size();
+        } else if (vectors.binary_data_.empty()) {
             record.type = wal::MXLogType::InsertVector;
             record.data = vectors.float_data_.data();
             record.data_size = vectors.float_data_.size() * sizeof(float);
@@ -908,8 +968,14 @@ DBImpl::DeleteVectors(const std::string& collection_id, const std::string& parti
 
     Status status;
     if (options_.wal_enable_) {
-        wal_mgr_->DeleteById(collection_id, partition_tag, vector_ids);
+        ErrorCode wal_rst =
+            vector_ids.empty() ? WAL_SUCCESS : wal_mgr_->DeleteById(collection_id, partition_tag, vector_ids);
         swn_wal_.Notify();
+        if (wal_rst == WAL_SYNC_ERROR) {
+            return Status(DB_ERROR, "Failed to sync wal, the entities may still be deleted");
+        } else if (wal_rst != WAL_SUCCESS) {
+            return Status(DB_ERROR, "Failed to write wal");
+        }
     } else {
         wal::MXLogRecord record;
         record.lsn = 0;  // need to get from meta ?
@@ -1140,7 +1206,8 @@ DBImpl::CompactFile(const meta::SegmentSchema& file, double threshold, meta::Seg
     auto segment_writer_ptr = std::make_shared<segment::SegmentWriter>(new_segment_dir);
 
     LOG_ENGINE_DEBUG_ << "Compacting begin...";
-    segment_writer_ptr->Merge(segment_dir_to_merge, compacted_file.file_id_);
+    std::vector<int64_t> offset_map;
+    segment_writer_ptr->Merge(segment_dir_to_merge, compacted_file.file_id_, &offset_map);
 
     // Serialize
     LOG_ENGINE_DEBUG_ << "Serializing compacted segment...";
@@ -1172,8 +1239,6 @@ DBImpl::CompactFile(const meta::SegmentSchema& file, double threshold, meta::Seg
         compacted_file.file_type_ = meta::SegmentSchema::TO_DELETE;
     }
 
-    files_to_update.emplace_back(compacted_file);
-
     // Set all files in segment to TO_DELETE
     auto& segment_id = file.segment_id_;
     meta::FilesHolder files_holder;
@@ -1184,11 +1249,28 @@ DBImpl::CompactFile(const meta::SegmentSchema& file, double threshold, meta::Seg
 
     milvus::engine::meta::SegmentsSchema& segment_files = files_holder.HoldFiles();
     for (auto& f : segment_files) {
+        // an IVF index of the origin segment is compacted along with the raw data instead of being rebuilt,
+        // if it fails for any reason the compacted file stays TO_INDEX
+        if (f.file_type_ == (int32_t)meta::SegmentSchema::INDEX &&
+            compacted_file.file_type_ == (int32_t)meta::SegmentSchema::TO_INDEX) {
+            meta::SegmentSchema compacted_index_file;
+            auto index_status = CompactIndexFile(f, compacted_file, offset_map, segment_writer_ptr, compacted_index_file);
+            if (index_status.ok()) {
+                compacted_file.file_type_ = meta::SegmentSchema::BACKUP;
+                files_to_update.emplace_back(compacted_index_file);
+            } else {
+                LOG_ENGINE_DEBUG_ << "Index of segment " << segment_id
+                                  << " is not compacted, rebuild it: " << index_status.message();
+            }
+        }
+
         f.file_type_ = meta::SegmentSchema::FILE_TYPE::TO_DELETE;
         files_to_update.emplace_back(f);
     }
     files_holder.ReleaseFiles();
 
+    files_to_update.emplace_back(compacted_file);
+
     LOG_ENGINE_DEBUG_ << "Compacted segment " << compacted_file.segment_id_ << " from "
                       << std::to_string(file.file_size_) << " bytes to " << std::to_string(compacted_file.file_size_)
                       << " bytes";
@@ -1200,6 +1282,66 @@ DBImpl::CompactFile(const meta::SegmentSchema& file, double threshold, meta::Seg
     return status;
 }
 
+Status
+DBImpl::CompactIndexFile(const meta::SegmentSchema& index_file, const meta::SegmentSchema& compacted_file,
+                         const std::vector<int64_t>& offset_map, const segment::SegmentWriterPtr& segment_writer_ptr,
+                         meta::SegmentSchema& compacted_index_file) {
+    // only inverted lists can drop and renumber entries without retraining
+    auto engine_type = (EngineType)index_file.engine_type_;
+    if (engine_type != EngineType::FAISS_IVFFLAT && engine_type != EngineType::FAISS_IVFSQ8 &&
+        engine_type != EngineType::FAISS_PQ) {
+        return Status(DB_ERROR, "Index type doesn't support compaction");
+    }
+
+    std::string segment_dir;
+    utils::GetParentPath(index_file.location_, segment_dir);
+    segment::SegmentReader segment_reader(segment_dir);
+    segment::VectorIndexPtr vector_index_ptr;
+    auto status = segment_reader.LoadVectorIndex(index_file.location_, vector_index_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    auto index = std::dynamic_pointer_cast<knowhere::IVF>(vector_index_ptr->GetVectorIndex());
+    if (index == nullptr) {
+        return Status(DB_ERROR, "Index of " + index_file.file_id_ + " is not an IVF index");
+    }
+
+    try {
+        index->CompactInvertedLists(offset_map);
+    } catch (std::exception& ex) {
+        return Status(DB_ERROR, "Failed to compact index: " + std::string(ex.what()));
+    }
+
+    // the index file belongs to the compacted segment, same as BuildIndexTask does for a raw file
+    compacted_index_file.collection_id_ = index_file.collection_id_;
+    compacted_index_file.segment_id_ = compacted_file.file_id_;
+    compacted_index_file.date_ = index_file.date_;
+    compacted_index_file.file_type_ = meta::SegmentSchema::NEW_INDEX;
+    status = meta_ptr_->CreateCollectionFile(compacted_index_file);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (compacted_index_file.engine_type_ != index_file.engine_type_) {
+        status = Status(DB_ERROR, "Index type of collection has been changed");
+    } else {
+        segment_writer_ptr->SetVectorIndex(index);
+        status = segment_writer_ptr->WriteVectorIndex(compacted_index_file.location_);
+    }
+
+    if (!status.ok()) {
+        compacted_index_file.file_type_ = meta::SegmentSchema::TO_DELETE;
+        meta_ptr_->UpdateCollectionFile(compacted_index_file);
+        return status;
+    }
+
+    compacted_index_file.file_type_ = meta::SegmentSchema::INDEX;
+    compacted_index_file.file_size_ = server::CommonUtil::GetFileSize(compacted_index_file.location_);
+    compacted_index_file.row_count_ = index->Count();
+    return Status::OK();
+}
+
 Status
 DBImpl::GetVectorsByID(const engine::meta::CollectionSchema& collection, const std::string& partition_tag,
                        const IDNumbers& id_array, std::vector<engine::VectorsData>& vectors) {
@@ -1406,6 +1548,9 @@ DBImpl::GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::Vect
             return segment_reader.LoadUids(uids_ptr);
         };
 
+        // uid_index_ptr
+        segment::UidIndexPtr uid_index_ptr = nullptr;
+
         // deleted_docs_ptr
         segment::DeletedDocsPtr deleted_docs_ptr = nullptr;
         auto LoadDeleteDoc = [&]() { return segment_reader.LoadDeletedDocs(deleted_docs_ptr); };
@@ -1434,31 +1579,39 @@ DBImpl::GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::Vect
             segment_writer.WriteBloomFilter(id_bloom_filter_ptr);
         }
 
+        // Check which ids may be present by bloom filter in a batch.
+        std::vector<segment::doc_id_t> ids_to_check(temp_ids.size());
+        std::vector<uint8_t> maybe_present(temp_ids.size());
+        for (size_t i = 0; i < temp_ids.size(); i++) {
+            ids_to_check[i] = temp_ids[i].second;
+        }
+        id_bloom_filter_ptr->CheckMany(ids_to_check.data(), ids_to_check.size(), maybe_present.data());
+
         for (size_t i = 0; i < temp_ids.size();) {
             // each id must has a VectorsData
             // if vector not found for an id, its VectorsData's vector_count = 0, else 1
             VectorsData& vector_ref = vectors[temp_ids[i].first];
             auto vector_id = temp_ids[i].second;
 
-            // Check if the id is present in bloom filter.
-            if (id_bloom_filter_ptr->Check(vector_id)) {
-                // Load uids and check if the id is indeed present. If yes, find its offset.
-                if (uids_ptr == nullptr && !(status = LoadUid()).ok()) {
+            if (maybe_present[i]) {
+                // Look up the uid index to check if the id is indeed present. If yes, find its offset.
+                if (uid_index_ptr == nullptr && !(status = segment_reader.LoadUidIndex(uid_index_ptr)).ok()) {
                     return status;
                 }
 
-                auto found = std::find(uids_ptr->begin(), uids_ptr->end(), vector_id);
-                if (found != uids_ptr->end()) {
-                    auto offset = std::distance(uids_ptr->begin(), found);
-
+                auto offsets = uid_index_ptr->Find(vector_id);
+                if (offsets.first != offsets.second) {
                     // Check whether the id has been deleted
                     if (!deleted_docs_ptr && !(status = LoadDeleteDoc()).ok()) {
                         return status;
                     }
-                    auto& deleted_docs = deleted_docs_ptr->GetDeletedDocs();
+                    auto found = std::find_if_not(offsets.first, offsets.second, [&](segment::offset_t offset) {
+                        return deleted_docs_ptr->IsDeleted(offset);
+                    });
+
+                    if (found != offsets.second) {
+                        auto offset = *found;
 
-                    auto deleted = std::find(deleted_docs.begin(), deleted_docs.end(), offset);
-                    if (deleted == deleted_docs.end()) {
                         // Load raw vector
                         std::vector<uint8_t> raw_vector;
                         status = segment_reader.LoadsSingleVector(offset * single_vector_bytes, single_vector_bytes,
@@ -1479,6 +1632,8 @@ DBImpl::GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::Vect
                         }
                         temp_ids[i] = temp_ids.back();
                         temp_ids.resize(temp_ids.size() - 1);
+                        maybe_present[i] = maybe_present.back();
+                        maybe_present.resize(maybe_present.size() - 1);
                         continue;
                     }
                 }
@@ -1707,26 +1862,64 @@ Status
 DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
               const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
               const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) {
+    return HybridQuery(context, collection_id, partition_tags, nullptr, k, extra_params, vectors, result_ids,
+                       result_distances);
+}
+
+Status
+DBImpl::HybridQuery(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
+                    const std::vector<std::string>& partition_tags, const query::GeneralQueryPtr& general_query,
+                    uint64_t k, const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
+                    ResultDistances& result_distances) {
     milvus::server::ContextChild tracer(context, "Query");
 
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
-    // step 1: get all collection files from collection
+    if (general_query != nullptr) {
+        auto status = query::ValidateAttrQuery(general_query);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    // step 1: search the inserted vectors not flushed yet, the buffers being flushed included.
+    // it comes before the files are collected: the segment a buffer is flushed into in between is then skipped by
+    // its file id, while in the other order its rows would be in neither. the deletes not applied to the segments
+    // yet are excluded by each segment search, the buffers are filtered by them already
+    std::set<std::string> search_collection_ids;
+    Status status = CollectionIdsFromSnapshot(collection_id, partition_tags, search_collection_ids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    TopkResultMap mem_results;
+    std::unordered_set<IDNumber> deleted_ids;
+    if (!vectors.float_data_.empty() || !vectors.binary_data_.empty()) {
+        status = mem_mgr_->Search(search_collection_ids, vectors, k, general_query, mem_results, deleted_ids);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    // step 2: get all collection files from collection
     meta::FilesHolder files_holder;
-    Status status = CollectFilesToSearch(collection_id, partition_tags, files_holder);
+    status = CollectFilesFromSnapshot(collection_id, partition_tags, files_holder, search_collection_ids);
     if (!status.ok()) {
         return status;
     }
 
     if (files_holder.HoldFiles().empty()) {
-        return Status::OK();  // no files to search
+        // no files to search
+        scheduler::SearchJob::ReduceTaskResults(mem_results, vectors.vector_count_, k, result_ids, result_distances);
+        return Status::OK();
     }
 
-    // step 2: do query
+    // step 3: do query
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances);
+    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances,
+                        mem_results, general_query, std::move(deleted_ids));
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     return status;
@@ -1761,7 +1954,9 @@ DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances);
+    TopkResultMap mem_results;
+    status = QueryAsync(tracer.Context(), files_holder, k, extra_params, vectors, result_ids, result_distances,
+                        mem_results, nullptr);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     return status;
@@ -1782,7 +1977,8 @@ DBImpl::Size(uint64_t& result) {
 Status
 DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesHolder& files_holder, uint64_t k,
                    const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
-                   ResultDistances& result_distances) {
+                   ResultDistances& result_distances, TopkResultMap& mem_results,
+                   const query::GeneralQueryPtr& general_query, std::unordered_set<IDNumber> deleted_ids) {
     milvus::server::ContextChild tracer(context, "Query Async");
     server::CollectQueryMetrics metrics(vectors.vector_count_);
 
@@ -1798,7 +1994,9 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesH
 
     // step 1: construct search job
     LOG_ENGINE_DEBUG_ << LogOut("Engine query begin, index file count: %ld", files.size());
-    scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(tracer.Context(), k, extra_params, vectors);
+    scheduler::SearchJobPtr job =
+        std::make_shared<scheduler::SearchJob>(tracer.Context(), k, extra_params, vectors, general_query,
+                                               std::move(deleted_ids));
     for (auto& file : files) {
         // no need to process shadow files
         if (file.file_type_ == milvus::engine::meta::SegmentSchema::FILE_TYPE::NEW ||
@@ -1807,10 +2005,34 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesH
             continue;
         }
 
+        // the buffer flushed into the segment during this query was searched already
+        if (mem_results.find(file.id_) != mem_results.end()) {
+            continue;
+        }
+
+        // skip the segments whose zone maps match no entity, before their index is loaded
+        if (general_query != nullptr) {
+            std::string segment_dir;
+            utils::GetParentPath(file.location_, segment_dir);
+            segment::SegmentReader segment_reader(segment_dir);
+            segment::AttrsPtr attrs_ptr;
+            auto status = segment_reader.LoadAttrsZoneMaps(attrs_ptr);
+            if (!status.ok()) {
+                return status;
+            }
+            if (query::CheckZoneMaps(general_query, *attrs_ptr, file.row_count_) == query::ZoneMapResult::NONE) {
+                continue;
+            }
+        }
+
         scheduler::SegmentSchemaPtr file_ptr = std::make_shared<meta::SegmentSchema>(file);
         job->AddIndexFile(file_ptr);
     }
 
+    for (auto& pair : mem_results) {
+        job->AddTaskResult(pair.first, pair.second);
+    }
+
     // Suspend builder
     SuspendIfFirst();
 
@@ -1888,6 +2110,13 @@ DBImpl::StartMetricTask() {
         server::Metrics::GetInstance().CpuCacheUsageGaugeSet(0);
     }
 
+    auto cache_statistics = cache::CpuCacheMgr::GetInstance()->Statistics();
+    for (size_t i = 0; i < cache_statistics.size(); ++i) {
+        auto& statistics = cache_statistics[i];
+        server::Metrics::GetInstance().CpuCacheShardGaugeSet(i, statistics.hit_count_, statistics.miss_count_,
+                                                             statistics.eviction_count_);
+    }
+
     server::Metrics::GetInstance().GpuCacheUsageGaugeSet();
     uint64_t size;
     Size(size);
@@ -2095,6 +2324,15 @@ DBImpl::GetPartitionsByTags(const std::string& collection_id, const std::vector<
     std::vector<meta::CollectionSchema> all_partitions;
     auto status = meta_ptr_->ShowPartitions(collection_id, all_partitions);
 
+    return MatchPartitionsByTags(collection_id, all_partitions, partition_tags, partition_name_array, partition_array);
+}
+
+Status
+DBImpl::MatchPartitionsByTags(const std::string& collection_id,
+                              const std::vector<meta::CollectionSchema>& all_partitions,
+                              const std::vector<std::string>& partition_tags,
+                              std::set<std::string>& partition_name_array,
+                              std::vector<meta::CollectionSchema>& partition_array) {
     for (auto& tag : partition_tags) {
         // trim side-blank of tag, only compare valid characters
         // for example: " ab cd " is treated as "ab cd"
@@ -2282,7 +2520,71 @@ DBImpl::GetCollectionRowCountRecursively(const std::string& collection_id, uint6
 }
 
 Status
-DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
+DBImpl::ExecWalRecordBatch(const wal::MXLogRecordBatch& batch) {
+    // records of a collection must be applied in order, different collections are applied in parallel
+    std::map<std::string, std::vector<const wal::MXLogRecord*>> collection_records;
+    for (auto& record : batch.records) {
+        collection_records[record.collection_id].push_back(&record);
+    }
+
+    size_t thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, collection_records.size());
+    ThreadPool pool(thread_count, collection_records.size());
+
+    // the first failure stops all collections, no flush after it moves a flushed lsn past the failed record
+    std::atomic<bool> failed(false);
+    std::vector<std::future<Status>> futures;
+    for (auto& pair : collection_records) {
+        auto& collection_id = pair.first;
+        auto& records = pair.second;
+        futures.emplace_back(pool.enqueue([this, &collection_id, &records, &failed]() {
+            for (auto record : records) {
+                if (failed.load()) {
+                    return Status::OK();
+                }
+
+                auto status = ExecWalRecord(*record, false);
+                fiu_do_on("DBImpl.ExecWalRecordBatch.apply_failed", status = Status(DB_ERROR, ""));
+                if (!status.ok()) {
+                    LOG_WAL_ERROR_ << "Failed to apply wal record " << record->lsn << ": " << status.message();
+                    failed.store(true);
+                    return status;
+                }
+
+                // a flush of all collections would mark the unapplied records of other collections as flushed,
+                // only the collection of this thread is flushed, up to the record just applied
+                if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+                    LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] ", "recovery", 0)
+                                      << "Insert buffer size exceeds limit. Force flush " << collection_id;
+                    InternalFlush(collection_id);
+                }
+            }
+            return Status::OK();
+        }));
+    }
+
+    Status status;
+    for (auto& future : futures) {
+        auto apply_status = future.get();
+        if (status.ok() && !apply_status.ok()) {
+            status = apply_status;
+        }
+    }
+    if (!status.ok()) {
+        return status;
+    }
+
+    // all records of the batch are applied, flush in bulk if necessary
+    if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+        LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] ", "recovery", 0) << "Insert buffer size exceeds limit. Force flush";
+        InternalFlush();
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::ExecWalRecord(const wal::MXLogRecord& record, bool flush_if_mem_full) {
     fiu_return_on("DBImpl.ExexWalRecord.return", Status(););
 
     auto collections_flushed = [&](const std::string collection_id,
@@ -2307,8 +2609,8 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
         return max_lsn;
     };
 
-    auto force_flush_if_mem_full = [&]() -> uint64_t {
-        if (mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
+    auto force_flush_if_mem_full = [&]() {
+        if (flush_if_mem_full && mem_mgr_->GetCurrentMem() > options_.insert_buffer_size_) {
             LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] ", "insert", 0) << "Insert buffer size exceeds limit. Force flush";
             InternalFlush();
         }
@@ -2353,6 +2655,26 @@ DBImpl::ExecWalRecord(const wal::MXLogRecord& record) {
             break;
         }
 
+        case wal::MXLogType::Entity: {
+            std::string target_collection_name;
+            status = GetPartitionByTag(record.collection_id, record.partition_tag, target_collection_name);
+            if (!status.ok()) {
+                LOG_WAL_ERROR_ << LogOut("[%s][%ld] ", "insert", 0) << "Get partition fail: " << status.message();
+                return status;
+            }
+
+            VectorsData entities;
+            if (!wal::WalManager::DeserializeEntities(record, entities)) {
+                return Status(DB_ERROR, "Broken entity record of collection " + record.collection_id);
+            }
+            status = mem_mgr_->InsertEntities(target_collection_name, std::move(entities), record.lsn);
+            force_flush_if_mem_full();
+
+            // metrics
+            milvus::server::CollectInsertMetrics metrics(record.length, status);
+            break;
+        }
+
         case wal::MXLogType::Delete: {
             // If no partition tag specified, will delete from all partitions under this collection
             // including the collection itself. Else only delete from the specified partiion.
@@ -2456,6 +2778,36 @@ DBImpl::InternalFlush(const std::string& collection_id) {
     ExecWalRecord(record);
 }
 
+Status
+DBImpl::WaitInsertBuffer() {
+    // without wal the inserting thread flushes the buffer by itself once it is full
+    if (!options_.wal_enable_) {
+        return Status::OK();
+    }
+
+    // the buffer holds the wal records not applied yet and the vectors in mem tables, both are drained by
+    // the wal thread, so the writers are slowed down to the speed of applying and flushing.
+    // the insert requests run on the worker shared with delete and flush, a long wait holds up the requests
+    // queued behind the insert, so the wait is bounded, after that the insert is rejected and can be retried
+    auto buffer_full = [&]() {
+        bool full = mem_mgr_->GetCurrentMem() + wal_mgr_->GetPendingSize() > options_.insert_buffer_size_;
+        fiu_do_on("DBImpl.WaitInsertBuffer.buffer_full", full = true);
+        return initialized_.load(std::memory_order_acquire) && full;
+    };
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(INSERT_BUFFER_MAX_WAIT_MS);
+    std::unique_lock<std::mutex> lock(insert_buffer_mutex_);
+    while (buffer_full()) {
+        swn_wal_.Notify();
+        if (insert_buffer_cv_.wait_until(lock, deadline) == std::cv_status::timeout && buffer_full()) {
+            LOG_ENGINE_DEBUG_ << "Insert buffer is still full after " << INSERT_BUFFER_MAX_WAIT_MS << "ms";
+            return Status(DB_INSERT_BUFFER_FULL, "Insert buffer is full, retry later");
+        }
+    }
+
+    return Status::OK();
+}
+
 void
 DBImpl::BackgroundWalThread() {
     SetThreadName("wal_thread");
@@ -2468,11 +2820,18 @@ DBImpl::BackgroundWalThread() {
     if (options_.auto_flush_interval_ > 0) {
         next_auto_flush_time = get_next_auto_flush_time();
     }
+    // wake up the writers waiting for room in insert buffer, under the lock so that no wake-up is lost
+    auto notify_insert_buffer = [&]() {
+        std::lock_guard<std::mutex> lock(insert_buffer_mutex_);
+        insert_buffer_cv_.notify_all();
+    };
+
     InternalFlush();
     while (true) {
         if (options_.auto_flush_interval_ > 0) {
             if (std::chrono::system_clock::now() >= next_auto_flush_time) {
                 InternalFlush();
+                notify_insert_buffer();
                 next_auto_flush_time = get_next_auto_flush_time();
             }
         }
@@ -2486,6 +2845,7 @@ DBImpl::BackgroundWalThread() {
 
         if (record.type != wal::MXLogType::None) {
             ExecWalRecord(record);
+            notify_insert_buffer();
             if (record.type == wal::MXLogType::Flush) {
                 // notify flush request to return
                 flush_req_swn_.Notify();
@@ -2550,6 +2910,164 @@ DBImpl::BackgroundMetricThread() {
     }
 }
 
+void
+DBImpl::BackgroundWarmUpThread() {
+    SetThreadName("warmup_thread");
+    auto status = WarmUpCache();
+    if (!status.ok()) {
+        LOG_ENGINE_ERROR_ << "Failed to warm up cache: " << status.message();
+    }
+
+    while (true) {
+        swn_warmup_.Wait_For(std::chrono::seconds(options_.cache_warmup_interval_));
+
+        status = SaveCacheManifest();
+        if (!status.ok()) {
+            LOG_ENGINE_ERROR_ << "Failed to save cache manifest: " << status.message();
+        }
+
+        if (!initialized_.load(std::memory_order_acquire)) {
+            LOG_ENGINE_DEBUG_ << "DB background warm-up thread exit";
+            break;
+        }
+    }
+}
+
+Status
+DBImpl::WarmUpCache() {
+    // the manifest lists the cached items, most frequently accessed first
+    std::string manifest_path = options_.meta_.path_ + "/" + CACHE_MANIFEST_NAME;
+    std::ifstream manifest(manifest_path);
+    if (!manifest.is_open()) {
+        return Status::OK();
+    }
+
+    std::vector<std::string> locations;
+    uint64_t access_count = 0;
+    std::string location;
+    while (manifest >> access_count && std::getline(manifest >> std::ws, location)) {
+        locations.emplace_back(location);
+    }
+    manifest.close();
+    if (locations.empty()) {
+        return Status::OK();
+    }
+
+    // files may be merged or deleted after the manifest is saved, only the current searchable files are loaded,
+    // the other items in manifest such as bloom filters are loaded along with their segments by queries
+    std::vector<meta::CollectionSchema> collection_array;
+    auto status = meta_ptr_->AllCollections(collection_array, true);
+    if (!status.ok()) {
+        return status;
+    }
+
+    meta::FilesHolder files_holder;
+    for (auto& collection : collection_array) {
+        status = CollectFilesToSearch(collection.collection_id_, std::vector<std::string>(), files_holder);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    std::unordered_map<std::string, const meta::SegmentSchema*> searchable_files;
+    for (auto& file : files_holder.HoldFiles()) {
+        searchable_files.insert(std::make_pair(file.location_, &file));
+    }
+
+    // load files in priority order until the cache is full
+    auto cache_mgr = cache::CpuCacheMgr::GetInstance();
+    int64_t available_size = cache_mgr->CacheCapacity() - cache_mgr->CacheUsage();
+    int64_t total_size = 0;
+    std::vector<const meta::SegmentSchema*> files_to_load;
+    for (auto& file_location : locations) {
+        auto iter = searchable_files.find(file_location);
+        if (iter == searchable_files.end() || cache_mgr->ItemExists(file_location)) {
+            continue;
+        }
+        total_size += iter->second->file_size_;
+        if (total_size > available_size) {
+            break;
+        }
+        files_to_load.push_back(iter->second);
+    }
+
+    LOG_ENGINE_DEBUG_ << "Begin warm-up cache, totally " << files_to_load.size() << " files need to be loaded";
+    TimeRecorderAuto rc("Warm-up cache");
+
+    auto load_file = [&](const meta::SegmentSchema& file) {
+        // server is stopping, no need to continue
+        if (!initialized_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        EngineType engine_type;
+        if (file.file_type_ == meta::SegmentSchema::FILE_TYPE::RAW ||
+            file.file_type_ == meta::SegmentSchema::FILE_TYPE::TO_INDEX ||
+            file.file_type_ == meta::SegmentSchema::FILE_TYPE::BACKUP) {
+            engine_type =
+                utils::IsBinaryMetricType(file.metric_type_) ? EngineType::FAISS_BIN_IDMAP : EngineType::FAISS_IDMAP;
+        } else {
+            engine_type = (EngineType)file.engine_type_;
+        }
+
+        auto json = milvus::json::parse(file.index_params_);
+        ExecutionEnginePtr engine = EngineFactory::Build(file.dimension_, file.location_, engine_type,
+                                                         (MetricType)file.metric_type_, json, file.updated_time_);
+        if (engine == nullptr) {
+            LOG_ENGINE_ERROR_ << "Invalid engine type";
+            return;
+        }
+
+        try {
+            auto load_status = engine->Load(false, true);
+            if (!load_status.ok()) {
+                LOG_ENGINE_ERROR_ << "Failed to warm up file " << file.location_ << ": " << load_status.message();
+            }
+        } catch (std::exception& ex) {
+            LOG_ENGINE_ERROR_ << "Failed to warm up file " << file.location_ << ": " << ex.what();
+        }
+    };
+
+    // loaders take the files in priority order
+    ThreadPool pool(CACHE_WARMUP_THREAD_NUM, files_to_load.size() + 1);
+    std::vector<std::future<void>> futures;
+    for (auto file : files_to_load) {
+        futures.emplace_back(pool.enqueue(load_file, std::cref(*file)));
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::SaveCacheManifest() {
+    auto hot_items = cache::CpuCacheMgr::GetInstance()->HotItems();
+
+    // write a new manifest and replace the old one, a crash never leaves a partial manifest
+    std::string manifest_path = options_.meta_.path_ + "/" + CACHE_MANIFEST_NAME;
+    std::string temp_path = manifest_path + ".tmp";
+    std::ofstream manifest(temp_path, std::ios::out | std::ios::trunc);
+    if (!manifest.is_open()) {
+        return Status(DB_ERROR, "Failed to open file: " + temp_path);
+    }
+    for (auto& item : hot_items) {
+        manifest << item.second << " " << item.first << "\n";
+    }
+    manifest.close();
+    if (manifest.fail()) {
+        return Status(DB_ERROR, "Failed to write file: " + temp_path);
+    }
+
+    if (std::rename(temp_path.c_str(), manifest_path.c_str()) != 0) {
+        return Status(DB_ERROR, "Failed to rename file: " + temp_path);
+    }
+
+    LOG_ENGINE_DEBUG_ << "Save " << hot_items.size() << " items into cache manifest";
+    return Status::OK();
+}
+
 void
 DBImpl::OnCacheInsertDataChanged(bool value) {
     options_.insert_cache_immediately_ = value;
@@ -2620,5 +3138,71 @@ DBImpl::CollectFilesToSearch(const std::string& collection_id, const std::vector
     return status;
 }
 
+Status
+DBImpl::CollectFilesFromSnapshot(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                                 meta::FilesHolder& files_holder, std::set<std::string>& search_collection_ids) {
+    if (snapshot_meta_ptr_ == nullptr) {
+        return CollectFilesToSearch(collection_id, partition_tags, files_holder);
+    }
+
+    meta::CollectionSnapshotPtr snapshot;
+    auto status = snapshot_meta_ptr_->GetCollectionSnapshot(collection_id, snapshot);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::set<std::string> partition_ids;
+    status = MatchSnapshotPartitions(collection_id, partition_tags, snapshot, partition_ids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the snapshot pins its files as long as it is held here, marking them again keeps them
+    // from TTL clean up until the search finished
+    search_collection_ids = partition_ids;
+    for (auto& partition_id : partition_ids) {
+        auto iter = snapshot->files_.find(partition_id);
+        if (iter != snapshot->files_.end()) {
+            files_holder.MarkFiles(iter->second);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::CollectionIdsFromSnapshot(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                                  std::set<std::string>& search_collection_ids) {
+    search_collection_ids.clear();
+    if (snapshot_meta_ptr_ == nullptr) {
+        return Status::OK();
+    }
+
+    meta::CollectionSnapshotPtr snapshot;
+    auto status = snapshot_meta_ptr_->GetCollectionSnapshot(collection_id, snapshot);
+    if (!status.ok()) {
+        return status;
+    }
+
+    return MatchSnapshotPartitions(collection_id, partition_tags, snapshot, search_collection_ids);
+}
+
+Status
+DBImpl::MatchSnapshotPartitions(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                                const meta::CollectionSnapshotPtr& snapshot, std::set<std::string>& partition_ids) {
+    if (partition_tags.empty()) {
+        // no partition tag specified, means search in whole collection
+        partition_ids.insert(collection_id);
+        for (auto& schema : snapshot->partitions_) {
+            partition_ids.insert(schema.collection_id_);
+        }
+        return Status::OK();
+    }
+
+    std::vector<meta::CollectionSchema> partition_array;
+    return MatchPartitionsByTags(collection_id, snapshot->partitions_, partition_tags, partition_ids,
+                                 partition_array);  // fails when no partition matches
+}
+
 }  // namespace engine
 }  // namespace milvus
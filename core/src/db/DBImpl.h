@@ -21,6 +21,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "config/handler/CacheConfigHandler.h"
@@ -31,6 +32,8 @@
 #include "db/insert/MemManager.h"
 #include "db/merge/MergeManager.h"
 #include "db/meta/FilesHolder.h"
+#include "db/meta/SnapshotMetaImpl.h"
+#include "segment/SegmentWriter.h"
 #include "utils/ThreadPool.h"
 #include "wal/WalManager.h"
 
@@ -160,6 +163,12 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
           const std::vector<std::string>& partition_tags, uint64_t k, const milvus::json& extra_params,
           const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) override;
 
+    Status
+    HybridQuery(const std::shared_ptr<server::Context>& context, const std::string& collection_id,
+                const std::vector<std::string>& partition_tags, const query::GeneralQueryPtr& general_query, uint64_t k,
+                const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
+                ResultDistances& result_distances) override;
+
     Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::vector<std::string>& file_ids, uint64_t k,
                   const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
@@ -179,7 +188,8 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     Status
     QueryAsync(const std::shared_ptr<server::Context>& context, meta::FilesHolder& files_holder, uint64_t k,
                const milvus::json& extra_params, const VectorsData& vectors, ResultIds& result_ids,
-               ResultDistances& result_distances);
+               ResultDistances& result_distances, TopkResultMap& mem_results,
+               const query::GeneralQueryPtr& general_query, std::unordered_set<IDNumber> deleted_ids = {});
 
     Status
     GetVectorsByIdHelper(const IDNumbers& id_array, std::vector<engine::VectorsData>& vectors,
@@ -188,6 +198,9 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     void
     InternalFlush(const std::string& collection_id = "");
 
+    Status
+    WaitInsertBuffer();
+
     void
     BackgroundWalThread();
 
@@ -200,6 +213,9 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     void
     BackgroundIndexThread();
 
+    void
+    BackgroundWarmUpThread();
+
     void
     WaitMergeFileFinish();
 
@@ -209,6 +225,12 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     void
     StartMetricTask();
 
+    Status
+    WarmUpCache();
+
+    Status
+    SaveCacheManifest();
+
     void
     StartMergeTask(const std::set<std::string>& merge_collection_ids, bool force_merge_all = false);
 
@@ -224,6 +246,11 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     Status
     CompactFile(const meta::SegmentSchema& file, double threshold, meta::SegmentsSchema& files_to_update);
 
+    Status
+    CompactIndexFile(const meta::SegmentSchema& index_file, const meta::SegmentSchema& compacted_file,
+                     const std::vector<int64_t>& offset_map, const segment::SegmentWriterPtr& segment_writer_ptr,
+                     meta::SegmentSchema& compacted_index_file);
+
     Status
     GetFilesToBuildIndex(const std::string& collection_id, const std::vector<int>& file_types,
                          meta::FilesHolder& files_holder);
@@ -236,6 +263,11 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
                         std::set<std::string>& partition_name_array,
                         std::vector<meta::CollectionSchema>& partition_array);
 
+    Status
+    MatchPartitionsByTags(const std::string& collection_id, const std::vector<meta::CollectionSchema>& all_partitions,
+                          const std::vector<std::string>& partition_tags, std::set<std::string>& partition_name_array,
+                          std::vector<meta::CollectionSchema>& partition_array);
+
     Status
     UpdateCollectionIndexRecursively(const std::string& collection_id, const CollectionIndex& index, bool meta_only);
 
@@ -250,7 +282,10 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     GetCollectionRowCountRecursively(const std::string& collection_id, uint64_t& row_count);
 
     Status
-    ExecWalRecord(const wal::MXLogRecord& record);
+    ExecWalRecord(const wal::MXLogRecord& record, bool flush_if_mem_full = true);
+
+    Status
+    ExecWalRecordBatch(const wal::MXLogRecordBatch& batch);
 
     void
     SuspendIfFirst();
@@ -262,12 +297,26 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     CollectFilesToSearch(const std::string& collection_id, const std::vector<std::string>& partition_tags,
                          meta::FilesHolder& files_holder);
 
+    Status
+    CollectFilesFromSnapshot(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                             meta::FilesHolder& files_holder, std::set<std::string>& search_collection_ids);
+
+    // the collection and partitions to search, empty in readonly mode
+    Status
+    CollectionIdsFromSnapshot(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                              std::set<std::string>& search_collection_ids);
+
+    Status
+    MatchSnapshotPartitions(const std::string& collection_id, const std::vector<std::string>& partition_tags,
+                            const meta::CollectionSnapshotPtr& snapshot, std::set<std::string>& partition_ids);
+
  private:
     DBOptions options_;
 
     std::atomic<bool> initialized_;
 
     meta::MetaPtr meta_ptr_;
+    meta::SnapshotMetaImplPtr snapshot_meta_ptr_;  // null in readonly mode, meta is changed by other nodes
     MemManagerPtr mem_mgr_;
     MergeManagerPtr merge_mgr_ptr_;
 
@@ -277,6 +326,7 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     std::thread bg_flush_thread_;
     std::thread bg_metric_thread_;
     std::thread bg_index_thread_;
+    std::thread bg_warmup_thread_;
 
     struct SimpleWaitNotify {
         bool notified_ = false;
@@ -327,10 +377,15 @@ class DBImpl : public DB, public server::CacheConfigHandler, public server::Engi
     SimpleWaitNotify swn_flush_;
     SimpleWaitNotify swn_metric_;
     SimpleWaitNotify swn_index_;
+    SimpleWaitNotify swn_warmup_;
 
     SimpleWaitNotify flush_req_swn_;
     SimpleWaitNotify index_req_swn_;
 
+    // wake up the writers waiting for room in insert buffer
+    std::mutex insert_buffer_mutex_;
+    std::condition_variable insert_buffer_cv_;
+
     ThreadPool merge_thread_pool_;
     std::mutex merge_result_mutex_;
     std::list<std::future<void>> merge_thread_results_;
@@ -71,6 +71,8 @@ struct DBOptions {
 
     size_t insert_buffer_size_ = 4 * GB;
     bool insert_cache_immediately_ = false;
+    bool cache_warmup_enable_ = false;
+    int64_t cache_warmup_interval_ = 300;  // s
 
     int64_t auto_flush_interval_ = 1;
     int64_t file_cleanup_timeout_ = 10;
@@ -82,6 +84,9 @@ struct DBOptions {
     bool recovery_error_ignore_ = true;
     int64_t buffer_size_ = 256;
     std::string mxlog_path_ = "/tmp/milvus/wal/";
+    bool wal_sync_enable_ = true;
+    int64_t wal_sync_interval_ = 1;          // ms
+    int64_t wal_sync_batch_size_ = 1048576;  // bytes
 };  // Options
 
 }  // namespace engine
@@ -35,6 +35,16 @@ typedef std::vector<IDNumber> IDNumbers;
 typedef std::vector<faiss::Index::idx_t> ResultIds;
 typedef std::vector<faiss::Index::distance_t> ResultDistances;
 
+// topk result of searching one segment, each query has k valid results stored with stride topk
+struct TopkResult {
+    ResultIds ids_;
+    ResultDistances distances_;
+    size_t k_ = 0;
+    bool ascending_ = true;
+};
+
+using TopkResultMap = std::unordered_map<size_t, TopkResult>;
+
 struct CollectionIndex {
     int32_t engine_type_ = (int)EngineType::FAISS_IDMAP;
     int32_t metric_type_ = (int)MetricType::L2;
@@ -46,6 +56,11 @@ struct VectorsData {
     std::vector<float> float_data_;
     std::vector<uint8_t> binary_data_;
     IDNumbers id_array_;
+    uint64_t lsn_ = 0;  // filled by insert, wal position covering the inserted vectors
+
+    // attribute columns of the vectors, a column holds vector_count_ values of its type
+    std::unordered_map<std::string, DataType> attr_types_;
+    std::unordered_map<std::string, std::vector<uint8_t>> attr_data_;
 };
 
 struct Entity {
@@ -301,7 +301,9 @@ GetIndexName(int32_t index_type) {
         {(int32_t)engine::EngineType::FAISS_BIN_IDMAP, RAWDATA_INDEX_NAME},
         {(int32_t)engine::EngineType::FAISS_BIN_IVFFLAT, "IVFFLAT"},
         {(int32_t)engine::EngineType::HNSW, "HNSW"},
-        {(int32_t)engine::EngineType::ANNOY, "ANNOY"}};
+        {(int32_t)engine::EngineType::ANNOY, "ANNOY"},
+        {(int32_t)engine::EngineType::HNSW_SQ8, "HNSW_SQ8"},
+        {(int32_t)engine::EngineType::FAISS_PQ_FASTSCAN, "PQ_FASTSCAN"}};
 
     if (index_type_name.find(index_type) == index_type_name.end()) {
         return "Unknow";
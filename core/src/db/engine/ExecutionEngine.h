@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <faiss/utils/ConcurrentBitset.h>
@@ -40,7 +41,9 @@ enum class EngineType {
     FAISS_BIN_IVFFLAT,
     HNSW,
     ANNOY,
-    MAX_VALUE = ANNOY,
+    HNSW_SQ8,
+    FAISS_PQ_FASTSCAN,
+    MAX_VALUE = FAISS_PQ_FASTSCAN,
 };
 
 enum class MetricType {
@@ -112,12 +115,16 @@ class ExecutionEngine {
 
     virtual Status
     GetVectorByID(const int64_t id, uint8_t* vector, bool hybrid) = 0;
+#endif
 
+    // filter the following searches by the term and range queries of general_query, all_filtered is set
+    // when no entity of the segment matches and the segment needn't be searched
     virtual Status
-    ExecBinaryQuery(query::GeneralQueryPtr general_query, faiss::ConcurrentBitsetPtr bitset,
-                    std::unordered_map<std::string, DataType>& attr_type, uint64_t& nq, uint64_t& topk,
-                    std::vector<float>& distances, std::vector<int64_t>& labels) = 0;
-#endif
+    ExecBinaryQuery(const query::GeneralQueryPtr& general_query, bool& all_filtered) = 0;
+
+    // also filter the following searches by the deletes not applied to the segment yet, after ExecBinaryQuery
+    virtual Status
+    ExecDeletedIds(const std::unordered_set<int64_t>& deleted_ids) = 0;
 
     virtual Status
     Search(int64_t n, const float* data, int64_t k, const milvus::json& extra_params, float* distances, int64_t* labels,
@@ -16,6 +16,7 @@
 
 #include <stdexcept>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -28,6 +29,8 @@
 #include "knowhere/index/vector_index/ConfAdapter.h"
 #include "knowhere/index/vector_index/ConfAdapterMgr.h"
 #include "knowhere/index/vector_index/IndexBinaryIDMAP.h"
+#include "knowhere/index/vector_index/IndexHNSWSQ8.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/VecIndex.h"
 #include "knowhere/index/vector_index/VecIndexFactory.h"
@@ -46,6 +49,7 @@
 #include "knowhere/index/vector_index/IndexType.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
 #include "metrics/Metrics.h"
+#include "query/AttrFilter.h"
 #include "scheduler/Utils.h"
 #include "segment/SegmentReader.h"
 #include "segment/SegmentWriter.h"
@@ -122,6 +126,10 @@ MappingIndexType(EngineType type) {
             return knowhere::IndexEnum::INDEX_HNSW;
         case EngineType::ANNOY:
             return knowhere::IndexEnum::INDEX_ANNOY;
+        case EngineType::HNSW_SQ8:
+            return knowhere::IndexEnum::INDEX_HNSW_SQ8;
+        case EngineType::FAISS_PQ_FASTSCAN:
+            return knowhere::IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN;
         default:
             break;
     }
@@ -129,6 +137,24 @@ MappingIndexType(EngineType type) {
     return knowhere::IndexEnum::INVALID;
 }
 
+bool
+IsRerankEnabled(EngineType type, const milvus::json& index_params) {
+    if (type != EngineType::HNSW_SQ8 && type != EngineType::FAISS_PQ_FASTSCAN) {
+        return false;
+    }
+    auto iter = index_params.find(knowhere::IndexParams::rerank);
+    return iter != index_params.end() && iter->is_boolean() && iter->get<bool>();
+}
+
+void
+SetRerankData(EngineType type, const knowhere::VecIndexPtr& index, std::shared_ptr<uint8_t[]> vectors_data) {
+    if (type == EngineType::HNSW_SQ8) {
+        std::static_pointer_cast<knowhere::IndexHNSWSQ8>(index)->SetRawData(std::move(vectors_data));
+    } else {
+        std::static_pointer_cast<knowhere::IVFPQFastScan>(index)->SetRawData(std::move(vectors_data));
+    }
+}
+
 }  // namespace
 
 #ifdef MILVUS_GPU_VERSION
@@ -242,6 +268,14 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type, knowhere::IndexMode mode)
             index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_ANNOY, mode);
             break;
         }
+        case EngineType::HNSW_SQ8: {
+            index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_HNSW_SQ8, mode);
+            break;
+        }
+        case EngineType::FAISS_PQ_FASTSCAN: {
+            index = vec_index_factory.CreateVecIndex(knowhere::IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN, mode);
+            break;
+        }
         default:
             break;
     }
@@ -410,23 +444,25 @@ ExecutionEngineImpl::Load(bool load_blacklist, bool to_cache) {
                 throw Exception(DB_ERROR, "Illegal index params");
             }
 
-            segment::VectorsPtr vectors = nullptr;
-            auto status = segment_reader_ptr->LoadsVectors(vectors);
+            // the raw vectors are read into one shared buffer and copied only once, into the brute force index
+            std::shared_ptr<uint8_t[]> vectors_data = nullptr;
+            size_t vectors_bytes = 0;
+            auto status = segment_reader_ptr->LoadsSharedVectors(vectors_data, vectors_bytes);
+            segment::UidsPtr vector_uids_ptr = nullptr;
+            if (status.ok()) {
+                status = segment_reader_ptr->LoadUids(vector_uids_ptr);
+            }
             if (!status.ok()) {
                 std::string msg = "Failed to load vectors from " + location_;
                 LOG_ENGINE_ERROR_ << msg;
                 return Status(DB_ERROR, msg);
             }
 
-            auto& vectors_uids = vectors->GetMutableUids();
-            std::shared_ptr<std::vector<int64_t>> vector_uids_ptr = std::make_shared<std::vector<int64_t>>();
-            vector_uids_ptr->swap(vectors_uids);
             index_->SetUids(vector_uids_ptr);
             LOG_ENGINE_DEBUG_ << "set uids " << vector_uids_ptr->size() << " for index " << location_;
 
-            auto& vectors_data = vectors->GetData();
             auto count = vector_uids_ptr->size();
-            auto dataset = knowhere::GenDataset(count, this->dim_, vectors_data.data());
+            auto dataset = knowhere::GenDataset(count, this->dim_, vectors_data.get());
             if (index_type_ == EngineType::FAISS_IDMAP) {
                 auto bf_index = std::static_pointer_cast<knowhere::IDMAP>(index_);
                 bf_index->Train(knowhere::DatasetPtr(), conf);
@@ -455,6 +491,19 @@ ExecutionEngineImpl::Load(bool load_blacklist, bool to_cache) {
                 index_->SetUids(uids_ptr);
                 LOG_ENGINE_DEBUG_ << "set uids " << index_->GetUids()->size() << " for index " << location_;
 
+                if (IsRerankEnabled(index_type_, index_params_)) {
+                    std::shared_ptr<uint8_t[]> vectors_data = nullptr;
+                    size_t vectors_bytes = 0;
+                    status = segment_reader_ptr->LoadsSharedVectors(vectors_data, vectors_bytes);
+                    if (!status.ok()) {
+                        std::string msg = "Failed to load vectors from " + location_;
+                        LOG_ENGINE_ERROR_ << msg;
+                        return Status(DB_ERROR, msg);
+                    }
+                    SetRerankData(index_type_, index_, vectors_data);
+                    LOG_ENGINE_DEBUG_ << "set raw vectors for re-ranking of index " << location_;
+                }
+
                 LOG_ENGINE_DEBUG_ << "Finished loading index file from segment " << segment_dir;
             } catch (std::exception& e) {
                 LOG_ENGINE_ERROR_ << e.what();
@@ -495,9 +544,7 @@ ExecutionEngineImpl::Load(bool load_blacklist, bool to_cache) {
             blacklist_->time_stamp_ = time_stamp_;
             if (!deleted_docs.empty()) {
                 auto concurrent_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(index_->Count());
-                for (auto& offset : deleted_docs) {
-                    concurrent_bitset_ptr->set(offset);
-                }
+                concurrent_bitset_ptr->set(deleted_docs.data(), deleted_docs.size());
                 blacklist_->bitset_ = concurrent_bitset_ptr;
             }
 
@@ -685,11 +732,123 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     to_index->SetUids(uids);
     LOG_ENGINE_DEBUG_ << "Set " << to_index->UidsSize() << "uids for " << location;
 
+    // the new index may be cached right after building, it needs the raw vectors as a loaded one does.
+    // the vectors of the brute force index are shared instead of copied, the new index keeps it alive
+    // and only reads them
+    if (from_index != nullptr && IsRerankEnabled(engine_type, index_params_)) {
+        auto raw_vectors = reinterpret_cast<uint8_t*>(const_cast<float*>(from_index->GetRawVectors()));
+        std::shared_ptr<uint8_t[]> vectors_data(from_index, raw_vectors);
+        SetRerankData(engine_type, to_index, vectors_data);
+        LOG_ENGINE_DEBUG_ << "Set raw vectors for re-ranking of index " << location;
+    }
+
     LOG_ENGINE_DEBUG_ << "Finish build index: " << location;
     return std::make_shared<ExecutionEngineImpl>(to_index, location, engine_type, metric_type_, index_params_,
                                                  time_stamp_);
 }
 
+Status
+ExecutionEngineImpl::ExecBinaryQuery(const query::GeneralQueryPtr& general_query, bool& all_filtered) {
+    TimeRecorder rc(LogOut("[%s][%ld] ExecutionEngineImpl::ExecBinaryQuery", "search", 0));
+    all_filtered = false;
+    filter_bitset_ = nullptr;
+
+    if (index_ == nullptr) {
+        LOG_ENGINE_ERROR_ << LogOut("[%s][%ld] ExecutionEngineImpl: index is null, failed to filter", "search", 0);
+        return Status(DB_ERROR, "index is null");
+    }
+
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
+    auto segment_reader_ptr = std::make_shared<segment::SegmentReader>(segment_dir);
+    auto row_count = static_cast<size_t>(index_->Count());
+
+    // the zone maps decide most segments without reading the columns
+    segment::AttrsPtr attrs_ptr;
+    auto status = segment_reader_ptr->LoadAttrsZoneMaps(attrs_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+    auto zone_map_result = query::CheckZoneMaps(general_query, *attrs_ptr, row_count);
+    rc.RecordSection("check zone maps");
+    if (zone_map_result == query::ZoneMapResult::NONE) {
+        all_filtered = true;
+        return Status::OK();
+    }
+    if (zone_map_result == query::ZoneMapResult::ALL) {
+        return Status::OK();
+    }
+
+    status = segment_reader_ptr->LoadAttrs(attrs_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the cached blacklist is shared by other queries, the filter goes to a copy
+    auto bitset = std::make_shared<faiss::ConcurrentBitset>(row_count);
+    if (blacklist_ != nullptr && blacklist_->bitset_ != nullptr) {
+        *bitset |= *blacklist_->bitset_;
+    }
+    status = query::FilterAttrs(general_query, *attrs_ptr, *bitset);
+    if (!status.ok()) {
+        return status;
+    }
+    rc.RecordSection("filter attributes");
+
+    all_filtered = (bitset->count() == row_count);
+    filter_bitset_ = bitset;
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::ExecDeletedIds(const std::unordered_set<int64_t>& deleted_ids) {
+    if (deleted_ids.empty()) {
+        return Status::OK();
+    }
+    if (index_ == nullptr) {
+        LOG_ENGINE_ERROR_ << LogOut("[%s][%ld] ExecutionEngineImpl: index is null, failed to filter", "search", 0);
+        return Status(DB_ERROR, "index is null");
+    }
+
+    std::string segment_dir;
+    utils::GetParentPath(location_, segment_dir);
+    segment::SegmentReader segment_reader(segment_dir);
+    segment::UidIndexPtr uid_index_ptr;
+    auto status = segment_reader.LoadUidIndex(uid_index_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // the bitset in use may be the cached blacklist, the deletes go to a copy
+    faiss::ConcurrentBitsetPtr bitset = nullptr;
+    for (auto id : deleted_ids) {
+        auto range = uid_index_ptr->Find(id);
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            if (bitset == nullptr) {
+                bitset = std::make_shared<faiss::ConcurrentBitset>(index_->Count());
+                auto search_bitset = SearchBitset();
+                if (search_bitset != nullptr) {
+                    *bitset |= *search_bitset;
+                }
+            }
+            bitset->set(*iter);
+        }
+    }
+
+    if (bitset != nullptr) {
+        filter_bitset_ = bitset;
+    }
+    return Status::OK();
+}
+
+faiss::ConcurrentBitsetPtr
+ExecutionEngineImpl::SearchBitset() const {
+    if (filter_bitset_ != nullptr) {
+        return filter_bitset_;
+    }
+    return blacklist_ ? blacklist_->bitset_ : nullptr;
+}
+
 void
 CopyResult(const knowhere::DatasetPtr& dataset, int64_t result_len, float* distances, int64_t* labels) {
     float* res_dist = dataset->Get<float*>(knowhere::meta::DISTANCE);
@@ -728,7 +887,7 @@ ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, const milvu
 
     rc.RecordSection("query prepare");
     auto dataset = knowhere::GenDataset(n, index_->Dim(), data);
-    auto result = index_->Query(dataset, conf, (blacklist_ ? blacklist_->bitset_ : nullptr));
+    auto result = index_->Query(dataset, conf, SearchBitset());
     rc.RecordSection("query done");
 
     LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] get %ld uids from index %s", "search", 0, index_->GetUids()->size(),
@@ -769,7 +928,7 @@ ExecutionEngineImpl::Search(int64_t n, const uint8_t* data, int64_t k, const mil
 
     rc.RecordSection("query prepare");
     auto dataset = knowhere::GenDataset(n, index_->Dim(), data);
-    auto result = index_->Query(dataset, conf, (blacklist_ ? blacklist_->bitset_ : nullptr));
+    auto result = index_->Query(dataset, conf, SearchBitset());
     rc.RecordSection("query done");
 
     LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld] get %ld uids from index %s", "search", 0, index_->GetUids()->size(),
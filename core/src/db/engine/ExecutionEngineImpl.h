@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ExecutionEngine.h"
@@ -66,12 +67,13 @@ class ExecutionEngineImpl : public ExecutionEngine {
 
     Status
     GetVectorByID(const int64_t id, uint8_t* vector, bool hybrid) override;
+#endif
 
     Status
-    ExecBinaryQuery(query::GeneralQueryPtr general_query, faiss::ConcurrentBitsetPtr bitset,
-                    std::unordered_map<std::string, DataType>& attr_type, uint64_t& nq, uint64_t& topk,
-                    std::vector<float>& distances, std::vector<int64_t>& labels) override;
-#endif
+    ExecBinaryQuery(const query::GeneralQueryPtr& general_query, bool& all_filtered) override;
+
+    Status
+    ExecDeletedIds(const std::unordered_set<int64_t>& deleted_ids) override;
 
     Status
     Search(int64_t n, const float* data, int64_t k, const milvus::json& extra_params, float* distances, int64_t* labels,
@@ -124,8 +126,12 @@ class ExecutionEngineImpl : public ExecutionEngine {
     void
     HybridUnset() const;
 
+    faiss::ConcurrentBitsetPtr
+    SearchBitset() const;
+
  protected:
     knowhere::BlacklistPtr blacklist_ = nullptr;
+    faiss::ConcurrentBitsetPtr filter_bitset_ = nullptr;  // deleted docs and filtered entities of this query only
     knowhere::VecIndexPtr index_ = nullptr;
 #ifdef MILVUS_GPU_VERSION
     knowhere::VecIndexPtr index_reserve_ = nullptr;  // reserve the cpu index before copying it to gpu
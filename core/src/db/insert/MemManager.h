@@ -15,9 +15,11 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "db/Types.h"
+#include "query/GeneralQuery.h"
 #include "utils/Status.h"
 
 namespace milvus {
@@ -33,6 +35,10 @@ class MemManager {
     InsertVectors(const std::string& collection_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                   const uint8_t* vectors, uint64_t lsn) = 0;
 
+    // insert vectors along with their attribute columns
+    virtual Status
+    InsertEntities(const std::string& collection_id, VectorsData entities, uint64_t lsn) = 0;
+
     virtual Status
     DeleteVector(const std::string& collection_id, IDNumber vector_id, uint64_t lsn) = 0;
 
@@ -52,6 +58,14 @@ class MemManager {
     virtual Status
     EraseMemVector(const std::string& collection_id) = 0;
 
+    // search the buffers not flushed yet among the entities matching general_query if any, results holds one
+    // entry per buffer searched, keyed by its file id; deleted_ids returns the deletes not applied to the flushed
+    // segments yet, the buffers are already filtered by them
+    virtual Status
+    Search(const std::set<std::string>& collection_ids, const VectorsData& vectors, uint64_t topk,
+           const query::GeneralQueryPtr& general_query, TopkResultMap& results,
+           std::unordered_set<IDNumber>& deleted_ids) = 0;
+
     virtual size_t
     GetCurrentMutableMem() = 0;
 
@@ -12,17 +12,21 @@
 #include "db/insert/MemManagerImpl.h"
 
 #include <fiu-local.h>
-#include <thread>
+#include <algorithm>
+#include <future>
+#include <utility>
 
 #include "VectorSource.h"
 #include "db/Constants.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
 
 MemTablePtr
 MemManagerImpl::GetMemByTable(const std::string& collection_id) {
+    std::unique_lock<std::mutex> lock(mutex_);
     auto memIt = mem_id_map_.find(collection_id);
     if (memIt != mem_id_map_.end()) {
         return memIt->second;
@@ -43,7 +47,7 @@ MemManagerImpl::InsertVectors(const std::string& collection_id, int64_t length,
     memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
     VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
 
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(GetCollectionMutex(collection_id));
 
     return InsertVectorsNoLock(collection_id, source, lsn);
 }
@@ -59,7 +63,16 @@ MemManagerImpl::InsertVectors(const std::string& collection_id, int64_t length,
     memcpy(vectors_data.id_array_.data(), vector_ids, length * sizeof(IDNumber));
     VectorSourcePtr source = std::make_shared<VectorSource>(vectors_data);
 
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(GetCollectionMutex(collection_id));
+
+    return InsertVectorsNoLock(collection_id, source, lsn);
+}
+
+Status
+MemManagerImpl::InsertEntities(const std::string& collection_id, VectorsData entities, uint64_t lsn) {
+    VectorSourcePtr source = std::make_shared<VectorSource>(std::move(entities));
+
+    std::unique_lock<std::mutex> lock(GetCollectionMutex(collection_id));
 
     return InsertVectorsNoLock(collection_id, source, lsn);
 }
@@ -75,7 +88,7 @@ MemManagerImpl::InsertVectorsNoLock(const std::string& collection_id, const Vect
 
 Status
 MemManagerImpl::DeleteVector(const std::string& collection_id, IDNumber vector_id, uint64_t lsn) {
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(GetCollectionMutex(collection_id));
     MemTablePtr mem = GetMemByTable(collection_id);
     mem->SetLSN(lsn);
     auto status = mem->Delete(vector_id);
@@ -85,7 +98,7 @@ MemManagerImpl::DeleteVector(const std::string& collection_id, IDNumber vector_i
 Status
 MemManagerImpl::DeleteVectors(const std::string& collection_id, int64_t length, const IDNumber* vector_ids,
                               uint64_t lsn) {
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(GetCollectionMutex(collection_id));
     MemTablePtr mem = GetMemByTable(collection_id);
     mem->SetLSN(lsn);
 
@@ -112,24 +125,31 @@ MemManagerImpl::DeleteVectors(const std::string& collection_id, int64_t length,
 Status
 MemManagerImpl::Flush(const std::string& collection_id) {
     ToImmutable(collection_id);
-    // TODO: There is actually only one memTable in the immutable list
+    // the tables stay in immutable list while serializing, so they are still searchable.
+    // the tables of other collections are left to their own flush, they may be applied up to a different lsn
+    std::unique_lock<std::mutex> lock(serialization_mtx_);
     MemList temp_immutable_list;
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        immu_mem_list_.swap(temp_immutable_list);
+        std::unique_lock<std::mutex> list_lock(mutex_);
+        for (auto& mem : immu_mem_list_) {
+            if (mem->GetTableId() == collection_id) {
+                temp_immutable_list.push_back(mem);
+            }
+        }
     }
 
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
     auto max_lsn = GetMaxLSN(temp_immutable_list);
     for (auto& mem : temp_immutable_list) {
         LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
         auto status = mem->Serialize(max_lsn, true);
         if (!status.ok()) {
             LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
+            RemoveImmutable(temp_immutable_list);
             return status;
         }
         LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
     }
+    RemoveImmutable(temp_immutable_list);
 
     return Status::OK();
 }
@@ -138,24 +158,45 @@ Status
 MemManagerImpl::Flush(std::set<std::string>& collection_ids) {
     ToImmutable();
 
+    std::unique_lock<std::mutex> lock(serialization_mtx_);
     MemList temp_immutable_list;
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        immu_mem_list_.swap(temp_immutable_list);
+        std::unique_lock<std::mutex> list_lock(mutex_);
+        temp_immutable_list = immu_mem_list_;
     }
 
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
     collection_ids.clear();
     auto max_lsn = GetMaxLSN(temp_immutable_list);
+
+    // mem tables are independent of each other, serialize them in parallel
+    std::vector<std::future<Status>> futures;
     for (auto& mem : temp_immutable_list) {
-        LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
-        auto status = mem->Serialize(max_lsn, true);
-        if (!status.ok()) {
-            LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
-            return status;
+        futures.emplace_back(serialize_thread_pool_.enqueue([mem, max_lsn]() {
+            LOG_ENGINE_DEBUG_ << "Flushing collection: " << mem->GetTableId();
+            auto status = mem->Serialize(max_lsn, true);
+            if (!status.ok()) {
+                LOG_ENGINE_ERROR_ << "Flush collection " << mem->GetTableId() << " failed";
+                return status;
+            }
+            LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
+            return Status::OK();
+        }));
+    }
+
+    Status status;
+    auto mem = temp_immutable_list.begin();
+    for (auto& future : futures) {
+        auto serialize_status = future.get();
+        if (serialize_status.ok()) {
+            collection_ids.insert((*mem)->GetTableId());
+        } else if (status.ok()) {
+            status = serialize_status;
         }
-        collection_ids.insert(mem->GetTableId());
-        LOG_ENGINE_DEBUG_ << "Flushed collection: " << mem->GetTableId();
+        ++mem;
+    }
+    RemoveImmutable(temp_immutable_list);
+    if (!status.ok()) {
+        return status;
     }
 
     meta_->SetGlobalLastLSN(max_lsn);
@@ -165,6 +206,8 @@ MemManagerImpl::Flush(std::set<std::string>& collection_ids) {
 
 Status
 MemManagerImpl::ToImmutable(const std::string& collection_id) {
+    // no insert or delete is in progress on the table once it is immutable
+    std::unique_lock<std::mutex> collection_lock(GetCollectionMutex(collection_id));
     std::unique_lock<std::mutex> lock(mutex_);
     auto memIt = mem_id_map_.find(collection_id);
     if (memIt != mem_id_map_.end()) {
@@ -182,18 +225,19 @@ MemManagerImpl::ToImmutable(const std::string& collection_id) {
 
 Status
 MemManagerImpl::ToImmutable() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    MemIdMap temp_map;
-    for (auto& kv : mem_id_map_) {
-        if (kv.second->Empty()) {
-            // empty collection without any deletes, no need to serialize
-            temp_map.insert(kv);
-        } else {
-            immu_mem_list_.push_back(kv.second);
+    // the collection lock comes before the list lock, so the tables are collected first
+    std::vector<std::string> collection_ids;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (auto& kv : mem_id_map_) {
+            collection_ids.push_back(kv.first);
         }
     }
 
-    mem_id_map_.swap(temp_map);
+    // empty collection without any deletes is kept, no need to serialize
+    for (auto& collection_id : collection_ids) {
+        ToImmutable(collection_id);
+    }
     return Status::OK();
 }
 
@@ -215,6 +259,67 @@ MemManagerImpl::EraseMemVector(const std::string& collection_id) {
     return Status::OK();
 }
 
+std::mutex&
+MemManagerImpl::GetCollectionMutex(const std::string& collection_id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return collection_mutexes_[collection_id];
+}
+
+void
+MemManagerImpl::RemoveImmutable(const MemList& tables) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto& mem : tables) {
+        immu_mem_list_.erase(std::remove(immu_mem_list_.begin(), immu_mem_list_.end(), mem), immu_mem_list_.end());
+    }
+}
+
+Status
+MemManagerImpl::Search(const std::set<std::string>& collection_ids, const VectorsData& vectors, uint64_t topk,
+                       const query::GeneralQueryPtr& general_query, TopkResultMap& results,
+                       std::unordered_set<IDNumber>& deleted_ids) {
+    // newest table first, deletes of a table only apply to the data older than it
+    std::vector<MemTable::MemTableFileList> files_list;
+    std::vector<std::unordered_set<IDNumber>> deleted_list;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        MemList tables;
+        for (auto& collection_id : collection_ids) {
+            auto iter = mem_id_map_.find(collection_id);
+            if (iter != mem_id_map_.end()) {
+                tables.push_back(iter->second);
+            }
+        }
+        for (auto iter = immu_mem_list_.rbegin(); iter != immu_mem_list_.rend(); ++iter) {
+            if (collection_ids.find((*iter)->GetTableId()) != collection_ids.end()) {
+                tables.push_back(*iter);
+            }
+        }
+
+        files_list.resize(tables.size());
+        deleted_list.resize(tables.size());
+        for (size_t i = 0; i < tables.size(); ++i) {
+            tables[i]->GetMemTableFiles(files_list[i]);
+            tables[i]->GetDeletedDocs(deleted_list[i]);
+        }
+    }
+
+    deleted_ids.clear();
+    for (size_t i = 0; i < files_list.size(); ++i) {
+        for (auto& file : files_list[i]) {
+            TopkResult result;
+            auto status = file->Search(vectors, topk, general_query, deleted_ids, result);
+            if (!status.ok()) {
+                return status;
+            }
+            // kept even if empty, the segment flushed from the buffer is then not searched again
+            results[file->GetSegmentSchema().id_] = std::move(result);
+        }
+        deleted_ids.insert(deleted_list[i].begin(), deleted_list[i].end());
+    }
+
+    return Status::OK();
+}
+
 size_t
 MemManagerImpl::GetCurrentMutableMem() {
     size_t total_mem = 0;
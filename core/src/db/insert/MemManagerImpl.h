@@ -11,13 +11,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <ctime>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "config/Config.h"
@@ -26,6 +29,7 @@
 #include "db/insert/MemTable.h"
 #include "db/meta/Meta.h"
 #include "utils/Status.h"
+#include "utils/ThreadPool.h"
 
 namespace milvus {
 namespace engine {
@@ -36,7 +40,10 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     using MemIdMap = std::map<std::string, MemTablePtr>;
     using MemList = std::vector<MemTablePtr>;
 
-    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options) : meta_(meta), options_(options) {
+    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options)
+        : meta_(meta),
+          options_(options),
+          serialize_thread_pool_(std::max<size_t>(1, std::thread::hardware_concurrency())) {
         SetIdentity("MemManagerImpl");
         AddInsertBufferSizeListener();
     }
@@ -49,6 +56,9 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     InsertVectors(const std::string& collection_id, int64_t length, const IDNumber* vector_ids, int64_t dim,
                   const uint8_t* vectors, uint64_t lsn) override;
 
+    Status
+    InsertEntities(const std::string& collection_id, VectorsData entities, uint64_t lsn) override;
+
     Status
     DeleteVector(const std::string& collection_id, IDNumber vector_id, uint64_t lsn) override;
 
@@ -67,6 +77,11 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     Status
     EraseMemVector(const std::string& collection_id) override;
 
+    Status
+    Search(const std::set<std::string>& collection_ids, const VectorsData& vectors, uint64_t topk,
+           const query::GeneralQueryPtr& general_query, TopkResultMap& results,
+           std::unordered_set<IDNumber>& deleted_ids) override;
+
     size_t
     GetCurrentMutableMem() override;
 
@@ -93,15 +108,28 @@ class MemManagerImpl : public MemManager, public server::CacheConfigHandler {
     Status
     ToImmutable(const std::string& collection_id);
 
+    void
+    RemoveImmutable(const MemList& tables);
+
     uint64_t
     GetMaxLSN(const MemList& tables);
 
+    std::mutex&
+    GetCollectionMutex(const std::string& collection_id);
+
     MemIdMap mem_id_map_;
     MemList immu_mem_list_;
     meta::MetaPtr meta_;
     DBOptions options_;
-    std::mutex mutex_;
+    std::mutex mutex_;  // guards the maps and lists only, never held while copying data into a table
     std::mutex serialization_mtx_;
+
+    // inserts and deletes of a collection are applied one at a time, different collections in parallel.
+    // a mutex is created on the first write of a collection and kept, node-based map keeps its address
+    std::unordered_map<std::string, std::mutex> collection_mutexes_;
+
+    // serialize the mem tables of a flush in parallel
+    ThreadPool serialize_thread_pool_;
 };  // NewMemManager
 
 }  // namespace engine
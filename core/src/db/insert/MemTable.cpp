@@ -47,6 +47,8 @@ MemTable::Add(const VectorSourcePtr& source) {
             MemTableFilePtr new_mem_table_file = std::make_shared<MemTableFile>(collection_id_, meta_, options_);
             status = new_mem_table_file->Add(source);
             if (status.ok()) {
+                // searches read the list concurrently
+                std::lock_guard<std::mutex> lock(mutex_);
                 mem_table_file_list_.emplace_back(new_mem_table_file);
             }
         } else {
@@ -69,6 +71,7 @@ MemTable::Delete(segment::doc_id_t doc_id) {
         table_file->Delete(doc_id);
     }
     // Add the id to delete list so it can be applied to other segments on disk during the next flush
+    std::lock_guard<std::mutex> lock(mutex_);
     doc_ids_to_delete_.insert(doc_id);
 
     return Status::OK();
@@ -81,6 +84,7 @@ MemTable::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
         table_file->Delete(doc_ids);
     }
     // Add the id to delete list so it can be applied to other segments on disk during the next flush
+    std::lock_guard<std::mutex> lock(mutex_);
     for (auto& id : doc_ids) {
         doc_ids_to_delete_.insert(id);
     }
@@ -98,6 +102,18 @@ MemTable::GetTableFileCount() {
     return mem_table_file_list_.size();
 }
 
+void
+MemTable::GetMemTableFiles(MemTableFileList& mem_table_files) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mem_table_files = mem_table_file_list_;
+}
+
+void
+MemTable::GetDeletedDocs(std::unordered_set<segment::doc_id_t>& doc_ids) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    doc_ids.insert(doc_ids_to_delete_.begin(), doc_ids_to_delete_.end());
+}
+
 Status
 MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
     TimeRecorder recorder("MemTable::Serialize collection " + collection_id_);
@@ -112,7 +128,17 @@ MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
         }
     }
 
+    // serialized files are kept in the list, so they are searchable until they are visible in meta
     meta::SegmentsSchema update_files;
+    MemTableFileList serialized_files;
+    auto erase_serialized_files = [&]() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& file : serialized_files) {
+            mem_table_file_list_.erase(std::remove(mem_table_file_list_.begin(), mem_table_file_list_.end(), file),
+                                       mem_table_file_list_.end());
+        }
+    };
+
     for (auto mem_table_file = mem_table_file_list_.begin(); mem_table_file != mem_table_file_list_.end();) {
         // For empty segment
         if ((*mem_table_file)->Empty()) {
@@ -132,21 +158,20 @@ MemTable::Serialize(uint64_t wal_lsn, bool apply_delete) {
             // mark the failed segment as to_delete so that the meta system can remove it later
             schema.file_type_ = meta::SegmentSchema::TO_DELETE;
             meta_->UpdateCollectionFile(schema);
+            erase_serialized_files();
             return status;
         }
 
         // succeed, record the segment into meta by UpdateCollectionFiles()
         update_files.push_back(schema);
+        serialized_files.push_back(*mem_table_file);
         LOG_ENGINE_DEBUG_ << "Flushed segment " << (*mem_table_file)->GetSegmentId();
-
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            mem_table_file = mem_table_file_list_.erase(mem_table_file);
-        }
+        ++mem_table_file;
     }
 
     // Update meta files and flush lsn
     auto status = meta_->UpdateCollectionFiles(update_files);
+    erase_serialized_files();
     if (!status.ok()) {
         return status;
     }
@@ -196,9 +221,8 @@ MemTable::ApplyDeletes() {
     //     Load its uids and deleted docs file
     //     Scan the uids, if any un-deleted uid in segment's delete list
     //         add its offset to deletedDoc
-    //         remove the id from bloom filter
     //     Serialize segment's deletedDoc
-    //     Serialize bloom filter
+    //     Rebuild bloom filter without the deleted ids and serialize it
 
     LOG_ENGINE_DEBUG_ << "Applying " << doc_ids_to_delete_.size() << " deletes in collection: " << collection_id_;
 
@@ -219,6 +243,9 @@ MemTable::ApplyDeletes() {
 
     meta::SegmentsSchema files_to_update;
 
+    std::vector<segment::doc_id_t> ids_to_delete(doc_ids_to_delete_.begin(), doc_ids_to_delete_.end());
+    std::vector<uint8_t> maybe_present(ids_to_delete.size());
+
     for (auto& file : files) {
         LOG_ENGINE_DEBUG_ << "Applying deletes in segment: " << file.segment_id_;
 
@@ -282,9 +309,10 @@ MemTable::ApplyDeletes() {
         }
 
         // check ids by bloom filter
-        for (auto& id : doc_ids_to_delete_) {
-            if (id_bloom_filter_ptr->Check(id)) {
-                ids_to_check.emplace_back(id);
+        id_bloom_filter_ptr->CheckMany(ids_to_delete.data(), ids_to_delete.size(), maybe_present.data());
+        for (size_t i = 0; i < ids_to_delete.size(); ++i) {
+            if (maybe_present[i]) {
+                ids_to_check.emplace_back(ids_to_delete[i]);
             }
         }
 
@@ -296,45 +324,30 @@ MemTable::ApplyDeletes() {
             continue;
         }
 
-        // Load its uids and deleted docs file
-        if (uids_ptr == nullptr && !(status = LoadUid()).ok()) {
+        // Load its uid index and deleted docs file
+        segment::UidIndexPtr uid_index_ptr = nullptr;
+        if (!(status = segment_reader.LoadUidIndex(uid_index_ptr)).ok()) {
             return status;
         }
         if (deleted_docs_ptr == nullptr && !(status = LoadDeleteDoc()).ok()) {
             return status;
         }
-        auto& deleted_docs = deleted_docs_ptr->GetMutableDeletedDocs();
 
-        rec.RecordSection("load uids and deleted docs");
-
-        // sort ids_to_check
-        bool ids_sorted = false;
-        if (ids_to_check.size() >= 64) {
-            std::sort(ids_to_check.begin(), ids_to_check.end());
-            ids_sorted = true;
-            rec.RecordSection("Sorting " + std::to_string(ids_to_check.size()) + " ids");
-        }
+        rec.RecordSection("load uid index and deleted docs");
 
         // for each id
         int64_t segment_deleted_count = 0;
-        for (size_t i = 0; i < uids_ptr->size(); ++i) {
-            if (std::find(deleted_docs.begin(), deleted_docs.end(), i) != deleted_docs.end()) {
-                continue;
-            }
-            if (ids_sorted) {
-                if (!std::binary_search(ids_to_check.begin(), ids_to_check.end(), (*uids_ptr)[i])) {
-                    continue;
-                }
-            } else {
-                if (std::find(ids_to_check.begin(), ids_to_check.end(), (*uids_ptr)[i]) == ids_to_check.end()) {
+        for (auto& id : ids_to_check) {
+            auto offsets = uid_index_ptr->Find(id);
+            for (auto iter = offsets.first; iter != offsets.second; ++iter) {
+                if (deleted_docs_ptr->IsDeleted(*iter)) {
                     continue;
                 }
-            }
 
-            // delete
-            id_bloom_filter_ptr->Remove((*uids_ptr)[i]);
-            deleted_docs.push_back(i);
-            segment_deleted_count++;
+                // delete
+                deleted_docs_ptr->AddDeletedDoc(*iter);
+                segment_deleted_count++;
+            }
         }
 
         rec.RecordSection("Find uids and set deleted docs and bloom filter, append " +
@@ -355,7 +368,15 @@ MemTable::ApplyDeletes() {
 
         rec.RecordSection("Updated deleted docs");
 
-        status = segment_writer.WriteBloomFilter(id_bloom_filter_ptr);
+        // bits can't be removed from a bloom filter, build a new one from the ids left in the segment
+        if (uids_ptr == nullptr && !(status = LoadUid()).ok()) {
+            return status;
+        }
+        segment::IdBloomFilterPtr new_bloom_filter_ptr;
+        codec::DefaultCodec default_codec;
+        default_codec.GetIdBloomFilterFormat()->create(uids_ptr->size(), new_bloom_filter_ptr);
+        new_bloom_filter_ptr->Add(*uids_ptr, deleted_docs_ptr->GetMutableDeletedDocs());
+        status = segment_writer.WriteBloomFilter(new_bloom_filter_ptr);
         if (!status.ok()) {
             break;
         }
@@ -385,7 +406,10 @@ MemTable::ApplyDeletes() {
         return Status(DB_ERROR, err_msg);
     }
 
-    doc_ids_to_delete_.clear();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        doc_ids_to_delete_.clear();
+    }
 
     recorder.RecordSection("Update deletes to meta");
     recorder.ElapseFromBegin("Finished deletes");
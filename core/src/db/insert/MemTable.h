@@ -16,6 +16,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "config/handler/CacheConfigHandler.h"
@@ -47,6 +48,12 @@ class MemTable : public server::CacheConfigHandler {
     size_t
     GetTableFileCount();
 
+    void
+    GetMemTableFiles(MemTableFileList& mem_table_files);
+
+    void
+    GetDeletedDocs(std::unordered_set<segment::doc_id_t>& doc_ids);
+
     Status
     Serialize(uint64_t wal_lsn, bool apply_delete = true);
 
@@ -11,6 +11,10 @@
 
 #include "db/insert/MemTableFile.h"
 
+#include <faiss/utils/BinaryDistance.h>
+#include <faiss/utils/ConcurrentBitset.h>
+#include <faiss/utils/distances.h>
+
 #include <algorithm>
 #include <cmath>
 #include <iterator>
@@ -21,6 +25,7 @@
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
+#include "query/AttrFilter.h"
 #include "segment/SegmentReader.h"
 #include "utils/Log.h"
 #include "utils/ValidationUtil.h"
@@ -69,7 +74,8 @@ MemTableFile::Add(const VectorSourcePtr& source) {
         return Status(DB_ERROR, "Not able to create collection file");
     }
 
-    size_t single_vector_mem_size = source->SingleVectorSize(table_file_schema_.dimension_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t single_vector_mem_size = source->SingleVectorSize(table_file_schema_.dimension_) + source->SingleAttrsSize();
     size_t mem_left = GetMemLeft();
     if (mem_left >= single_vector_mem_size) {
         size_t num_vectors_to_add = std::ceil(mem_left / single_vector_mem_size);
@@ -87,10 +93,11 @@ MemTableFile::Add(const VectorSourcePtr& source) {
 
 Status
 MemTableFile::Delete(segment::doc_id_t doc_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
     segment::SegmentPtr segment_ptr;
     segment_writer_ptr_->GetSegment(segment_ptr);
     // Check wither the doc_id is present, if yes, delete it's corresponding buffer
-    auto uids = segment_ptr->vectors_ptr_->GetUids();
+    auto& uids = segment_ptr->vectors_ptr_->GetUids();
     auto found = std::find(uids.begin(), uids.end(), doc_id);
     if (found != uids.end()) {
         auto offset = std::distance(uids.begin(), found);
@@ -102,6 +109,7 @@ MemTableFile::Delete(segment::doc_id_t doc_id) {
 
 Status
 MemTableFile::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
+    std::lock_guard<std::mutex> lock(mutex_);
     segment::SegmentPtr segment_ptr;
     segment_writer_ptr_->GetSegment(segment_ptr);
 
@@ -113,26 +121,15 @@ MemTableFile::Delete(const std::vector<segment::doc_id_t>& doc_ids) {
 
     std::sort(temp.begin(), temp.end());
 
-    auto uids = segment_ptr->vectors_ptr_->GetUids();
-
-    size_t deleted = 0;
-    size_t loop = uids.size();
-    for (size_t i = 0; i < loop; ++i) {
+    // erase all found offsets in one pass instead of shifting the buffer for each of them
+    auto& uids = segment_ptr->vectors_ptr_->GetUids();
+    std::vector<segment::offset_t> offsets;
+    for (size_t i = 0; i < uids.size(); ++i) {
         if (std::binary_search(temp.begin(), temp.end(), uids[i])) {
-            segment_ptr->vectors_ptr_->Erase(i - deleted);
-            ++deleted;
+            offsets.push_back(i);
         }
     }
-    /*
-    for (auto& doc_id : doc_ids) {
-        auto found = std::find(uids.begin(), uids.end(), doc_id);
-        if (found != uids.end()) {
-            auto offset = std::distance(uids.begin(), found);
-            segment_ptr->vectors_ptr_->Erase(offset);
-            uids = segment_ptr->vectors_ptr_->GetUids();
-        }
-    }
-    */
+    segment_ptr->vectors_ptr_->Erase(offsets);
 
     return Status::OK();
 }
@@ -217,6 +214,125 @@ MemTableFile::Serialize(uint64_t wal_lsn) {
     return status;
 }
 
+Status
+MemTableFile::Search(const VectorsData& vectors, uint64_t topk, const query::GeneralQueryPtr& general_query,
+                     const std::unordered_set<segment::doc_id_t>& deleted_ids, TopkResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    result.k_ = 0;
+    if (segment_writer_ptr_ == nullptr) {
+        return Status::OK();
+    }
+
+    segment::SegmentPtr segment_ptr;
+    segment_writer_ptr_->GetSegment(segment_ptr);
+    auto& uids = segment_ptr->vectors_ptr_->GetUids();
+    auto& data = segment_ptr->vectors_ptr_->GetData();
+    size_t nq = vectors.vector_count_;
+    size_t count = uids.size();
+    if (nq == 0 || topk == 0 || count == 0) {
+        return Status::OK();
+    }
+
+    auto metric_type = static_cast<MetricType>(table_file_schema_.metric_type_);
+    size_t dim = table_file_schema_.dimension_;
+    bool is_binary = utils::IsBinaryMetricType(table_file_schema_.metric_type_);
+    if ((is_binary && vectors.binary_data_.size() != nq * dim / 8) ||
+        (!is_binary && vectors.float_data_.size() != nq * dim)) {
+        return Status(DB_ERROR, "Query vectors mismatch with collection " + collection_id_);
+    }
+
+    // deleted vectors and the entities not matching general_query are filtered out by bitset
+    faiss::ConcurrentBitsetPtr bitset = nullptr;
+    if (general_query != nullptr) {
+        auto& attrs = *segment_ptr->attrs_ptr_;
+        auto zone_map_result = query::CheckZoneMaps(general_query, attrs, count);
+        if (zone_map_result == query::ZoneMapResult::NONE) {
+            return Status::OK();
+        }
+        if (zone_map_result == query::ZoneMapResult::SOME) {
+            bitset = std::make_shared<faiss::ConcurrentBitset>(count);
+            auto status = query::FilterAttrs(general_query, attrs, *bitset);
+            if (!status.ok()) {
+                return status;
+            }
+        }
+    }
+    if (!deleted_ids.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            if (deleted_ids.find(uids[i]) != deleted_ids.end()) {
+                if (bitset == nullptr) {
+                    bitset = std::make_shared<faiss::ConcurrentBitset>(count);
+                }
+                bitset->set(i);
+            }
+        }
+    }
+
+    result.ids_.resize(nq * topk);
+    result.distances_.resize(nq * topk);
+    int64_t* ids = result.ids_.data();
+    float* distances = result.distances_.data();
+    switch (metric_type) {
+        case MetricType::L2: {
+            faiss::float_maxheap_array_t res = {nq, topk, ids, distances};
+            faiss::knn_L2sqr(vectors.float_data_.data(), reinterpret_cast<const float*>(data.data()), dim, nq, count,
+                             &res, bitset);
+            break;
+        }
+        case MetricType::IP: {
+            faiss::float_minheap_array_t res = {nq, topk, ids, distances};
+            faiss::knn_inner_product(vectors.float_data_.data(), reinterpret_cast<const float*>(data.data()), dim,
+                                     nq, count, &res, bitset);
+            break;
+        }
+        case MetricType::HAMMING: {
+            std::vector<int32_t> int_distances(nq * topk);
+            faiss::int_maxheap_array_t res = {nq, topk, ids, int_distances.data()};
+            faiss::binary_distance_knn_hc(faiss::METRIC_Hamming, &res, vectors.binary_data_.data(), data.data(), count,
+                                          dim / 8, bitset);
+            for (size_t i = 0; i < nq * topk; ++i) {
+                distances[i] = static_cast<float>(int_distances[i]);
+            }
+            break;
+        }
+        case MetricType::JACCARD:
+        case MetricType::TANIMOTO: {
+            faiss::float_maxheap_array_t res = {nq, topk, ids, distances};
+            faiss::binary_distance_knn_hc(faiss::METRIC_Jaccard, &res, vectors.binary_data_.data(), data.data(), count,
+                                          dim / 8, bitset);
+            if (metric_type == MetricType::TANIMOTO) {
+                for (size_t i = 0; i < nq * topk; ++i) {
+                    if (ids[i] >= 0) {
+                        distances[i] = faiss::Jaccard_2_Tanimoto(distances[i]);
+                    }
+                }
+            }
+            break;
+        }
+        case MetricType::SUBSTRUCTURE:
+        case MetricType::SUPERSTRUCTURE: {
+            auto faiss_metric =
+                (metric_type == MetricType::SUBSTRUCTURE) ? faiss::METRIC_Substructure : faiss::METRIC_Superstructure;
+            faiss::binary_distance_knn_mc(faiss_metric, vectors.binary_data_.data(), data.data(), nq, count, topk,
+                                          dim / 8, distances, ids, bitset);
+            break;
+        }
+        default:
+            return Status(DB_ERROR, "Unsupported metric type");
+    }
+
+    // convert offsets to user ids
+    for (auto& id : result.ids_) {
+        if (id >= 0) {
+            id = uids[id];
+        }
+    }
+    result.k_ = std::min(static_cast<size_t>(topk), count);
+    result.ascending_ = (metric_type != MetricType::IP);
+
+    return Status::OK();
+}
+
 const std::string&
 MemTableFile::GetSegmentId() const {
     return table_file_schema_.segment_id_;
@@ -12,13 +12,16 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "config/handler/CacheConfigHandler.h"
 #include "db/engine/ExecutionEngine.h"
 #include "db/insert/VectorSource.h"
 #include "db/meta/Meta.h"
+#include "query/GeneralQuery.h"
 #include "segment/SegmentWriter.h"
 #include "utils/Status.h"
 
@@ -56,6 +59,14 @@ class MemTableFile : public server::CacheConfigHandler {
     Status
     Serialize(uint64_t wal_lsn);
 
+    /*
+     * Brute-force search the vectors not flushed yet, vectors in deleted_ids are skipped;
+     * Result ids are user ids, each query has topk results, padded with -1 if not enough;
+     */
+    Status
+    Search(const VectorsData& vectors, uint64_t topk, const query::GeneralQueryPtr& general_query,
+           const std::unordered_set<segment::doc_id_t>& deleted_ids, TopkResult& result);
+
     const std::string&
     GetSegmentId() const;
 
@@ -76,6 +87,7 @@ class MemTableFile : public server::CacheConfigHandler {
     meta::MetaPtr meta_;
     DBOptions options_;
     size_t current_mem_;
+    std::mutex mutex_;  // protect the buffer from being modified while searching
 
     //    ExecutionEnginePtr execution_engine_;
     segment::SegmentWriterPtr segment_writer_ptr_;
@@ -50,7 +50,17 @@ VectorSource::Add(const segment::SegmentWriterPtr& segment_writer_ptr, const met
         }
     }
 
+    // attributes go first, they are aligned to the rows of the segment before the vectors are added
     Status status;
+    if (!vectors_.attr_data_.empty()) {
+        status = segment_writer_ptr->AddAttrs(vectors_.attr_types_, vectors_.attr_data_, current_num_vectors_added,
+                                              num_vectors_added);
+        if (!status.ok()) {
+            LOG_ENGINE_ERROR_ << LogOut("[%s][%ld]", "insert", 0) << "Insert attributes fail: " << status.message();
+            return status;
+        }
+    }
+
     if (!vectors_.float_data_.empty()) {
         LOG_ENGINE_DEBUG_ << LogOut("[%s][%ld]", "insert", 0) << "Insert float data into segment";
         auto size = num_vectors_added * table_file_schema.dimension_ * sizeof(float);
@@ -94,6 +104,15 @@ VectorSource::SingleVectorSize(uint16_t dimension) {
     return 0;
 }
 
+size_t
+VectorSource::SingleAttrsSize() {
+    size_t size = 0;
+    for (auto& pair : vectors_.attr_types_) {
+        size += segment::Attr::DataTypeSize(pair.second);
+    }
+    return size;
+}
+
 bool
 VectorSource::AllAdded() {
     return (current_num_vectors_added == vectors_.vector_count_);
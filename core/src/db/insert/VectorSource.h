@@ -41,6 +41,9 @@ class VectorSource {
     size_t
     SingleVectorSize(uint16_t dimension);
 
+    size_t
+    SingleAttrsSize();
+
     bool
     AllAdded();
 
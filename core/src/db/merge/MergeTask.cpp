@@ -102,7 +102,9 @@ MergeTask::Execute() {
 
     // step 4: update collection files state
     // if index type isn't IDMAP, set file type to TO_INDEX if file size exceed index_file_size
-    // else set file type to RAW, no need to build index
+    // else set file type to RAW, no need to build index.
+    // the merged index is built from scratch: every segment trains its own quantizer, so the inverted lists of
+    // two segments can't be appended, only a compacted segment keeps its index
     if (!utils::IsRawIndexType(collection_file.engine_type_)) {
         collection_file.file_type_ = (segment_writer_ptr->Size() >= (size_t)(collection_file.index_file_size_))
                                          ? meta::SegmentSchema::TO_INDEX
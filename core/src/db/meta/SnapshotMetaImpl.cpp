@@ -0,0 +1,463 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/meta/SnapshotMetaImpl.h"
+#include "utils/Log.h"
+
+#include <fiu-local.h>
+#include <utility>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+namespace {
+
+bool
+IsSearchableFile(const SegmentSchema& file) {
+    return file.file_type_ == SegmentSchema::RAW || file.file_type_ == SegmentSchema::TO_INDEX ||
+           file.file_type_ == SegmentSchema::INDEX;
+}
+
+}  // namespace
+
+SnapshotMetaImpl::SnapshotMetaImpl(const MetaPtr& meta) : meta_(meta) {
+}
+
+Status
+SnapshotMetaImpl::GetCollectionSnapshot(const std::string& collection_id, CollectionSnapshotPtr& snapshot) {
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = snapshots_.find(collection_id);
+        if (iter != snapshots_.end()) {
+            snapshot = iter->second;
+            return Status::OK();
+        }
+        version = version_;
+    }
+
+    // no snapshot yet, load it from sql without holding the lock
+    auto new_snapshot = std::make_shared<CollectionSnapshot>();
+    new_snapshot->version_ = version;
+    new_snapshot->collection_id_ = collection_id;
+    auto status = LoadCollectionSnapshot(collection_id, *new_snapshot);
+    fiu_do_on("SnapshotMetaImpl.GetCollectionSnapshot.load_fail", status = Status(DB_ERROR, ""));
+    if (!status.ok()) {
+        return status;
+    }
+
+    {
+        // meta changed during loading, the snapshot is only good for this caller
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            PublishNoLock(collection_id, new_snapshot);
+        }
+    }
+
+    snapshot = new_snapshot;
+    return Status::OK();
+}
+
+uint64_t
+SnapshotMetaImpl::SnapshotVersion() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+}
+
+Status
+SnapshotMetaImpl::LoadCollectionSnapshot(const std::string& collection_id, CollectionSnapshot& snapshot) {
+    // the sql meta marks the files together with reading them, no clean up comes in between
+    auto& files_holder = snapshot.files_holder_;
+    auto status = meta_->FilesToSearch(collection_id, files_holder);
+    if (!status.ok()) {
+        return status;
+    }
+
+    status = meta_->ShowPartitions(collection_id, snapshot.partitions_);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (!snapshot.partitions_.empty()) {
+        std::set<std::string> partition_ids;
+        for (auto& partition : snapshot.partitions_) {
+            partition_ids.insert(partition.collection_id_);
+        }
+        status = meta_->FilesToSearchEx(collection_id, partition_ids, files_holder);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    snapshot.files_[collection_id];
+    for (auto& partition : snapshot.partitions_) {
+        snapshot.files_[partition.collection_id_];
+    }
+    for (auto& file : files_holder.HoldFiles()) {
+        snapshot.files_[file.collection_id_].push_back(file);
+    }
+
+    LOG_ENGINE_DEBUG_ << "Load snapshot of collection " << collection_id << ": " << snapshot.partitions_.size()
+                      << " partitions, " << files_holder.HoldFiles().size() << " files";
+    return Status::OK();
+}
+
+void
+SnapshotMetaImpl::Refresh(const std::set<std::string>& collection_ids) {
+    std::lock_guard<std::mutex> refresh_lock(refresh_mutex_);
+    std::set<std::string> root_ids;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++version_;
+        for (auto& collection_id : collection_ids) {
+            // the snapshots not used yet are loaded on first use
+            auto root_id = RootIdNoLock(collection_id);
+            if (snapshots_.find(root_id) != snapshots_.end()) {
+                root_ids.insert(root_id);
+            }
+        }
+    }
+
+    // the old snapshot stays published until the new one is loaded, readers never wait for sql
+    for (auto& root_id : root_ids) {
+        auto new_snapshot = std::make_shared<CollectionSnapshot>();
+        new_snapshot->collection_id_ = root_id;
+        auto status = LoadCollectionSnapshot(root_id, *new_snapshot);
+        fiu_do_on("SnapshotMetaImpl.Refresh.load_fail", status = Status(DB_ERROR, ""));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        EraseNoLock(root_id);
+        if (!status.ok()) {
+            LOG_ENGINE_WARNING_ << "Failed to refresh snapshot of collection " << root_id << ": " << status.message();
+            continue;
+        }
+        new_snapshot->version_ = version_;
+        PublishNoLock(root_id, new_snapshot);
+    }
+}
+
+void
+SnapshotMetaImpl::Refresh(const std::string& collection_id) {
+    Refresh(std::set<std::string>{collection_id});
+}
+
+void
+SnapshotMetaImpl::Refresh(const SegmentsSchema& files) {
+    std::set<std::string> collection_ids;
+    for (auto& file : files) {
+        collection_ids.insert(file.collection_id_);
+    }
+    Refresh(collection_ids);
+}
+
+void
+SnapshotMetaImpl::RefreshAll() {
+    std::set<std::string> collection_ids;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& pair : snapshots_) {
+            collection_ids.insert(pair.first);
+        }
+    }
+    Refresh(collection_ids);
+}
+
+void
+SnapshotMetaImpl::Invalidate(const std::string& collection_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    EraseNoLock(RootIdNoLock(collection_id));
+}
+
+void
+SnapshotMetaImpl::InvalidateAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    snapshots_.clear();
+    partition_roots_.clear();
+}
+
+void
+SnapshotMetaImpl::PublishNoLock(const std::string& root_id, const std::shared_ptr<CollectionSnapshot>& snapshot) {
+    snapshots_[root_id] = snapshot;
+    for (auto& partition : snapshot->partitions_) {
+        partition_roots_[partition.collection_id_] = root_id;
+    }
+}
+
+void
+SnapshotMetaImpl::EraseNoLock(const std::string& root_id) {
+    auto iter = snapshots_.find(root_id);
+    if (iter == snapshots_.end()) {
+        return;
+    }
+    for (auto& partition : iter->second->partitions_) {
+        partition_roots_.erase(partition.collection_id_);
+    }
+    snapshots_.erase(iter);
+}
+
+std::string
+SnapshotMetaImpl::RootIdNoLock(const std::string& collection_id) {
+    auto iter = partition_roots_.find(collection_id);
+    if (iter != partition_roots_.end()) {
+        return iter->second;
+    }
+    return collection_id;
+}
+
+Status
+SnapshotMetaImpl::CreateCollection(CollectionSchema& collection_schema) {
+    auto status = meta_->CreateCollection(collection_schema);
+    Invalidate(collection_schema.collection_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeCollection(CollectionSchema& collection_schema) {
+    return meta_->DescribeCollection(collection_schema);
+}
+
+Status
+SnapshotMetaImpl::HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root) {
+    return meta_->HasCollection(collection_id, has_or_not, is_root);
+}
+
+Status
+SnapshotMetaImpl::AllCollections(std::vector<CollectionSchema>& collection_schema_array, bool is_root) {
+    return meta_->AllCollections(collection_schema_array, is_root);
+}
+
+Status
+SnapshotMetaImpl::DropCollections(const std::vector<std::string>& collection_id_array) {
+    auto status = meta_->DropCollections(collection_id_array);
+    for (auto& collection_id : collection_id_array) {
+        Invalidate(collection_id);
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) {
+    auto status = meta_->DeleteCollectionFiles(collection_id_array);
+    for (auto& collection_id : collection_id_array) {
+        Invalidate(collection_id);
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreateCollectionFile(SegmentSchema& file_schema) {
+    auto status = meta_->CreateCollectionFile(file_schema);
+    if (IsSearchableFile(file_schema)) {
+        Refresh(file_schema.collection_id_);
+    }
+    return status;
+}
+
+Status
+SnapshotMetaImpl::GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                                     FilesHolder& files_holder) {
+    return meta_->GetCollectionFiles(collection_id, ids, files_holder);
+}
+
+Status
+SnapshotMetaImpl::GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) {
+    return meta_->GetCollectionFilesBySegmentId(segment_id, files_holder);
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) {
+    auto status = meta_->UpdateCollectionIndex(collection_id, index);
+    Refresh(collection_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFlag(const std::string& collection_id, int64_t flag) {
+    return meta_->UpdateCollectionFlag(collection_id, flag);
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) {
+    return meta_->UpdateCollectionFlushLSN(collection_id, flush_lsn);
+}
+
+Status
+SnapshotMetaImpl::GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) {
+    return meta_->GetCollectionFlushLSN(collection_id, flush_lsn);
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFile(SegmentSchema& file_schema) {
+    auto status = meta_->UpdateCollectionFile(file_schema);
+    Refresh(file_schema.collection_id_);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFilesToIndex(const std::string& collection_id) {
+    auto status = meta_->UpdateCollectionFilesToIndex(collection_id);
+    Refresh(collection_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFiles(SegmentsSchema& files) {
+    auto status = meta_->UpdateCollectionFiles(files);
+    Refresh(files);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::UpdateCollectionFilesRowCount(SegmentsSchema& files) {
+    auto status = meta_->UpdateCollectionFilesRowCount(files);
+    Refresh(files);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) {
+    return meta_->DescribeCollectionIndex(collection_id, index);
+}
+
+Status
+SnapshotMetaImpl::DropCollectionIndex(const std::string& collection_id) {
+    auto status = meta_->DropCollectionIndex(collection_id);
+    Refresh(collection_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CreatePartition(const std::string& collection_id, const std::string& partition_name,
+                                  const std::string& tag, uint64_t lsn) {
+    auto status = meta_->CreatePartition(collection_id, partition_name, tag, lsn);
+    Refresh(collection_id);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) {
+    return meta_->HasPartition(collection_id, tag, has_or_not);
+}
+
+Status
+SnapshotMetaImpl::DropPartition(const std::string& partition_name) {
+    auto status = meta_->DropPartition(partition_name);
+    Refresh(partition_name);
+    return status;
+}
+
+Status
+SnapshotMetaImpl::ShowPartitions(const std::string& collection_id,
+                                 std::vector<meta::CollectionSchema>& partition_schema_array) {
+    return meta_->ShowPartitions(collection_id, partition_schema_array);
+}
+
+Status
+SnapshotMetaImpl::CountPartitions(const std::string& collection_id, int64_t& partition_count) {
+    return meta_->CountPartitions(collection_id, partition_count);
+}
+
+Status
+SnapshotMetaImpl::GetPartitionName(const std::string& collection_id, const std::string& tag,
+                                   std::string& partition_name) {
+    return meta_->GetPartitionName(collection_id, tag, partition_name);
+}
+
+Status
+SnapshotMetaImpl::FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) {
+    return meta_->FilesToSearch(collection_id, files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                                  FilesHolder& files_holder) {
+    return meta_->FilesToSearchEx(root_collection, partition_id_array, files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) {
+    return meta_->FilesToMerge(collection_id, files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesToIndex(FilesHolder& files_holder) {
+    return meta_->FilesToIndex(files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                              FilesHolder& files_holder) {
+    return meta_->FilesByType(collection_id, file_types, files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections,
+                                const std::vector<int>& file_types, FilesHolder& files_holder) {
+    return meta_->FilesByTypeEx(collections, file_types, files_holder);
+}
+
+Status
+SnapshotMetaImpl::FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) {
+    return meta_->FilesByID(ids, files_holder);
+}
+
+Status
+SnapshotMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+SnapshotMetaImpl::Archive() {
+    auto status = meta_->Archive();
+    RefreshAll();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::CleanUpShadowFiles() {
+    // shadow files are never searchable
+    return meta_->CleanUpShadowFiles();
+}
+
+Status
+SnapshotMetaImpl::CleanUpFilesWithTTL(uint64_t seconds) {
+    // only to-delete files and collections are removed, the files of snapshots still in use are pinned
+    return meta_->CleanUpFilesWithTTL(seconds);
+}
+
+Status
+SnapshotMetaImpl::DropAll() {
+    auto status = meta_->DropAll();
+    InvalidateAll();
+    return status;
+}
+
+Status
+SnapshotMetaImpl::Count(const std::string& collection_id, uint64_t& result) {
+    return meta_->Count(collection_id, result);
+}
+
+Status
+SnapshotMetaImpl::SetGlobalLastLSN(uint64_t lsn) {
+    return meta_->SetGlobalLastLSN(lsn);
+}
+
+Status
+SnapshotMetaImpl::GetGlobalLastLSN(uint64_t& lsn) {
+    return meta_->GetGlobalLastLSN(lsn);
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,222 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Meta.h"
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+// immutable view of the searchable files of a root collection and all its partitions,
+// never modified after publish, readers hold it by shared pointer as long as they need
+struct CollectionSnapshot {
+    uint64_t version_ = 0;
+    std::string collection_id_;
+    std::vector<CollectionSchema> partitions_;
+    std::unordered_map<std::string, SegmentsSchema> files_;  // collection/partition id mapping to to-search files
+    FilesHolder files_holder_;  // pins the files against TTL clean up until the last reader releases the snapshot
+};
+
+using CollectionSnapshotPtr = std::shared_ptr<const CollectionSnapshot>;
+
+// decorator of the sql meta, keeps copy-on-write snapshots of to-search files in memory,
+// every meta modification passing through it rebuilds the snapshots it affects before returning
+class SnapshotMetaImpl : public Meta {
+ public:
+    explicit SnapshotMetaImpl(const MetaPtr& meta);
+
+    Status
+    GetCollectionSnapshot(const std::string& collection_id, CollectionSnapshotPtr& snapshot);
+
+    uint64_t
+    SnapshotVersion();
+
+    Status
+    CreateCollection(CollectionSchema& collection_schema) override;
+
+    Status
+    DescribeCollection(CollectionSchema& collection_schema) override;
+
+    Status
+    HasCollection(const std::string& collection_id, bool& has_or_not, bool is_root = false) override;
+
+    Status
+    AllCollections(std::vector<CollectionSchema>& collection_schema_array, bool is_root = false) override;
+
+    Status
+    DropCollections(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    DeleteCollectionFiles(const std::vector<std::string>& collection_id_array) override;
+
+    Status
+    CreateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    GetCollectionFiles(const std::string& collection_id, const std::vector<size_t>& ids,
+                       FilesHolder& files_holder) override;
+
+    Status
+    GetCollectionFilesBySegmentId(const std::string& segment_id, FilesHolder& files_holder) override;
+
+    Status
+    UpdateCollectionIndex(const std::string& collection_id, const CollectionIndex& index) override;
+
+    Status
+    UpdateCollectionFlag(const std::string& collection_id, int64_t flag) override;
+
+    Status
+    UpdateCollectionFlushLSN(const std::string& collection_id, uint64_t flush_lsn) override;
+
+    Status
+    GetCollectionFlushLSN(const std::string& collection_id, uint64_t& flush_lsn) override;
+
+    Status
+    UpdateCollectionFile(SegmentSchema& file_schema) override;
+
+    Status
+    UpdateCollectionFilesToIndex(const std::string& collection_id) override;
+
+    Status
+    UpdateCollectionFiles(SegmentsSchema& files) override;
+
+    Status
+    UpdateCollectionFilesRowCount(SegmentsSchema& files) override;
+
+    Status
+    DescribeCollectionIndex(const std::string& collection_id, CollectionIndex& index) override;
+
+    Status
+    DropCollectionIndex(const std::string& collection_id) override;
+
+    Status
+    CreatePartition(const std::string& collection_id, const std::string& partition_name, const std::string& tag,
+                    uint64_t lsn) override;
+
+    Status
+    HasPartition(const std::string& collection_id, const std::string& tag, bool& has_or_not) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& collection_id,
+                   std::vector<meta::CollectionSchema>& partition_schema_array) override;
+
+    Status
+    CountPartitions(const std::string& collection_id, int64_t& partition_count) override;
+
+    Status
+    GetPartitionName(const std::string& collection_id, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToSearchEx(const std::string& root_collection, const std::set<std::string>& partition_id_array,
+                    FilesHolder& files_holder) override;
+
+    Status
+    FilesToMerge(const std::string& collection_id, FilesHolder& files_holder) override;
+
+    Status
+    FilesToIndex(FilesHolder& files_holder) override;
+
+    Status
+    FilesByType(const std::string& collection_id, const std::vector<int>& file_types,
+                FilesHolder& files_holder) override;
+
+    Status
+    FilesByTypeEx(const std::vector<meta::CollectionSchema>& collections, const std::vector<int>& file_types,
+                  FilesHolder& files_holder) override;
+
+    Status
+    FilesByID(const std::vector<size_t>& ids, FilesHolder& files_holder) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds /*, CleanUpFilter* filter = nullptr*/) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& collection_id, uint64_t& result) override;
+
+    Status
+    SetGlobalLastLSN(uint64_t lsn) override;
+
+    Status
+    GetGlobalLastLSN(uint64_t& lsn) override;
+
+ private:
+    Status
+    LoadCollectionSnapshot(const std::string& collection_id, CollectionSnapshot& snapshot);
+
+    void
+    Refresh(const std::set<std::string>& collection_ids);
+
+    void
+    Refresh(const std::string& collection_id);
+
+    void
+    Refresh(const SegmentsSchema& files);
+
+    void
+    RefreshAll();
+
+    void
+    Invalidate(const std::string& collection_id);
+
+    void
+    InvalidateAll();
+
+    void
+    PublishNoLock(const std::string& root_id, const std::shared_ptr<CollectionSnapshot>& snapshot);
+
+    void
+    EraseNoLock(const std::string& root_id);
+
+    std::string
+    RootIdNoLock(const std::string& collection_id);
+
+ private:
+    MetaPtr meta_;
+
+    std::mutex refresh_mutex_;  // snapshots are rebuilt one after another, the last one published is the latest
+    std::mutex mutex_;
+    uint64_t version_ = 0;  // increased by every meta modification
+    std::unordered_map<std::string, CollectionSnapshotPtr> snapshots_;  // root collection id mapping to snapshot
+    std::unordered_map<std::string, std::string> partition_roots_;      // partition id mapping to root collection id
+};
+
+using SnapshotMetaImplPtr = std::shared_ptr<SnapshotMetaImpl>;
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -11,7 +11,9 @@
 
 #include "db/wal/WalBuffer.h"
 
+#include <fiu-local.h>
 #include <cstring>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -39,7 +41,11 @@ ParserLsn(uint64_t lsn, uint32_t& file_no, uint32_t& offset) {
 }
 
 MXLogBuffer::MXLogBuffer(const std::string& mxlog_path, const uint32_t buffer_size)
-    : mxlog_buffer_size_(buffer_size * UNIT_MB), mxlog_writer_(mxlog_path) {
+    : mxlog_buffer_size_(buffer_size * UNIT_MB),
+      reserved_lsn_(0),
+      committed_lsn_(0),
+      written_lsn_(0),
+      mxlog_writer_(mxlog_path) {
 }
 
 MXLogBuffer::~MXLogBuffer() {
@@ -147,6 +153,7 @@ MXLogBuffer::Init(uint64_t start_lsn, uint64_t end_lsn) {
     }
 
     SetFileNoFrom(mxlog_buffer_reader_.file_no);
+    ResetWritePos();
 
     return true;
 }
@@ -155,6 +162,8 @@ void
 MXLogBuffer::Reset(uint64_t lsn) {
     LOG_WAL_DEBUG_ << "reset lsn " << lsn;
 
+    std::lock_guard<std::mutex> write_lck(write_mutex_);
+
     buf_[0] = BufferPtr(new char[mxlog_buffer_size_]);
     buf_[1] = BufferPtr(new char[mxlog_buffer_size_]);
 
@@ -172,6 +181,7 @@ MXLogBuffer::Reset(uint64_t lsn) {
     mxlog_writer_.SetFileOpenMode("w");
 
     SetFileNoFrom(mxlog_buffer_reader_.file_no);
+    ResetWritePos();
 }
 
 uint32_t
@@ -182,7 +192,23 @@ MXLogBuffer::GetBufferSize() {
 // buffer writer cares about surplus space of buffer
 uint32_t
 MXLogBuffer::SurplusSpace() {
-    return mxlog_buffer_size_ - mxlog_buffer_writer_.buf_offset;
+    uint32_t file_no;
+    uint32_t offset;
+    ParserLsn(reserved_lsn_.load(), file_no, offset);
+    return (offset < mxlog_buffer_size_) ? (mxlog_buffer_size_ - offset) : 0;
+}
+
+uint32_t
+MXLogBuffer::UnsyncedSize() {
+    uint32_t written_file_no, written_offset;
+    ParserLsn(written_lsn_.load(), written_file_no, written_offset);
+    uint32_t committed_file_no, committed_offset;
+    ParserLsn(committed_lsn_.load(), committed_file_no, committed_offset);
+    if (committed_file_no != written_file_no || committed_offset < written_offset) {
+        // the wal file is switching
+        return 0;
+    }
+    return committed_offset - written_offset;
 }
 
 uint32_t
@@ -194,31 +220,38 @@ MXLogBuffer::RecordSize(const MXLogRecord& record) {
 ErrorCode
 MXLogBuffer::Append(MXLogRecord& record) {
     uint32_t record_size = RecordSize(record);
-    if (SurplusSpace() < record_size) {
-        // writer buffer has no space, switch wal file and write to a new buffer
-        std::unique_lock<std::mutex> lck(mutex_);
-        if (mxlog_buffer_writer_.buf_idx == mxlog_buffer_reader_.buf_idx) {
-            // swith writer buffer
-            mxlog_buffer_reader_.max_offset = mxlog_buffer_writer_.buf_offset;
-            mxlog_buffer_writer_.buf_idx ^= 1;
-        }
-        mxlog_buffer_writer_.file_no++;
-        mxlog_buffer_writer_.buf_offset = 0;
-        lck.unlock();
+    if (record_size > mxlog_buffer_size_) {
+        LOG_WAL_ERROR_ << "record size " << record_size << " exceeds wal buffer size " << mxlog_buffer_size_;
+        return WAL_ERROR;
+    }
 
-        // Reborn means close old wal file and open new wal file
-        if (!mxlog_writer_.ReBorn(ToFileName(mxlog_buffer_writer_.file_no), "w")) {
-            LOG_WAL_ERROR_ << "ReBorn wal file error " << mxlog_buffer_writer_.file_no;
-            return WAL_FILE_ERROR;
+    // reserve space for the record, concurrent writers only contend on the reserved lsn
+    uint32_t file_no = 0;
+    uint32_t offset = 0;
+    uint64_t start_lsn = reserved_lsn_.load();
+    while (true) {
+        ParserLsn(start_lsn, file_no, offset);
+        if ((uint64_t)offset + record_size <= mxlog_buffer_size_) {
+            if (reserved_lsn_.compare_exchange_weak(start_lsn, start_lsn + record_size)) {
+                break;
+            }
+        } else {
+            // writer buffer has no space, switch wal file and write to a new buffer
+            auto error_code = SwitchFile(file_no);
+            if (error_code != WAL_SUCCESS) {
+                return error_code;
+            }
+            start_lsn = reserved_lsn_.load();
         }
     }
 
-    // point to the offset of current record in wal file
+    // point to the offset of current record in wal file,
+    // the buffer can't be switched until this record is committed
     char* current_write_buf = buf_[mxlog_buffer_writer_.buf_idx].get();
-    uint32_t current_write_offset = mxlog_buffer_writer_.buf_offset;
+    uint32_t current_write_offset = offset;
 
     MXLogRecordHeader head;
-    BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset + (uint32_t)record_size, head.mxl_lsn);
+    BuildLsn(file_no, offset + record_size, head.mxl_lsn);
     head.mxl_type = (uint8_t)record.type;
     head.collection_id_size = (uint16_t)record.collection_id.size();
     head.partition_tag_size = (uint16_t)record.partition_tag.size();
@@ -247,18 +280,115 @@ MXLogBuffer::Append(MXLogRecord& record) {
         current_write_offset += record.data_size;
     }
 
-    bool write_rst = mxlog_writer_.Write(current_write_buf + mxlog_buffer_writer_.buf_offset, record_size);
-    if (!write_rst) {
-        LOG_WAL_ERROR_ << "write wal file error";
-        return WAL_FILE_ERROR;
+    // commit in lsn order, so that all the records before committed_lsn_ are complete in the buffer
+    while (committed_lsn_.load(std::memory_order_acquire) != start_lsn) {
+        std::this_thread::yield();
     }
-
     mxlog_buffer_writer_.buf_offset = current_write_offset;
+    committed_lsn_.store(head.mxl_lsn, std::memory_order_release);
 
     record.lsn = head.mxl_lsn;
     return WAL_SUCCESS;
 }
 
+ErrorCode
+MXLogBuffer::Sync(uint64_t& lsn) {
+    std::lock_guard<std::mutex> write_lck(write_mutex_);
+    uint64_t committed_lsn = committed_lsn_.load(std::memory_order_acquire);
+    fiu_return_on("MXLogBuffer.Sync.write_failed", WAL_FILE_ERROR);
+    if (!WriteBuffer(committed_lsn)) {
+        return WAL_FILE_ERROR;
+    }
+
+    lsn = committed_lsn;
+    return WAL_SUCCESS;
+}
+
+ErrorCode
+MXLogBuffer::SwitchFile(uint32_t file_no) {
+    std::lock_guard<std::mutex> write_lck(write_mutex_);
+
+    // seal the current file, no more space can be reserved in it
+    uint64_t end_lsn = reserved_lsn_.load();
+    uint32_t end_file_no = 0;
+    uint32_t end_offset = 0;
+    do {
+        ParserLsn(end_lsn, end_file_no, end_offset);
+        if (end_file_no != file_no) {
+            // switched by another writer
+            return WAL_SUCCESS;
+        }
+    } while (!reserved_lsn_.compare_exchange_weak(end_lsn, end_lsn | LSN_OFFSET_MASK));
+
+    // wait for the writers still copying their records into this file
+    while (committed_lsn_.load(std::memory_order_acquire) != end_lsn) {
+        std::this_thread::yield();
+    }
+
+    // the rest of the old file must be durable before it is closed
+    if (!WriteBuffer(end_lsn)) {
+        reserved_lsn_.store(end_lsn);
+        return WAL_FILE_ERROR;
+    }
+
+    // Reborn means close old wal file and open new wal file
+    if (!mxlog_writer_.ReBorn(ToFileName(file_no + 1), "w")) {
+        LOG_WAL_ERROR_ << "ReBorn wal file error " << file_no + 1;
+        reserved_lsn_.store(end_lsn);
+        return WAL_FILE_ERROR;
+    }
+
+    std::unique_lock<std::mutex> lck(mutex_);
+    if (mxlog_buffer_writer_.buf_idx == mxlog_buffer_reader_.buf_idx) {
+        // swith writer buffer
+        mxlog_buffer_reader_.max_offset = end_offset;
+        mxlog_buffer_writer_.buf_idx ^= 1;
+    }
+    mxlog_buffer_writer_.file_no = file_no + 1;
+    mxlog_buffer_writer_.buf_offset = 0;
+    lck.unlock();
+
+    ResetWritePos();
+    return WAL_SUCCESS;
+}
+
+// write the committed records to wal file and sync them, caller must hold write_mutex_
+bool
+MXLogBuffer::WriteBuffer(uint64_t committed_lsn) {
+    uint32_t committed_file_no, committed_offset;
+    ParserLsn(committed_lsn, committed_file_no, committed_offset);
+    uint32_t written_file_no, written_offset;
+    ParserLsn(written_lsn_.load(), written_file_no, written_offset);
+
+    if (committed_offset > written_offset) {
+        // written at their offset, the records of a failed sync are written and synced again by the next call
+        char* current_write_buf = buf_[mxlog_buffer_writer_.buf_idx].get();
+        if (!mxlog_writer_.WriteAt(current_write_buf + written_offset, written_offset,
+                                   committed_offset - written_offset)) {
+            LOG_WAL_ERROR_ << "write wal file error " << committed_file_no;
+            return false;
+        }
+        bool synced = mxlog_writer_.Sync();
+        fiu_do_on("MXLogBuffer.WriteBuffer.sync_failed", synced = false);
+        if (!synced) {
+            LOG_WAL_ERROR_ << "sync wal file error " << committed_file_no;
+            return false;
+        }
+        written_lsn_.store(committed_lsn);
+    }
+    return true;
+}
+
+// all the writer positions start from the writer handler, caller must hold write_mutex_ if writers exist
+void
+MXLogBuffer::ResetWritePos() {
+    uint64_t lsn;
+    BuildLsn(mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset, lsn);
+    written_lsn_.store(lsn);
+    committed_lsn_.store(lsn);
+    reserved_lsn_.store(lsn);
+}
+
 ErrorCode
 MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     // init output
@@ -339,6 +469,13 @@ MXLogBuffer::Next(const uint64_t last_applied_lsn, MXLogRecord& record) {
     return WAL_SUCCESS;
 }
 
+bool
+MXLogBuffer::ReadReachFileEnd() {
+    std::lock_guard<std::mutex> lck(mutex_);
+    return mxlog_buffer_reader_.file_no != mxlog_buffer_writer_.file_no &&
+           mxlog_buffer_reader_.buf_offset == mxlog_buffer_reader_.max_offset;
+}
+
 uint64_t
 MXLogBuffer::GetReadLsn() {
     uint64_t read_lsn;
@@ -350,8 +487,10 @@ bool
 MXLogBuffer::ResetWriteLsn(uint64_t lsn) {
     LOG_WAL_INFO_ << "reset write lsn " << lsn;
 
+    std::lock_guard<std::mutex> write_lck(write_mutex_);
     uint32_t old_file_no = mxlog_buffer_writer_.file_no;
     ParserLsn(lsn, mxlog_buffer_writer_.file_no, mxlog_buffer_writer_.buf_offset);
+    ResetWritePos();
     if (old_file_no == mxlog_buffer_writer_.file_no) {
         LOG_WAL_DEBUG_ << "file No. is not changed";
         return true;
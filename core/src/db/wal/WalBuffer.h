@@ -64,15 +64,33 @@ class MXLogBuffer {
     Reset(uint64_t lsn);
 
     // Note: record.lsn will be set inner
+    // thread safe, writers reserve space lock-free and publish their records in lsn order
     ErrorCode
     Append(MXLogRecord& record);
 
+    /*
+     * Write the appended records to wal file and sync them to disk
+     * @param lsn[out]: records before lsn are durable
+     * @retval error_code
+     */
+    ErrorCode
+    Sync(uint64_t& lsn);
+
+    // size of the appended records which are not written to wal file yet
+    uint32_t
+    UnsyncedSize();
+
     ErrorCode
     Next(const uint64_t last_applied_lsn, MXLogRecord& record);
 
+    // the reader has consumed a whole wal file, next record will be loaded from another file
+    bool
+    ReadReachFileEnd();
+
     uint64_t
     GetReadLsn();
 
+    // not thread safe with Append, only for the time no writer exists
     bool
     ResetWriteLsn(uint64_t lsn);
 
@@ -92,10 +110,25 @@ class MXLogBuffer {
     uint32_t
     RecordSize(const MXLogRecord& record);
 
+    ErrorCode
+    SwitchFile(uint32_t file_no);
+
+    bool
+    WriteBuffer(uint64_t committed_lsn);
+
+    void
+    ResetWritePos();
+
  private:
     uint32_t mxlog_buffer_size_;  // from config
     BufferPtr buf_[2];
-    std::mutex mutex_;
+    std::mutex mutex_;        // protect the buffer switch between reader and writer
+    std::mutex write_mutex_;  // protect the wal file writing and the wal file switch
+
+    // positions of the writer, in lsn format
+    std::atomic<uint64_t> reserved_lsn_;   // space before it has been reserved by writers
+    std::atomic<uint64_t> committed_lsn_;  // records before it are completely copied into buffer
+    std::atomic<uint64_t> written_lsn_;    // records before it are written to wal file and synced to disk
     uint32_t file_no_from_;
     MXLogBufferHandler mxlog_buffer_reader_;
     MXLogBufferHandler mxlog_buffer_writer_;
@@ -43,10 +43,19 @@ struct MXLogRecord {
     const void* data = nullptr;
 };
 
+// records of one wal file, ids and data of the records point into the owned buffer
+struct MXLogRecordBatch {
+    std::vector<MXLogRecord> records;
+    std::vector<uint8_t> buffer;
+};
+
 struct MXLogConfiguration {
     bool recovery_error_ignore;
     uint32_t buffer_size;
     std::string mxlog_path;
+    bool sync_enable = true;             // writers wait until their records are synced to disk
+    uint32_t sync_interval = 1;          // ms, time window of a group commit
+    uint32_t sync_batch_size = UNIT_MB;  // bytes, a group commit is issued at once when reaching this size
 };
 
 }  // namespace wal
@@ -11,6 +11,7 @@
 
 #include "db/wal/WalFileHandler.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -29,6 +30,14 @@ bool
 MXLogFileHandler::OpenFile() {
     if (p_file_ == nullptr) {
         p_file_ = fopen((file_path_ + file_name_).c_str(), file_mode_.c_str());
+        if (p_file_ != nullptr && file_mode_ == "w") {
+            // a new wal file, make its directory entry durable as well
+            int dir_fd = open(file_path_.c_str(), O_RDONLY);
+            if (dir_fd >= 0) {
+                fsync(dir_fd);
+                close(dir_fd);
+            }
+        }
     }
     return (p_file_ != nullptr);
 }
@@ -70,7 +79,29 @@ MXLogFileHandler::Write(char* buf, uint32_t data_size, bool is_sync) {
         written_size = fwrite(buf, 1, data_size, p_file_);
         fflush(p_file_);
     }
-    return (written_size == data_size);
+    if (written_size != data_size) {
+        return false;
+    }
+    return !is_sync || Sync();
+}
+
+bool
+MXLogFileHandler::WriteAt(char* buf, uint32_t data_offset, uint32_t data_size) {
+    uint32_t written_size = 0;
+    if (OpenFile() && data_size != 0) {
+        if (fseek(p_file_, data_offset, SEEK_SET) != 0) {
+            return false;
+        }
+        written_size = fwrite(buf, 1, data_size, p_file_);
+        fflush(p_file_);
+    }
+    return written_size == data_size;
+}
+
+bool
+MXLogFileHandler::Sync() {
+    // fflush only hands the data to the page cache, it is not durable until fdatasync
+    return (p_file_ != nullptr) && (fdatasync(fileno(p_file_)) == 0);
 }
 
 bool
@@ -38,6 +38,11 @@ class MXLogFileHandler {
     Load(char* buf, uint32_t data_offset, uint32_t data_size);
     bool
     Write(char* buf, uint32_t data_size, bool is_sync = false);
+    // write at the offset of file instead of the current position
+    bool
+    WriteAt(char* buf, uint32_t data_offset, uint32_t data_size);
+    bool
+    Sync();
     bool
     ReBorn(const std::string& file_name, const std::string& open_mode);
     uint32_t
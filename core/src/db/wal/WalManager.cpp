@@ -14,10 +14,14 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 #include "config/Config.h"
+#include "segment/Attr.h"
 #include "utils/CommonUtil.h"
 #include "utils/Exception.h"
 #include "utils/Log.h"
@@ -33,6 +37,9 @@ WalManager::WalManager(const MXLogConfiguration& config) {
     mxlog_config_.recovery_error_ignore = config.recovery_error_ignore;
     mxlog_config_.buffer_size = config.buffer_size;
     mxlog_config_.mxlog_path = config.mxlog_path;
+    mxlog_config_.sync_enable = config.sync_enable;
+    mxlog_config_.sync_interval = config.sync_interval;
+    mxlog_config_.sync_batch_size = config.sync_batch_size;
 
     // check the path end with '/'
     if (mxlog_config_.mxlog_path.back() != '/') {
@@ -48,6 +55,7 @@ WalManager::WalManager(const MXLogConfiguration& config) {
 }
 
 WalManager::~WalManager() {
+    StopSyncThread();
 }
 
 ErrorCode
@@ -137,6 +145,9 @@ WalManager::Init(const meta::MetaPtr& meta) {
     mxlog_config_.buffer_size = p_buffer_->GetBufferSize();
 
     last_applied_lsn_ = applied_lsn;
+    if (error_code == WAL_SUCCESS) {
+        StartSyncThread();
+    }
     return error_code;
 }
 
@@ -159,16 +170,8 @@ WalManager::GetNextRecovery(MXLogRecord& record) {
             break;
         }
 
-        // background thread has not started.
-        // so, needn't lock here.
-        auto it_col = collections_.find(record.collection_id);
-        if (it_col != collections_.end()) {
-            auto it_part = it_col->second.find(record.partition_tag);
-            if (it_part != it_col->second.end()) {
-                if (it_part->second.flush_lsn < record.lsn) {
-                    break;
-                }
-            }
+        if (IsRecoveryRecord(record)) {
+            break;
         }
     }
 
@@ -181,6 +184,67 @@ WalManager::GetNextRecovery(MXLogRecord& record) {
     return error_code;
 }
 
+ErrorCode
+WalManager::GetNextRecoveryBatch(MXLogRecordBatch& batch) {
+    batch.records.clear();
+    batch.buffer.clear();
+
+    // records point into the read buffer, which is overwritten when the next wal file is loaded,
+    // so a batch stops at the end of a wal file
+    ErrorCode error_code = WAL_SUCCESS;
+    size_t data_size = 0;
+    auto aligned_size = [](size_t size) -> size_t { return (size + sizeof(IDNumber) - 1) & ~(sizeof(IDNumber) - 1); };
+    while (true) {
+        MXLogRecord record;
+        error_code = p_buffer_->Next(last_applied_lsn_, record);
+        if (error_code != WAL_SUCCESS) {
+            // a wal file is loaded only when the batch is empty, no record is lost here
+            if (mxlog_config_.recovery_error_ignore) {
+                // reset and break recovery
+                p_buffer_->Reset(last_applied_lsn_);
+                error_code = WAL_SUCCESS;
+            }
+            break;
+        }
+        if (record.type == MXLogType::None) {
+            break;
+        }
+
+        if (IsRecoveryRecord(record)) {
+            data_size += aligned_size(record.length * sizeof(IDNumber)) + aligned_size(record.data_size);
+            batch.records.emplace_back(std::move(record));
+        }
+
+        if (!batch.records.empty() && p_buffer_->ReadReachFileEnd()) {
+            break;
+        }
+    }
+
+    // copy ids and data out of the read buffer
+    batch.buffer.resize(data_size);
+    uint8_t* dst = batch.buffer.data();
+    for (auto& record : batch.records) {
+        if (record.ids != nullptr) {
+            size_t size = record.length * sizeof(IDNumber);
+            memcpy(dst, record.ids, size);
+            record.ids = reinterpret_cast<const IDNumber*>(dst);
+            dst += aligned_size(size);
+        }
+        if (record.data != nullptr) {
+            memcpy(dst, record.data, record.data_size);
+            record.data = dst;
+            dst += aligned_size(record.data_size);
+        }
+    }
+
+    if (!batch.records.empty()) {
+        LOG_WAL_INFO_ << "recovery batch of " << batch.records.size() << " records, lsn from "
+                      << batch.records.front().lsn << " to " << batch.records.back().lsn;
+    }
+
+    return error_code;
+}
+
 ErrorCode
 WalManager::GetNextRecord(MXLogRecord& record) {
     auto check_flush = [&]() -> bool {
@@ -333,22 +397,22 @@ WalManager::PartitionUpdated(const std::string& collection_id, const std::string
 }
 
 template <typename T>
-bool
+ErrorCode
 WalManager::Insert(const std::string& collection_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-                   const std::vector<T>& vectors) {
+                   const std::vector<T>& vectors, uint64_t* lsn) {
     MXLogType log_type;
     if (std::is_same<T, float>::value) {
         log_type = MXLogType::InsertVector;
     } else if (std::is_same<T, uint8_t>::value) {
         log_type = MXLogType::InsertBinary;
     } else {
-        return false;
+        return WAL_ERROR;
     }
 
     size_t vector_num = vector_ids.size();
     if (vector_num == 0) {
         LOG_WAL_ERROR_ << LogOut("[%s][%ld] The ids is empty.", "insert", 0);
-        return false;
+        return WAL_ERROR;
     }
     size_t dim = vectors.size() / vector_num;
     size_t unit_size = dim * sizeof(T) + sizeof(IDNumber);
@@ -371,7 +435,7 @@ WalManager::Insert(const std::string& collection_id, const std::string& partitio
         if (max_rcd_num == 0) {
             LOG_WAL_ERROR_ << LogOut("[%s][%ld]", "insert", 0) << "Wal buffer size is too small "
                            << mxlog_config_.buffer_size << " unit " << unit_size;
-            return false;
+            return WAL_ERROR;
         }
 
         record.length = std::min(vector_num - i, max_rcd_num);
@@ -379,30 +443,202 @@ WalManager::Insert(const std::string& collection_id, const std::string& partitio
         record.data_size = record.length * dim * sizeof(T);
         record.data = vectors.data() + i * dim;
 
+        // a failed append reserves no space, the write position is shared with the other writers and kept
         auto error_code = p_buffer_->Append(record);
         if (error_code != WAL_SUCCESS) {
-            p_buffer_->ResetWriteLsn(last_applied_lsn_);
-            return false;
+            return WAL_ERROR;
         }
         new_lsn = record.lsn;
     }
 
-    last_applied_lsn_ = new_lsn;
+    UpdateLastAppliedLsn(new_lsn);
     PartitionUpdated(collection_id, partition_tag, new_lsn);
 
     LOG_WAL_INFO_ << LogOut("[%s][%ld]", "insert", 0) << collection_id << " insert in part " << partition_tag
                   << " with lsn " << new_lsn;
 
-    return p_meta_handler_->SetMXLogInternalMeta(new_lsn);
+    if (lsn != nullptr) {
+        *lsn = new_lsn;
+    }
+    return WaitSynced(new_lsn);
+}
+
+// data of an Entity record of n rows:
+// [uint8 is binary][uint32 vectors bytes][vectors][uint32 attr num]
+// then for each attribute [uint32 name length][name][int32 type][n values]
+namespace {
+
+template <typename T>
+void
+AppendValue(std::vector<uint8_t>& data, T value) {
+    auto ptr = reinterpret_cast<const uint8_t*>(&value);
+    data.insert(data.end(), ptr, ptr + sizeof(T));
+}
+
+void
+AppendBytes(std::vector<uint8_t>& data, const void* bytes, size_t size) {
+    auto ptr = reinterpret_cast<const uint8_t*>(bytes);
+    data.insert(data.end(), ptr, ptr + size);
+}
+
+template <typename T>
+bool
+ReadValue(const uint8_t*& ptr, const uint8_t* end, T& value) {
+    if (end - ptr < static_cast<int64_t>(sizeof(T))) {
+        return false;
+    }
+    memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+}  // namespace
+
+void
+WalManager::SerializeEntities(const VectorsData& entities, size_t offset, size_t count, std::vector<uint8_t>& data) {
+    data.clear();
+    bool is_binary = entities.float_data_.empty();
+    size_t row_bytes = is_binary ? entities.binary_data_.size() / entities.vector_count_
+                                 : entities.float_data_.size() / entities.vector_count_ * sizeof(float);
+    const uint8_t* vectors = is_binary ? entities.binary_data_.data()
+                                       : reinterpret_cast<const uint8_t*>(entities.float_data_.data());
+    AppendValue<uint8_t>(data, is_binary ? 1 : 0);
+    AppendValue<uint32_t>(data, count * row_bytes);
+    AppendBytes(data, vectors + offset * row_bytes, count * row_bytes);
+
+    AppendValue<uint32_t>(data, entities.attr_data_.size());
+    for (auto& pair : entities.attr_data_) {
+        auto type = entities.attr_types_.at(pair.first);
+        size_t type_size = segment::Attr::DataTypeSize(type);
+        AppendValue<uint32_t>(data, pair.first.size());
+        AppendBytes(data, pair.first.data(), pair.first.size());
+        AppendValue<int32_t>(data, static_cast<int32_t>(type));
+        AppendBytes(data, pair.second.data() + offset * type_size, count * type_size);
+    }
 }
 
 bool
+WalManager::DeserializeEntities(const MXLogRecord& record, VectorsData& entities) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(record.data);
+    const uint8_t* end = ptr + record.data_size;
+    size_t count = record.length;
+
+    uint8_t is_binary = 0;
+    uint32_t vectors_bytes = 0;
+    if (!ReadValue(ptr, end, is_binary) || !ReadValue(ptr, end, vectors_bytes) ||
+        static_cast<size_t>(end - ptr) < vectors_bytes) {
+        return false;
+    }
+    if (is_binary) {
+        entities.binary_data_.assign(ptr, ptr + vectors_bytes);
+    } else {
+        entities.float_data_.resize(vectors_bytes / sizeof(float));
+        memcpy(entities.float_data_.data(), ptr, vectors_bytes);
+    }
+    ptr += vectors_bytes;
+
+    uint32_t attr_num = 0;
+    if (!ReadValue(ptr, end, attr_num)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < attr_num; ++i) {
+        uint32_t name_length = 0;
+        if (!ReadValue(ptr, end, name_length) || static_cast<size_t>(end - ptr) < name_length) {
+            return false;
+        }
+        std::string name(reinterpret_cast<const char*>(ptr), name_length);
+        ptr += name_length;
+
+        int32_t type = 0;
+        if (!ReadValue(ptr, end, type)) {
+            return false;
+        }
+        size_t column_bytes = count * segment::Attr::DataTypeSize(static_cast<DataType>(type));
+        if (column_bytes == 0 || static_cast<size_t>(end - ptr) < column_bytes) {
+            return false;
+        }
+        entities.attr_types_[name] = static_cast<DataType>(type);
+        entities.attr_data_[name].assign(ptr, ptr + column_bytes);
+        ptr += column_bytes;
+    }
+
+    entities.vector_count_ = count;
+    entities.id_array_.assign(record.ids, record.ids + count);
+    return true;
+}
+
+ErrorCode
+WalManager::InsertEntities(const std::string& collection_id, const std::string& partition_tag,
+                           const VectorsData& entities, uint64_t* lsn) {
+    size_t vector_num = entities.id_array_.size();
+    if (vector_num == 0) {
+        LOG_WAL_ERROR_ << LogOut("[%s][%ld] The ids is empty.", "insert", 0);
+        return WAL_ERROR;
+    }
+
+    size_t unit_size = sizeof(IDNumber) + (entities.float_data_.size() * sizeof(float) + entities.binary_data_.size()) /
+                                              entities.vector_count_;
+    size_t head_size = SizeOfMXLogRecordHeader + collection_id.length() + partition_tag.length() + sizeof(uint8_t) +
+                       sizeof(uint32_t) * 2;
+    for (auto& pair : entities.attr_types_) {
+        unit_size += segment::Attr::DataTypeSize(pair.second);
+        head_size += sizeof(uint32_t) + pair.first.size() + sizeof(int32_t);
+    }
+
+    MXLogRecord record;
+    record.type = MXLogType::Entity;
+    record.collection_id = collection_id;
+    record.partition_tag = partition_tag;
+
+    std::vector<uint8_t> data;
+    uint64_t new_lsn = 0;
+    for (size_t i = 0; i < vector_num; i += record.length) {
+        size_t surplus_space = p_buffer_->SurplusSpace();
+        size_t max_rcd_num = 0;
+        if (surplus_space >= head_size + unit_size) {
+            max_rcd_num = (surplus_space - head_size) / unit_size;
+        } else {
+            max_rcd_num = (mxlog_config_.buffer_size - head_size) / unit_size;
+        }
+        if (max_rcd_num == 0) {
+            LOG_WAL_ERROR_ << LogOut("[%s][%ld]", "insert", 0) << "Wal buffer size is too small "
+                           << mxlog_config_.buffer_size << " unit " << unit_size;
+            return WAL_ERROR;
+        }
+
+        record.length = std::min(vector_num - i, max_rcd_num);
+        record.ids = entities.id_array_.data() + i;
+        SerializeEntities(entities, i, record.length, data);
+        record.data_size = data.size();
+        record.data = data.data();
+
+        // a failed append reserves no space, the write position is shared with the other writers and kept
+        auto error_code = p_buffer_->Append(record);
+        if (error_code != WAL_SUCCESS) {
+            return WAL_ERROR;
+        }
+        new_lsn = record.lsn;
+    }
+
+    UpdateLastAppliedLsn(new_lsn);
+    PartitionUpdated(collection_id, partition_tag, new_lsn);
+
+    LOG_WAL_INFO_ << LogOut("[%s][%ld]", "insert", 0) << collection_id << " insert entities in part " << partition_tag
+                  << " with lsn " << new_lsn;
+
+    if (lsn != nullptr) {
+        *lsn = new_lsn;
+    }
+    return WaitSynced(new_lsn);
+}
+
+ErrorCode
 WalManager::DeleteById(const std::string& collection_id, const std::string& partition_tag,
                        const IDNumbers& vector_ids) {
     size_t vector_num = vector_ids.size();
     if (vector_num == 0) {
         LOG_WAL_ERROR_ << "The ids is empty.";
-        return false;
+        return WAL_ERROR;
     }
 
     size_t unit_size = sizeof(IDNumber);
@@ -428,20 +664,20 @@ WalManager::DeleteById(const std::string& collection_id, const std::string& part
         record.data_size = 0;
         record.data = nullptr;
 
+        // a failed append reserves no space, the write position is shared with the other writers and kept
         auto error_code = p_buffer_->Append(record);
         if (error_code != WAL_SUCCESS) {
-            p_buffer_->ResetWriteLsn(last_applied_lsn_);
-            return false;
+            return WAL_ERROR;
         }
         new_lsn = record.lsn;
     }
 
-    last_applied_lsn_ = new_lsn;
+    UpdateLastAppliedLsn(new_lsn);
     CollectionUpdated(collection_id, new_lsn);
 
     LOG_WAL_INFO_ << collection_id << " delete rows by id, lsn " << new_lsn;
 
-    return p_meta_handler_->SetMXLogInternalMeta(new_lsn);
+    return WaitSynced(new_lsn);
 }
 
 uint64_t
@@ -494,13 +730,134 @@ WalManager::RemoveOldFiles(uint64_t flushed_lsn) {
     }
 }
 
-template bool
+uint64_t
+WalManager::GetPendingSize() {
+    if (p_buffer_ == nullptr) {
+        return 0;
+    }
+
+    // lsn is (file No. << 32 | offset), a wal file holds at most one buffer of records
+    uint64_t read_lsn = p_buffer_->GetReadLsn();
+    uint64_t write_lsn = last_applied_lsn_;
+    if (write_lsn <= read_lsn) {
+        return 0;
+    }
+    uint64_t file_count = (write_lsn >> 32) - (read_lsn >> 32);
+    return file_count * mxlog_config_.buffer_size + (write_lsn & 0xFFFFFFFF) - (read_lsn & 0xFFFFFFFF);
+}
+
+bool
+WalManager::IsRecoveryRecord(const MXLogRecord& record) {
+    // collections may be flushed while the recovered records are being applied
+    std::lock_guard<std::mutex> lck(mutex_);
+    auto it_col = collections_.find(record.collection_id);
+    if (it_col != collections_.end()) {
+        auto it_part = it_col->second.find(record.partition_tag);
+        if (it_part != it_col->second.end()) {
+            return it_part->second.flush_lsn < record.lsn;
+        }
+    }
+    return false;
+}
+
+void
+WalManager::UpdateLastAppliedLsn(uint64_t lsn) {
+    // records are committed in lsn order, the largest lsn covers all the records of concurrent writers
+    uint64_t applied_lsn = last_applied_lsn_.load();
+    while (applied_lsn < lsn && !last_applied_lsn_.compare_exchange_weak(applied_lsn, lsn)) {
+    }
+}
+
+ErrorCode
+WalManager::WaitSynced(uint64_t lsn) {
+    std::unique_lock<std::mutex> lck(sync_mutex_);
+    sync_requested_ = true;
+    sync_cv_.notify_one();
+    if (!mxlog_config_.sync_enable) {
+        return (sync_error_ != WAL_SUCCESS) ? WAL_SYNC_ERROR : WAL_SUCCESS;
+    }
+
+    // only a sync round started after this point can fail the records, an older failure was already reported
+    uint64_t round = sync_round_;
+    synced_cv_.wait(lck, [&] { return synced_lsn_ >= lsn || failed_sync_round_ > round || !sync_running_; });
+    if (synced_lsn_ >= lsn) {
+        return WAL_SUCCESS;
+    }
+    return WAL_SYNC_ERROR;
+}
+
+void
+WalManager::StartSyncThread() {
+    std::lock_guard<std::mutex> lck(sync_mutex_);
+    if (sync_running_) {
+        return;
+    }
+    sync_running_ = true;
+    sync_thread_ = std::thread(&WalManager::SyncWorker, this);
+}
+
+void
+WalManager::StopSyncThread() {
+    std::unique_lock<std::mutex> lck(sync_mutex_);
+    sync_running_ = false;
+    sync_cv_.notify_one();
+    lck.unlock();
+
+    if (sync_thread_.joinable()) {
+        sync_thread_.join();
+    }
+}
+
+void
+WalManager::SyncWorker() {
+    SetThreadName("wal_sync");
+    auto interval = std::chrono::milliseconds(mxlog_config_.sync_interval);
+
+    std::unique_lock<std::mutex> lck(sync_mutex_);
+    while (true) {
+        sync_cv_.wait(lck, [&] { return sync_requested_ || !sync_running_; });
+        if (sync_running_ && interval.count() > 0) {
+            // collect records from concurrent writers until the interval is over or the batch is big enough
+            sync_cv_.wait_for(lck, interval, [&] {
+                return !sync_running_ || p_buffer_->UnsyncedSize() >= mxlog_config_.sync_batch_size;
+            });
+        }
+        bool running = sync_running_;
+        sync_requested_ = false;
+        lck.unlock();
+
+        // one fdatasync for the whole batch, then move the end of valid records in meta
+        uint64_t lsn = 0;
+        auto error_code = p_buffer_->Sync(lsn);
+        if (error_code == WAL_SUCCESS && lsn != synced_lsn_ && !p_meta_handler_->SetMXLogInternalMeta(lsn)) {
+            error_code = WAL_META_ERROR;
+        }
+
+        lck.lock();
+        ++sync_round_;
+        if (error_code == WAL_SUCCESS) {
+            synced_lsn_ = std::max(synced_lsn_, lsn);
+            sync_error_ = WAL_SUCCESS;
+        } else {
+            LOG_WAL_ERROR_ << "wal sync error " << error_code;
+            sync_error_ = error_code;
+            failed_sync_round_ = sync_round_;
+        }
+        synced_cv_.notify_all();
+
+        if (!running) {
+            break;
+        }
+    }
+}
+
+template ErrorCode
 WalManager::Insert<float>(const std::string& collection_id, const std::string& partition_tag,
-                          const IDNumbers& vector_ids, const std::vector<float>& vectors);
+                          const IDNumbers& vector_ids, const std::vector<float>& vectors, uint64_t* lsn);
 
-template bool
+template ErrorCode
 WalManager::Insert<uint8_t>(const std::string& collection_id, const std::string& partition_tag,
-                            const IDNumbers& vector_ids, const std::vector<uint8_t>& vectors);
+                            const IDNumbers& vector_ids, const std::vector<uint8_t>& vectors, uint64_t* lsn);
 
 }  // namespace wal
 }  // namespace engine
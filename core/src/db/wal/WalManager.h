@@ -12,8 +12,11 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -49,6 +52,15 @@ class WalManager {
     ErrorCode
     GetNextRecovery(MXLogRecord& record);
 
+    /*
+     * Get recovery records of the next wal file, the batch owns its data,
+     * so it is still valid when the following wal files are loaded
+     * @param batch[out]: records batch, empty if recovery is finished
+     * @retval error_code
+     */
+    ErrorCode
+    GetNextRecoveryBatch(MXLogRecordBatch& batch);
+
     /*
      * Get next record
      * @param record[out]: record
@@ -132,19 +144,53 @@ class WalManager {
      * @param collection_id: partition tag
      * @param vector_ids: vector ids
      * @param vectors: vectors
+     * @param lsn[out]: lsn of the last record written for the vectors, set when the records are written
+     * @retval WAL_SUCCESS: the records are synced to disk (if sync is enabled)
+     *         WAL_SYNC_ERROR: the records are written but not confirmed on disk, they may still be applied
+     *         other error code: nothing is written
      */
     template <typename T>
-    bool
+    ErrorCode
     Insert(const std::string& collection_id, const std::string& partition_tag, const IDNumbers& vector_ids,
-           const std::vector<T>& vectors);
+           const std::vector<T>& vectors, uint64_t* lsn = nullptr);
+
+    /*
+     * Insert vectors along with their attribute columns, as Entity records
+     * @param collection_id: collection id
+     * @param partition_tag: partition tag
+     * @param entities: vectors, ids and attribute columns
+     * @param lsn[out]: lsn of the last record written for the entities, set when the records are written
+     * @retval WAL_SUCCESS: the records are synced to disk (if sync is enabled)
+     *         WAL_SYNC_ERROR: the records are written but not confirmed on disk, they may still be applied
+     *         other error code: nothing is written
+     */
+    ErrorCode
+    InsertEntities(const std::string& collection_id, const std::string& partition_tag, const VectorsData& entities,
+                   uint64_t* lsn = nullptr);
+
+    /*
+     * Encode the vectors and attributes of rows [offset, offset + count) of entities as the data of an Entity record
+     */
+    static void
+    SerializeEntities(const VectorsData& entities, size_t offset, size_t count, std::vector<uint8_t>& data);
+
+    /*
+     * Decode an Entity record
+     * @retval false if the record data is broken
+     */
+    static bool
+    DeserializeEntities(const MXLogRecord& record, VectorsData& entities);
 
     /*
      * Insert
      * @param collection_id: collection id
      * @param partition_tag: partition tag
      * @param vector_ids: vector ids
+     * @retval WAL_SUCCESS: the records are synced to disk (if sync is enabled)
+     *         WAL_SYNC_ERROR: the records are written but not confirmed on disk, they may still be applied
+     *         other error code: nothing is written
      */
-    bool
+    ErrorCode
     DeleteById(const std::string& collection_id, const std::string& partition_tag, const IDNumbers& vector_ids);
 
     /*
@@ -159,6 +205,13 @@ class WalManager {
     void
     RemoveOldFiles(uint64_t flushed_lsn);
 
+    /*
+     * Get the size of records written to wal but not applied yet
+     * @retval size in bytes
+     */
+    uint64_t
+    GetPendingSize();
+
     /*
      * Get the LSN of the last inserting or deleting operation
      * @retval lsn
@@ -172,6 +225,29 @@ class WalManager {
     WalManager
     operator=(WalManager&);
 
+    bool
+    IsRecoveryRecord(const MXLogRecord& record);
+
+    void
+    UpdateLastAppliedLsn(uint64_t lsn);
+
+    /*
+     * Wait until the records before lsn are synced to disk (if sync is enabled)
+     * @param lsn: lsn of the last appended record
+     * @retval error_code
+     */
+    ErrorCode
+    WaitSynced(uint64_t lsn);
+
+    void
+    StartSyncThread();
+
+    void
+    StopSyncThread();
+
+    void
+    SyncWorker();
+
     MXLogConfiguration mxlog_config_;
 
     MXLogBufferPtr p_buffer_;
@@ -200,15 +276,27 @@ class WalManager {
         }
     };
     FlushInfo flush_info_;
+
+    // group commit, a single thread syncs the records of all writers
+    std::thread sync_thread_;
+    std::mutex sync_mutex_;
+    std::condition_variable sync_cv_;    // wake up the sync thread
+    std::condition_variable synced_cv_;  // wake up the writers waiting for sync
+    bool sync_running_ = false;
+    bool sync_requested_ = false;
+    uint64_t synced_lsn_ = 0;
+    uint64_t sync_round_ = 0;             // count of finished syncs
+    uint64_t failed_sync_round_ = 0;      // the last sync that failed
+    ErrorCode sync_error_ = WAL_SUCCESS;  // error of the last sync, cleared by a successful one
 };
 
-extern template bool
+extern template ErrorCode
 WalManager::Insert<float>(const std::string& collection_id, const std::string& partition_tag,
-                          const IDNumbers& vector_ids, const std::vector<float>& vectors);
+                          const IDNumbers& vector_ids, const std::vector<float>& vectors, uint64_t* lsn);
 
-extern template bool
+extern template ErrorCode
 WalManager::Insert<uint8_t>(const std::string& collection_id, const std::string& partition_tag,
-                            const IDNumbers& vector_ids, const std::vector<uint8_t>& vectors);
+                            const IDNumbers& vector_ids, const std::vector<uint8_t>& vectors, uint64_t* lsn);
 
 }  // namespace wal
 }  // namespace engine
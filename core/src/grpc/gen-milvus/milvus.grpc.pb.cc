@@ -61,6 +61,9 @@ static const char* MilvusService_method_names[] = {
   "/milvus.grpc.MilvusService/GetEntityByID",
   "/milvus.grpc.MilvusService/GetEntityIDs",
   "/milvus.grpc.MilvusService/DeleteEntitiesByID",
+  "/milvus.grpc.MilvusService/InsertPacked",
+  "/milvus.grpc.MilvusService/SearchPacked",
+  "/milvus.grpc.MilvusService/InsertStream",
 };
 
 std::unique_ptr< MilvusService::Stub> MilvusService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -111,6 +114,9 @@ MilvusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_GetEntityByID_(MilvusService_method_names[38], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetEntityIDs_(MilvusService_method_names[39], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_DeleteEntitiesByID_(MilvusService_method_names[40], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InsertPacked_(MilvusService_method_names[41], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SearchPacked_(MilvusService_method_names[42], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_InsertStream_(MilvusService_method_names[43], ::grpc::internal::RpcMethod::CLIENT_STREAMING, channel)
   {}
 
 ::grpc::Status MilvusService::Stub::CreateCollection(::grpc::ClientContext* context, const ::milvus::grpc::CollectionSchema& request, ::milvus::grpc::Status* response) {
@@ -1261,6 +1267,78 @@ void MilvusService::Stub::experimental_async::DeleteEntitiesByID(::grpc::ClientC
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::Status>::Create(channel_.get(), cq, rpcmethod_DeleteEntitiesByID_, context, request, false);
 }
 
+::grpc::Status MilvusService::Stub::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedInsertParam& request, ::milvus::grpc::VectorIds* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_InsertPacked_, context, request, response);
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedInsertParam* request, ::milvus::grpc::VectorIds* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::VectorIds* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedInsertParam* request, ::milvus::grpc::VectorIds* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, reactor);
+}
+
+void MilvusService::Stub::experimental_async::InsertPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::VectorIds* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_InsertPacked_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::VectorIds>* MilvusService::Stub::AsyncInsertPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::PackedInsertParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::VectorIds>::Create(channel_.get(), cq, rpcmethod_InsertPacked_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::VectorIds>* MilvusService::Stub::PrepareAsyncInsertPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::PackedInsertParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::VectorIds>::Create(channel_.get(), cq, rpcmethod_InsertPacked_, context, request, false);
+}
+
+::grpc::Status MilvusService::Stub::SearchPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedSearchParam& request, ::milvus::grpc::TopKQueryResult* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SearchPacked_, context, request, response);
+}
+
+void MilvusService::Stub::experimental_async::SearchPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedSearchParam* request, ::milvus::grpc::TopKQueryResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SearchPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::SearchPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::TopKQueryResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SearchPacked_, context, request, response, std::move(f));
+}
+
+void MilvusService::Stub::experimental_async::SearchPacked(::grpc::ClientContext* context, const ::milvus::grpc::PackedSearchParam* request, ::milvus::grpc::TopKQueryResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SearchPacked_, context, request, response, reactor);
+}
+
+void MilvusService::Stub::experimental_async::SearchPacked(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::milvus::grpc::TopKQueryResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SearchPacked_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::AsyncSearchPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::PackedSearchParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchPacked_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::milvus::grpc::TopKQueryResult>* MilvusService::Stub::PrepareAsyncSearchPackedRaw(::grpc::ClientContext* context, const ::milvus::grpc::PackedSearchParam& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::milvus::grpc::TopKQueryResult>::Create(channel_.get(), cq, rpcmethod_SearchPacked_, context, request, false);
+}
+
+::grpc::ClientWriter< ::milvus::grpc::PackedInsertParam>* MilvusService::Stub::InsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::InsertStreamResult* response) {
+  return ::grpc_impl::internal::ClientWriterFactory< ::milvus::grpc::PackedInsertParam>::Create(channel_.get(), rpcmethod_InsertStream_, context, response);
+}
+
+void MilvusService::Stub::experimental_async::InsertStream(::grpc::ClientContext* context, ::milvus::grpc::InsertStreamResult* response, ::grpc::experimental::ClientWriteReactor< ::milvus::grpc::PackedInsertParam>* reactor) {
+  ::grpc_impl::internal::ClientCallbackWriterFactory< ::milvus::grpc::PackedInsertParam>::Create(stub_->channel_.get(), stub_->rpcmethod_InsertStream_, context, response, reactor);
+}
+
+::grpc::ClientAsyncWriter< ::milvus::grpc::PackedInsertParam>* MilvusService::Stub::AsyncInsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::InsertStreamResult* response, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncWriterFactory< ::milvus::grpc::PackedInsertParam>::Create(channel_.get(), cq, rpcmethod_InsertStream_, context, response, true, tag);
+}
+
+::grpc::ClientAsyncWriter< ::milvus::grpc::PackedInsertParam>* MilvusService::Stub::PrepareAsyncInsertStreamRaw(::grpc::ClientContext* context, ::milvus::grpc::InsertStreamResult* response, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncWriterFactory< ::milvus::grpc::PackedInsertParam>::Create(channel_.get(), cq, rpcmethod_InsertStream_, context, response, false, nullptr);
+}
+
 MilvusService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MilvusService_method_names[0],
@@ -1467,6 +1545,21 @@ MilvusService::Service::Service() {
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::HDeleteByIDParam, ::milvus::grpc::Status>(
           std::mem_fn(&MilvusService::Service::DeleteEntitiesByID), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[41],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::PackedInsertParam, ::milvus::grpc::VectorIds>(
+          std::mem_fn(&MilvusService::Service::InsertPacked), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[42],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MilvusService::Service, ::milvus::grpc::PackedSearchParam, ::milvus::grpc::TopKQueryResult>(
+          std::mem_fn(&MilvusService::Service::SearchPacked), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MilvusService_method_names[43],
+      ::grpc::internal::RpcMethod::CLIENT_STREAMING,
+      new ::grpc::internal::ClientStreamingHandler< MilvusService::Service, ::milvus::grpc::PackedInsertParam, ::milvus::grpc::InsertStreamResult>(
+          std::mem_fn(&MilvusService::Service::InsertStream), this)));
 }
 
 MilvusService::Service::~Service() {
@@ -1759,6 +1852,27 @@ MilvusService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MilvusService::Service::InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedInsertParam* request, ::milvus::grpc::VectorIds* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MilvusService::Service::SearchPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedSearchParam* request, ::milvus::grpc::TopKQueryResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MilvusService::Service::InsertStream(::grpc::ServerContext* context, ::grpc::ServerReader< ::milvus::grpc::PackedInsertParam>* reader, ::milvus::grpc::InsertStreamResult* response) {
+  (void) context;
+  (void) reader;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace milvus
 }  // namespace grpc
@@ -247,6 +247,22 @@ class HIndexParamDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<HIndexParam> _instance;
 } _HIndexParam_default_instance_;
+class PackedInsertParamDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PackedInsertParam> _instance;
+} _PackedInsertParam_default_instance_;
+class PackedSearchParamDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PackedSearchParam> _instance;
+} _PackedSearchParam_default_instance_;
+class IdRangeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<IdRange> _instance;
+} _IdRange_default_instance_;
+class InsertStreamResultDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InsertStreamResult> _instance;
+} _InsertStreamResult_default_instance_;
 }  // namespace grpc
 }  // namespace milvus
 static void InitDefaultsscc_info_AttrRecord_milvus_2eproto() {
@@ -644,6 +660,20 @@ static void InitDefaultsscc_info_HSearchParam_milvus_2eproto() {
       &scc_info_BooleanQuery_milvus_2eproto.base,
       &scc_info_KeyValuePair_milvus_2eproto.base,}};
 
+static void InitDefaultsscc_info_IdRange_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_IdRange_default_instance_;
+    new (ptr) ::milvus::grpc::IdRange();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::IdRange::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IdRange_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_IdRange_milvus_2eproto}, {}};
+
 static void InitDefaultsscc_info_IndexParam_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -676,6 +706,22 @@ static void InitDefaultsscc_info_InsertParam_milvus_2eproto() {
       &scc_info_RowRecord_milvus_2eproto.base,
       &scc_info_KeyValuePair_milvus_2eproto.base,}};
 
+static void InitDefaultsscc_info_InsertStreamResult_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_InsertStreamResult_default_instance_;
+    new (ptr) ::milvus::grpc::InsertStreamResult();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::InsertStreamResult::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_InsertStreamResult_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsscc_info_InsertStreamResult_milvus_2eproto}, {
+      &scc_info_Status_status_2eproto.base,
+      &scc_info_IdRange_milvus_2eproto.base,}};
+
 static void InitDefaultsscc_info_KeyValuePair_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -722,6 +768,36 @@ static void InitDefaultsscc_info_MappingList_milvus_2eproto() {
       &scc_info_Status_status_2eproto.base,
       &scc_info_Mapping_milvus_2eproto.base,}};
 
+static void InitDefaultsscc_info_PackedInsertParam_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_PackedInsertParam_default_instance_;
+    new (ptr) ::milvus::grpc::PackedInsertParam();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::PackedInsertParam::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PackedInsertParam_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_PackedInsertParam_milvus_2eproto}, {
+      &scc_info_KeyValuePair_milvus_2eproto.base,}};
+
+static void InitDefaultsscc_info_PackedSearchParam_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_PackedSearchParam_default_instance_;
+    new (ptr) ::milvus::grpc::PackedSearchParam();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::PackedSearchParam::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_PackedSearchParam_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_PackedSearchParam_milvus_2eproto}, {
+      &scc_info_KeyValuePair_milvus_2eproto.base,}};
+
 static void InitDefaultsscc_info_PartitionList_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -990,8 +1066,8 @@ static void InitDefaultsscc_info_VectorsIdentity_milvus_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VectorsIdentity_milvus_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_VectorsIdentity_milvus_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[50];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_milvus_2eproto[3];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[54];
+static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_milvus_2eproto[4];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_milvus_2eproto = nullptr;
 
 const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -1394,6 +1470,46 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, collection_name_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, index_type_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::HIndexParam, extra_params_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, collection_name_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, data_type_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, dimension_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, vector_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, row_id_array_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, partition_tag_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedInsertParam, extra_params_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, collection_name_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, partition_tag_array_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, data_type_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, dimension_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, query_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, topk_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::PackedSearchParam, extra_params_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::IdRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::IdRange, first_id_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::IdRange, count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertStreamResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertStreamResult, status_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertStreamResult, row_count_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertStreamResult, id_ranges_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertStreamResult, lsn_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::milvus::grpc::KeyValuePair)},
@@ -1446,6 +1562,10 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 376, -1, sizeof(::milvus::grpc::HGetEntityIDsParam)},
   { 383, -1, sizeof(::milvus::grpc::HDeleteByIDParam)},
   { 390, -1, sizeof(::milvus::grpc::HIndexParam)},
+  { 399, -1, sizeof(::milvus::grpc::PackedInsertParam)},
+  { 411, -1, sizeof(::milvus::grpc::PackedSearchParam)},
+  { 423, -1, sizeof(::milvus::grpc::IdRange)},
+  { 430, -1, sizeof(::milvus::grpc::InsertStreamResult)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1499,6 +1619,10 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HGetEntityIDsParam_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HDeleteByIDParam_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_HIndexParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_PackedInsertParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_PackedSearchParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_IdRange_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_InsertStreamResult_default_instance_),
 };
 
 const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -1633,95 +1757,119 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "ndexParam\022#\n\006status\030\001 \001(\0132\023.milvus.grpc."
   "Status\022\027\n\017collection_name\030\002 \001(\t\022\022\n\nindex"
   "_type\030\003 \001(\005\022/\n\014extra_params\030\004 \003(\0132\031.milv"
-  "us.grpc.KeyValuePair*\206\001\n\010DataType\022\010\n\004NUL"
-  "L\020\000\022\010\n\004INT8\020\001\022\t\n\005INT16\020\002\022\t\n\005INT32\020\003\022\t\n\005I"
-  "NT64\020\004\022\n\n\006STRING\020\024\022\010\n\004BOOL\020\036\022\t\n\005FLOAT\020(\022"
-  "\n\n\006DOUBLE\020)\022\n\n\006VECTOR\020d\022\014\n\007UNKNOWN\020\217N*C\n"
-  "\017CompareOperator\022\006\n\002LT\020\000\022\007\n\003LTE\020\001\022\006\n\002EQ\020"
-  "\002\022\006\n\002GT\020\003\022\007\n\003GTE\020\004\022\006\n\002NE\020\005*8\n\005Occur\022\013\n\007I"
-  "NVALID\020\000\022\010\n\004MUST\020\001\022\n\n\006SHOULD\020\002\022\014\n\010MUST_N"
-  "OT\020\0032\370\027\n\rMilvusService\022H\n\020CreateCollecti"
-  "on\022\035.milvus.grpc.CollectionSchema\032\023.milv"
-  "us.grpc.Status\"\000\022F\n\rHasCollection\022\033.milv"
-  "us.grpc.CollectionName\032\026.milvus.grpc.Boo"
-  "lReply\"\000\022R\n\022DescribeCollection\022\033.milvus."
-  "grpc.CollectionName\032\035.milvus.grpc.Collec"
-  "tionSchema\"\000\022Q\n\017CountCollection\022\033.milvus"
-  ".grpc.CollectionName\032\037.milvus.grpc.Colle"
-  "ctionRowCount\"\000\022J\n\017ShowCollections\022\024.mil"
-  "vus.grpc.Command\032\037.milvus.grpc.Collectio"
-  "nNameList\"\000\022P\n\022ShowCollectionInfo\022\033.milv"
-  "us.grpc.CollectionName\032\033.milvus.grpc.Col"
-  "lectionInfo\"\000\022D\n\016DropCollection\022\033.milvus"
-  ".grpc.CollectionName\032\023.milvus.grpc.Statu"
-  "s\"\000\022=\n\013CreateIndex\022\027.milvus.grpc.IndexPa"
-  "ram\032\023.milvus.grpc.Status\"\000\022G\n\rDescribeIn"
-  "dex\022\033.milvus.grpc.CollectionName\032\027.milvu"
-  "s.grpc.IndexParam\"\000\022\?\n\tDropIndex\022\033.milvu"
-  "s.grpc.CollectionName\032\023.milvus.grpc.Stat"
-  "us\"\000\022E\n\017CreatePartition\022\033.milvus.grpc.Pa"
-  "rtitionParam\032\023.milvus.grpc.Status\"\000\022E\n\014H"
-  "asPartition\022\033.milvus.grpc.PartitionParam"
-  "\032\026.milvus.grpc.BoolReply\"\000\022K\n\016ShowPartit"
-  "ions\022\033.milvus.grpc.CollectionName\032\032.milv"
-  "us.grpc.PartitionList\"\000\022C\n\rDropPartition"
-  "\022\033.milvus.grpc.PartitionParam\032\023.milvus.g"
-  "rpc.Status\"\000\022<\n\006Insert\022\030.milvus.grpc.Ins"
-  "ertParam\032\026.milvus.grpc.VectorIds\"\000\022J\n\016Ge"
-  "tVectorsByID\022\034.milvus.grpc.VectorsIdenti"
-  "ty\032\030.milvus.grpc.VectorsData\"\000\022H\n\014GetVec"
-  "torIDs\022\036.milvus.grpc.GetVectorIDsParam\032\026"
-  ".milvus.grpc.VectorIds\"\000\022B\n\006Search\022\030.mil"
-  "vus.grpc.SearchParam\032\034.milvus.grpc.TopKQ"
-  "ueryResult\"\000\022J\n\nSearchByID\022\034.milvus.grpc"
-  ".SearchByIDParam\032\034.milvus.grpc.TopKQuery"
-  "Result\"\000\022P\n\rSearchInFiles\022\037.milvus.grpc."
-  "SearchInFilesParam\032\034.milvus.grpc.TopKQue"
-  "ryResult\"\000\0227\n\003Cmd\022\024.milvus.grpc.Command\032"
-  "\030.milvus.grpc.StringReply\"\000\022A\n\nDeleteByI"
-  "D\022\034.milvus.grpc.DeleteByIDParam\032\023.milvus"
-  ".grpc.Status\"\000\022O\n\021PreloadCollection\022#.mi"
-  "lvus.grpc.PreloadCollectionParam\032\023.milvu"
-  "s.grpc.Status\"\000\022O\n\021ReleaseCollection\022#.m"
-  "ilvus.grpc.PreloadCollectionParam\032\023.milv"
-  "us.grpc.Status\"\000\022I\n\016ReloadSegments\022 .mil"
-  "vus.grpc.ReLoadSegmentsParam\032\023.milvus.gr"
-  "pc.Status\"\000\0227\n\005Flush\022\027.milvus.grpc.Flush"
-  "Param\032\023.milvus.grpc.Status\"\000\022=\n\007Compact\022"
+  "us.grpc.KeyValuePair\"\342\001\n\021PackedInsertPar"
+  "am\022\027\n\017collection_name\030\001 \001(\t\022.\n\tdata_type"
+  "\030\002 \001(\0162\033.milvus.grpc.VectorDataType\022\021\n\td"
+  "imension\030\003 \001(\003\022\023\n\013vector_data\030\004 \001(\014\022\024\n\014r"
+  "ow_id_array\030\005 \003(\003\022\025\n\rpartition_tag\030\006 \001(\t"
+  "\022/\n\014extra_params\030\007 \003(\0132\031.milvus.grpc.Key"
+  "ValuePair\"\337\001\n\021PackedSearchParam\022\027\n\017colle"
+  "ction_name\030\001 \001(\t\022\033\n\023partition_tag_array\030"
+  "\002 \003(\t\022.\n\tdata_type\030\003 \001(\0162\033.milvus.grpc.V"
+  "ectorDataType\022\021\n\tdimension\030\004 \001(\003\022\022\n\nquer"
+  "y_data\030\005 \001(\014\022\014\n\004topk\030\006 \001(\003\022/\n\014extra_para"
+  "ms\030\007 \003(\0132\031.milvus.grpc.KeyValuePair\"*\n\007I"
+  "dRange\022\020\n\010first_id\030\001 \001(\003\022\r\n\005count\030\002 \001(\003\""
+  "\202\001\n\022InsertStreamResult\022#\n\006status\030\001 \001(\0132\023"
+  ".milvus.grpc.Status\022\021\n\trow_count\030\002 \001(\003\022\'"
+  "\n\tid_ranges\030\003 \003(\0132\024.milvus.grpc.IdRange\022"
+  "\013\n\003lsn\030\004 \001(\003*\206\001\n\010DataType\022\010\n\004NULL\020\000\022\010\n\004I"
+  "NT8\020\001\022\t\n\005INT16\020\002\022\t\n\005INT32\020\003\022\t\n\005INT64\020\004\022\n"
+  "\n\006STRING\020\024\022\010\n\004BOOL\020\036\022\t\n\005FLOAT\020(\022\n\n\006DOUBL"
+  "E\020)\022\n\n\006VECTOR\020d\022\014\n\007UNKNOWN\020\217N*C\n\017Compare"
+  "Operator\022\006\n\002LT\020\000\022\007\n\003LTE\020\001\022\006\n\002EQ\020\002\022\006\n\002GT\020"
+  "\003\022\007\n\003GTE\020\004\022\006\n\002NE\020\005*8\n\005Occur\022\013\n\007INVALID\020\000"
+  "\022\010\n\004MUST\020\001\022\n\n\006SHOULD\020\002\022\014\n\010MUST_NOT\020\003*5\n\016"
+  "VectorDataType\022\020\n\014VECTOR_FLOAT\020\000\022\021\n\rVECT"
+  "OR_BINARY\020\0012\347\031\n\rMilvusService\022H\n\020CreateC"
+  "ollection\022\035.milvus.grpc.CollectionSchema"
+  "\032\023.milvus.grpc.Status\"\000\022F\n\rHasCollection"
+  "\022\033.milvus.grpc.CollectionName\032\026.milvus.g"
+  "rpc.BoolReply\"\000\022R\n\022DescribeCollection\022\033."
+  "milvus.grpc.CollectionName\032\035.milvus.grpc"
+  ".CollectionSchema\"\000\022Q\n\017CountCollection\022\033"
+  ".milvus.grpc.CollectionName\032\037.milvus.grp"
+  "c.CollectionRowCount\"\000\022J\n\017ShowCollection"
+  "s\022\024.milvus.grpc.Command\032\037.milvus.grpc.Co"
+  "llectionNameList\"\000\022P\n\022ShowCollectionInfo"
+  "\022\033.milvus.grpc.CollectionName\032\033.milvus.g"
+  "rpc.CollectionInfo\"\000\022D\n\016DropCollection\022\033"
+  ".milvus.grpc.CollectionName\032\023.milvus.grp"
+  "c.Status\"\000\022=\n\013CreateIndex\022\027.milvus.grpc."
+  "IndexParam\032\023.milvus.grpc.Status\"\000\022G\n\rDes"
+  "cribeIndex\022\033.milvus.grpc.CollectionName\032"
+  "\027.milvus.grpc.IndexParam\"\000\022\?\n\tDropIndex\022"
   "\033.milvus.grpc.CollectionName\032\023.milvus.gr"
-  "pc.Status\"\000\022E\n\026CreateHybridCollection\022\024."
-  "milvus.grpc.Mapping\032\023.milvus.grpc.Status"
-  "\"\000\022L\n\023HasHybridCollection\022\033.milvus.grpc."
-  "CollectionName\032\026.milvus.grpc.BoolReply\"\000"
-  "\022J\n\024DropHybridCollection\022\033.milvus.grpc.C"
-  "ollectionName\032\023.milvus.grpc.Status\"\000\022O\n\030"
-  "DescribeHybridCollection\022\033.milvus.grpc.C"
-  "ollectionName\032\024.milvus.grpc.Mapping\"\000\022W\n"
-  "\025CountHybridCollection\022\033.milvus.grpc.Col"
-  "lectionName\032\037.milvus.grpc.CollectionRowC"
-  "ount\"\000\022I\n\025ShowHybridCollections\022\024.milvus"
-  ".grpc.Command\032\030.milvus.grpc.MappingList\""
-  "\000\022V\n\030ShowHybridCollectionInfo\022\033.milvus.g"
-  "rpc.CollectionName\032\033.milvus.grpc.Collect"
-  "ionInfo\"\000\022M\n\027PreloadHybridCollection\022\033.m"
-  "ilvus.grpc.CollectionName\032\023.milvus.grpc."
-  "Status\"\000\022D\n\014InsertEntity\022\031.milvus.grpc.H"
-  "InsertParam\032\027.milvus.grpc.HEntityIDs\"\000\022I"
-  "\n\014HybridSearch\022\031.milvus.grpc.HSearchPara"
-  "m\032\034.milvus.grpc.TopKQueryResult\"\000\022]\n\026Hyb"
-  "ridSearchInSegments\022#.milvus.grpc.HSearc"
-  "hInSegmentsParam\032\034.milvus.grpc.TopKQuery"
-  "Result\"\000\022E\n\rGetEntityByID\022\034.milvus.grpc."
-  "HEntityIdentity\032\024.milvus.grpc.HEntity\"\000\022"
-  "J\n\014GetEntityIDs\022\037.milvus.grpc.HGetEntity"
-  "IDsParam\032\027.milvus.grpc.HEntityIDs\"\000\022J\n\022D"
-  "eleteEntitiesByID\022\035.milvus.grpc.HDeleteB"
-  "yIDParam\032\023.milvus.grpc.Status\"\000b\006proto3"
+  "pc.Status\"\000\022E\n\017CreatePartition\022\033.milvus."
+  "grpc.PartitionParam\032\023.milvus.grpc.Status"
+  "\"\000\022E\n\014HasPartition\022\033.milvus.grpc.Partiti"
+  "onParam\032\026.milvus.grpc.BoolReply\"\000\022K\n\016Sho"
+  "wPartitions\022\033.milvus.grpc.CollectionName"
+  "\032\032.milvus.grpc.PartitionList\"\000\022C\n\rDropPa"
+  "rtition\022\033.milvus.grpc.PartitionParam\032\023.m"
+  "ilvus.grpc.Status\"\000\022<\n\006Insert\022\030.milvus.g"
+  "rpc.InsertParam\032\026.milvus.grpc.VectorIds\""
+  "\000\022J\n\016GetVectorsByID\022\034.milvus.grpc.Vector"
+  "sIdentity\032\030.milvus.grpc.VectorsData\"\000\022H\n"
+  "\014GetVectorIDs\022\036.milvus.grpc.GetVectorIDs"
+  "Param\032\026.milvus.grpc.VectorIds\"\000\022B\n\006Searc"
+  "h\022\030.milvus.grpc.SearchParam\032\034.milvus.grp"
+  "c.TopKQueryResult\"\000\022J\n\nSearchByID\022\034.milv"
+  "us.grpc.SearchByIDParam\032\034.milvus.grpc.To"
+  "pKQueryResult\"\000\022P\n\rSearchInFiles\022\037.milvu"
+  "s.grpc.SearchInFilesParam\032\034.milvus.grpc."
+  "TopKQueryResult\"\000\0227\n\003Cmd\022\024.milvus.grpc.C"
+  "ommand\032\030.milvus.grpc.StringReply\"\000\022A\n\nDe"
+  "leteByID\022\034.milvus.grpc.DeleteByIDParam\032\023"
+  ".milvus.grpc.Status\"\000\022O\n\021PreloadCollecti"
+  "on\022#.milvus.grpc.PreloadCollectionParam\032"
+  "\023.milvus.grpc.Status\"\000\022O\n\021ReleaseCollect"
+  "ion\022#.milvus.grpc.PreloadCollectionParam"
+  "\032\023.milvus.grpc.Status\"\000\022I\n\016ReloadSegment"
+  "s\022 .milvus.grpc.ReLoadSegmentsParam\032\023.mi"
+  "lvus.grpc.Status\"\000\0227\n\005Flush\022\027.milvus.grp"
+  "c.FlushParam\032\023.milvus.grpc.Status\"\000\022=\n\007C"
+  "ompact\022\033.milvus.grpc.CollectionName\032\023.mi"
+  "lvus.grpc.Status\"\000\022E\n\026CreateHybridCollec"
+  "tion\022\024.milvus.grpc.Mapping\032\023.milvus.grpc"
+  ".Status\"\000\022L\n\023HasHybridCollection\022\033.milvu"
+  "s.grpc.CollectionName\032\026.milvus.grpc.Bool"
+  "Reply\"\000\022J\n\024DropHybridCollection\022\033.milvus"
+  ".grpc.CollectionName\032\023.milvus.grpc.Statu"
+  "s\"\000\022O\n\030DescribeHybridCollection\022\033.milvus"
+  ".grpc.CollectionName\032\024.milvus.grpc.Mappi"
+  "ng\"\000\022W\n\025CountHybridCollection\022\033.milvus.g"
+  "rpc.CollectionName\032\037.milvus.grpc.Collect"
+  "ionRowCount\"\000\022I\n\025ShowHybridCollections\022\024"
+  ".milvus.grpc.Command\032\030.milvus.grpc.Mappi"
+  "ngList\"\000\022V\n\030ShowHybridCollectionInfo\022\033.m"
+  "ilvus.grpc.CollectionName\032\033.milvus.grpc."
+  "CollectionInfo\"\000\022M\n\027PreloadHybridCollect"
+  "ion\022\033.milvus.grpc.CollectionName\032\023.milvu"
+  "s.grpc.Status\"\000\022D\n\014InsertEntity\022\031.milvus"
+  ".grpc.HInsertParam\032\027.milvus.grpc.HEntity"
+  "IDs\"\000\022I\n\014HybridSearch\022\031.milvus.grpc.HSea"
+  "rchParam\032\034.milvus.grpc.TopKQueryResult\"\000"
+  "\022]\n\026HybridSearchInSegments\022#.milvus.grpc"
+  ".HSearchInSegmentsParam\032\034.milvus.grpc.To"
+  "pKQueryResult\"\000\022E\n\rGetEntityByID\022\034.milvu"
+  "s.grpc.HEntityIdentity\032\024.milvus.grpc.HEn"
+  "tity\"\000\022J\n\014GetEntityIDs\022\037.milvus.grpc.HGe"
+  "tEntityIDsParam\032\027.milvus.grpc.HEntityIDs"
+  "\"\000\022J\n\022DeleteEntitiesByID\022\035.milvus.grpc.H"
+  "DeleteByIDParam\032\023.milvus.grpc.Status\"\000\022H"
+  "\n\014InsertPacked\022\036.milvus.grpc.PackedInser"
+  "tParam\032\026.milvus.grpc.VectorIds\"\000\022N\n\014Sear"
+  "chPacked\022\036.milvus.grpc.PackedSearchParam"
+  "\032\034.milvus.grpc.TopKQueryResult\"\000\022S\n\014Inse"
+  "rtStream\022\036.milvus.grpc.PackedInsertParam"
+  "\032\037.milvus.grpc.InsertStreamResult\"\000(\001b\006p"
+  "roto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[49] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[53] = {
   &scc_info_AttrRecord_milvus_2eproto.base,
   &scc_info_BoolReply_milvus_2eproto.base,
   &scc_info_BooleanQuery_milvus_2eproto.base,
@@ -1748,11 +1896,15 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
   &scc_info_HQueryResult_milvus_2eproto.base,
   &scc_info_HSearchInSegmentsParam_milvus_2eproto.base,
   &scc_info_HSearchParam_milvus_2eproto.base,
+  &scc_info_IdRange_milvus_2eproto.base,
   &scc_info_IndexParam_milvus_2eproto.base,
   &scc_info_InsertParam_milvus_2eproto.base,
+  &scc_info_InsertStreamResult_milvus_2eproto.base,
   &scc_info_KeyValuePair_milvus_2eproto.base,
   &scc_info_Mapping_milvus_2eproto.base,
   &scc_info_MappingList_milvus_2eproto.base,
+  &scc_info_PackedInsertParam_milvus_2eproto.base,
+  &scc_info_PackedSearchParam_milvus_2eproto.base,
   &scc_info_PartitionList_milvus_2eproto.base,
   &scc_info_PartitionParam_milvus_2eproto.base,
   &scc_info_PreloadCollectionParam_milvus_2eproto.base,
@@ -1775,10 +1927,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 8599,
-  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 49, 1,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 9525,
+  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 53, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
-  file_level_metadata_milvus_2eproto, 50, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
+  file_level_metadata_milvus_2eproto, 54, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -1842,6 +1994,20 @@ bool Occur_IsValid(int value) {
   }
 }
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VectorDataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_milvus_2eproto);
+  return file_level_enum_descriptors_milvus_2eproto[3];
+}
+bool VectorDataType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -20822,84 +20988,1968 @@ void HIndexParam::InternalSwap(HIndexParam* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace grpc
-}  // namespace milvus
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::milvus::grpc::KeyValuePair* Arena::CreateMaybeMessage< ::milvus::grpc::KeyValuePair >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::KeyValuePair >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionName* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionName >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::CollectionName >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionNameList* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionNameList >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::CollectionNameList >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionSchema* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionSchema >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::CollectionSchema >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::PartitionParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionList* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionList >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::PartitionList >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::RowRecord* Arena::CreateMaybeMessage< ::milvus::grpc::RowRecord >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::RowRecord >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage< ::milvus::grpc::InsertParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::InsertParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorIds* Arena::CreateMaybeMessage< ::milvus::grpc::VectorIds >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::VectorIds >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchInFilesParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchInFilesParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchInFilesParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchByIDParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::SearchByIDParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::PreloadCollectionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PreloadCollectionParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::PreloadCollectionParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::ReLoadSegmentsParam* Arena::CreateMaybeMessage< ::milvus::grpc::ReLoadSegmentsParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::ReLoadSegmentsParam >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::TopKQueryResult* Arena::CreateMaybeMessage< ::milvus::grpc::TopKQueryResult >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::TopKQueryResult >(arena);
-}
-template<> PROTOBUF_NOINLINE ::milvus::grpc::StringReply* Arena::CreateMaybeMessage< ::milvus::grpc::StringReply >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::StringReply >(arena);
+// ===================================================================
+
+void PackedInsertParam::InitAsDefaultInstance() {
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage< ::milvus::grpc::BoolReply >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::BoolReply >(arena);
+class PackedInsertParam::_Internal {
+ public:
+};
+
+PackedInsertParam::PackedInsertParam()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.PackedInsertParam)
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionRowCount* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionRowCount >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::CollectionRowCount >(arena);
+PackedInsertParam::PackedInsertParam(const PackedInsertParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      row_id_array_(from.row_id_array_),
+      extra_params_(from.extra_params_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.collection_name().empty()) {
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  vector_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.vector_data().empty()) {
+    vector_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.vector_data_);
+  }
+  partition_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.partition_tag().empty()) {
+    partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
+  }
+  ::memcpy(&dimension_, &from.dimension_,
+    static_cast<size_t>(reinterpret_cast<char*>(&data_type_) -
+    reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.PackedInsertParam)
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::Command* Arena::CreateMaybeMessage< ::milvus::grpc::Command >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::Command >(arena);
+
+void PackedInsertParam::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PackedInsertParam_milvus_2eproto.base);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&data_type_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage< ::milvus::grpc::IndexParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::IndexParam >(arena);
+
+PackedInsertParam::~PackedInsertParam() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.PackedInsertParam)
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::FlushParam* Arena::CreateMaybeMessage< ::milvus::grpc::FlushParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::FlushParam >(arena);
+
+void PackedInsertParam::SharedDtor() {
+  collection_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::DeleteByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::DeleteByIDParam >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::DeleteByIDParam >(arena);
+
+void PackedInsertParam::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionInfo* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::CollectionInfo >(arena);
+const PackedInsertParam& PackedInsertParam::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PackedInsertParam_milvus_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsIdentity* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsIdentity >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::VectorsIdentity >(arena);
+
+
+void PackedInsertParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.PackedInsertParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  row_id_array_.Clear();
+  extra_params_.Clear();
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  vector_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&data_type_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
+  _internal_metadata_.Clear();
 }
-template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsData* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsData >(Arena* arena) {
-  return Arena::CreateInternal< ::milvus::grpc::VectorsData >(arena);
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* PackedInsertParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string collection_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_collection_name(), ptr, ctx, "milvus.grpc.PackedInsertParam.collection_name");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .milvus.grpc.VectorDataType data_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+          set_data_type(static_cast<::milvus::grpc::VectorDataType>(val));
+        } else goto handle_unusual;
+        continue;
+      // int64 dimension = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes vector_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_vector_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 row_id_array = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_row_id_array(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40) {
+          add_row_id_array(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string partition_tag = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_partition_tag(), ptr, ctx, "milvus.grpc.PackedInsertParam.partition_tag");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(add_extra_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 58);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool PackedInsertParam::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.PackedInsertParam)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string collection_name = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_collection_name()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.PackedInsertParam.collection_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .milvus.grpc.VectorDataType data_type = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_data_type(static_cast< ::milvus::grpc::VectorDataType >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 dimension = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &dimension_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes vector_data = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (34 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_vector_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 row_id_array = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_row_id_array())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 42u, input, this->mutable_row_id_array())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // string partition_tag = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_partition_tag()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.PackedInsertParam.partition_tag"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_extra_params()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.PackedInsertParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.PackedInsertParam)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void PackedInsertParam::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.PackedInsertParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedInsertParam.collection_name");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->collection_name(), output);
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 2;
+  if (this->data_type() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      2, this->data_type(), output);
+  }
+
+  // int64 dimension = 3;
+  if (this->dimension() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(3, this->dimension(), output);
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      4, this->vector_data(), output);
+  }
+
+  // repeated int64 row_id_array = 5;
+  if (this->row_id_array_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(5, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_row_id_array_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->row_id_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->row_id_array(i), output);
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedInsertParam.partition_tag");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      6, this->partition_tag(), output);
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7,
+      this->extra_params(static_cast<int>(i)),
+      output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.PackedInsertParam)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PackedInsertParam::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.PackedInsertParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedInsertParam.collection_name");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        1, this->collection_name(), target);
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 2;
+  if (this->data_type() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      2, this->data_type(), target);
+  }
+
+  // int64 dimension = 3;
+  if (this->dimension() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->dimension(), target);
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        4, this->vector_data(), target);
+  }
+
+  // repeated int64 row_id_array = 5;
+  if (this->row_id_array_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      5,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _row_id_array_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->row_id_array_, target);
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag().data(), static_cast<int>(this->partition_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedInsertParam.partition_tag");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        6, this->partition_tag(), target);
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, this->extra_params(static_cast<int>(i)), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.PackedInsertParam)
+  return target;
+}
+
+size_t PackedInsertParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.PackedInsertParam)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 row_id_array = 5;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->row_id_array_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _row_id_array_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->extra_params_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->extra_params(static_cast<int>(i)));
+    }
+  }
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->collection_name());
+  }
+
+  // bytes vector_data = 4;
+  if (this->vector_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->vector_data());
+  }
+
+  // string partition_tag = 6;
+  if (this->partition_tag().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->partition_tag());
+  }
+
+  // int64 dimension = 3;
+  if (this->dimension() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->dimension());
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 2;
+  if (this->data_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->data_type());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PackedInsertParam::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.PackedInsertParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PackedInsertParam* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PackedInsertParam>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.PackedInsertParam)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.PackedInsertParam)
+    MergeFrom(*source);
+  }
+}
+
+void PackedInsertParam::MergeFrom(const PackedInsertParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.PackedInsertParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  row_id_array_.MergeFrom(from.row_id_array_);
+  extra_params_.MergeFrom(from.extra_params_);
+  if (from.collection_name().size() > 0) {
+
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  if (from.vector_data().size() > 0) {
+
+    vector_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.vector_data_);
+  }
+  if (from.partition_tag().size() > 0) {
+
+    partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
+  }
+  if (from.dimension() != 0) {
+    set_dimension(from.dimension());
+  }
+  if (from.data_type() != 0) {
+    set_data_type(from.data_type());
+  }
+}
+
+void PackedInsertParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.PackedInsertParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PackedInsertParam::CopyFrom(const PackedInsertParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.PackedInsertParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedInsertParam::IsInitialized() const {
+  return true;
+}
+
+void PackedInsertParam::InternalSwap(PackedInsertParam* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  row_id_array_.InternalSwap(&other->row_id_array_);
+  CastToBase(&extra_params_)->InternalSwap(CastToBase(&other->extra_params_));
+  collection_name_.Swap(&other->collection_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  vector_data_.Swap(&other->vector_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  partition_tag_.Swap(&other->partition_tag_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(dimension_, other->dimension_);
+  swap(data_type_, other->data_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackedInsertParam::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void PackedSearchParam::InitAsDefaultInstance() {
+}
+class PackedSearchParam::_Internal {
+ public:
+};
+
+PackedSearchParam::PackedSearchParam()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.PackedSearchParam)
+}
+PackedSearchParam::PackedSearchParam(const PackedSearchParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      partition_tag_array_(from.partition_tag_array_),
+      extra_params_(from.extra_params_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.collection_name().empty()) {
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  query_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.query_data().empty()) {
+    query_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.query_data_);
+  }
+  ::memcpy(&dimension_, &from.dimension_,
+    static_cast<size_t>(reinterpret_cast<char*>(&data_type_) -
+    reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.PackedSearchParam)
+}
+
+void PackedSearchParam::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_PackedSearchParam_milvus_2eproto.base);
+  collection_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  query_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&data_type_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
+}
+
+PackedSearchParam::~PackedSearchParam() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.PackedSearchParam)
+  SharedDtor();
+}
+
+void PackedSearchParam::SharedDtor() {
+  collection_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  query_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void PackedSearchParam::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PackedSearchParam& PackedSearchParam::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PackedSearchParam_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PackedSearchParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.PackedSearchParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  partition_tag_array_.Clear();
+  extra_params_.Clear();
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  query_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&dimension_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&data_type_) -
+      reinterpret_cast<char*>(&dimension_)) + sizeof(data_type_));
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* PackedSearchParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string collection_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_collection_name(), ptr, ctx, "milvus.grpc.PackedSearchParam.collection_name");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated string partition_tag_array = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(add_partition_tag_array(), ptr, ctx, "milvus.grpc.PackedSearchParam.partition_tag_array");
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 18);
+        } else goto handle_unusual;
+        continue;
+      // .milvus.grpc.VectorDataType data_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+          set_data_type(static_cast<::milvus::grpc::VectorDataType>(val));
+        } else goto handle_unusual;
+        continue;
+      // int64 dimension = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes query_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_query_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 topk = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          topk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(add_extra_params(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 58);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool PackedSearchParam::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.PackedSearchParam)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string collection_name = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_collection_name()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.PackedSearchParam.collection_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string partition_tag_array = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->add_partition_tag_array()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->partition_tag_array(this->partition_tag_array_size() - 1).data(),
+            static_cast<int>(this->partition_tag_array(this->partition_tag_array_size() - 1).length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.PackedSearchParam.partition_tag_array"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // .milvus.grpc.VectorDataType data_type = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (24 & 0xFF)) {
+          int value = 0;
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   int, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          set_data_type(static_cast< ::milvus::grpc::VectorDataType >(value));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 dimension = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &dimension_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes query_data = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_query_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 topk = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (48 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &topk_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_extra_params()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.PackedSearchParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.PackedSearchParam)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void PackedSearchParam::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.PackedSearchParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedSearchParam.collection_name");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->collection_name(), output);
+  }
+
+  // repeated string partition_tag_array = 2;
+  for (int i = 0, n = this->partition_tag_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag_array(i).data(), static_cast<int>(this->partition_tag_array(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedSearchParam.partition_tag_array");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteString(
+      2, this->partition_tag_array(i), output);
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 3;
+  if (this->data_type() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnum(
+      3, this->data_type(), output);
+  }
+
+  // int64 dimension = 4;
+  if (this->dimension() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(4, this->dimension(), output);
+  }
+
+  // bytes query_data = 5;
+  if (this->query_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->query_data(), output);
+  }
+
+  // int64 topk = 6;
+  if (this->topk() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(6, this->topk(), output);
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7,
+      this->extra_params(static_cast<int>(i)),
+      output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.PackedSearchParam)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PackedSearchParam::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.PackedSearchParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->collection_name().data(), static_cast<int>(this->collection_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedSearchParam.collection_name");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        1, this->collection_name(), target);
+  }
+
+  // repeated string partition_tag_array = 2;
+  for (int i = 0, n = this->partition_tag_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->partition_tag_array(i).data(), static_cast<int>(this->partition_tag_array(i).length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.PackedSearchParam.partition_tag_array");
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteStringToArray(2, this->partition_tag_array(i), target);
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 3;
+  if (this->data_type() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->data_type(), target);
+  }
+
+  // int64 dimension = 4;
+  if (this->dimension() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(4, this->dimension(), target);
+  }
+
+  // bytes query_data = 5;
+  if (this->query_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        5, this->query_data(), target);
+  }
+
+  // int64 topk = 6;
+  if (this->topk() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(6, this->topk(), target);
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->extra_params_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        7, this->extra_params(static_cast<int>(i)), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.PackedSearchParam)
+  return target;
+}
+
+size_t PackedSearchParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.PackedSearchParam)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string partition_tag_array = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->partition_tag_array_size());
+  for (int i = 0, n = this->partition_tag_array_size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      this->partition_tag_array(i));
+  }
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->extra_params_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->extra_params(static_cast<int>(i)));
+    }
+  }
+
+  // string collection_name = 1;
+  if (this->collection_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->collection_name());
+  }
+
+  // bytes query_data = 5;
+  if (this->query_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->query_data());
+  }
+
+  // int64 dimension = 4;
+  if (this->dimension() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->dimension());
+  }
+
+  // int64 topk = 6;
+  if (this->topk() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->topk());
+  }
+
+  // .milvus.grpc.VectorDataType data_type = 3;
+  if (this->data_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->data_type());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PackedSearchParam::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.PackedSearchParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PackedSearchParam* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PackedSearchParam>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.PackedSearchParam)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.PackedSearchParam)
+    MergeFrom(*source);
+  }
+}
+
+void PackedSearchParam::MergeFrom(const PackedSearchParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.PackedSearchParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  partition_tag_array_.MergeFrom(from.partition_tag_array_);
+  extra_params_.MergeFrom(from.extra_params_);
+  if (from.collection_name().size() > 0) {
+
+    collection_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.collection_name_);
+  }
+  if (from.query_data().size() > 0) {
+
+    query_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.query_data_);
+  }
+  if (from.dimension() != 0) {
+    set_dimension(from.dimension());
+  }
+  if (from.topk() != 0) {
+    set_topk(from.topk());
+  }
+  if (from.data_type() != 0) {
+    set_data_type(from.data_type());
+  }
+}
+
+void PackedSearchParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.PackedSearchParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PackedSearchParam::CopyFrom(const PackedSearchParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.PackedSearchParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PackedSearchParam::IsInitialized() const {
+  return true;
+}
+
+void PackedSearchParam::InternalSwap(PackedSearchParam* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  partition_tag_array_.InternalSwap(CastToBase(&other->partition_tag_array_));
+  CastToBase(&extra_params_)->InternalSwap(CastToBase(&other->extra_params_));
+  collection_name_.Swap(&other->collection_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  query_data_.Swap(&other->query_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(dimension_, other->dimension_);
+  swap(topk_, other->topk_);
+  swap(data_type_, other->data_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PackedSearchParam::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void IdRange::InitAsDefaultInstance() {
+}
+class IdRange::_Internal {
+ public:
+};
+
+IdRange::IdRange()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.IdRange)
+}
+IdRange::IdRange(const IdRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&first_id_, &from.first_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&count_) -
+    reinterpret_cast<char*>(&first_id_)) + sizeof(count_));
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.IdRange)
+}
+
+void IdRange::SharedCtor() {
+  ::memset(&first_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&count_) -
+      reinterpret_cast<char*>(&first_id_)) + sizeof(count_));
+}
+
+IdRange::~IdRange() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.IdRange)
+  SharedDtor();
+}
+
+void IdRange::SharedDtor() {
+}
+
+void IdRange::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const IdRange& IdRange::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_IdRange_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void IdRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.IdRange)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&first_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&count_) -
+      reinterpret_cast<char*>(&first_id_)) + sizeof(count_));
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* IdRange::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int64 first_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          first_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool IdRange::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.IdRange)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // int64 first_id = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (8 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &first_id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 count = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.IdRange)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.IdRange)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void IdRange::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.IdRange)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 first_id = 1;
+  if (this->first_id() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(1, this->first_id(), output);
+  }
+
+  // int64 count = 2;
+  if (this->count() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->count(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.IdRange)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* IdRange::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.IdRange)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 first_id = 1;
+  if (this->first_id() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(1, this->first_id(), target);
+  }
+
+  // int64 count = 2;
+  if (this->count() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->count(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.IdRange)
+  return target;
+}
+
+size_t IdRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.IdRange)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 first_id = 1;
+  if (this->first_id() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->first_id());
+  }
+
+  // int64 count = 2;
+  if (this->count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->count());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void IdRange::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.IdRange)
+  GOOGLE_DCHECK_NE(&from, this);
+  const IdRange* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<IdRange>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.IdRange)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.IdRange)
+    MergeFrom(*source);
+  }
+}
+
+void IdRange::MergeFrom(const IdRange& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.IdRange)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.first_id() != 0) {
+    set_first_id(from.first_id());
+  }
+  if (from.count() != 0) {
+    set_count(from.count());
+  }
+}
+
+void IdRange::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.IdRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void IdRange::CopyFrom(const IdRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.IdRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IdRange::IsInitialized() const {
+  return true;
+}
+
+void IdRange::InternalSwap(IdRange* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(first_id_, other->first_id_);
+  swap(count_, other->count_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IdRange::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void InsertStreamResult::InitAsDefaultInstance() {
+  ::milvus::grpc::_InsertStreamResult_default_instance_._instance.get_mutable()->status_ = const_cast< ::milvus::grpc::Status*>(
+      ::milvus::grpc::Status::internal_default_instance());
+}
+class InsertStreamResult::_Internal {
+ public:
+  static const ::milvus::grpc::Status& status(const InsertStreamResult* msg);
+};
+
+const ::milvus::grpc::Status&
+InsertStreamResult::_Internal::status(const InsertStreamResult* msg) {
+  return *msg->status_;
+}
+void InsertStreamResult::clear_status() {
+  if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
+    delete status_;
+  }
+  status_ = nullptr;
+}
+InsertStreamResult::InsertStreamResult()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.InsertStreamResult)
+}
+InsertStreamResult::InsertStreamResult(const InsertStreamResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      id_ranges_(from.id_ranges_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_status()) {
+    status_ = new ::milvus::grpc::Status(*from.status_);
+  } else {
+    status_ = nullptr;
+  }
+  ::memcpy(&row_count_, &from.row_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&lsn_) -
+    reinterpret_cast<char*>(&row_count_)) + sizeof(lsn_));
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.InsertStreamResult)
+}
+
+void InsertStreamResult::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InsertStreamResult_milvus_2eproto.base);
+  ::memset(&status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&lsn_) -
+      reinterpret_cast<char*>(&status_)) + sizeof(lsn_));
+}
+
+InsertStreamResult::~InsertStreamResult() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.InsertStreamResult)
+  SharedDtor();
+}
+
+void InsertStreamResult::SharedDtor() {
+  if (this != internal_default_instance()) delete status_;
+}
+
+void InsertStreamResult::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const InsertStreamResult& InsertStreamResult::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InsertStreamResult_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void InsertStreamResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.InsertStreamResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  id_ranges_.Clear();
+  if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
+    delete status_;
+  }
+  status_ = nullptr;
+  ::memset(&row_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&lsn_) -
+      reinterpret_cast<char*>(&row_count_)) + sizeof(lsn_));
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* InsertStreamResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .milvus.grpc.Status status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(mutable_status(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 row_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          row_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .milvus.grpc.IdRange id_ranges = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(add_id_ranges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 26);
+        } else goto handle_unusual;
+        continue;
+      // int64 lsn = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool InsertStreamResult::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.InsertStreamResult)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // .milvus.grpc.Status status = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+               input, mutable_status()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 row_count = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &row_count_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .milvus.grpc.IdRange id_ranges = 3;
+      case 3: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (26 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadMessage(
+                input, add_id_ranges()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 lsn = 4;
+      case 4: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (32 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &lsn_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.InsertStreamResult)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.InsertStreamResult)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void InsertStreamResult::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.InsertStreamResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, _Internal::status(this), output);
+  }
+
+  // int64 row_count = 2;
+  if (this->row_count() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(2, this->row_count(), output);
+  }
+
+  // repeated .milvus.grpc.IdRange id_ranges = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->id_ranges_size()); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3,
+      this->id_ranges(static_cast<int>(i)),
+      output);
+  }
+
+  // int64 lsn = 4;
+  if (this->lsn() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(4, this->lsn(), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.InsertStreamResult)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* InsertStreamResult::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.InsertStreamResult)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        1, _Internal::status(this), target);
+  }
+
+  // int64 row_count = 2;
+  if (this->row_count() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(2, this->row_count(), target);
+  }
+
+  // repeated .milvus.grpc.IdRange id_ranges = 3;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->id_ranges_size()); i < n; i++) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessageToArray(
+        3, this->id_ranges(static_cast<int>(i)), target);
+  }
+
+  // int64 lsn = 4;
+  if (this->lsn() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(4, this->lsn(), target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.InsertStreamResult)
+  return target;
+}
+
+size_t InsertStreamResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.InsertStreamResult)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .milvus.grpc.IdRange id_ranges = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->id_ranges_size());
+    total_size += 1UL * count;
+    for (unsigned int i = 0; i < count; i++) {
+      total_size +=
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          this->id_ranges(static_cast<int>(i)));
+    }
+  }
+
+  // .milvus.grpc.Status status = 1;
+  if (this->has_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *status_);
+  }
+
+  // int64 row_count = 2;
+  if (this->row_count() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->row_count());
+  }
+
+  // int64 lsn = 4;
+  if (this->lsn() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->lsn());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void InsertStreamResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.InsertStreamResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  const InsertStreamResult* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InsertStreamResult>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.InsertStreamResult)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.InsertStreamResult)
+    MergeFrom(*source);
+  }
+}
+
+void InsertStreamResult::MergeFrom(const InsertStreamResult& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.InsertStreamResult)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  id_ranges_.MergeFrom(from.id_ranges_);
+  if (from.has_status()) {
+    mutable_status()->::milvus::grpc::Status::MergeFrom(from.status());
+  }
+  if (from.row_count() != 0) {
+    set_row_count(from.row_count());
+  }
+  if (from.lsn() != 0) {
+    set_lsn(from.lsn());
+  }
+}
+
+void InsertStreamResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.InsertStreamResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void InsertStreamResult::CopyFrom(const InsertStreamResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.InsertStreamResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InsertStreamResult::IsInitialized() const {
+  return true;
+}
+
+void InsertStreamResult::InternalSwap(InsertStreamResult* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  CastToBase(&id_ranges_)->InternalSwap(CastToBase(&other->id_ranges_));
+  swap(status_, other->status_);
+  swap(row_count_, other->row_count_);
+  swap(lsn_, other->lsn_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InsertStreamResult::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace grpc
+}  // namespace milvus
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::milvus::grpc::KeyValuePair* Arena::CreateMaybeMessage< ::milvus::grpc::KeyValuePair >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::KeyValuePair >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionName* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionName >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::CollectionName >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionNameList* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionNameList >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::CollectionNameList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionSchema* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionSchema >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::CollectionSchema >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PartitionParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PartitionList* Arena::CreateMaybeMessage< ::milvus::grpc::PartitionList >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PartitionList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::RowRecord* Arena::CreateMaybeMessage< ::milvus::grpc::RowRecord >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::RowRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage< ::milvus::grpc::InsertParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::InsertParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorIds* Arena::CreateMaybeMessage< ::milvus::grpc::VectorIds >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorIds >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchInFilesParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchInFilesParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchInFilesParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::SearchByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::SearchByIDParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::SearchByIDParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PreloadCollectionParam* Arena::CreateMaybeMessage< ::milvus::grpc::PreloadCollectionParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PreloadCollectionParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::ReLoadSegmentsParam* Arena::CreateMaybeMessage< ::milvus::grpc::ReLoadSegmentsParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::ReLoadSegmentsParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::TopKQueryResult* Arena::CreateMaybeMessage< ::milvus::grpc::TopKQueryResult >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::TopKQueryResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::StringReply* Arena::CreateMaybeMessage< ::milvus::grpc::StringReply >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::StringReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage< ::milvus::grpc::BoolReply >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::BoolReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionRowCount* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionRowCount >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::CollectionRowCount >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::Command* Arena::CreateMaybeMessage< ::milvus::grpc::Command >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::Command >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage< ::milvus::grpc::IndexParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::IndexParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::FlushParam* Arena::CreateMaybeMessage< ::milvus::grpc::FlushParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::FlushParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::DeleteByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::DeleteByIDParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::DeleteByIDParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::CollectionInfo* Arena::CreateMaybeMessage< ::milvus::grpc::CollectionInfo >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::CollectionInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsIdentity* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsIdentity >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorsIdentity >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::VectorsData* Arena::CreateMaybeMessage< ::milvus::grpc::VectorsData >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::VectorsData >(arena);
 }
 template<> PROTOBUF_NOINLINE ::milvus::grpc::GetVectorIDsParam* Arena::CreateMaybeMessage< ::milvus::grpc::GetVectorIDsParam >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::GetVectorIDsParam >(arena);
@@ -20976,6 +23026,18 @@ template<> PROTOBUF_NOINLINE ::milvus::grpc::HDeleteByIDParam* Arena::CreateMayb
 template<> PROTOBUF_NOINLINE ::milvus::grpc::HIndexParam* Arena::CreateMaybeMessage< ::milvus::grpc::HIndexParam >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::HIndexParam >(arena);
 }
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PackedInsertParam* Arena::CreateMaybeMessage< ::milvus::grpc::PackedInsertParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PackedInsertParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::PackedSearchParam* Arena::CreateMaybeMessage< ::milvus::grpc::PackedSearchParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::PackedSearchParam >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::IdRange* Arena::CreateMaybeMessage< ::milvus::grpc::IdRange >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::IdRange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::milvus::grpc::InsertStreamResult* Arena::CreateMaybeMessage< ::milvus::grpc::InsertStreamResult >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::InsertStreamResult >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
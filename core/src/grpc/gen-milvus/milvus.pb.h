@@ -49,7 +49,7 @@ struct TableStruct_milvus_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[50]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[54]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -139,12 +139,18 @@ extern HSearchInSegmentsParamDefaultTypeInternal _HSearchInSegmentsParam_default
 class HSearchParam;
 class HSearchParamDefaultTypeInternal;
 extern HSearchParamDefaultTypeInternal _HSearchParam_default_instance_;
+class IdRange;
+class IdRangeDefaultTypeInternal;
+extern IdRangeDefaultTypeInternal _IdRange_default_instance_;
 class IndexParam;
 class IndexParamDefaultTypeInternal;
 extern IndexParamDefaultTypeInternal _IndexParam_default_instance_;
 class InsertParam;
 class InsertParamDefaultTypeInternal;
 extern InsertParamDefaultTypeInternal _InsertParam_default_instance_;
+class InsertStreamResult;
+class InsertStreamResultDefaultTypeInternal;
+extern InsertStreamResultDefaultTypeInternal _InsertStreamResult_default_instance_;
 class KeyValuePair;
 class KeyValuePairDefaultTypeInternal;
 extern KeyValuePairDefaultTypeInternal _KeyValuePair_default_instance_;
@@ -154,6 +160,12 @@ extern MappingDefaultTypeInternal _Mapping_default_instance_;
 class MappingList;
 class MappingListDefaultTypeInternal;
 extern MappingListDefaultTypeInternal _MappingList_default_instance_;
+class PackedInsertParam;
+class PackedInsertParamDefaultTypeInternal;
+extern PackedInsertParamDefaultTypeInternal _PackedInsertParam_default_instance_;
+class PackedSearchParam;
+class PackedSearchParamDefaultTypeInternal;
+extern PackedSearchParamDefaultTypeInternal _PackedSearchParam_default_instance_;
 class PartitionList;
 class PartitionListDefaultTypeInternal;
 extern PartitionListDefaultTypeInternal _PartitionList_default_instance_;
@@ -238,11 +250,15 @@ template<> ::milvus::grpc::HInsertParam* Arena::CreateMaybeMessage<::milvus::grp
 template<> ::milvus::grpc::HQueryResult* Arena::CreateMaybeMessage<::milvus::grpc::HQueryResult>(Arena*);
 template<> ::milvus::grpc::HSearchInSegmentsParam* Arena::CreateMaybeMessage<::milvus::grpc::HSearchInSegmentsParam>(Arena*);
 template<> ::milvus::grpc::HSearchParam* Arena::CreateMaybeMessage<::milvus::grpc::HSearchParam>(Arena*);
+template<> ::milvus::grpc::IdRange* Arena::CreateMaybeMessage<::milvus::grpc::IdRange>(Arena*);
 template<> ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage<::milvus::grpc::IndexParam>(Arena*);
 template<> ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage<::milvus::grpc::InsertParam>(Arena*);
+template<> ::milvus::grpc::InsertStreamResult* Arena::CreateMaybeMessage<::milvus::grpc::InsertStreamResult>(Arena*);
 template<> ::milvus::grpc::KeyValuePair* Arena::CreateMaybeMessage<::milvus::grpc::KeyValuePair>(Arena*);
 template<> ::milvus::grpc::Mapping* Arena::CreateMaybeMessage<::milvus::grpc::Mapping>(Arena*);
 template<> ::milvus::grpc::MappingList* Arena::CreateMaybeMessage<::milvus::grpc::MappingList>(Arena*);
+template<> ::milvus::grpc::PackedInsertParam* Arena::CreateMaybeMessage<::milvus::grpc::PackedInsertParam>(Arena*);
+template<> ::milvus::grpc::PackedSearchParam* Arena::CreateMaybeMessage<::milvus::grpc::PackedSearchParam>(Arena*);
 template<> ::milvus::grpc::PartitionList* Arena::CreateMaybeMessage<::milvus::grpc::PartitionList>(Arena*);
 template<> ::milvus::grpc::PartitionParam* Arena::CreateMaybeMessage<::milvus::grpc::PartitionParam>(Arena*);
 template<> ::milvus::grpc::PreloadCollectionParam* Arena::CreateMaybeMessage<::milvus::grpc::PreloadCollectionParam>(Arena*);
@@ -355,6 +371,31 @@ inline bool Occur_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Occur>(
     Occur_descriptor(), name, value);
 }
+enum VectorDataType : int {
+  VECTOR_FLOAT = 0,
+  VECTOR_BINARY = 1,
+  VectorDataType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
+  VectorDataType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+};
+bool VectorDataType_IsValid(int value);
+constexpr VectorDataType VectorDataType_MIN = VECTOR_FLOAT;
+constexpr VectorDataType VectorDataType_MAX = VECTOR_BINARY;
+constexpr int VectorDataType_ARRAYSIZE = VectorDataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VectorDataType_descriptor();
+template<typename T>
+inline const std::string& VectorDataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VectorDataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VectorDataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    VectorDataType_descriptor(), enum_t_value);
+}
+inline bool VectorDataType_Parse(
+    const std::string& name, VectorDataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VectorDataType>(
+    VectorDataType_descriptor(), name, value);
+}
 // ===================================================================
 
 class KeyValuePair :
@@ -8363,215 +8404,921 @@ class HIndexParam :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class PackedInsertParam :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.PackedInsertParam) */ {
+ public:
+  PackedInsertParam();
+  virtual ~PackedInsertParam();
 
-// ===================================================================
+  PackedInsertParam(const PackedInsertParam& from);
+  PackedInsertParam(PackedInsertParam&& from) noexcept
+    : PackedInsertParam() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// KeyValuePair
+  inline PackedInsertParam& operator=(const PackedInsertParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedInsertParam& operator=(PackedInsertParam&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string key = 1;
-inline void KeyValuePair::clear_key() {
-  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& KeyValuePair::key() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.KeyValuePair.key)
-  return key_.GetNoArena();
-}
-inline void KeyValuePair::set_key(const std::string& value) {
-  
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.KeyValuePair.key)
-}
-inline void KeyValuePair::set_key(std::string&& value) {
-  
-  key_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.KeyValuePair.key)
-}
-inline void KeyValuePair::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.KeyValuePair.key)
-}
-inline void KeyValuePair::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.KeyValuePair.key)
-}
-inline std::string* KeyValuePair::mutable_key() {
-  
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.KeyValuePair.key)
-  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* KeyValuePair::release_key() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.KeyValuePair.key)
-  
-  return key_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void KeyValuePair::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.KeyValuePair.key)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PackedInsertParam& default_instance();
 
-// string value = 2;
-inline void KeyValuePair::clear_value() {
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& KeyValuePair::value() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.KeyValuePair.value)
-  return value_.GetNoArena();
-}
-inline void KeyValuePair::set_value(const std::string& value) {
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.KeyValuePair.value)
-}
-inline void KeyValuePair::set_value(std::string&& value) {
-  
-  value_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.KeyValuePair.value)
-}
-inline void KeyValuePair::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.KeyValuePair.value)
-}
-inline void KeyValuePair::set_value(const char* value, size_t size) {
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.KeyValuePair.value)
-}
-inline std::string* KeyValuePair::mutable_value() {
-  
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.KeyValuePair.value)
-  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* KeyValuePair::release_value() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.KeyValuePair.value)
-  
-  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void KeyValuePair::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
-  } else {
-    
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PackedInsertParam* internal_default_instance() {
+    return reinterpret_cast<const PackedInsertParam*>(
+               &_PackedInsertParam_default_instance_);
   }
-  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.KeyValuePair.value)
-}
+  static constexpr int kIndexInFileMessages =
+    50;
 
-// -------------------------------------------------------------------
+  friend void swap(PackedInsertParam& a, PackedInsertParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedInsertParam* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
 
-// CollectionName
+  // implements Message ----------------------------------------------
 
-// string collection_name = 1;
-inline void CollectionName::clear_collection_name() {
-  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& CollectionName::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.CollectionName.collection_name)
-  return collection_name_.GetNoArena();
-}
-inline void CollectionName::set_collection_name(const std::string& value) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.CollectionName.collection_name)
-}
-inline void CollectionName::set_collection_name(std::string&& value) {
-  
-  collection_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.CollectionName.collection_name)
-}
-inline void CollectionName::set_collection_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.CollectionName.collection_name)
-}
-inline void CollectionName::set_collection_name(const char* value, size_t size) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.CollectionName.collection_name)
-}
-inline std::string* CollectionName::mutable_collection_name() {
-  
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.CollectionName.collection_name)
-  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* CollectionName::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.CollectionName.collection_name)
-  
-  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void CollectionName::set_allocated_collection_name(std::string* collection_name) {
-  if (collection_name != nullptr) {
-    
-  } else {
-    
+  inline PackedInsertParam* New() const final {
+    return CreateMaybeMessage<PackedInsertParam>(nullptr);
   }
-  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.CollectionName.collection_name)
-}
 
-// -------------------------------------------------------------------
+  PackedInsertParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PackedInsertParam>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PackedInsertParam& from);
+  void MergeFrom(const PackedInsertParam& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// CollectionNameList
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
 
-// .milvus.grpc.Status status = 1;
-inline bool CollectionNameList::has_status() const {
-  return this != internal_default_instance() && status_ != nullptr;
-}
-inline const ::milvus::grpc::Status& CollectionNameList::status() const {
-  const ::milvus::grpc::Status* p = status_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.CollectionNameList.status)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
-      &::milvus::grpc::_Status_default_instance_);
-}
-inline ::milvus::grpc::Status* CollectionNameList::release_status() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.CollectionNameList.status)
-  
-  ::milvus::grpc::Status* temp = status_;
-  status_ = nullptr;
-  return temp;
-}
-inline ::milvus::grpc::Status* CollectionNameList::mutable_status() {
-  
-  if (status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
-    status_ = p;
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackedInsertParam* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.PackedInsertParam";
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.CollectionNameList.status)
-  return status_;
-}
-inline void CollectionNameList::set_allocated_status(::milvus::grpc::Status* status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
   }
-  if (status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, status, submessage_arena);
-    }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRowIdArrayFieldNumber = 5,
+    kExtraParamsFieldNumber = 7,
+    kCollectionNameFieldNumber = 1,
+    kVectorDataFieldNumber = 4,
+    kPartitionTagFieldNumber = 6,
+    kDimensionFieldNumber = 3,
+    kDataTypeFieldNumber = 2,
+  };
+  // repeated int64 row_id_array = 5;
+  int row_id_array_size() const;
+  void clear_row_id_array();
+  ::PROTOBUF_NAMESPACE_ID::int64 row_id_array(int index) const;
+  void set_row_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_row_id_array(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      row_id_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_row_id_array();
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  int extra_params_size() const;
+  void clear_extra_params();
+  ::milvus::grpc::KeyValuePair* mutable_extra_params(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+      mutable_extra_params();
+  const ::milvus::grpc::KeyValuePair& extra_params(int index) const;
+  ::milvus::grpc::KeyValuePair* add_extra_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+      extra_params() const;
+
+  // string collection_name = 1;
+  void clear_collection_name();
+  const std::string& collection_name() const;
+  void set_collection_name(const std::string& value);
+  void set_collection_name(std::string&& value);
+  void set_collection_name(const char* value);
+  void set_collection_name(const char* value, size_t size);
+  std::string* mutable_collection_name();
+  std::string* release_collection_name();
+  void set_allocated_collection_name(std::string* collection_name);
+
+  // bytes vector_data = 4;
+  void clear_vector_data();
+  const std::string& vector_data() const;
+  void set_vector_data(const std::string& value);
+  void set_vector_data(std::string&& value);
+  void set_vector_data(const char* value);
+  void set_vector_data(const void* value, size_t size);
+  std::string* mutable_vector_data();
+  std::string* release_vector_data();
+  void set_allocated_vector_data(std::string* vector_data);
+
+  // string partition_tag = 6;
+  void clear_partition_tag();
+  const std::string& partition_tag() const;
+  void set_partition_tag(const std::string& value);
+  void set_partition_tag(std::string&& value);
+  void set_partition_tag(const char* value);
+  void set_partition_tag(const char* value, size_t size);
+  std::string* mutable_partition_tag();
+  std::string* release_partition_tag();
+  void set_allocated_partition_tag(std::string* partition_tag);
+
+  // int64 dimension = 3;
+  void clear_dimension();
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension() const;
+  void set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // .milvus.grpc.VectorDataType data_type = 2;
+  void clear_data_type();
+  ::milvus::grpc::VectorDataType data_type() const;
+  void set_data_type(::milvus::grpc::VectorDataType value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.PackedInsertParam)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > row_id_array_;
+  mutable std::atomic<int> _row_id_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair > extra_params_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr vector_data_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr partition_tag_;
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension_;
+  int data_type_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PackedSearchParam :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.PackedSearchParam) */ {
+ public:
+  PackedSearchParam();
+  virtual ~PackedSearchParam();
+
+  PackedSearchParam(const PackedSearchParam& from);
+  PackedSearchParam(PackedSearchParam&& from) noexcept
+    : PackedSearchParam() {
+    *this = ::std::move(from);
+  }
+
+  inline PackedSearchParam& operator=(const PackedSearchParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PackedSearchParam& operator=(PackedSearchParam&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PackedSearchParam& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const PackedSearchParam* internal_default_instance() {
+    return reinterpret_cast<const PackedSearchParam*>(
+               &_PackedSearchParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(PackedSearchParam& a, PackedSearchParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PackedSearchParam* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PackedSearchParam* New() const final {
+    return CreateMaybeMessage<PackedSearchParam>(nullptr);
+  }
+
+  PackedSearchParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PackedSearchParam>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PackedSearchParam& from);
+  void MergeFrom(const PackedSearchParam& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PackedSearchParam* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.PackedSearchParam";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPartitionTagArrayFieldNumber = 2,
+    kExtraParamsFieldNumber = 7,
+    kCollectionNameFieldNumber = 1,
+    kQueryDataFieldNumber = 5,
+    kDimensionFieldNumber = 4,
+    kTopkFieldNumber = 6,
+    kDataTypeFieldNumber = 3,
+  };
+  // repeated string partition_tag_array = 2;
+  int partition_tag_array_size() const;
+  void clear_partition_tag_array();
+  const std::string& partition_tag_array(int index) const;
+  std::string* mutable_partition_tag_array(int index);
+  void set_partition_tag_array(int index, const std::string& value);
+  void set_partition_tag_array(int index, std::string&& value);
+  void set_partition_tag_array(int index, const char* value);
+  void set_partition_tag_array(int index, const char* value, size_t size);
+  std::string* add_partition_tag_array();
+  void add_partition_tag_array(const std::string& value);
+  void add_partition_tag_array(std::string&& value);
+  void add_partition_tag_array(const char* value);
+  void add_partition_tag_array(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& partition_tag_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_partition_tag_array();
+
+  // repeated .milvus.grpc.KeyValuePair extra_params = 7;
+  int extra_params_size() const;
+  void clear_extra_params();
+  ::milvus::grpc::KeyValuePair* mutable_extra_params(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+      mutable_extra_params();
+  const ::milvus::grpc::KeyValuePair& extra_params(int index) const;
+  ::milvus::grpc::KeyValuePair* add_extra_params();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+      extra_params() const;
+
+  // string collection_name = 1;
+  void clear_collection_name();
+  const std::string& collection_name() const;
+  void set_collection_name(const std::string& value);
+  void set_collection_name(std::string&& value);
+  void set_collection_name(const char* value);
+  void set_collection_name(const char* value, size_t size);
+  std::string* mutable_collection_name();
+  std::string* release_collection_name();
+  void set_allocated_collection_name(std::string* collection_name);
+
+  // bytes query_data = 5;
+  void clear_query_data();
+  const std::string& query_data() const;
+  void set_query_data(const std::string& value);
+  void set_query_data(std::string&& value);
+  void set_query_data(const char* value);
+  void set_query_data(const void* value, size_t size);
+  std::string* mutable_query_data();
+  std::string* release_query_data();
+  void set_allocated_query_data(std::string* query_data);
+
+  // int64 dimension = 4;
+  void clear_dimension();
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension() const;
+  void set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 topk = 6;
+  void clear_topk();
+  ::PROTOBUF_NAMESPACE_ID::int64 topk() const;
+  void set_topk(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // .milvus.grpc.VectorDataType data_type = 3;
+  void clear_data_type();
+  ::milvus::grpc::VectorDataType data_type() const;
+  void set_data_type(::milvus::grpc::VectorDataType value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.PackedSearchParam)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> partition_tag_array_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair > extra_params_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collection_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr query_data_;
+  ::PROTOBUF_NAMESPACE_ID::int64 dimension_;
+  ::PROTOBUF_NAMESPACE_ID::int64 topk_;
+  int data_type_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IdRange :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.IdRange) */ {
+ public:
+  IdRange();
+  virtual ~IdRange();
+
+  IdRange(const IdRange& from);
+  IdRange(IdRange&& from) noexcept
+    : IdRange() {
+    *this = ::std::move(from);
+  }
+
+  inline IdRange& operator=(const IdRange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IdRange& operator=(IdRange&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const IdRange& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const IdRange* internal_default_instance() {
+    return reinterpret_cast<const IdRange*>(
+               &_IdRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    52;
+
+  friend void swap(IdRange& a, IdRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IdRange* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline IdRange* New() const final {
+    return CreateMaybeMessage<IdRange>(nullptr);
+  }
+
+  IdRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<IdRange>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const IdRange& from);
+  void MergeFrom(const IdRange& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IdRange* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.IdRange";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstIdFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // int64 first_id = 1;
+  void clear_first_id();
+  ::PROTOBUF_NAMESPACE_ID::int64 first_id() const;
+  void set_first_id(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 count = 2;
+  void clear_count();
+  ::PROTOBUF_NAMESPACE_ID::int64 count() const;
+  void set_count(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.IdRange)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::int64 first_id_;
+  ::PROTOBUF_NAMESPACE_ID::int64 count_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InsertStreamResult :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.InsertStreamResult) */ {
+ public:
+  InsertStreamResult();
+  virtual ~InsertStreamResult();
+
+  InsertStreamResult(const InsertStreamResult& from);
+  InsertStreamResult(InsertStreamResult&& from) noexcept
+    : InsertStreamResult() {
+    *this = ::std::move(from);
+  }
+
+  inline InsertStreamResult& operator=(const InsertStreamResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InsertStreamResult& operator=(InsertStreamResult&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const InsertStreamResult& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const InsertStreamResult* internal_default_instance() {
+    return reinterpret_cast<const InsertStreamResult*>(
+               &_InsertStreamResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    53;
+
+  friend void swap(InsertStreamResult& a, InsertStreamResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InsertStreamResult* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline InsertStreamResult* New() const final {
+    return CreateMaybeMessage<InsertStreamResult>(nullptr);
+  }
+
+  InsertStreamResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<InsertStreamResult>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const InsertStreamResult& from);
+  void MergeFrom(const InsertStreamResult& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertStreamResult* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.InsertStreamResult";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdRangesFieldNumber = 3,
+    kStatusFieldNumber = 1,
+    kRowCountFieldNumber = 2,
+    kLsnFieldNumber = 4,
+  };
+  // repeated .milvus.grpc.IdRange id_ranges = 3;
+  int id_ranges_size() const;
+  void clear_id_ranges();
+  ::milvus::grpc::IdRange* mutable_id_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::IdRange >*
+      mutable_id_ranges();
+  const ::milvus::grpc::IdRange& id_ranges(int index) const;
+  ::milvus::grpc::IdRange* add_id_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::IdRange >&
+      id_ranges() const;
+
+  // .milvus.grpc.Status status = 1;
+  bool has_status() const;
+  void clear_status();
+  const ::milvus::grpc::Status& status() const;
+  ::milvus::grpc::Status* release_status();
+  ::milvus::grpc::Status* mutable_status();
+  void set_allocated_status(::milvus::grpc::Status* status);
+
+  // int64 row_count = 2;
+  void clear_row_count();
+  ::PROTOBUF_NAMESPACE_ID::int64 row_count() const;
+  void set_row_count(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 lsn = 4;
+  void clear_lsn();
+  ::PROTOBUF_NAMESPACE_ID::int64 lsn() const;
+  void set_lsn(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.InsertStreamResult)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::IdRange > id_ranges_;
+  ::milvus::grpc::Status* status_;
+  ::PROTOBUF_NAMESPACE_ID::int64 row_count_;
+  ::PROTOBUF_NAMESPACE_ID::int64 lsn_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// KeyValuePair
+
+// string key = 1;
+inline void KeyValuePair::clear_key() {
+  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& KeyValuePair::key() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.KeyValuePair.key)
+  return key_.GetNoArena();
+}
+inline void KeyValuePair::set_key(const std::string& value) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.KeyValuePair.key)
+}
+inline void KeyValuePair::set_key(std::string&& value) {
+  
+  key_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.KeyValuePair.key)
+}
+inline void KeyValuePair::set_key(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.KeyValuePair.key)
+}
+inline void KeyValuePair::set_key(const char* value, size_t size) {
+  
+  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.KeyValuePair.key)
+}
+inline std::string* KeyValuePair::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.KeyValuePair.key)
+  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* KeyValuePair::release_key() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.KeyValuePair.key)
+  
+  return key_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void KeyValuePair::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.KeyValuePair.key)
+}
+
+// string value = 2;
+inline void KeyValuePair::clear_value() {
+  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& KeyValuePair::value() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.KeyValuePair.value)
+  return value_.GetNoArena();
+}
+inline void KeyValuePair::set_value(const std::string& value) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.KeyValuePair.value)
+}
+inline void KeyValuePair::set_value(std::string&& value) {
+  
+  value_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.KeyValuePair.value)
+}
+inline void KeyValuePair::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.KeyValuePair.value)
+}
+inline void KeyValuePair::set_value(const char* value, size_t size) {
+  
+  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.KeyValuePair.value)
+}
+inline std::string* KeyValuePair::mutable_value() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.KeyValuePair.value)
+  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* KeyValuePair::release_value() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.KeyValuePair.value)
+  
+  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void KeyValuePair::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.KeyValuePair.value)
+}
+
+// -------------------------------------------------------------------
+
+// CollectionName
+
+// string collection_name = 1;
+inline void CollectionName::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& CollectionName::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.CollectionName.collection_name)
+  return collection_name_.GetNoArena();
+}
+inline void CollectionName::set_collection_name(const std::string& value) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.CollectionName.collection_name)
+}
+inline void CollectionName::set_collection_name(std::string&& value) {
+  
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.CollectionName.collection_name)
+}
+inline void CollectionName::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.CollectionName.collection_name)
+}
+inline void CollectionName::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.CollectionName.collection_name)
+}
+inline std::string* CollectionName::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.CollectionName.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* CollectionName::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.CollectionName.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void CollectionName::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
+    
+  } else {
+    
+  }
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.CollectionName.collection_name)
+}
+
+// -------------------------------------------------------------------
+
+// CollectionNameList
+
+// .milvus.grpc.Status status = 1;
+inline bool CollectionNameList::has_status() const {
+  return this != internal_default_instance() && status_ != nullptr;
+}
+inline const ::milvus::grpc::Status& CollectionNameList::status() const {
+  const ::milvus::grpc::Status* p = status_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.CollectionNameList.status)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
+      &::milvus::grpc::_Status_default_instance_);
+}
+inline ::milvus::grpc::Status* CollectionNameList::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.CollectionNameList.status)
+  
+  ::milvus::grpc::Status* temp = status_;
+  status_ = nullptr;
+  return temp;
+}
+inline ::milvus::grpc::Status* CollectionNameList::mutable_status() {
+  
+  if (status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
+    status_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.CollectionNameList.status)
+  return status_;
+}
+inline void CollectionNameList::set_allocated_status(::milvus::grpc::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
@@ -12796,700 +13543,1139 @@ inline ::milvus::grpc::RangeQuery* GeneralQuery::mutable_range_query() {
   return query_.range_query_;
 }
 
-// .milvus.grpc.VectorQuery vector_query = 4;
-inline bool GeneralQuery::has_vector_query() const {
-  return query_case() == kVectorQuery;
+// .milvus.grpc.VectorQuery vector_query = 4;
+inline bool GeneralQuery::has_vector_query() const {
+  return query_case() == kVectorQuery;
+}
+inline void GeneralQuery::set_has_vector_query() {
+  _oneof_case_[0] = kVectorQuery;
+}
+inline void GeneralQuery::clear_vector_query() {
+  if (has_vector_query()) {
+    delete query_.vector_query_;
+    clear_has_query();
+  }
+}
+inline ::milvus::grpc::VectorQuery* GeneralQuery::release_vector_query() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.GeneralQuery.vector_query)
+  if (has_vector_query()) {
+    clear_has_query();
+      ::milvus::grpc::VectorQuery* temp = query_.vector_query_;
+    query_.vector_query_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::milvus::grpc::VectorQuery& GeneralQuery::vector_query() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.GeneralQuery.vector_query)
+  return has_vector_query()
+      ? *query_.vector_query_
+      : *reinterpret_cast< ::milvus::grpc::VectorQuery*>(&::milvus::grpc::_VectorQuery_default_instance_);
+}
+inline ::milvus::grpc::VectorQuery* GeneralQuery::mutable_vector_query() {
+  if (!has_vector_query()) {
+    clear_query();
+    set_has_vector_query();
+    query_.vector_query_ = CreateMaybeMessage< ::milvus::grpc::VectorQuery >(
+        GetArenaNoVirtual());
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.GeneralQuery.vector_query)
+  return query_.vector_query_;
+}
+
+inline bool GeneralQuery::has_query() const {
+  return query_case() != QUERY_NOT_SET;
+}
+inline void GeneralQuery::clear_has_query() {
+  _oneof_case_[0] = QUERY_NOT_SET;
+}
+inline GeneralQuery::QueryCase GeneralQuery::query_case() const {
+  return GeneralQuery::QueryCase(_oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// HSearchParam
+
+// string collection_name = 1;
+inline void HSearchParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& HSearchParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.collection_name)
+  return collection_name_.GetNoArena();
+}
+inline void HSearchParam::set_collection_name(const std::string& value) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.collection_name)
+}
+inline void HSearchParam::set_collection_name(std::string&& value) {
+  
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HSearchParam.collection_name)
+}
+inline void HSearchParam::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchParam.collection_name)
+}
+inline void HSearchParam::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchParam.collection_name)
+}
+inline std::string* HSearchParam::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* HSearchParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchParam.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void HSearchParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
+    
+  } else {
+    
+  }
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchParam.collection_name)
+}
+
+// repeated string partition_tag_array = 2;
+inline int HSearchParam::partition_tag_array_size() const {
+  return partition_tag_array_.size();
+}
+inline void HSearchParam::clear_partition_tag_array() {
+  partition_tag_array_.Clear();
+}
+inline const std::string& HSearchParam::partition_tag_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.partition_tag_array)
+  return partition_tag_array_.Get(index);
+}
+inline std::string* HSearchParam::mutable_partition_tag_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.partition_tag_array)
+  return partition_tag_array_.Mutable(index);
+}
+inline void HSearchParam::set_partition_tag_array(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(value);
+}
+inline void HSearchParam::set_partition_tag_array(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(std::move(value));
+}
+inline void HSearchParam::set_partition_tag_array(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline void HSearchParam::set_partition_tag_array(int index, const char* value, size_t size) {
+  partition_tag_array_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline std::string* HSearchParam::add_partition_tag_array() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HSearchParam.partition_tag_array)
+  return partition_tag_array_.Add();
+}
+inline void HSearchParam::add_partition_tag_array(const std::string& value) {
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline void HSearchParam::add_partition_tag_array(std::string&& value) {
+  partition_tag_array_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline void HSearchParam::add_partition_tag_array(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline void HSearchParam::add_partition_tag_array(const char* value, size_t size) {
+  partition_tag_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HSearchParam.partition_tag_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HSearchParam::partition_tag_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchParam.partition_tag_array)
+  return partition_tag_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HSearchParam::mutable_partition_tag_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchParam.partition_tag_array)
+  return &partition_tag_array_;
+}
+
+// .milvus.grpc.GeneralQuery general_query = 3;
+inline bool HSearchParam::has_general_query() const {
+  return this != internal_default_instance() && general_query_ != nullptr;
+}
+inline void HSearchParam::clear_general_query() {
+  if (GetArenaNoVirtual() == nullptr && general_query_ != nullptr) {
+    delete general_query_;
+  }
+  general_query_ = nullptr;
+}
+inline const ::milvus::grpc::GeneralQuery& HSearchParam::general_query() const {
+  const ::milvus::grpc::GeneralQuery* p = general_query_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.general_query)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::GeneralQuery*>(
+      &::milvus::grpc::_GeneralQuery_default_instance_);
+}
+inline ::milvus::grpc::GeneralQuery* HSearchParam::release_general_query() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchParam.general_query)
+  
+  ::milvus::grpc::GeneralQuery* temp = general_query_;
+  general_query_ = nullptr;
+  return temp;
+}
+inline ::milvus::grpc::GeneralQuery* HSearchParam::mutable_general_query() {
+  
+  if (general_query_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::GeneralQuery>(GetArenaNoVirtual());
+    general_query_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.general_query)
+  return general_query_;
+}
+inline void HSearchParam::set_allocated_general_query(::milvus::grpc::GeneralQuery* general_query) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete general_query_;
+  }
+  if (general_query) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      general_query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, general_query, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  general_query_ = general_query;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchParam.general_query)
+}
+
+// repeated .milvus.grpc.KeyValuePair extra_params = 4;
+inline int HSearchParam::extra_params_size() const {
+  return extra_params_.size();
+}
+inline void HSearchParam::clear_extra_params() {
+  extra_params_.Clear();
+}
+inline ::milvus::grpc::KeyValuePair* HSearchParam::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.extra_params)
+  return extra_params_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+HSearchParam::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchParam.extra_params)
+  return &extra_params_;
+}
+inline const ::milvus::grpc::KeyValuePair& HSearchParam::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.extra_params)
+  return extra_params_.Get(index);
+}
+inline ::milvus::grpc::KeyValuePair* HSearchParam::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.extra_params)
+  return extra_params_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+HSearchParam::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchParam.extra_params)
+  return extra_params_;
+}
+
+// -------------------------------------------------------------------
+
+// HSearchInSegmentsParam
+
+// repeated string segment_id_array = 1;
+inline int HSearchInSegmentsParam::segment_id_array_size() const {
+  return segment_id_array_.size();
 }
-inline void GeneralQuery::set_has_vector_query() {
-  _oneof_case_[0] = kVectorQuery;
+inline void HSearchInSegmentsParam::clear_segment_id_array() {
+  segment_id_array_.Clear();
 }
-inline void GeneralQuery::clear_vector_query() {
-  if (has_vector_query()) {
-    delete query_.vector_query_;
-    clear_has_query();
-  }
+inline const std::string& HSearchInSegmentsParam::segment_id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  return segment_id_array_.Get(index);
 }
-inline ::milvus::grpc::VectorQuery* GeneralQuery::release_vector_query() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.GeneralQuery.vector_query)
-  if (has_vector_query()) {
-    clear_has_query();
-      ::milvus::grpc::VectorQuery* temp = query_.vector_query_;
-    query_.vector_query_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline std::string* HSearchInSegmentsParam::mutable_segment_id_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  return segment_id_array_.Mutable(index);
 }
-inline const ::milvus::grpc::VectorQuery& GeneralQuery::vector_query() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.GeneralQuery.vector_query)
-  return has_vector_query()
-      ? *query_.vector_query_
-      : *reinterpret_cast< ::milvus::grpc::VectorQuery*>(&::milvus::grpc::_VectorQuery_default_instance_);
+inline void HSearchInSegmentsParam::set_segment_id_array(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  segment_id_array_.Mutable(index)->assign(value);
 }
-inline ::milvus::grpc::VectorQuery* GeneralQuery::mutable_vector_query() {
-  if (!has_vector_query()) {
-    clear_query();
-    set_has_vector_query();
-    query_.vector_query_ = CreateMaybeMessage< ::milvus::grpc::VectorQuery >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.GeneralQuery.vector_query)
-  return query_.vector_query_;
+inline void HSearchInSegmentsParam::set_segment_id_array(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  segment_id_array_.Mutable(index)->assign(std::move(value));
 }
-
-inline bool GeneralQuery::has_query() const {
-  return query_case() != QUERY_NOT_SET;
+inline void HSearchInSegmentsParam::set_segment_id_array(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  segment_id_array_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline void GeneralQuery::clear_has_query() {
-  _oneof_case_[0] = QUERY_NOT_SET;
+inline void HSearchInSegmentsParam::set_segment_id_array(int index, const char* value, size_t size) {
+  segment_id_array_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline GeneralQuery::QueryCase GeneralQuery::query_case() const {
-  return GeneralQuery::QueryCase(_oneof_case_[0]);
+inline std::string* HSearchInSegmentsParam::add_segment_id_array() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  return segment_id_array_.Add();
 }
-// -------------------------------------------------------------------
-
-// HSearchParam
-
-// string collection_name = 1;
-inline void HSearchParam::clear_collection_name() {
-  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void HSearchInSegmentsParam::add_segment_id_array(const std::string& value) {
+  segment_id_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline const std::string& HSearchParam::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.collection_name)
-  return collection_name_.GetNoArena();
+inline void HSearchInSegmentsParam::add_segment_id_array(std::string&& value) {
+  segment_id_array_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline void HSearchParam::set_collection_name(const std::string& value) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.collection_name)
+inline void HSearchInSegmentsParam::add_segment_id_array(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  segment_id_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline void HSearchParam::set_collection_name(std::string&& value) {
-  
-  collection_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HSearchParam.collection_name)
+inline void HSearchInSegmentsParam::add_segment_id_array(const char* value, size_t size) {
+  segment_id_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
 }
-inline void HSearchParam::set_collection_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchParam.collection_name)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HSearchInSegmentsParam::segment_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  return segment_id_array_;
 }
-inline void HSearchParam::set_collection_name(const char* value, size_t size) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchParam.collection_name)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HSearchInSegmentsParam::mutable_segment_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  return &segment_id_array_;
 }
-inline std::string* HSearchParam::mutable_collection_name() {
+
+// .milvus.grpc.HSearchParam search_param = 2;
+inline bool HSearchInSegmentsParam::has_search_param() const {
+  return this != internal_default_instance() && search_param_ != nullptr;
+}
+inline void HSearchInSegmentsParam::clear_search_param() {
+  if (GetArenaNoVirtual() == nullptr && search_param_ != nullptr) {
+    delete search_param_;
+  }
+  search_param_ = nullptr;
+}
+inline const ::milvus::grpc::HSearchParam& HSearchInSegmentsParam::search_param() const {
+  const ::milvus::grpc::HSearchParam* p = search_param_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchInSegmentsParam.search_param)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::HSearchParam*>(
+      &::milvus::grpc::_HSearchParam_default_instance_);
+}
+inline ::milvus::grpc::HSearchParam* HSearchInSegmentsParam::release_search_param() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchInSegmentsParam.search_param)
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.collection_name)
-  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::milvus::grpc::HSearchParam* temp = search_param_;
+  search_param_ = nullptr;
+  return temp;
 }
-inline std::string* HSearchParam::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchParam.collection_name)
+inline ::milvus::grpc::HSearchParam* HSearchInSegmentsParam::mutable_search_param() {
   
-  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (search_param_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::HSearchParam>(GetArenaNoVirtual());
+    search_param_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchInSegmentsParam.search_param)
+  return search_param_;
 }
-inline void HSearchParam::set_allocated_collection_name(std::string* collection_name) {
-  if (collection_name != nullptr) {
+inline void HSearchInSegmentsParam::set_allocated_search_param(::milvus::grpc::HSearchParam* search_param) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete search_param_;
+  }
+  if (search_param) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      search_param = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, search_param, submessage_arena);
+    }
     
   } else {
     
   }
-  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchParam.collection_name)
+  search_param_ = search_param;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchInSegmentsParam.search_param)
 }
 
-// repeated string partition_tag_array = 2;
-inline int HSearchParam::partition_tag_array_size() const {
-  return partition_tag_array_.size();
+// -------------------------------------------------------------------
+
+// AttrRecord
+
+// repeated string value = 1;
+inline int AttrRecord::value_size() const {
+  return value_.size();
 }
-inline void HSearchParam::clear_partition_tag_array() {
-  partition_tag_array_.Clear();
+inline void AttrRecord::clear_value() {
+  value_.Clear();
 }
-inline const std::string& HSearchParam::partition_tag_array(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.partition_tag_array)
-  return partition_tag_array_.Get(index);
+inline const std::string& AttrRecord::value(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.AttrRecord.value)
+  return value_.Get(index);
 }
-inline std::string* HSearchParam::mutable_partition_tag_array(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.partition_tag_array)
-  return partition_tag_array_.Mutable(index);
+inline std::string* AttrRecord::mutable_value(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.AttrRecord.value)
+  return value_.Mutable(index);
 }
-inline void HSearchParam::set_partition_tag_array(int index, const std::string& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.partition_tag_array)
-  partition_tag_array_.Mutable(index)->assign(value);
+inline void AttrRecord::set_value(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrRecord.value)
+  value_.Mutable(index)->assign(value);
 }
-inline void HSearchParam::set_partition_tag_array(int index, std::string&& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchParam.partition_tag_array)
-  partition_tag_array_.Mutable(index)->assign(std::move(value));
+inline void AttrRecord::set_value(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.AttrRecord.value)
+  value_.Mutable(index)->assign(std::move(value));
 }
-inline void HSearchParam::set_partition_tag_array(int index, const char* value) {
+inline void AttrRecord::set_value(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  partition_tag_array_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchParam.partition_tag_array)
+  value_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.AttrRecord.value)
 }
-inline void HSearchParam::set_partition_tag_array(int index, const char* value, size_t size) {
-  partition_tag_array_.Mutable(index)->assign(
+inline void AttrRecord::set_value(int index, const char* value, size_t size) {
+  value_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchParam.partition_tag_array)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.AttrRecord.value)
 }
-inline std::string* HSearchParam::add_partition_tag_array() {
-  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HSearchParam.partition_tag_array)
-  return partition_tag_array_.Add();
+inline std::string* AttrRecord::add_value() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.AttrRecord.value)
+  return value_.Add();
 }
-inline void HSearchParam::add_partition_tag_array(const std::string& value) {
-  partition_tag_array_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.partition_tag_array)
+inline void AttrRecord::add_value(const std::string& value) {
+  value_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.AttrRecord.value)
 }
-inline void HSearchParam::add_partition_tag_array(std::string&& value) {
-  partition_tag_array_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.partition_tag_array)
+inline void AttrRecord::add_value(std::string&& value) {
+  value_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.AttrRecord.value)
 }
-inline void HSearchParam::add_partition_tag_array(const char* value) {
+inline void AttrRecord::add_value(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  partition_tag_array_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:milvus.grpc.HSearchParam.partition_tag_array)
+  value_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.AttrRecord.value)
 }
-inline void HSearchParam::add_partition_tag_array(const char* value, size_t size) {
-  partition_tag_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HSearchParam.partition_tag_array)
+inline void AttrRecord::add_value(const char* value, size_t size) {
+  value_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.AttrRecord.value)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-HSearchParam::partition_tag_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchParam.partition_tag_array)
-  return partition_tag_array_;
+AttrRecord::value() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.AttrRecord.value)
+  return value_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-HSearchParam::mutable_partition_tag_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchParam.partition_tag_array)
-  return &partition_tag_array_;
+AttrRecord::mutable_value() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.AttrRecord.value)
+  return &value_;
 }
 
-// .milvus.grpc.GeneralQuery general_query = 3;
-inline bool HSearchParam::has_general_query() const {
-  return this != internal_default_instance() && general_query_ != nullptr;
-}
-inline void HSearchParam::clear_general_query() {
-  if (GetArenaNoVirtual() == nullptr && general_query_ != nullptr) {
-    delete general_query_;
-  }
-  general_query_ = nullptr;
+// -------------------------------------------------------------------
+
+// HEntity
+
+// .milvus.grpc.Status status = 1;
+inline bool HEntity::has_status() const {
+  return this != internal_default_instance() && status_ != nullptr;
 }
-inline const ::milvus::grpc::GeneralQuery& HSearchParam::general_query() const {
-  const ::milvus::grpc::GeneralQuery* p = general_query_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.general_query)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::GeneralQuery*>(
-      &::milvus::grpc::_GeneralQuery_default_instance_);
+inline const ::milvus::grpc::Status& HEntity::status() const {
+  const ::milvus::grpc::Status* p = status_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.status)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
+      &::milvus::grpc::_Status_default_instance_);
 }
-inline ::milvus::grpc::GeneralQuery* HSearchParam::release_general_query() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchParam.general_query)
+inline ::milvus::grpc::Status* HEntity::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HEntity.status)
   
-  ::milvus::grpc::GeneralQuery* temp = general_query_;
-  general_query_ = nullptr;
+  ::milvus::grpc::Status* temp = status_;
+  status_ = nullptr;
   return temp;
 }
-inline ::milvus::grpc::GeneralQuery* HSearchParam::mutable_general_query() {
+inline ::milvus::grpc::Status* HEntity::mutable_status() {
   
-  if (general_query_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::GeneralQuery>(GetArenaNoVirtual());
-    general_query_ = p;
+  if (status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
+    status_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.general_query)
-  return general_query_;
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.status)
+  return status_;
 }
-inline void HSearchParam::set_allocated_general_query(::milvus::grpc::GeneralQuery* general_query) {
+inline void HEntity::set_allocated_status(::milvus::grpc::Status* status) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete general_query_;
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
   }
-  if (general_query) {
+  if (status) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      general_query = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, general_query, submessage_arena);
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
     }
     
   } else {
     
   }
-  general_query_ = general_query;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchParam.general_query)
+  status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntity.status)
 }
 
-// repeated .milvus.grpc.KeyValuePair extra_params = 4;
-inline int HSearchParam::extra_params_size() const {
-  return extra_params_.size();
+// int64 entity_id = 2;
+inline void HEntity::clear_entity_id() {
+  entity_id_ = PROTOBUF_LONGLONG(0);
 }
-inline void HSearchParam::clear_extra_params() {
-  extra_params_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::int64 HEntity::entity_id() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.entity_id)
+  return entity_id_;
 }
-inline ::milvus::grpc::KeyValuePair* HSearchParam::mutable_extra_params(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchParam.extra_params)
-  return extra_params_.Mutable(index);
+inline void HEntity::set_entity_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  entity_id_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.entity_id)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
-HSearchParam::mutable_extra_params() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchParam.extra_params)
-  return &extra_params_;
+
+// repeated string field_names = 3;
+inline int HEntity::field_names_size() const {
+  return field_names_.size();
 }
-inline const ::milvus::grpc::KeyValuePair& HSearchParam::extra_params(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchParam.extra_params)
-  return extra_params_.Get(index);
+inline void HEntity::clear_field_names() {
+  field_names_.Clear();
 }
-inline ::milvus::grpc::KeyValuePair* HSearchParam::add_extra_params() {
-  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchParam.extra_params)
-  return extra_params_.Add();
+inline const std::string& HEntity::field_names(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.field_names)
+  return field_names_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
-HSearchParam::extra_params() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchParam.extra_params)
-  return extra_params_;
+inline std::string* HEntity::mutable_field_names(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.field_names)
+  return field_names_.Mutable(index);
 }
-
-// -------------------------------------------------------------------
-
-// HSearchInSegmentsParam
-
-// repeated string segment_id_array = 1;
-inline int HSearchInSegmentsParam::segment_id_array_size() const {
-  return segment_id_array_.size();
+inline void HEntity::set_field_names(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.field_names)
+  field_names_.Mutable(index)->assign(value);
 }
-inline void HSearchInSegmentsParam::clear_segment_id_array() {
-  segment_id_array_.Clear();
+inline void HEntity::set_field_names(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.field_names)
+  field_names_.Mutable(index)->assign(std::move(value));
 }
-inline const std::string& HSearchInSegmentsParam::segment_id_array(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  return segment_id_array_.Get(index);
+inline void HEntity::set_field_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  field_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntity.field_names)
 }
-inline std::string* HSearchInSegmentsParam::mutable_segment_id_array(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  return segment_id_array_.Mutable(index);
+inline void HEntity::set_field_names(int index, const char* value, size_t size) {
+  field_names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntity.field_names)
 }
-inline void HSearchInSegmentsParam::set_segment_id_array(int index, const std::string& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  segment_id_array_.Mutable(index)->assign(value);
+inline std::string* HEntity::add_field_names() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HEntity.field_names)
+  return field_names_.Add();
 }
-inline void HSearchInSegmentsParam::set_segment_id_array(int index, std::string&& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  segment_id_array_.Mutable(index)->assign(std::move(value));
+inline void HEntity::add_field_names(const std::string& value) {
+  field_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.field_names)
 }
-inline void HSearchInSegmentsParam::set_segment_id_array(int index, const char* value) {
+inline void HEntity::add_field_names(std::string&& value) {
+  field_names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.field_names)
+}
+inline void HEntity::add_field_names(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  segment_id_array_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+  field_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.HEntity.field_names)
 }
-inline void HSearchInSegmentsParam::set_segment_id_array(int index, const char* value, size_t size) {
-  segment_id_array_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+inline void HEntity::add_field_names(const char* value, size_t size) {
+  field_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HEntity.field_names)
 }
-inline std::string* HSearchInSegmentsParam::add_segment_id_array() {
-  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  return segment_id_array_.Add();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+HEntity::field_names() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HEntity.field_names)
+  return field_names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+HEntity::mutable_field_names() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntity.field_names)
+  return &field_names_;
+}
+
+// bytes attr_records = 4;
+inline void HEntity::clear_attr_records() {
+  attr_records_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& HEntity::attr_records() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.attr_records)
+  return attr_records_.GetNoArena();
+}
+inline void HEntity::set_attr_records(const std::string& value) {
+  
+  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.attr_records)
+}
+inline void HEntity::set_attr_records(std::string&& value) {
+  
+  attr_records_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HEntity.attr_records)
+}
+inline void HEntity::set_attr_records(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntity.attr_records)
+}
+inline void HEntity::set_attr_records(const void* value, size_t size) {
+  
+  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntity.attr_records)
+}
+inline std::string* HEntity::mutable_attr_records() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.attr_records)
+  return attr_records_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* HEntity::release_attr_records() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HEntity.attr_records)
+  
+  return attr_records_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void HEntity::set_allocated_attr_records(std::string* attr_records) {
+  if (attr_records != nullptr) {
+    
+  } else {
+    
+  }
+  attr_records_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), attr_records);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntity.attr_records)
+}
+
+// int64 row_num = 5;
+inline void HEntity::clear_row_num() {
+  row_num_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 HEntity::row_num() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.row_num)
+  return row_num_;
+}
+inline void HEntity::set_row_num(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  row_num_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.row_num)
+}
+
+// repeated .milvus.grpc.FieldValue result_values = 6;
+inline int HEntity::result_values_size() const {
+  return result_values_.size();
 }
-inline void HSearchInSegmentsParam::add_segment_id_array(const std::string& value) {
-  segment_id_array_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+inline void HEntity::clear_result_values() {
+  result_values_.Clear();
 }
-inline void HSearchInSegmentsParam::add_segment_id_array(std::string&& value) {
-  segment_id_array_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+inline ::milvus::grpc::FieldValue* HEntity::mutable_result_values(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.result_values)
+  return result_values_.Mutable(index);
 }
-inline void HSearchInSegmentsParam::add_segment_id_array(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  segment_id_array_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::FieldValue >*
+HEntity::mutable_result_values() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntity.result_values)
+  return &result_values_;
 }
-inline void HSearchInSegmentsParam::add_segment_id_array(const char* value, size_t size) {
-  segment_id_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
+inline const ::milvus::grpc::FieldValue& HEntity::result_values(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.result_values)
+  return result_values_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-HSearchInSegmentsParam::segment_id_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  return segment_id_array_;
+inline ::milvus::grpc::FieldValue* HEntity::add_result_values() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.result_values)
+  return result_values_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-HSearchInSegmentsParam::mutable_segment_id_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HSearchInSegmentsParam.segment_id_array)
-  return &segment_id_array_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::FieldValue >&
+HEntity::result_values() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HEntity.result_values)
+  return result_values_;
 }
 
-// .milvus.grpc.HSearchParam search_param = 2;
-inline bool HSearchInSegmentsParam::has_search_param() const {
-  return this != internal_default_instance() && search_param_ != nullptr;
-}
-inline void HSearchInSegmentsParam::clear_search_param() {
-  if (GetArenaNoVirtual() == nullptr && search_param_ != nullptr) {
-    delete search_param_;
-  }
-  search_param_ = nullptr;
+// -------------------------------------------------------------------
+
+// HQueryResult
+
+// .milvus.grpc.Status status = 1;
+inline bool HQueryResult::has_status() const {
+  return this != internal_default_instance() && status_ != nullptr;
 }
-inline const ::milvus::grpc::HSearchParam& HSearchInSegmentsParam::search_param() const {
-  const ::milvus::grpc::HSearchParam* p = search_param_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HSearchInSegmentsParam.search_param)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::HSearchParam*>(
-      &::milvus::grpc::_HSearchParam_default_instance_);
+inline const ::milvus::grpc::Status& HQueryResult::status() const {
+  const ::milvus::grpc::Status* p = status_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.status)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
+      &::milvus::grpc::_Status_default_instance_);
 }
-inline ::milvus::grpc::HSearchParam* HSearchInSegmentsParam::release_search_param() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HSearchInSegmentsParam.search_param)
+inline ::milvus::grpc::Status* HQueryResult::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HQueryResult.status)
   
-  ::milvus::grpc::HSearchParam* temp = search_param_;
-  search_param_ = nullptr;
+  ::milvus::grpc::Status* temp = status_;
+  status_ = nullptr;
   return temp;
 }
-inline ::milvus::grpc::HSearchParam* HSearchInSegmentsParam::mutable_search_param() {
+inline ::milvus::grpc::Status* HQueryResult::mutable_status() {
   
-  if (search_param_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::HSearchParam>(GetArenaNoVirtual());
-    search_param_ = p;
+  if (status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
+    status_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HSearchInSegmentsParam.search_param)
-  return search_param_;
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HQueryResult.status)
+  return status_;
 }
-inline void HSearchInSegmentsParam::set_allocated_search_param(::milvus::grpc::HSearchParam* search_param) {
+inline void HQueryResult::set_allocated_status(::milvus::grpc::Status* status) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete search_param_;
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
   }
-  if (search_param) {
+  if (status) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      search_param = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, search_param, submessage_arena);
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
     }
     
   } else {
     
   }
-  search_param_ = search_param;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HSearchInSegmentsParam.search_param)
+  status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HQueryResult.status)
+}
+
+// repeated .milvus.grpc.HEntity entities = 2;
+inline int HQueryResult::entities_size() const {
+  return entities_.size();
+}
+inline void HQueryResult::clear_entities() {
+  entities_.Clear();
+}
+inline ::milvus::grpc::HEntity* HQueryResult::mutable_entities(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HQueryResult.entities)
+  return entities_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::HEntity >*
+HQueryResult::mutable_entities() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.entities)
+  return &entities_;
+}
+inline const ::milvus::grpc::HEntity& HQueryResult::entities(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.entities)
+  return entities_.Get(index);
+}
+inline ::milvus::grpc::HEntity* HQueryResult::add_entities() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.entities)
+  return entities_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::HEntity >&
+HQueryResult::entities() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.entities)
+  return entities_;
+}
+
+// int64 row_num = 3;
+inline void HQueryResult::clear_row_num() {
+  row_num_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 HQueryResult::row_num() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.row_num)
+  return row_num_;
+}
+inline void HQueryResult::set_row_num(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  row_num_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.row_num)
+}
+
+// repeated float score = 4;
+inline int HQueryResult::score_size() const {
+  return score_.size();
+}
+inline void HQueryResult::clear_score() {
+  score_.Clear();
+}
+inline float HQueryResult::score(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.score)
+  return score_.Get(index);
+}
+inline void HQueryResult::set_score(int index, float value) {
+  score_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.score)
+}
+inline void HQueryResult::add_score(float value) {
+  score_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.score)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HQueryResult::score() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.score)
+  return score_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HQueryResult::mutable_score() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.score)
+  return &score_;
+}
+
+// repeated float distance = 5;
+inline int HQueryResult::distance_size() const {
+  return distance_.size();
+}
+inline void HQueryResult::clear_distance() {
+  distance_.Clear();
+}
+inline float HQueryResult::distance(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.distance)
+  return distance_.Get(index);
+}
+inline void HQueryResult::set_distance(int index, float value) {
+  distance_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.distance)
+}
+inline void HQueryResult::add_distance(float value) {
+  distance_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.distance)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HQueryResult::distance() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.distance)
+  return distance_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HQueryResult::mutable_distance() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.distance)
+  return &distance_;
 }
 
 // -------------------------------------------------------------------
 
-// AttrRecord
+// HInsertParam
 
-// repeated string value = 1;
-inline int AttrRecord::value_size() const {
-  return value_.size();
+// string collection_name = 1;
+inline void HInsertParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void AttrRecord::clear_value() {
-  value_.Clear();
+inline const std::string& HInsertParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.collection_name)
+  return collection_name_.GetNoArena();
 }
-inline const std::string& AttrRecord::value(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.AttrRecord.value)
-  return value_.Get(index);
+inline void HInsertParam::set_collection_name(const std::string& value) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.collection_name)
 }
-inline std::string* AttrRecord::mutable_value(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.AttrRecord.value)
-  return value_.Mutable(index);
+inline void HInsertParam::set_collection_name(std::string&& value) {
+  
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HInsertParam.collection_name)
 }
-inline void AttrRecord::set_value(int index, const std::string& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.AttrRecord.value)
-  value_.Mutable(index)->assign(value);
+inline void HInsertParam::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HInsertParam.collection_name)
 }
-inline void AttrRecord::set_value(int index, std::string&& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.AttrRecord.value)
-  value_.Mutable(index)->assign(std::move(value));
+inline void HInsertParam::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HInsertParam.collection_name)
+}
+inline std::string* HInsertParam::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* HInsertParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void AttrRecord::set_value(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  value_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.AttrRecord.value)
+inline void HInsertParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
+    
+  } else {
+    
+  }
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.collection_name)
 }
-inline void AttrRecord::set_value(int index, const char* value, size_t size) {
-  value_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.AttrRecord.value)
+
+// string partition_tag = 2;
+inline void HInsertParam::clear_partition_tag() {
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* AttrRecord::add_value() {
-  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.AttrRecord.value)
-  return value_.Add();
+inline const std::string& HInsertParam::partition_tag() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.partition_tag)
+  return partition_tag_.GetNoArena();
 }
-inline void AttrRecord::add_value(const std::string& value) {
-  value_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.AttrRecord.value)
+inline void HInsertParam::set_partition_tag(const std::string& value) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.partition_tag)
 }
-inline void AttrRecord::add_value(std::string&& value) {
-  value_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:milvus.grpc.AttrRecord.value)
+inline void HInsertParam::set_partition_tag(std::string&& value) {
+  
+  partition_tag_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HInsertParam.partition_tag)
 }
-inline void AttrRecord::add_value(const char* value) {
+inline void HInsertParam::set_partition_tag(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  value_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:milvus.grpc.AttrRecord.value)
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HInsertParam.partition_tag)
 }
-inline void AttrRecord::add_value(const char* value, size_t size) {
-  value_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.AttrRecord.value)
+inline void HInsertParam::set_partition_tag(const char* value, size_t size) {
+  
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HInsertParam.partition_tag)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-AttrRecord::value() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.AttrRecord.value)
-  return value_;
+inline std::string* HInsertParam::mutable_partition_tag() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.partition_tag)
+  return partition_tag_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-AttrRecord::mutable_value() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.AttrRecord.value)
-  return &value_;
+inline std::string* HInsertParam::release_partition_tag() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.partition_tag)
+  
+  return partition_tag_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void HInsertParam::set_allocated_partition_tag(std::string* partition_tag) {
+  if (partition_tag != nullptr) {
+    
+  } else {
+    
+  }
+  partition_tag_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), partition_tag);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.partition_tag)
 }
 
-// -------------------------------------------------------------------
-
-// HEntity
-
-// .milvus.grpc.Status status = 1;
-inline bool HEntity::has_status() const {
-  return this != internal_default_instance() && status_ != nullptr;
+// .milvus.grpc.HEntity entities = 3;
+inline bool HInsertParam::has_entities() const {
+  return this != internal_default_instance() && entities_ != nullptr;
 }
-inline const ::milvus::grpc::Status& HEntity::status() const {
-  const ::milvus::grpc::Status* p = status_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.status)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
-      &::milvus::grpc::_Status_default_instance_);
+inline void HInsertParam::clear_entities() {
+  if (GetArenaNoVirtual() == nullptr && entities_ != nullptr) {
+    delete entities_;
+  }
+  entities_ = nullptr;
 }
-inline ::milvus::grpc::Status* HEntity::release_status() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HEntity.status)
+inline const ::milvus::grpc::HEntity& HInsertParam::entities() const {
+  const ::milvus::grpc::HEntity* p = entities_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.entities)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::HEntity*>(
+      &::milvus::grpc::_HEntity_default_instance_);
+}
+inline ::milvus::grpc::HEntity* HInsertParam::release_entities() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.entities)
   
-  ::milvus::grpc::Status* temp = status_;
-  status_ = nullptr;
+  ::milvus::grpc::HEntity* temp = entities_;
+  entities_ = nullptr;
   return temp;
 }
-inline ::milvus::grpc::Status* HEntity::mutable_status() {
+inline ::milvus::grpc::HEntity* HInsertParam::mutable_entities() {
   
-  if (status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
-    status_ = p;
+  if (entities_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::HEntity>(GetArenaNoVirtual());
+    entities_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.status)
-  return status_;
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.entities)
+  return entities_;
 }
-inline void HEntity::set_allocated_status(::milvus::grpc::Status* status) {
+inline void HInsertParam::set_allocated_entities(::milvus::grpc::HEntity* entities) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
+    delete entities_;
   }
-  if (status) {
+  if (entities) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, status, submessage_arena);
+      entities = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, entities, submessage_arena);
     }
     
   } else {
     
   }
-  status_ = status;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntity.status)
-}
-
-// int64 entity_id = 2;
-inline void HEntity::clear_entity_id() {
-  entity_id_ = PROTOBUF_LONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::int64 HEntity::entity_id() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.entity_id)
-  return entity_id_;
-}
-inline void HEntity::set_entity_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  
-  entity_id_ = value;
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.entity_id)
+  entities_ = entities;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.entities)
 }
 
-// repeated string field_names = 3;
-inline int HEntity::field_names_size() const {
-  return field_names_.size();
-}
-inline void HEntity::clear_field_names() {
-  field_names_.Clear();
+// repeated int64 entity_id_array = 4;
+inline int HInsertParam::entity_id_array_size() const {
+  return entity_id_array_.size();
 }
-inline const std::string& HEntity::field_names(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.field_names)
-  return field_names_.Get(index);
+inline void HInsertParam::clear_entity_id_array() {
+  entity_id_array_.Clear();
 }
-inline std::string* HEntity::mutable_field_names(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.field_names)
-  return field_names_.Mutable(index);
+inline ::PROTOBUF_NAMESPACE_ID::int64 HInsertParam::entity_id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.entity_id_array)
+  return entity_id_array_.Get(index);
 }
-inline void HEntity::set_field_names(int index, const std::string& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.field_names)
-  field_names_.Mutable(index)->assign(value);
+inline void HInsertParam::set_entity_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  entity_id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.entity_id_array)
 }
-inline void HEntity::set_field_names(int index, std::string&& value) {
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.field_names)
-  field_names_.Mutable(index)->assign(std::move(value));
+inline void HInsertParam::add_entity_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  entity_id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HInsertParam.entity_id_array)
 }
-inline void HEntity::set_field_names(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  field_names_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntity.field_names)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+HInsertParam::entity_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HInsertParam.entity_id_array)
+  return entity_id_array_;
 }
-inline void HEntity::set_field_names(int index, const char* value, size_t size) {
-  field_names_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntity.field_names)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+HInsertParam::mutable_entity_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HInsertParam.entity_id_array)
+  return &entity_id_array_;
 }
-inline std::string* HEntity::add_field_names() {
-  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.HEntity.field_names)
-  return field_names_.Add();
+
+// repeated .milvus.grpc.KeyValuePair extra_params = 5;
+inline int HInsertParam::extra_params_size() const {
+  return extra_params_.size();
 }
-inline void HEntity::add_field_names(const std::string& value) {
-  field_names_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.field_names)
+inline void HInsertParam::clear_extra_params() {
+  extra_params_.Clear();
 }
-inline void HEntity::add_field_names(std::string&& value) {
-  field_names_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.field_names)
+inline ::milvus::grpc::KeyValuePair* HInsertParam::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.extra_params)
+  return extra_params_.Mutable(index);
 }
-inline void HEntity::add_field_names(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  field_names_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:milvus.grpc.HEntity.field_names)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+HInsertParam::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HInsertParam.extra_params)
+  return &extra_params_;
 }
-inline void HEntity::add_field_names(const char* value, size_t size) {
-  field_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.HEntity.field_names)
+inline const ::milvus::grpc::KeyValuePair& HInsertParam::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.extra_params)
+  return extra_params_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-HEntity::field_names() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HEntity.field_names)
-  return field_names_;
+inline ::milvus::grpc::KeyValuePair* HInsertParam::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.HInsertParam.extra_params)
+  return extra_params_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-HEntity::mutable_field_names() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntity.field_names)
-  return &field_names_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+HInsertParam::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HInsertParam.extra_params)
+  return extra_params_;
 }
 
-// bytes attr_records = 4;
-inline void HEntity::clear_attr_records() {
-  attr_records_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// HEntityIdentity
+
+// string collection_name = 1;
+inline void HEntityIdentity::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const std::string& HEntity::attr_records() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.attr_records)
-  return attr_records_.GetNoArena();
+inline const std::string& HEntityIdentity::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIdentity.collection_name)
+  return collection_name_.GetNoArena();
 }
-inline void HEntity::set_attr_records(const std::string& value) {
+inline void HEntityIdentity::set_collection_name(const std::string& value) {
   
-  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.attr_records)
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIdentity.collection_name)
 }
-inline void HEntity::set_attr_records(std::string&& value) {
+inline void HEntityIdentity::set_collection_name(std::string&& value) {
   
-  attr_records_.SetNoArena(
+  collection_name_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HEntity.attr_records)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HEntityIdentity.collection_name)
 }
-inline void HEntity::set_attr_records(const char* value) {
+inline void HEntityIdentity::set_collection_name(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntity.attr_records)
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntityIdentity.collection_name)
 }
-inline void HEntity::set_attr_records(const void* value, size_t size) {
+inline void HEntityIdentity::set_collection_name(const char* value, size_t size) {
   
-  attr_records_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntity.attr_records)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntityIdentity.collection_name)
 }
-inline std::string* HEntity::mutable_attr_records() {
+inline std::string* HEntityIdentity::mutable_collection_name() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.attr_records)
-  return attr_records_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntityIdentity.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HEntity::release_attr_records() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HEntity.attr_records)
+inline std::string* HEntityIdentity::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HEntityIdentity.collection_name)
   
-  return attr_records_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HEntity::set_allocated_attr_records(std::string* attr_records) {
-  if (attr_records != nullptr) {
+inline void HEntityIdentity::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
     
   } else {
     
   }
-  attr_records_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), attr_records);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntity.attr_records)
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntityIdentity.collection_name)
 }
 
-// int64 row_num = 5;
-inline void HEntity::clear_row_num() {
-  row_num_ = PROTOBUF_LONGLONG(0);
+// int64 id = 2;
+inline void HEntityIdentity::clear_id() {
+  id_ = PROTOBUF_LONGLONG(0);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 HEntity::row_num() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.row_num)
-  return row_num_;
+inline ::PROTOBUF_NAMESPACE_ID::int64 HEntityIdentity::id() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIdentity.id)
+  return id_;
 }
-inline void HEntity::set_row_num(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void HEntityIdentity::set_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
   
-  row_num_ = value;
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntity.row_num)
-}
-
-// repeated .milvus.grpc.FieldValue result_values = 6;
-inline int HEntity::result_values_size() const {
-  return result_values_.size();
-}
-inline void HEntity::clear_result_values() {
-  result_values_.Clear();
-}
-inline ::milvus::grpc::FieldValue* HEntity::mutable_result_values(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntity.result_values)
-  return result_values_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::FieldValue >*
-HEntity::mutable_result_values() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntity.result_values)
-  return &result_values_;
-}
-inline const ::milvus::grpc::FieldValue& HEntity::result_values(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntity.result_values)
-  return result_values_.Get(index);
-}
-inline ::milvus::grpc::FieldValue* HEntity::add_result_values() {
-  // @@protoc_insertion_point(field_add:milvus.grpc.HEntity.result_values)
-  return result_values_.Add();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::FieldValue >&
-HEntity::result_values() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HEntity.result_values)
-  return result_values_;
+  id_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIdentity.id)
 }
 
 // -------------------------------------------------------------------
 
-// HQueryResult
+// HEntityIDs
 
 // .milvus.grpc.Status status = 1;
-inline bool HQueryResult::has_status() const {
+inline bool HEntityIDs::has_status() const {
   return this != internal_default_instance() && status_ != nullptr;
 }
-inline const ::milvus::grpc::Status& HQueryResult::status() const {
+inline const ::milvus::grpc::Status& HEntityIDs::status() const {
   const ::milvus::grpc::Status* p = status_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.status)
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIDs.status)
   return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
       &::milvus::grpc::_Status_default_instance_);
 }
-inline ::milvus::grpc::Status* HQueryResult::release_status() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HQueryResult.status)
+inline ::milvus::grpc::Status* HEntityIDs::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HEntityIDs.status)
   
   ::milvus::grpc::Status* temp = status_;
   status_ = nullptr;
   return temp;
 }
-inline ::milvus::grpc::Status* HQueryResult::mutable_status() {
+inline ::milvus::grpc::Status* HEntityIDs::mutable_status() {
   
   if (status_ == nullptr) {
     auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
     status_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HQueryResult.status)
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntityIDs.status)
   return status_;
 }
-inline void HQueryResult::set_allocated_status(::milvus::grpc::Status* status) {
+inline void HEntityIDs::set_allocated_status(::milvus::grpc::Status* status) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
     delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
@@ -13505,700 +14691,925 @@ inline void HQueryResult::set_allocated_status(::milvus::grpc::Status* status) {
     
   }
   status_ = status;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HQueryResult.status)
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntityIDs.status)
 }
 
-// repeated .milvus.grpc.HEntity entities = 2;
-inline int HQueryResult::entities_size() const {
-  return entities_.size();
+// repeated int64 entity_id_array = 2;
+inline int HEntityIDs::entity_id_array_size() const {
+  return entity_id_array_.size();
 }
-inline void HQueryResult::clear_entities() {
-  entities_.Clear();
+inline void HEntityIDs::clear_entity_id_array() {
+  entity_id_array_.Clear();
 }
-inline ::milvus::grpc::HEntity* HQueryResult::mutable_entities(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HQueryResult.entities)
-  return entities_.Mutable(index);
+inline ::PROTOBUF_NAMESPACE_ID::int64 HEntityIDs::entity_id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIDs.entity_id_array)
+  return entity_id_array_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::HEntity >*
-HQueryResult::mutable_entities() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.entities)
-  return &entities_;
+inline void HEntityIDs::set_entity_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  entity_id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIDs.entity_id_array)
 }
-inline const ::milvus::grpc::HEntity& HQueryResult::entities(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.entities)
-  return entities_.Get(index);
+inline void HEntityIDs::add_entity_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  entity_id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HEntityIDs.entity_id_array)
 }
-inline ::milvus::grpc::HEntity* HQueryResult::add_entities() {
-  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.entities)
-  return entities_.Add();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+HEntityIDs::entity_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HEntityIDs.entity_id_array)
+  return entity_id_array_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::HEntity >&
-HQueryResult::entities() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.entities)
-  return entities_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+HEntityIDs::mutable_entity_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntityIDs.entity_id_array)
+  return &entity_id_array_;
 }
 
-// int64 row_num = 3;
-inline void HQueryResult::clear_row_num() {
-  row_num_ = PROTOBUF_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// HGetEntityIDsParam
+
+// string collection_name = 1;
+inline void HGetEntityIDsParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 HQueryResult::row_num() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.row_num)
-  return row_num_;
+inline const std::string& HGetEntityIDsParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HGetEntityIDsParam.collection_name)
+  return collection_name_.GetNoArena();
 }
-inline void HQueryResult::set_row_num(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void HGetEntityIDsParam::set_collection_name(const std::string& value) {
   
-  row_num_ = value;
-  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.row_num)
-}
-
-// repeated float score = 4;
-inline int HQueryResult::score_size() const {
-  return score_.size();
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HGetEntityIDsParam.collection_name)
 }
-inline void HQueryResult::clear_score() {
-  score_.Clear();
+inline void HGetEntityIDsParam::set_collection_name(std::string&& value) {
+  
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HGetEntityIDsParam.collection_name)
 }
-inline float HQueryResult::score(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.score)
-  return score_.Get(index);
+inline void HGetEntityIDsParam::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HGetEntityIDsParam.collection_name)
 }
-inline void HQueryResult::set_score(int index, float value) {
-  score_.Set(index, value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.score)
+inline void HGetEntityIDsParam::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HGetEntityIDsParam.collection_name)
 }
-inline void HQueryResult::add_score(float value) {
-  score_.Add(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.score)
+inline std::string* HGetEntityIDsParam::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HGetEntityIDsParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HQueryResult::score() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.score)
-  return score_;
+inline std::string* HGetEntityIDsParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HGetEntityIDsParam.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HQueryResult::mutable_score() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.score)
-  return &score_;
+inline void HGetEntityIDsParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
+    
+  } else {
+    
+  }
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HGetEntityIDsParam.collection_name)
 }
 
-// repeated float distance = 5;
-inline int HQueryResult::distance_size() const {
-  return distance_.size();
+// string segment_name = 2;
+inline void HGetEntityIDsParam::clear_segment_name() {
+  segment_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& HGetEntityIDsParam::segment_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HGetEntityIDsParam.segment_name)
+  return segment_name_.GetNoArena();
 }
-inline void HQueryResult::clear_distance() {
-  distance_.Clear();
+inline void HGetEntityIDsParam::set_segment_name(const std::string& value) {
+  
+  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HGetEntityIDsParam.segment_name)
 }
-inline float HQueryResult::distance(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HQueryResult.distance)
-  return distance_.Get(index);
+inline void HGetEntityIDsParam::set_segment_name(std::string&& value) {
+  
+  segment_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HGetEntityIDsParam.segment_name)
 }
-inline void HQueryResult::set_distance(int index, float value) {
-  distance_.Set(index, value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HQueryResult.distance)
+inline void HGetEntityIDsParam::set_segment_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HGetEntityIDsParam.segment_name)
 }
-inline void HQueryResult::add_distance(float value) {
-  distance_.Add(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HQueryResult.distance)
+inline void HGetEntityIDsParam::set_segment_name(const char* value, size_t size) {
+  
+  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HGetEntityIDsParam.segment_name)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-HQueryResult::distance() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HQueryResult.distance)
-  return distance_;
+inline std::string* HGetEntityIDsParam::mutable_segment_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HGetEntityIDsParam.segment_name)
+  return segment_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-HQueryResult::mutable_distance() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HQueryResult.distance)
-  return &distance_;
+inline std::string* HGetEntityIDsParam::release_segment_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HGetEntityIDsParam.segment_name)
+  
+  return segment_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void HGetEntityIDsParam::set_allocated_segment_name(std::string* segment_name) {
+  if (segment_name != nullptr) {
+    
+  } else {
+    
+  }
+  segment_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), segment_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HGetEntityIDsParam.segment_name)
 }
 
 // -------------------------------------------------------------------
 
-// HInsertParam
+// HDeleteByIDParam
 
 // string collection_name = 1;
-inline void HInsertParam::clear_collection_name() {
+inline void HDeleteByIDParam::clear_collection_name() {
   collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const std::string& HInsertParam::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.collection_name)
+inline const std::string& HDeleteByIDParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HDeleteByIDParam.collection_name)
   return collection_name_.GetNoArena();
 }
-inline void HInsertParam::set_collection_name(const std::string& value) {
+inline void HDeleteByIDParam::set_collection_name(const std::string& value) {
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_set:milvus.grpc.HDeleteByIDParam.collection_name)
 }
-inline void HInsertParam::set_collection_name(std::string&& value) {
+inline void HDeleteByIDParam::set_collection_name(std::string&& value) {
   
   collection_name_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HDeleteByIDParam.collection_name)
 }
-inline void HInsertParam::set_collection_name(const char* value) {
+inline void HDeleteByIDParam::set_collection_name(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HDeleteByIDParam.collection_name)
 }
-inline void HInsertParam::set_collection_name(const char* value, size_t size) {
+inline void HDeleteByIDParam::set_collection_name(const char* value, size_t size) {
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HDeleteByIDParam.collection_name)
 }
-inline std::string* HInsertParam::mutable_collection_name() {
+inline std::string* HDeleteByIDParam::mutable_collection_name() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HDeleteByIDParam.collection_name)
   return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HInsertParam::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.collection_name)
+inline std::string* HDeleteByIDParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HDeleteByIDParam.collection_name)
   
   return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HInsertParam::set_allocated_collection_name(std::string* collection_name) {
+inline void HDeleteByIDParam::set_allocated_collection_name(std::string* collection_name) {
   if (collection_name != nullptr) {
     
   } else {
     
   }
   collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.collection_name)
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HDeleteByIDParam.collection_name)
 }
 
-// string partition_tag = 2;
-inline void HInsertParam::clear_partition_tag() {
-  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated int64 id_array = 2;
+inline int HDeleteByIDParam::id_array_size() const {
+  return id_array_.size();
 }
-inline const std::string& HInsertParam::partition_tag() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.partition_tag)
-  return partition_tag_.GetNoArena();
+inline void HDeleteByIDParam::clear_id_array() {
+  id_array_.Clear();
 }
-inline void HInsertParam::set_partition_tag(const std::string& value) {
-  
-  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.partition_tag)
+inline ::PROTOBUF_NAMESPACE_ID::int64 HDeleteByIDParam::id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HDeleteByIDParam.id_array)
+  return id_array_.Get(index);
 }
-inline void HInsertParam::set_partition_tag(std::string&& value) {
-  
-  partition_tag_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HInsertParam.partition_tag)
+inline void HDeleteByIDParam::set_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HDeleteByIDParam.id_array)
 }
-inline void HInsertParam::set_partition_tag(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HInsertParam.partition_tag)
+inline void HDeleteByIDParam::add_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.HDeleteByIDParam.id_array)
 }
-inline void HInsertParam::set_partition_tag(const char* value, size_t size) {
-  
-  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HInsertParam.partition_tag)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+HDeleteByIDParam::id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HDeleteByIDParam.id_array)
+  return id_array_;
 }
-inline std::string* HInsertParam::mutable_partition_tag() {
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+HDeleteByIDParam::mutable_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HDeleteByIDParam.id_array)
+  return &id_array_;
+}
+
+// -------------------------------------------------------------------
+
+// HIndexParam
+
+// .milvus.grpc.Status status = 1;
+inline bool HIndexParam::has_status() const {
+  return this != internal_default_instance() && status_ != nullptr;
+}
+inline const ::milvus::grpc::Status& HIndexParam::status() const {
+  const ::milvus::grpc::Status* p = status_;
+  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.status)
+  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
+      &::milvus::grpc::_Status_default_instance_);
+}
+inline ::milvus::grpc::Status* HIndexParam::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HIndexParam.status)
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.partition_tag)
-  return partition_tag_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::milvus::grpc::Status* temp = status_;
+  status_ = nullptr;
+  return temp;
 }
-inline std::string* HInsertParam::release_partition_tag() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.partition_tag)
+inline ::milvus::grpc::Status* HIndexParam::mutable_status() {
   
-  return partition_tag_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
+    status_ = p;
+  }
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.status)
+  return status_;
 }
-inline void HInsertParam::set_allocated_partition_tag(std::string* partition_tag) {
-  if (partition_tag != nullptr) {
+inline void HIndexParam::set_allocated_status(::milvus::grpc::Status* status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
+  }
+  if (status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status, submessage_arena);
+    }
     
   } else {
     
   }
-  partition_tag_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), partition_tag);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.partition_tag)
+  status_ = status;
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HIndexParam.status)
 }
 
-// .milvus.grpc.HEntity entities = 3;
-inline bool HInsertParam::has_entities() const {
-  return this != internal_default_instance() && entities_ != nullptr;
+// string collection_name = 2;
+inline void HIndexParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HInsertParam::clear_entities() {
-  if (GetArenaNoVirtual() == nullptr && entities_ != nullptr) {
-    delete entities_;
-  }
-  entities_ = nullptr;
+inline const std::string& HIndexParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.collection_name)
+  return collection_name_.GetNoArena();
 }
-inline const ::milvus::grpc::HEntity& HInsertParam::entities() const {
-  const ::milvus::grpc::HEntity* p = entities_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.entities)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::HEntity*>(
-      &::milvus::grpc::_HEntity_default_instance_);
+inline void HIndexParam::set_collection_name(const std::string& value) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.HIndexParam.collection_name)
 }
-inline ::milvus::grpc::HEntity* HInsertParam::release_entities() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HInsertParam.entities)
+inline void HIndexParam::set_collection_name(std::string&& value) {
   
-  ::milvus::grpc::HEntity* temp = entities_;
-  entities_ = nullptr;
-  return temp;
+  collection_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HIndexParam.collection_name)
 }
-inline ::milvus::grpc::HEntity* HInsertParam::mutable_entities() {
+inline void HIndexParam::set_collection_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
   
-  if (entities_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::HEntity>(GetArenaNoVirtual());
-    entities_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.entities)
-  return entities_;
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.HIndexParam.collection_name)
 }
-inline void HInsertParam::set_allocated_entities(::milvus::grpc::HEntity* entities) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete entities_;
-  }
-  if (entities) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      entities = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, entities, submessage_arena);
-    }
+inline void HIndexParam::set_collection_name(const char* value, size_t size) {
+  
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HIndexParam.collection_name)
+}
+inline std::string* HIndexParam::mutable_collection_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* HIndexParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.HIndexParam.collection_name)
+  
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void HIndexParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
     
   } else {
     
   }
-  entities_ = entities;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HInsertParam.entities)
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HIndexParam.collection_name)
 }
 
-// repeated int64 entity_id_array = 4;
-inline int HInsertParam::entity_id_array_size() const {
-  return entity_id_array_.size();
-}
-inline void HInsertParam::clear_entity_id_array() {
-  entity_id_array_.Clear();
-}
-inline ::PROTOBUF_NAMESPACE_ID::int64 HInsertParam::entity_id_array(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.entity_id_array)
-  return entity_id_array_.Get(index);
-}
-inline void HInsertParam::set_entity_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  entity_id_array_.Set(index, value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HInsertParam.entity_id_array)
-}
-inline void HInsertParam::add_entity_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  entity_id_array_.Add(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HInsertParam.entity_id_array)
+// int32 index_type = 3;
+inline void HIndexParam::clear_index_type() {
+  index_type_ = 0;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
-HInsertParam::entity_id_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HInsertParam.entity_id_array)
-  return entity_id_array_;
+inline ::PROTOBUF_NAMESPACE_ID::int32 HIndexParam::index_type() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.index_type)
+  return index_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
-HInsertParam::mutable_entity_id_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HInsertParam.entity_id_array)
-  return &entity_id_array_;
+inline void HIndexParam::set_index_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  index_type_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.HIndexParam.index_type)
 }
 
-// repeated .milvus.grpc.KeyValuePair extra_params = 5;
-inline int HInsertParam::extra_params_size() const {
+// repeated .milvus.grpc.KeyValuePair extra_params = 4;
+inline int HIndexParam::extra_params_size() const {
   return extra_params_.size();
 }
-inline void HInsertParam::clear_extra_params() {
+inline void HIndexParam::clear_extra_params() {
   extra_params_.Clear();
 }
-inline ::milvus::grpc::KeyValuePair* HInsertParam::mutable_extra_params(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HInsertParam.extra_params)
+inline ::milvus::grpc::KeyValuePair* HIndexParam::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.extra_params)
   return extra_params_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
-HInsertParam::mutable_extra_params() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HInsertParam.extra_params)
+HIndexParam::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HIndexParam.extra_params)
   return &extra_params_;
 }
-inline const ::milvus::grpc::KeyValuePair& HInsertParam::extra_params(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HInsertParam.extra_params)
+inline const ::milvus::grpc::KeyValuePair& HIndexParam::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.extra_params)
   return extra_params_.Get(index);
 }
-inline ::milvus::grpc::KeyValuePair* HInsertParam::add_extra_params() {
-  // @@protoc_insertion_point(field_add:milvus.grpc.HInsertParam.extra_params)
+inline ::milvus::grpc::KeyValuePair* HIndexParam::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.HIndexParam.extra_params)
   return extra_params_.Add();
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
-HInsertParam::extra_params() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HInsertParam.extra_params)
+HIndexParam::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.HIndexParam.extra_params)
   return extra_params_;
 }
 
 // -------------------------------------------------------------------
 
-// HEntityIdentity
+// PackedInsertParam
 
 // string collection_name = 1;
-inline void HEntityIdentity::clear_collection_name() {
+inline void PackedInsertParam::clear_collection_name() {
   collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const std::string& HEntityIdentity::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIdentity.collection_name)
+inline const std::string& PackedInsertParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.collection_name)
   return collection_name_.GetNoArena();
 }
-inline void HEntityIdentity::set_collection_name(const std::string& value) {
+inline void PackedInsertParam::set_collection_name(const std::string& value) {
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.collection_name)
 }
-inline void HEntityIdentity::set_collection_name(std::string&& value) {
+inline void PackedInsertParam::set_collection_name(std::string&& value) {
   
   collection_name_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.PackedInsertParam.collection_name)
 }
-inline void HEntityIdentity::set_collection_name(const char* value) {
+inline void PackedInsertParam::set_collection_name(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedInsertParam.collection_name)
 }
-inline void HEntityIdentity::set_collection_name(const char* value, size_t size) {
+inline void PackedInsertParam::set_collection_name(const char* value, size_t size) {
   
   collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedInsertParam.collection_name)
 }
-inline std::string* HEntityIdentity::mutable_collection_name() {
+inline std::string* PackedInsertParam::mutable_collection_name() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedInsertParam.collection_name)
   return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HEntityIdentity::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HEntityIdentity.collection_name)
+inline std::string* PackedInsertParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.PackedInsertParam.collection_name)
   
   return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HEntityIdentity::set_allocated_collection_name(std::string* collection_name) {
+inline void PackedInsertParam::set_allocated_collection_name(std::string* collection_name) {
   if (collection_name != nullptr) {
     
   } else {
     
   }
   collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntityIdentity.collection_name)
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.PackedInsertParam.collection_name)
 }
 
-// int64 id = 2;
-inline void HEntityIdentity::clear_id() {
-  id_ = PROTOBUF_LONGLONG(0);
+// .milvus.grpc.VectorDataType data_type = 2;
+inline void PackedInsertParam::clear_data_type() {
+  data_type_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 HEntityIdentity::id() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIdentity.id)
-  return id_;
+inline ::milvus::grpc::VectorDataType PackedInsertParam::data_type() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.data_type)
+  return static_cast< ::milvus::grpc::VectorDataType >(data_type_);
 }
-inline void HEntityIdentity::set_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void PackedInsertParam::set_data_type(::milvus::grpc::VectorDataType value) {
   
-  id_ = value;
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIdentity.id)
+  data_type_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.data_type)
 }
 
-// -------------------------------------------------------------------
-
-// HEntityIDs
+// int64 dimension = 3;
+inline void PackedInsertParam::clear_dimension() {
+  dimension_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedInsertParam::dimension() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.dimension)
+  return dimension_;
+}
+inline void PackedInsertParam::set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  dimension_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.dimension)
+}
 
-// .milvus.grpc.Status status = 1;
-inline bool HEntityIDs::has_status() const {
-  return this != internal_default_instance() && status_ != nullptr;
+// bytes vector_data = 4;
+inline void PackedInsertParam::clear_vector_data() {
+  vector_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::milvus::grpc::Status& HEntityIDs::status() const {
-  const ::milvus::grpc::Status* p = status_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIDs.status)
-  return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
-      &::milvus::grpc::_Status_default_instance_);
+inline const std::string& PackedInsertParam::vector_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.vector_data)
+  return vector_data_.GetNoArena();
 }
-inline ::milvus::grpc::Status* HEntityIDs::release_status() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HEntityIDs.status)
+inline void PackedInsertParam::set_vector_data(const std::string& value) {
   
-  ::milvus::grpc::Status* temp = status_;
-  status_ = nullptr;
-  return temp;
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.vector_data)
 }
-inline ::milvus::grpc::Status* HEntityIDs::mutable_status() {
+inline void PackedInsertParam::set_vector_data(std::string&& value) {
   
-  if (status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
-    status_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HEntityIDs.status)
-  return status_;
+  vector_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.PackedInsertParam.vector_data)
 }
-inline void HEntityIDs::set_allocated_status(::milvus::grpc::Status* status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
-  }
-  if (status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, status, submessage_arena);
-    }
+inline void PackedInsertParam::set_vector_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedInsertParam.vector_data)
+}
+inline void PackedInsertParam::set_vector_data(const void* value, size_t size) {
+  
+  vector_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedInsertParam.vector_data)
+}
+inline std::string* PackedInsertParam::mutable_vector_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedInsertParam.vector_data)
+  return vector_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* PackedInsertParam::release_vector_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.PackedInsertParam.vector_data)
+  
+  return vector_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void PackedInsertParam::set_allocated_vector_data(std::string* vector_data) {
+  if (vector_data != nullptr) {
     
   } else {
     
   }
-  status_ = status;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HEntityIDs.status)
+  vector_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), vector_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.PackedInsertParam.vector_data)
 }
 
-// repeated int64 entity_id_array = 2;
-inline int HEntityIDs::entity_id_array_size() const {
-  return entity_id_array_.size();
+// repeated int64 row_id_array = 5;
+inline int PackedInsertParam::row_id_array_size() const {
+  return row_id_array_.size();
 }
-inline void HEntityIDs::clear_entity_id_array() {
-  entity_id_array_.Clear();
+inline void PackedInsertParam::clear_row_id_array() {
+  row_id_array_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 HEntityIDs::entity_id_array(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HEntityIDs.entity_id_array)
-  return entity_id_array_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedInsertParam::row_id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.row_id_array)
+  return row_id_array_.Get(index);
 }
-inline void HEntityIDs::set_entity_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  entity_id_array_.Set(index, value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HEntityIDs.entity_id_array)
+inline void PackedInsertParam::set_row_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  row_id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.row_id_array)
 }
-inline void HEntityIDs::add_entity_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  entity_id_array_.Add(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HEntityIDs.entity_id_array)
+inline void PackedInsertParam::add_row_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  row_id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.PackedInsertParam.row_id_array)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
-HEntityIDs::entity_id_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HEntityIDs.entity_id_array)
-  return entity_id_array_;
+PackedInsertParam::row_id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.PackedInsertParam.row_id_array)
+  return row_id_array_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
-HEntityIDs::mutable_entity_id_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HEntityIDs.entity_id_array)
-  return &entity_id_array_;
+PackedInsertParam::mutable_row_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.PackedInsertParam.row_id_array)
+  return &row_id_array_;
 }
 
-// -------------------------------------------------------------------
-
-// HGetEntityIDsParam
-
-// string collection_name = 1;
-inline void HGetEntityIDsParam::clear_collection_name() {
-  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string partition_tag = 6;
+inline void PackedInsertParam::clear_partition_tag() {
+  partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline const std::string& HGetEntityIDsParam::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HGetEntityIDsParam.collection_name)
-  return collection_name_.GetNoArena();
+inline const std::string& PackedInsertParam::partition_tag() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.partition_tag)
+  return partition_tag_.GetNoArena();
 }
-inline void HGetEntityIDsParam::set_collection_name(const std::string& value) {
+inline void PackedInsertParam::set_partition_tag(const std::string& value) {
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HGetEntityIDsParam.collection_name)
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedInsertParam.partition_tag)
 }
-inline void HGetEntityIDsParam::set_collection_name(std::string&& value) {
+inline void PackedInsertParam::set_partition_tag(std::string&& value) {
   
-  collection_name_.SetNoArena(
+  partition_tag_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HGetEntityIDsParam.collection_name)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.PackedInsertParam.partition_tag)
 }
-inline void HGetEntityIDsParam::set_collection_name(const char* value) {
+inline void PackedInsertParam::set_partition_tag(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HGetEntityIDsParam.collection_name)
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedInsertParam.partition_tag)
 }
-inline void HGetEntityIDsParam::set_collection_name(const char* value, size_t size) {
+inline void PackedInsertParam::set_partition_tag(const char* value, size_t size) {
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  partition_tag_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HGetEntityIDsParam.collection_name)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedInsertParam.partition_tag)
 }
-inline std::string* HGetEntityIDsParam::mutable_collection_name() {
+inline std::string* PackedInsertParam::mutable_partition_tag() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HGetEntityIDsParam.collection_name)
-  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedInsertParam.partition_tag)
+  return partition_tag_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HGetEntityIDsParam::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HGetEntityIDsParam.collection_name)
+inline std::string* PackedInsertParam::release_partition_tag() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.PackedInsertParam.partition_tag)
   
-  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return partition_tag_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HGetEntityIDsParam::set_allocated_collection_name(std::string* collection_name) {
-  if (collection_name != nullptr) {
+inline void PackedInsertParam::set_allocated_partition_tag(std::string* partition_tag) {
+  if (partition_tag != nullptr) {
     
   } else {
     
   }
-  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HGetEntityIDsParam.collection_name)
+  partition_tag_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), partition_tag);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.PackedInsertParam.partition_tag)
 }
 
-// string segment_name = 2;
-inline void HGetEntityIDsParam::clear_segment_name() {
-  segment_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// repeated .milvus.grpc.KeyValuePair extra_params = 7;
+inline int PackedInsertParam::extra_params_size() const {
+  return extra_params_.size();
 }
-inline const std::string& HGetEntityIDsParam::segment_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HGetEntityIDsParam.segment_name)
-  return segment_name_.GetNoArena();
+inline void PackedInsertParam::clear_extra_params() {
+  extra_params_.Clear();
 }
-inline void HGetEntityIDsParam::set_segment_name(const std::string& value) {
+inline ::milvus::grpc::KeyValuePair* PackedInsertParam::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedInsertParam.extra_params)
+  return extra_params_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+PackedInsertParam::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.PackedInsertParam.extra_params)
+  return &extra_params_;
+}
+inline const ::milvus::grpc::KeyValuePair& PackedInsertParam::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedInsertParam.extra_params)
+  return extra_params_.Get(index);
+}
+inline ::milvus::grpc::KeyValuePair* PackedInsertParam::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.PackedInsertParam.extra_params)
+  return extra_params_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+PackedInsertParam::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.PackedInsertParam.extra_params)
+  return extra_params_;
+}
+
+// -------------------------------------------------------------------
+
+// PackedSearchParam
+
+// string collection_name = 1;
+inline void PackedSearchParam::clear_collection_name() {
+  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& PackedSearchParam::collection_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.collection_name)
+  return collection_name_.GetNoArena();
+}
+inline void PackedSearchParam::set_collection_name(const std::string& value) {
   
-  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HGetEntityIDsParam.segment_name)
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.collection_name)
 }
-inline void HGetEntityIDsParam::set_segment_name(std::string&& value) {
+inline void PackedSearchParam::set_collection_name(std::string&& value) {
   
-  segment_name_.SetNoArena(
+  collection_name_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HGetEntityIDsParam.segment_name)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.PackedSearchParam.collection_name)
 }
-inline void HGetEntityIDsParam::set_segment_name(const char* value) {
+inline void PackedSearchParam::set_collection_name(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HGetEntityIDsParam.segment_name)
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedSearchParam.collection_name)
 }
-inline void HGetEntityIDsParam::set_segment_name(const char* value, size_t size) {
+inline void PackedSearchParam::set_collection_name(const char* value, size_t size) {
   
-  segment_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HGetEntityIDsParam.segment_name)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedSearchParam.collection_name)
 }
-inline std::string* HGetEntityIDsParam::mutable_segment_name() {
+inline std::string* PackedSearchParam::mutable_collection_name() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HGetEntityIDsParam.segment_name)
-  return segment_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedSearchParam.collection_name)
+  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HGetEntityIDsParam::release_segment_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HGetEntityIDsParam.segment_name)
+inline std::string* PackedSearchParam::release_collection_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.PackedSearchParam.collection_name)
   
-  return segment_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HGetEntityIDsParam::set_allocated_segment_name(std::string* segment_name) {
-  if (segment_name != nullptr) {
+inline void PackedSearchParam::set_allocated_collection_name(std::string* collection_name) {
+  if (collection_name != nullptr) {
     
   } else {
     
   }
-  segment_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), segment_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HGetEntityIDsParam.segment_name)
+  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.PackedSearchParam.collection_name)
 }
 
-// -------------------------------------------------------------------
+// repeated string partition_tag_array = 2;
+inline int PackedSearchParam::partition_tag_array_size() const {
+  return partition_tag_array_.size();
+}
+inline void PackedSearchParam::clear_partition_tag_array() {
+  partition_tag_array_.Clear();
+}
+inline const std::string& PackedSearchParam::partition_tag_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.partition_tag_array)
+  return partition_tag_array_.Get(index);
+}
+inline std::string* PackedSearchParam::mutable_partition_tag_array(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedSearchParam.partition_tag_array)
+  return partition_tag_array_.Mutable(index);
+}
+inline void PackedSearchParam::set_partition_tag_array(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(value);
+}
+inline void PackedSearchParam::set_partition_tag_array(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.partition_tag_array)
+  partition_tag_array_.Mutable(index)->assign(std::move(value));
+}
+inline void PackedSearchParam::set_partition_tag_array(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline void PackedSearchParam::set_partition_tag_array(int index, const char* value, size_t size) {
+  partition_tag_array_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline std::string* PackedSearchParam::add_partition_tag_array() {
+  // @@protoc_insertion_point(field_add_mutable:milvus.grpc.PackedSearchParam.partition_tag_array)
+  return partition_tag_array_.Add();
+}
+inline void PackedSearchParam::add_partition_tag_array(const std::string& value) {
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline void PackedSearchParam::add_partition_tag_array(std::string&& value) {
+  partition_tag_array_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline void PackedSearchParam::add_partition_tag_array(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  partition_tag_array_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline void PackedSearchParam::add_partition_tag_array(const char* value, size_t size) {
+  partition_tag_array_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:milvus.grpc.PackedSearchParam.partition_tag_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PackedSearchParam::partition_tag_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.PackedSearchParam.partition_tag_array)
+  return partition_tag_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PackedSearchParam::mutable_partition_tag_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.PackedSearchParam.partition_tag_array)
+  return &partition_tag_array_;
+}
 
-// HDeleteByIDParam
+// .milvus.grpc.VectorDataType data_type = 3;
+inline void PackedSearchParam::clear_data_type() {
+  data_type_ = 0;
+}
+inline ::milvus::grpc::VectorDataType PackedSearchParam::data_type() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.data_type)
+  return static_cast< ::milvus::grpc::VectorDataType >(data_type_);
+}
+inline void PackedSearchParam::set_data_type(::milvus::grpc::VectorDataType value) {
+  
+  data_type_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.data_type)
+}
 
-// string collection_name = 1;
-inline void HDeleteByIDParam::clear_collection_name() {
-  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// int64 dimension = 4;
+inline void PackedSearchParam::clear_dimension() {
+  dimension_ = PROTOBUF_LONGLONG(0);
 }
-inline const std::string& HDeleteByIDParam::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HDeleteByIDParam.collection_name)
-  return collection_name_.GetNoArena();
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedSearchParam::dimension() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.dimension)
+  return dimension_;
 }
-inline void HDeleteByIDParam::set_collection_name(const std::string& value) {
+inline void PackedSearchParam::set_dimension(::PROTOBUF_NAMESPACE_ID::int64 value) {
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HDeleteByIDParam.collection_name)
+  dimension_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.dimension)
 }
-inline void HDeleteByIDParam::set_collection_name(std::string&& value) {
+
+// bytes query_data = 5;
+inline void PackedSearchParam::clear_query_data() {
+  query_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& PackedSearchParam::query_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.query_data)
+  return query_data_.GetNoArena();
+}
+inline void PackedSearchParam::set_query_data(const std::string& value) {
   
-  collection_name_.SetNoArena(
+  query_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.query_data)
+}
+inline void PackedSearchParam::set_query_data(std::string&& value) {
+  
+  query_data_.SetNoArena(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HDeleteByIDParam.collection_name)
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.PackedSearchParam.query_data)
 }
-inline void HDeleteByIDParam::set_collection_name(const char* value) {
+inline void PackedSearchParam::set_query_data(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HDeleteByIDParam.collection_name)
+  query_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.PackedSearchParam.query_data)
 }
-inline void HDeleteByIDParam::set_collection_name(const char* value, size_t size) {
+inline void PackedSearchParam::set_query_data(const void* value, size_t size) {
   
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  query_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HDeleteByIDParam.collection_name)
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.PackedSearchParam.query_data)
 }
-inline std::string* HDeleteByIDParam::mutable_collection_name() {
+inline std::string* PackedSearchParam::mutable_query_data() {
   
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HDeleteByIDParam.collection_name)
-  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedSearchParam.query_data)
+  return query_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline std::string* HDeleteByIDParam::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HDeleteByIDParam.collection_name)
+inline std::string* PackedSearchParam::release_query_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.PackedSearchParam.query_data)
   
-  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return query_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline void HDeleteByIDParam::set_allocated_collection_name(std::string* collection_name) {
-  if (collection_name != nullptr) {
+inline void PackedSearchParam::set_allocated_query_data(std::string* query_data) {
+  if (query_data != nullptr) {
     
   } else {
     
   }
-  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HDeleteByIDParam.collection_name)
+  query_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), query_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.PackedSearchParam.query_data)
 }
 
-// repeated int64 id_array = 2;
-inline int HDeleteByIDParam::id_array_size() const {
-  return id_array_.size();
+// int64 topk = 6;
+inline void PackedSearchParam::clear_topk() {
+  topk_ = PROTOBUF_LONGLONG(0);
 }
-inline void HDeleteByIDParam::clear_id_array() {
-  id_array_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::int64 PackedSearchParam::topk() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.topk)
+  return topk_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 HDeleteByIDParam::id_array(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HDeleteByIDParam.id_array)
-  return id_array_.Get(index);
+inline void PackedSearchParam::set_topk(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  topk_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.PackedSearchParam.topk)
 }
-inline void HDeleteByIDParam::set_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  id_array_.Set(index, value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HDeleteByIDParam.id_array)
+
+// repeated .milvus.grpc.KeyValuePair extra_params = 7;
+inline int PackedSearchParam::extra_params_size() const {
+  return extra_params_.size();
 }
-inline void HDeleteByIDParam::add_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  id_array_.Add(value);
-  // @@protoc_insertion_point(field_add:milvus.grpc.HDeleteByIDParam.id_array)
+inline void PackedSearchParam::clear_extra_params() {
+  extra_params_.Clear();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
-HDeleteByIDParam::id_array() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HDeleteByIDParam.id_array)
-  return id_array_;
+inline ::milvus::grpc::KeyValuePair* PackedSearchParam::mutable_extra_params(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.PackedSearchParam.extra_params)
+  return extra_params_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
-HDeleteByIDParam::mutable_id_array() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HDeleteByIDParam.id_array)
-  return &id_array_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
+PackedSearchParam::mutable_extra_params() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.PackedSearchParam.extra_params)
+  return &extra_params_;
+}
+inline const ::milvus::grpc::KeyValuePair& PackedSearchParam::extra_params(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.PackedSearchParam.extra_params)
+  return extra_params_.Get(index);
+}
+inline ::milvus::grpc::KeyValuePair* PackedSearchParam::add_extra_params() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.PackedSearchParam.extra_params)
+  return extra_params_.Add();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
+PackedSearchParam::extra_params() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.PackedSearchParam.extra_params)
+  return extra_params_;
 }
 
 // -------------------------------------------------------------------
 
-// HIndexParam
+// IdRange
+
+// int64 first_id = 1;
+inline void IdRange::clear_first_id() {
+  first_id_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 IdRange::first_id() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.IdRange.first_id)
+  return first_id_;
+}
+inline void IdRange::set_first_id(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  first_id_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.IdRange.first_id)
+}
+
+// int64 count = 2;
+inline void IdRange::clear_count() {
+  count_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 IdRange::count() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.IdRange.count)
+  return count_;
+}
+inline void IdRange::set_count(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  count_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.IdRange.count)
+}
+
+// -------------------------------------------------------------------
+
+// InsertStreamResult
 
 // .milvus.grpc.Status status = 1;
-inline bool HIndexParam::has_status() const {
+inline bool InsertStreamResult::has_status() const {
   return this != internal_default_instance() && status_ != nullptr;
 }
-inline const ::milvus::grpc::Status& HIndexParam::status() const {
+inline const ::milvus::grpc::Status& InsertStreamResult::status() const {
   const ::milvus::grpc::Status* p = status_;
-  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.status)
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertStreamResult.status)
   return p != nullptr ? *p : *reinterpret_cast<const ::milvus::grpc::Status*>(
       &::milvus::grpc::_Status_default_instance_);
 }
-inline ::milvus::grpc::Status* HIndexParam::release_status() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HIndexParam.status)
+inline ::milvus::grpc::Status* InsertStreamResult::release_status() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertStreamResult.status)
   
   ::milvus::grpc::Status* temp = status_;
   status_ = nullptr;
   return temp;
 }
-inline ::milvus::grpc::Status* HIndexParam::mutable_status() {
+inline ::milvus::grpc::Status* InsertStreamResult::mutable_status() {
   
   if (status_ == nullptr) {
     auto* p = CreateMaybeMessage<::milvus::grpc::Status>(GetArenaNoVirtual());
     status_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.status)
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertStreamResult.status)
   return status_;
 }
-inline void HIndexParam::set_allocated_status(::milvus::grpc::Status* status) {
+inline void InsertStreamResult::set_allocated_status(::milvus::grpc::Status* status) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
     delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(status_);
@@ -14214,102 +15625,65 @@ inline void HIndexParam::set_allocated_status(::milvus::grpc::Status* status) {
     
   }
   status_ = status;
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HIndexParam.status)
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertStreamResult.status)
 }
 
-// string collection_name = 2;
-inline void HIndexParam::clear_collection_name() {
-  collection_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& HIndexParam::collection_name() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.collection_name)
-  return collection_name_.GetNoArena();
-}
-inline void HIndexParam::set_collection_name(const std::string& value) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:milvus.grpc.HIndexParam.collection_name)
-}
-inline void HIndexParam::set_collection_name(std::string&& value) {
-  
-  collection_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.HIndexParam.collection_name)
-}
-inline void HIndexParam::set_collection_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:milvus.grpc.HIndexParam.collection_name)
-}
-inline void HIndexParam::set_collection_name(const char* value, size_t size) {
-  
-  collection_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.HIndexParam.collection_name)
+// int64 row_count = 2;
+inline void InsertStreamResult::clear_row_count() {
+  row_count_ = PROTOBUF_LONGLONG(0);
 }
-inline std::string* HIndexParam::mutable_collection_name() {
-  
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.collection_name)
-  return collection_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertStreamResult::row_count() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertStreamResult.row_count)
+  return row_count_;
 }
-inline std::string* HIndexParam::release_collection_name() {
-  // @@protoc_insertion_point(field_release:milvus.grpc.HIndexParam.collection_name)
+inline void InsertStreamResult::set_row_count(::PROTOBUF_NAMESPACE_ID::int64 value) {
   
-  return collection_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void HIndexParam::set_allocated_collection_name(std::string* collection_name) {
-  if (collection_name != nullptr) {
-    
-  } else {
-    
-  }
-  collection_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), collection_name);
-  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.HIndexParam.collection_name)
+  row_count_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertStreamResult.row_count)
 }
 
-// int32 index_type = 3;
-inline void HIndexParam::clear_index_type() {
-  index_type_ = 0;
+// repeated .milvus.grpc.IdRange id_ranges = 3;
+inline int InsertStreamResult::id_ranges_size() const {
+  return id_ranges_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 HIndexParam::index_type() const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.index_type)
-  return index_type_;
+inline void InsertStreamResult::clear_id_ranges() {
+  id_ranges_.Clear();
 }
-inline void HIndexParam::set_index_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  index_type_ = value;
-  // @@protoc_insertion_point(field_set:milvus.grpc.HIndexParam.index_type)
+inline ::milvus::grpc::IdRange* InsertStreamResult::mutable_id_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertStreamResult.id_ranges)
+  return id_ranges_.Mutable(index);
 }
-
-// repeated .milvus.grpc.KeyValuePair extra_params = 4;
-inline int HIndexParam::extra_params_size() const {
-  return extra_params_.size();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::IdRange >*
+InsertStreamResult::mutable_id_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.InsertStreamResult.id_ranges)
+  return &id_ranges_;
 }
-inline void HIndexParam::clear_extra_params() {
-  extra_params_.Clear();
+inline const ::milvus::grpc::IdRange& InsertStreamResult::id_ranges(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertStreamResult.id_ranges)
+  return id_ranges_.Get(index);
 }
-inline ::milvus::grpc::KeyValuePair* HIndexParam::mutable_extra_params(int index) {
-  // @@protoc_insertion_point(field_mutable:milvus.grpc.HIndexParam.extra_params)
-  return extra_params_.Mutable(index);
+inline ::milvus::grpc::IdRange* InsertStreamResult::add_id_ranges() {
+  // @@protoc_insertion_point(field_add:milvus.grpc.InsertStreamResult.id_ranges)
+  return id_ranges_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >*
-HIndexParam::mutable_extra_params() {
-  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.HIndexParam.extra_params)
-  return &extra_params_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::IdRange >&
+InsertStreamResult::id_ranges() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.InsertStreamResult.id_ranges)
+  return id_ranges_;
 }
-inline const ::milvus::grpc::KeyValuePair& HIndexParam::extra_params(int index) const {
-  // @@protoc_insertion_point(field_get:milvus.grpc.HIndexParam.extra_params)
-  return extra_params_.Get(index);
+
+// int64 lsn = 4;
+inline void InsertStreamResult::clear_lsn() {
+  lsn_ = PROTOBUF_LONGLONG(0);
 }
-inline ::milvus::grpc::KeyValuePair* HIndexParam::add_extra_params() {
-  // @@protoc_insertion_point(field_add:milvus.grpc.HIndexParam.extra_params)
-  return extra_params_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertStreamResult::lsn() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertStreamResult.lsn)
+  return lsn_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::KeyValuePair >&
-HIndexParam::extra_params() const {
-  // @@protoc_insertion_point(field_list:milvus.grpc.HIndexParam.extra_params)
-  return extra_params_;
+inline void InsertStreamResult::set_lsn(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  lsn_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertStreamResult.lsn)
 }
 
 #ifdef __GNUC__
@@ -14413,6 +15787,14 @@ HIndexParam::extra_params() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -14436,6 +15818,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::milvus::grpc::Occur>() {
   return ::milvus::grpc::Occur_descriptor();
 }
+template <> struct is_proto_enum< ::milvus::grpc::VectorDataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::milvus::grpc::VectorDataType>() {
+  return ::milvus::grpc::VectorDataType_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -29,6 +29,9 @@ static const int64_t MAX_K = 1024 * 1024;
 static const int64_t MIN_NBITS = 1;
 static const int64_t MAX_NBITS = 16;
 static const int64_t DEFAULT_NBITS = 8;
+static const int64_t FASTSCAN_NBITS = 4;
+static const int64_t MIN_K_FACTOR = 1;
+static const int64_t MAX_K_FACTOR = 64;
 static const int64_t MIN_NLIST = 1;
 static const int64_t MAX_NLIST = 65536;
 static const int64_t MIN_NPROBE = 1;
@@ -208,6 +211,26 @@ IVFPQConfAdapter::IsValidForCPU(int64_t dimension, int64_t m) {
     return (dimension % m == 0);
 }
 
+bool
+IVFPQFastScanConfAdapter::CheckTrain(Config& oricfg, IndexMode& mode) {
+    // the codes are always 4-bit and scanned on CPU
+    mode = IndexMode::MODE_CPU;
+    oricfg[IndexParams::nbits] = FASTSCAN_NBITS;
+    if (!IVFConfAdapter::CheckTrain(oricfg, mode)) {
+        return false;
+    }
+
+    auto dimension = oricfg[meta::DIM].get<int64_t>();
+    CheckIntByRange(IndexParams::m, 1, dimension);
+    return IVFPQConfAdapter::IsValidForCPU(dimension, oricfg[IndexParams::m].get<int64_t>());
+}
+
+bool
+IVFPQFastScanConfAdapter::CheckSearch(Config& oricfg, const IndexType type, const IndexMode mode) {
+    CheckIntByRangeIfExist(IndexParams::k_factor, MIN_K_FACTOR, MAX_K_FACTOR);
+    return IVFConfAdapter::CheckSearch(oricfg, type, mode);
+}
+
 bool
 NSGConfAdapter::CheckTrain(Config& oricfg, IndexMode& mode) {
     static int64_t MIN_KNNG = 5;
@@ -224,12 +247,6 @@ NSGConfAdapter::CheckTrain(Config& oricfg, IndexMode& mode) {
     CheckIntByRange(IndexParams::out_degree, MIN_OUT_DEGREE, MAX_OUT_DEGREE);
     CheckIntByRange(IndexParams::candidate, MIN_CANDIDATE_POOL_SIZE, MAX_CANDIDATE_POOL_SIZE);
 
-    // auto tune params
-    oricfg[IndexParams::nlist] = MatchNlist(oricfg[meta::ROWS].get<int64_t>(), 8192);
-
-    int64_t nprobe = int(oricfg[IndexParams::nlist].get<int64_t>() * 0.1);
-    oricfg[IndexParams::nprobe] = nprobe < 1 ? 1 : nprobe;
-
     return ConfAdapter::CheckTrain(oricfg, mode);
 }
 
@@ -58,6 +58,15 @@ class IVFPQConfAdapter : public IVFConfAdapter {
     IsValidForCPU(int64_t dimension, int64_t m);
 };
 
+class IVFPQFastScanConfAdapter : public IVFConfAdapter {
+ public:
+    bool
+    CheckTrain(Config& oricfg, IndexMode& mode) override;
+
+    bool
+    CheckSearch(Config& oricfg, const IndexType type, const IndexMode mode) override;
+};
+
 class NSGConfAdapter : public ConfAdapter {
  public:
     bool
@@ -165,13 +165,14 @@ BinaryIVF::GenParams(const Config& config) {
 void
 BinaryIVF::QueryImpl(int64_t n, const uint8_t* data, int64_t k, float* distances, int64_t* labels, const Config& config,
                      faiss::ConcurrentBitsetPtr blacklist) {
+    // search parameters are passed per call, the index may be shared by concurrent searches
     auto params = GenParams(config);
     auto ivf_index = dynamic_cast<faiss::IndexBinaryIVF*>(index_.get());
-    ivf_index->nprobe = params->nprobe;
+    params->max_codes = ivf_index->max_codes;
 
     stdclock::time_point before = stdclock::now();
     int32_t* i_distances = reinterpret_cast<int32_t*>(distances);
-    index_->search(n, (uint8_t*)data, k, i_distances, labels, blacklist);
+    ivf_index->search_with_parameters(n, (uint8_t*)data, k, i_distances, labels, params.get(), blacklist);
 
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
@@ -107,6 +107,10 @@ IndexHNSW::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
             index_->addPoint(((float*)p_data + dim * i), i);
         }
     }
+
+    if (config.contains(IndexParams::reorder) && config[IndexParams::reorder].get<bool>()) {
+        index_->reorderByBFS();
+    }
 }
 
 DatasetPtr
@@ -122,14 +126,15 @@ IndexHNSW::Query(const DatasetPtr& dataset_ptr, const Config& config, faiss::Con
     auto p_id = (int64_t*)malloc(id_size * rows);
     auto p_dist = (float*)malloc(dist_size * rows);
 
-    index_->setEf(config[IndexParams::ef]);
+    // ef is passed per call, the index may be shared by concurrent searches
+    size_t ef = config[IndexParams::ef];
 
     bool transform = (index_->metric_type_ == 1);  // InnerProduct: 1
 
 #pragma omp parallel for
     for (unsigned int i = 0; i < rows; ++i) {
         auto single_query = (float*)p_data + i * dim;
-        auto rst = index_->searchKnn(single_query, k, blacklist);
+        auto rst = index_->searchKnn(single_query, k, blacklist, ef);
         size_t rst_size = rst.size();
 
         auto p_single_dis = p_dist + i * k;
@@ -0,0 +1,218 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "knowhere/index/vector_index/IndexHNSWSQ8.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <faiss/FaissHook.h>
+#include <faiss/impl/ScalarQuantizer.h>
+
+#include "faiss/BuilderSuspend.h"
+#include "hnswlib/hnswalg.h"
+#include "hnswlib/space_sq8.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/common/Log.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/FaissIO.h"
+
+namespace milvus {
+namespace knowhere {
+
+BinarySet
+IndexHNSWSQ8::Serialize(const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    try {
+        MemoryIOWriter writer;
+        index_->saveIndex(writer);
+        std::shared_ptr<uint8_t[]> data(writer.data_);
+
+        BinarySet res_set;
+        res_set.Append("HNSW_SQ8", data, writer.rp);
+        return res_set;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexHNSWSQ8::Load(const BinarySet& index_binary) {
+    try {
+        auto binary = index_binary.GetByName("HNSW_SQ8");
+
+        MemoryIOReader reader;
+        reader.total = binary->size;
+        reader.data_ = binary->data.get();
+
+        hnswlib::SpaceInterface<float>* space;
+        index_ = std::make_shared<hnswlib::HierarchicalNSW<float>>(space);
+        index_->loadIndex(reader);
+        raw_data_ = nullptr;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexHNSWSQ8::Train(const DatasetPtr& dataset_ptr, const Config& config) {
+    try {
+        GETTENSOR(dataset_ptr)
+
+        faiss::ScalarQuantizer sq(dim, faiss::QuantizerType::QT_8bit);
+        sq.train(rows, (const float*)p_data);
+
+        auto space = new hnswlib::SQ8Space(dim, config[Metric::TYPE] == Metric::IP, std::move(sq.trained));
+        index_ = std::make_shared<hnswlib::HierarchicalNSW<float>>(space, rows, config[IndexParams::M].get<int64_t>(),
+                                                                   config[IndexParams::efConstruction].get<int64_t>());
+        raw_data_ = nullptr;
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+void
+IndexHNSWSQ8::AddWithoutIds(const DatasetPtr& dataset_ptr, const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+
+    GETTENSOR(dataset_ptr)
+
+    auto space = dynamic_cast<hnswlib::SQ8Space*>(index_->space);
+    faiss::ScalarQuantizer sq(dim, faiss::QuantizerType::QT_8bit);
+    sq.trained = space->get_trained();
+    std::vector<uint8_t> codes(rows * sq.code_size);
+    sq.compute_codes((const float*)p_data, codes.data(), rows);
+
+    if (rows > 0) {
+        index_->addPoint(codes.data(), 0);
+#pragma omp parallel for
+        for (int i = 1; i < rows; ++i) {
+            faiss::BuilderSuspend::check_wait();
+            index_->addPoint(codes.data() + sq.code_size * i, i);
+        }
+    }
+
+    if (config.contains(IndexParams::reorder) && config[IndexParams::reorder].get<bool>()) {
+        index_->reorderByBFS();
+    }
+}
+
+DatasetPtr
+IndexHNSWSQ8::Query(const DatasetPtr& dataset_ptr, const Config& config, faiss::ConcurrentBitsetPtr blacklist) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+    GETTENSOR(dataset_ptr)
+
+    size_t k = config[meta::TOPK].get<int64_t>();
+    size_t id_size = sizeof(int64_t) * k;
+    size_t dist_size = sizeof(float) * k;
+    auto p_id = (int64_t*)malloc(id_size * rows);
+    auto p_dist = (float*)malloc(dist_size * rows);
+
+    // ef is passed per call, the index may be shared by concurrent searches
+    size_t ef = config[IndexParams::ef];
+
+    auto space = dynamic_cast<hnswlib::SQ8Space*>(index_->space);
+    bool is_ip = space->is_ip();
+    auto raw_data = (const float*)raw_data_.get();
+
+#pragma omp parallel for
+    for (unsigned int i = 0; i < rows; ++i) {
+        auto single_query = (float*)p_data + i * dim;
+        std::unique_ptr<faiss::SQDistanceComputer> dc(space->get_query_computer(single_query));
+
+        // with the raw vectors, all the ef candidates found on the codes are re-ranked exactly
+        std::vector<std::pair<float, int64_t>> candidates;
+        auto rst = index_->searchKnn(dc.get(), raw_data ? std::max(ef, k) : k, blacklist, ef);
+        candidates.reserve(rst.size());
+        while (!rst.empty()) {
+            auto& it = rst.top();
+            candidates.emplace_back(it.first, it.second);
+            rst.pop();
+        }
+        std::reverse(candidates.begin(), candidates.end());
+
+        if (raw_data) {
+            for (auto& candidate : candidates) {
+                auto vec = raw_data + candidate.second * dim;
+                candidate.first = is_ip ? -faiss::fvec_inner_product(single_query, vec, dim)
+                                        : faiss::fvec_L2sqr(single_query, vec, dim);
+            }
+            size_t rst_k = std::min(k, candidates.size());
+            std::partial_sort(candidates.begin(), candidates.begin() + rst_k, candidates.end());
+            candidates.resize(rst_k);
+        }
+
+        auto p_single_dis = p_dist + i * k;
+        auto p_single_id = p_id + i * k;
+        size_t rst_size = candidates.size();
+        for (size_t idx = 0; idx < rst_size; idx++) {
+            auto dist = candidates[idx].first;
+            p_single_dis[idx] = is_ip ? (raw_data ? -dist : 1 - dist) : dist;
+            p_single_id[idx] = candidates[idx].second;
+        }
+        MapOffsetToUid(p_single_id, rst_size);
+
+        for (size_t idx = rst_size; idx < k; idx++) {
+            p_single_dis[idx] = float(1.0 / 0.0);
+            p_single_id[idx] = -1;
+        }
+    }
+
+    auto ret_ds = std::make_shared<Dataset>();
+    ret_ds->Set(meta::IDS, p_id);
+    ret_ds->Set(meta::DISTANCE, p_dist);
+    return ret_ds;
+}
+
+int64_t
+IndexHNSWSQ8::Count() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return index_->cur_element_count;
+}
+
+int64_t
+IndexHNSWSQ8::Dim() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return (*(size_t*)index_->dist_func_param_);
+}
+
+void
+IndexHNSWSQ8::UpdateIndexSize() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    index_size_ = index_->cal_size();
+    if (raw_data_) {
+        index_size_ += Count() * Dim() * sizeof(float);
+    }
+}
+
+void
+IndexHNSWSQ8::SetRawData(std::shared_ptr<uint8_t[]> raw_data) {
+    raw_data_ = std::move(raw_data);
+    UpdateIndexSize();
+}
+
+}  // namespace knowhere
+}  // namespace milvus
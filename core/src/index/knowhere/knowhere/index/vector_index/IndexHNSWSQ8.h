@@ -0,0 +1,67 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "hnswlib/hnswlib.h"
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/VecIndex.h"
+
+namespace milvus {
+namespace knowhere {
+
+// HNSW graph whose elements are 8-bit scalar quantized codes instead of float vectors, about a quarter
+// of the memory of IndexHNSW. The graph is built and searched on the codes; when the raw vectors are
+// set, the ef candidates of every query are re-ranked by their exact distances.
+class IndexHNSWSQ8 : public VecIndex {
+ public:
+    IndexHNSWSQ8() {
+        index_type_ = IndexEnum::INDEX_HNSW_SQ8;
+    }
+
+    BinarySet
+    Serialize(const Config& config = Config()) override;
+
+    void
+    Load(const BinarySet& index_binary) override;
+
+    void
+    Train(const DatasetPtr& dataset_ptr, const Config& config) override;
+
+    void
+    AddWithoutIds(const DatasetPtr&, const Config&) override;
+
+    DatasetPtr
+    Query(const DatasetPtr& dataset_ptr, const Config& config, faiss::ConcurrentBitsetPtr blacklist) override;
+
+    int64_t
+    Count() override;
+
+    int64_t
+    Dim() override;
+
+    void
+    UpdateIndexSize() override;
+
+    // raw float vectors in insertion order, they are not serialized with the index
+    void
+    SetRawData(std::shared_ptr<uint8_t[]> raw_data);
+
+ private:
+    std::shared_ptr<hnswlib::HierarchicalNSW<float>> index_;
+    std::shared_ptr<uint8_t[]> raw_data_ = nullptr;
+};
+
+}  // namespace knowhere
+}  // namespace milvus
@@ -25,8 +25,10 @@
 #include <fiu-local.h>
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
@@ -285,6 +287,46 @@ IVF::GenGraph(const float* data, const int64_t k, GraphType& graph, const Config
     }
 }
 
+void
+IVF::CompactInvertedLists(const std::vector<int64_t>& id_map) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto invlists = ivf_index ? dynamic_cast<faiss::ArrayInvertedLists*>(ivf_index->invlists) : nullptr;
+    if (invlists == nullptr) {
+        KNOWHERE_THROW_MSG("compact is only supported on writable inverted lists");
+    }
+
+    size_t ntotal = 0;
+    auto code_size = ivf_index->code_size;
+    for (size_t list_no = 0; list_no < invlists->nlist; ++list_no) {
+        auto& ids = invlists->ids[list_no];
+        auto& codes = invlists->codes[list_no];
+        size_t kept = 0;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (ids[i] < 0 || ids[i] >= (int64_t)id_map.size() || id_map[ids[i]] < 0) {
+                continue;
+            }
+            ids[kept] = id_map[ids[i]];
+            if (kept != i) {
+                memcpy(codes.data() + kept * code_size, codes.data() + i * code_size, code_size);
+            }
+            ++kept;
+        }
+        invlists->resize(list_no, kept);
+        ntotal += kept;
+    }
+    ivf_index->ntotal = ntotal;
+
+    // rebuild the direct map, if any, for the new ids
+    auto direct_map_type = ivf_index->direct_map.type;
+    ivf_index->set_direct_map_type(faiss::DirectMap::NoMap);
+    ivf_index->set_direct_map_type(direct_map_type);
+    UpdateIndexSize();
+}
+
 std::shared_ptr<faiss::IVFSearchParameters>
 IVF::GenParams(const Config& config) {
     auto params = std::make_shared<faiss::IVFSearchParameters>();
@@ -296,16 +338,23 @@ IVF::GenParams(const Config& config) {
 void
 IVF::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& config,
                faiss::ConcurrentBitsetPtr blacklist) {
+    // search parameters are passed per call, the index may be shared by concurrent searches
     auto params = GenParams(config);
     auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
-    ivf_index->nprobe = std::min(params->nprobe, ivf_index->invlists->nlist);
+    params->nprobe = std::min(params->nprobe, ivf_index->invlists->nlist);
+    params->max_codes = ivf_index->max_codes;
     stdclock::time_point before = stdclock::now();
     if (params->nprobe > 1 && n <= 4) {
-        ivf_index->parallel_mode = 1;
+        params->parallel_mode = 1;
+    } else if (n * params->nprobe >= 2 * ivf_index->invlists->nlist && params->max_codes == 0 &&
+               dynamic_cast<faiss::IndexIVFPQ*>(ivf_index) == nullptr) {
+        // lists probed by several queries of the batch on average, scan each of them once for all these queries,
+        // pq scans are bound by the table lookups rather than by reading the codes so they keep mode 0
+        params->parallel_mode = 3;
     } else {
-        ivf_index->parallel_mode = 0;
+        params->parallel_mode = 0;
     }
-    ivf_index->search(n, (float*)data, k, distances, labels, blacklist);
+    ivf_index->search_with_parameters(n, (float*)data, k, distances, labels, params.get(), blacklist);
     stdclock::time_point after = stdclock::now();
     double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
     LOG_KNOWHERE_DEBUG_ << "IVF search cost: " << search_cost
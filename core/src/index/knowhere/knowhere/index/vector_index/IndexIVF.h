@@ -72,6 +72,11 @@ class IVF : public VecIndex, public FaissBaseIndex {
     virtual void
     GenGraph(const float* data, const int64_t k, GraphType& graph, const Config& config);
 
+    // drop and renumber entries of the inverted lists in place, keeping the trained quantizer,
+    // id_map maps each old id to its new id, entries mapped to -1 are dropped
+    virtual void
+    CompactInvertedLists(const std::vector<int64_t>& id_map);
+
  protected:
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config&);
@@ -0,0 +1,129 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <faiss/FaissHook.h>
+#include <faiss/IndexFlat.h>
+#include <faiss/IndexIVFPQFastScan.h>
+
+#include "knowhere/common/Exception.h"
+#include "knowhere/common/Log.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
+#include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/helpers/IndexParameter.h"
+
+namespace milvus {
+namespace knowhere {
+
+static const int64_t DEFAULT_K_FACTOR = 4;
+
+void
+IVFPQFastScan::Load(const BinarySet& binary_set) {
+    IVF::Load(binary_set);
+    raw_data_ = nullptr;
+}
+
+void
+IVFPQFastScan::Train(const DatasetPtr& dataset_ptr, const Config& config) {
+    GETTENSOR(dataset_ptr)
+
+    faiss::MetricType metric_type = GetMetricType(config[Metric::TYPE].get<std::string>());
+    faiss::Index* coarse_quantizer = new faiss::IndexFlat(dim, metric_type);
+    auto index = std::make_shared<faiss::IndexIVFPQFastScan>(coarse_quantizer, dim,
+                                                             config[IndexParams::nlist].get<int64_t>(),
+                                                             config[IndexParams::m].get<int64_t>(), metric_type);
+    index->own_fields = true;
+    index->train(rows, reinterpret_cast<const float*>(p_data));
+    index_ = index;
+    raw_data_ = nullptr;
+}
+
+VecIndexPtr
+IVFPQFastScan::CopyCpuToGpu(const int64_t device_id, const Config& config) {
+    KNOWHERE_THROW_MSG("IVF_PQ_FASTSCAN is only supported on CPU");
+}
+
+void
+IVFPQFastScan::UpdateIndexSize() {
+    IVFPQ::UpdateIndexSize();
+    if (raw_data_) {
+        index_size_ += Count() * Dim() * sizeof(float);
+    }
+}
+
+void
+IVFPQFastScan::CompactInvertedLists(const std::vector<int64_t>& id_map) {
+    KNOWHERE_THROW_MSG("IVF_PQ_FASTSCAN doesn't support compaction, the codes are packed by blocks");
+}
+
+void
+IVFPQFastScan::SetRawData(std::shared_ptr<uint8_t[]> raw_data) {
+    raw_data_ = std::move(raw_data);
+    UpdateIndexSize();
+}
+
+void
+IVFPQFastScan::QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels,
+                         const Config& config, faiss::ConcurrentBitsetPtr blacklist) {
+    if (raw_data_ == nullptr) {
+        IVF::QueryImpl(n, data, k, distances, labels, config, blacklist);
+        return;
+    }
+
+    // the labels are offsets in insertion order, they index the raw vectors
+    int64_t k_factor =
+        config.contains(IndexParams::k_factor) ? config[IndexParams::k_factor].get<int64_t>() : DEFAULT_K_FACTOR;
+    int64_t k_base = k * k_factor;
+    std::vector<float> base_distances(n * k_base);
+    std::vector<int64_t> base_labels(n * k_base);
+    IVF::QueryImpl(n, data, k_base, base_distances.data(), base_labels.data(), config, blacklist);
+
+    auto dim = index_->d;
+    bool is_ip = index_->metric_type == faiss::METRIC_INNER_PRODUCT;
+    auto raw_data = reinterpret_cast<const float*>(raw_data_.get());
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; ++i) {
+        const float* query = data + i * dim;
+        std::vector<std::pair<float, int64_t>> candidates;
+        candidates.reserve(k_base);
+        for (int64_t j = 0; j < k_base; ++j) {
+            auto id = base_labels[i * k_base + j];
+            if (id < 0) {
+                break;
+            }
+            auto vec = raw_data + id * dim;
+            candidates.emplace_back(
+                is_ip ? -faiss::fvec_inner_product(query, vec, dim) : faiss::fvec_L2sqr(query, vec, dim), id);
+        }
+
+        size_t result_size = std::min(candidates.size(), (size_t)k);
+        std::partial_sort(candidates.begin(), candidates.begin() + result_size, candidates.end());
+        for (int64_t j = 0; j < k; ++j) {
+            if (j < (int64_t)result_size) {
+                distances[i * k + j] = is_ip ? -candidates[j].first : candidates[j].first;
+                labels[i * k + j] = candidates[j].second;
+            } else {
+                distances[i * k + j] =
+                    is_ip ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+                labels[i * k + j] = -1;
+            }
+        }
+    }
+}
+
+}  // namespace knowhere
+}  // namespace milvus
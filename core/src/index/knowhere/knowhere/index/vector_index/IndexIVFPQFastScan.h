@@ -0,0 +1,67 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "knowhere/index/vector_index/IndexIVFPQ.h"
+
+namespace milvus {
+namespace knowhere {
+
+// IVF_PQ with 4-bit sub-quantizers whose codes are scanned 32 at a time with lookup tables held in SIMD
+// registers. The distances are approximate; when the raw vectors are set, k * k_factor candidates of every
+// query are re-ranked by their exact distances. CPU only.
+class IVFPQFastScan : public IVFPQ {
+ public:
+    IVFPQFastScan() : IVFPQ() {
+        index_type_ = IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN;
+    }
+
+    explicit IVFPQFastScan(std::shared_ptr<faiss::Index> index) : IVFPQ(std::move(index)) {
+        index_type_ = IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN;
+    }
+
+    void
+    Load(const BinarySet& binary_set) override;
+
+    void
+    Train(const DatasetPtr&, const Config&) override;
+
+    VecIndexPtr
+    CopyCpuToGpu(const int64_t, const Config&) override;
+
+    void
+    UpdateIndexSize() override;
+
+    void
+    CompactInvertedLists(const std::vector<int64_t>& id_map) override;
+
+    // raw float vectors in insertion order, they are not serialized with the index
+    void
+    SetRawData(std::shared_ptr<uint8_t[]> raw_data);
+
+ protected:
+    void
+    QueryImpl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& config,
+              faiss::ConcurrentBitsetPtr blacklist) override;
+
+ private:
+    std::shared_ptr<uint8_t[]> raw_data_ = nullptr;
+};
+
+using IVFPQFastScanPtr = std::shared_ptr<IVFPQFastScan>;
+
+}  // namespace knowhere
+}  // namespace milvus
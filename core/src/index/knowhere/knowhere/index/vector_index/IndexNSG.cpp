@@ -10,21 +10,21 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <fiu-local.h>
+#include <algorithm>
 #include <string>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/common/Timer.h"
-#include "knowhere/index/vector_index/IndexIDMAP.h"
-#include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/index/vector_index/IndexType.h"
 #include "knowhere/index/vector_index/adapter/VectorAdapter.h"
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/impl/nsg/NSG.h"
 #include "knowhere/index/vector_index/impl/nsg/NSGIO.h"
 
 #ifdef MILVUS_GPU_VERSION
+#include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/gpu/IndexGPUIDMAP.h"
-#include "knowhere/index/vector_index/gpu/IndexGPUIVF.h"
 #include "knowhere/index/vector_index/helpers/Cloner.h"
 #endif
 
@@ -106,29 +106,41 @@ NSG::Query(const DatasetPtr& dataset_ptr, const Config& config, faiss::Concurren
 
 void
 NSG::BuildAll(const DatasetPtr& dataset_ptr, const Config& config) {
-    auto idmap = std::make_shared<IDMAP>();
-    idmap->Train(dataset_ptr, config);
-    idmap->AddWithoutIds(dataset_ptr, config);
+    GETTENSOR(dataset_ptr)
+
+    impl::NsgIndex::Metric_Type metric;
+    auto metric_str = config[Metric::TYPE].get<std::string>();
+    if (metric_str == knowhere::Metric::IP) {
+        metric = impl::NsgIndex::Metric_Type::Metric_Type_IP;
+    } else if (metric_str == knowhere::Metric::L2) {
+        metric = impl::NsgIndex::Metric_Type::Metric_Type_L2;
+    } else {
+        KNOWHERE_THROW_MSG("Metric is not supported");
+    }
+    index_ = std::make_shared<impl::NsgIndex>(dim, rows, metric);
+
+    // the knn graph is built on the raw data, no copy of the data is made before NsgIndex::Build
     impl::Graph knng;
-    const float* raw_data = idmap->GetRawVectors();
     const int64_t k = config[IndexParams::knng].get<int64_t>();
 #ifdef MILVUS_GPU_VERSION
     const int64_t device_id = config[knowhere::meta::DEVICEID].get<int64_t>();
-    if (device_id == -1) {
-        auto preprocess_index = std::make_shared<IVF>();
-        preprocess_index->Train(dataset_ptr, config);
-        preprocess_index->AddWithoutIds(dataset_ptr, config);
-        preprocess_index->GenGraph(raw_data, k, knng, config);
-    } else {
+    if (device_id != -1) {
+        auto idmap = std::make_shared<IDMAP>();
+        idmap->Train(dataset_ptr, config);
+        idmap->AddWithoutIds(dataset_ptr, config);
         auto gpu_idx = cloner::CopyCpuToGpu(idmap, device_id, config);
+        idmap = nullptr;
         auto gpu_idmap = std::dynamic_pointer_cast<GPUIDMAP>(gpu_idx);
-        gpu_idmap->GenGraph(raw_data, k, knng, config);
+        gpu_idmap->GenGraph((const float*)p_data, k, knng, config);
+    } else {
+#endif
+        impl::NNDescentParams nnd_params;
+        nnd_params.k = k;
+        nnd_params.pool_size = k + std::min<int64_t>(k, 50);  // more candidates than k for a better recall
+        impl::NNDescent nnd((const float*)p_data, rows, dim, index_->distance_);
+        nnd.Build(nnd_params, knng);
+#ifdef MILVUS_GPU_VERSION
     }
-#else
-    auto preprocess_index = std::make_shared<IVF>();
-    preprocess_index->Train(dataset_ptr, config);
-    preprocess_index->AddWithoutIds(dataset_ptr, config);
-    preprocess_index->GenGraph(raw_data, k, knng, config);
 #endif
 
     impl::BuildParams b_params;
@@ -136,21 +148,12 @@ NSG::BuildAll(const DatasetPtr& dataset_ptr, const Config& config) {
     b_params.out_degree = config[IndexParams::out_degree];
     b_params.search_length = config[IndexParams::search_length];
 
-    GETTENSOR(dataset_ptr)
-
-    impl::NsgIndex::Metric_Type metric;
-    auto metric_str = config[Metric::TYPE].get<std::string>();
-    if (metric_str == knowhere::Metric::IP) {
-        metric = impl::NsgIndex::Metric_Type::Metric_Type_IP;
-    } else if (metric_str == knowhere::Metric::L2) {
-        metric = impl::NsgIndex::Metric_Type::Metric_Type_L2;
-    } else {
-        KNOWHERE_THROW_MSG("Metric is not supported");
-    }
-
-    index_ = std::make_shared<impl::NsgIndex>(dim, rows, metric);
     index_->SetKnnGraph(knng);
     index_->Build(rows, (float*)p_data, nullptr, b_params);
+
+    if (config.contains(IndexParams::reorder) && config[IndexParams::reorder].get<bool>()) {
+        index_->Reorder();
+    }
 }
 
 int64_t
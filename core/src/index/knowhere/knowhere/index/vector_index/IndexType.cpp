@@ -35,6 +35,8 @@ static std::unordered_map<int32_t, std::string> old_index_type_str_map = {
     {(int32_t)OldIndexType::SPTAG_BKT_RNT_CPU, IndexEnum::INDEX_SPTAG_BKT_RNT},
     {(int32_t)OldIndexType::HNSW, IndexEnum::INDEX_HNSW},
     {(int32_t)OldIndexType::ANNOY, IndexEnum::INDEX_ANNOY},
+    {(int32_t)OldIndexType::HNSW_SQ8, IndexEnum::INDEX_HNSW_SQ8},
+    {(int32_t)OldIndexType::FAISS_IVFPQ_FASTSCAN, IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN},
     {(int32_t)OldIndexType::FAISS_BIN_IDMAP, IndexEnum::INDEX_FAISS_BIN_IDMAP},
     {(int32_t)OldIndexType::FAISS_BIN_IVFLAT_CPU, IndexEnum::INDEX_FAISS_BIN_IVFFLAT},
 };
@@ -51,6 +53,8 @@ static std::unordered_map<std::string, int32_t> str_old_index_type_map = {
     {IndexEnum::INDEX_SPTAG_BKT_RNT, (int32_t)OldIndexType::SPTAG_BKT_RNT_CPU},
     {IndexEnum::INDEX_HNSW, (int32_t)OldIndexType::HNSW},
     {IndexEnum::INDEX_ANNOY, (int32_t)OldIndexType::ANNOY},
+    {IndexEnum::INDEX_HNSW_SQ8, (int32_t)OldIndexType::HNSW_SQ8},
+    {IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN, (int32_t)OldIndexType::FAISS_IVFPQ_FASTSCAN},
     {IndexEnum::INDEX_FAISS_BIN_IDMAP, (int32_t)OldIndexType::FAISS_BIN_IDMAP},
     {IndexEnum::INDEX_FAISS_BIN_IVFFLAT, (int32_t)OldIndexType::FAISS_BIN_IVFLAT_CPU},
 };
@@ -63,6 +67,7 @@ const char* INDEX_FAISS_IVFFLAT = "IVF_FLAT";
 const char* INDEX_FAISS_IVFPQ = "IVF_PQ";
 const char* INDEX_FAISS_IVFSQ8 = "IVF_SQ8";
 const char* INDEX_FAISS_IVFSQ8H = "IVF_SQ8_HYBRID";
+const char* INDEX_FAISS_IVFPQ_FASTSCAN = "IVF_PQ_FASTSCAN";
 const char* INDEX_FAISS_BIN_IDMAP = "BIN_IDMAP";
 const char* INDEX_FAISS_BIN_IVFFLAT = "BIN_IVF_FLAT";
 const char* INDEX_NSG = "NSG";
@@ -70,6 +75,7 @@ const char* INDEX_SPTAG_KDT_RNT = "SPTAG_KDT_RNT";
 const char* INDEX_SPTAG_BKT_RNT = "SPTAG_BKT_RNT";
 const char* INDEX_HNSW = "HNSW";
 const char* INDEX_ANNOY = "ANNOY";
+const char* INDEX_HNSW_SQ8 = "HNSW_SQ8";
 }  // namespace IndexEnum
 
 std::string
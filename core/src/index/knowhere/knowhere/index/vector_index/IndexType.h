@@ -35,6 +35,8 @@ enum class OldIndexType {
     SPTAG_BKT_RNT_CPU,
     HNSW,
     ANNOY,
+    HNSW_SQ8,
+    FAISS_IVFPQ_FASTSCAN,
     FAISS_BIN_IDMAP = 100,
     FAISS_BIN_IVFLAT_CPU = 101,
 };
@@ -49,6 +51,7 @@ extern const char* INDEX_FAISS_IVFFLAT;
 extern const char* INDEX_FAISS_IVFPQ;
 extern const char* INDEX_FAISS_IVFSQ8;
 extern const char* INDEX_FAISS_IVFSQ8H;
+extern const char* INDEX_FAISS_IVFPQ_FASTSCAN;
 extern const char* INDEX_FAISS_BIN_IDMAP;
 extern const char* INDEX_FAISS_BIN_IVFFLAT;
 extern const char* INDEX_NSG;
@@ -56,6 +59,7 @@ extern const char* INDEX_SPTAG_KDT_RNT;
 extern const char* INDEX_SPTAG_BKT_RNT;
 extern const char* INDEX_HNSW;
 extern const char* INDEX_ANNOY;
+extern const char* INDEX_HNSW_SQ8;
 }  // namespace IndexEnum
 
 enum class IndexMode { MODE_CPU = 0, MODE_GPU = 1, MODE_FPGA = 2 };
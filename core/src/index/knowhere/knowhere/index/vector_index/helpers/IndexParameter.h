@@ -33,6 +33,7 @@ constexpr const char* nprobe = "nprobe";
 constexpr const char* nlist = "nlist";
 constexpr const char* m = "m";          // PQ
 constexpr const char* nbits = "nbits";  // PQ/SQ
+constexpr const char* k_factor = "k_factor";  // IVF_PQ_FASTSCAN with rerank, candidates re-ranked per result
 
 // NSG Params
 constexpr const char* knng = "knng";
@@ -44,6 +45,10 @@ constexpr const char* candidate = "candidate_pool_size";
 constexpr const char* efConstruction = "efConstruction";
 constexpr const char* M = "M";
 constexpr const char* ef = "ef";
+constexpr const char* rerank = "rerank";  // HNSW_SQ8/IVF_PQ_FASTSCAN, keep the raw vectors to re-rank the results
+
+// HNSW/HNSW_SQ8/NSG, renumber the graph nodes after build so that neighbors are close in memory
+constexpr const char* reorder = "reorder";
 
 // Annoy Params
 constexpr const char* n_trees = "n_trees";
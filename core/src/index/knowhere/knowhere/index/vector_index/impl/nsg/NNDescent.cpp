@@ -0,0 +1,193 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "faiss/BuilderSuspend.h"
+#include "knowhere/common/Log.h"
+#include "knowhere/common/Timer.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+NNDescent::NNDescent(const float* data, size_t n, size_t dimension, const Distance* distance)
+    : data_(data), ntotal_(n), dimension_(dimension), distance_(distance) {
+}
+
+void
+NNDescent::Build(const NNDescentParams& params, Graph& knng) {
+    params_ = params;
+    params_.k = std::min(params_.k, ntotal_ > 0 ? ntotal_ - 1 : 0);
+    params_.pool_size = std::min(std::max(params_.pool_size, params_.k), ntotal_ > 0 ? ntotal_ - 1 : 0);
+    nhoods_ = std::vector<Nhood>(ntotal_);
+
+    TimeRecorder rc("NNDescent", 1);
+    Init();
+    rc.RecordSection("init");
+
+    auto threshold = static_cast<size_t>(params_.delta * params_.pool_size * ntotal_);
+    for (size_t it = 0; it < params_.iterations; ++it) {
+        Update();
+        auto updates = Join();
+        LOG_KNOWHERE_DEBUG_ << "NNDescent iteration " << it << ", updates: " << updates;
+        if (updates <= threshold) {
+            break;
+        }
+    }
+    rc.RecordSection("iterate");
+
+    // move the pools into the graph node by node, so the pools and the graph are never held together
+    knng.resize(ntotal_);
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        auto& node = knng[n];
+        node.resize(params_.k);
+        for (size_t i = 0; i < params_.k; ++i) {
+            node[i] = nhood.pool[i].id;
+        }
+        std::vector<Neighbor>().swap(nhood.pool);
+        std::vector<node_t>().swap(nhood.nn_new);
+        std::vector<node_t>().swap(nhood.nn_old);
+    }
+    std::vector<Nhood>().swap(nhoods_);
+    rc.ElapseFromBegin("finish");
+}
+
+void
+NNDescent::Init() {
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& pool = nhoods_[n].pool;
+        pool.reserve(params_.pool_size);
+
+        // random distinct neighbors, all the others if there are not enough
+        std::mt19937 rng(n);
+        std::uniform_int_distribution<node_t> dis(0, ntotal_ - 1);
+        while (pool.size() < params_.pool_size) {
+            auto id = dis(rng);
+            if (id == static_cast<node_t>(n)) {
+                continue;
+            }
+            auto dup = std::find_if(pool.begin(), pool.end(), [id](const Neighbor& nn) { return nn.id == id; });
+            if (dup == pool.end()) {
+                pool.emplace_back(id, Compare(n, id), false);
+            }
+        }
+        std::sort(pool.begin(), pool.end());
+    }
+}
+
+void
+NNDescent::Update() {
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        nhood.nn_new.clear();
+        nhood.nn_old.clear();
+        for (auto& nn : nhood.pool) {
+            if (!nn.has_explored) {
+                if (nhood.nn_new.size() < params_.sample) {
+                    nhood.nn_new.push_back(nn.id);
+                    nn.has_explored = true;
+                }
+            } else {
+                nhood.nn_old.push_back(nn.id);
+            }
+        }
+    }
+
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        for (auto id : nhoods_[n].nn_new) {
+            auto& other = nhoods_[id];
+            LockGuard lk(other.mutex);
+            if (other.rnn_new.size() < params_.reverse) {
+                other.rnn_new.push_back(n);
+            }
+        }
+        for (auto id : nhoods_[n].nn_old) {
+            auto& other = nhoods_[id];
+            LockGuard lk(other.mutex);
+            if (other.rnn_old.size() < params_.reverse) {
+                other.rnn_old.push_back(n);
+            }
+        }
+    }
+
+    auto merge = [](std::vector<node_t>& nn, std::vector<node_t>& rnn) {
+        nn.insert(nn.end(), rnn.begin(), rnn.end());
+        std::sort(nn.begin(), nn.end());
+        nn.erase(std::unique(nn.begin(), nn.end()), nn.end());
+        std::vector<node_t>().swap(rnn);
+    };
+#pragma omp parallel for schedule(dynamic, 100)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        auto& nhood = nhoods_[n];
+        merge(nhood.nn_new, nhood.rnn_new);
+        merge(nhood.nn_old, nhood.rnn_old);
+    }
+}
+
+size_t
+NNDescent::Join() {
+    size_t updates = 0;
+#pragma omp parallel for schedule(dynamic, 100) reduction(+ : updates)
+    for (size_t n = 0; n < ntotal_; ++n) {
+        faiss::BuilderSuspend::check_wait();
+        auto& nn_new = nhoods_[n].nn_new;
+        auto& nn_old = nhoods_[n].nn_old;
+        for (size_t i = 0; i < nn_new.size(); ++i) {
+            auto a = nn_new[i];
+            for (size_t j = i + 1; j < nn_new.size(); ++j) {
+                auto b = nn_new[j];
+                float dist = Compare(a, b);
+                updates += Insert(a, Neighbor(b, dist, false));
+                updates += Insert(b, Neighbor(a, dist, false));
+            }
+            for (auto b : nn_old) {
+                if (a == b) {
+                    continue;
+                }
+                float dist = Compare(a, b);
+                updates += Insert(a, Neighbor(b, dist, false));
+                updates += Insert(b, Neighbor(a, dist, false));
+            }
+        }
+    }
+    return updates;
+}
+
+bool
+NNDescent::Insert(node_t n, const Neighbor& nn) {
+    auto& nhood = nhoods_[n];
+    auto& pool = nhood.pool;
+    LockGuard lk(nhood.mutex);
+    if (pool.empty() || nn.distance >= pool.back().distance) {
+        return false;
+    }
+    for (auto& p : pool) {
+        if (p.id == nn.id) {
+            return false;
+        }
+    }
+    pool.pop_back();
+    pool.insert(std::upper_bound(pool.begin(), pool.end(), nn), nn);
+    return true;
+}
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
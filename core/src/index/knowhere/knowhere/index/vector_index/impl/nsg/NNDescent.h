@@ -0,0 +1,90 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Distance.h"
+#include "NSG.h"
+#include "Neighbor.h"
+
+namespace milvus {
+namespace knowhere {
+namespace impl {
+
+struct NNDescentParams {
+    size_t k;                // neighbors of each node in the knn graph
+    size_t pool_size = 0;    // candidates kept for each node while iterating, at least k
+    size_t sample = 10;      // new neighbors of each node joined in an iteration
+    size_t reverse = 100;    // max reverse neighbors of each node joined in an iteration
+    size_t iterations = 30;  // max iterations
+    float delta = 0.002;     // stop once less than delta * pool_size * n candidates are updated in an iteration
+};
+
+// approximate knn graph built by nn-descent: neighbors of neighbors are likely to be neighbors,
+// so each iteration compares the sampled neighbors and reverse neighbors of every node with each other.
+// works on the raw data without any copy, the extra memory is the candidate pools of the nodes
+class NNDescent {
+ public:
+    NNDescent(const float* data, size_t n, size_t dimension, const Distance* distance);
+
+    // knng[i] holds the ids of the nearest neighbors of node i, nearest first, excluding i
+    void
+    Build(const NNDescentParams& params, Graph& knng);
+
+ private:
+    // neighbor pool of a node sorted by distance, has_explored is false until a neighbor is sampled
+    struct Nhood {
+        std::mutex mutex;
+        std::vector<Neighbor> pool;
+        std::vector<node_t> nn_new;
+        std::vector<node_t> nn_old;
+        std::vector<node_t> rnn_new;
+        std::vector<node_t> rnn_old;
+    };
+
+    void
+    Init();
+
+    // sample the new and old neighbors to join, reverse neighbors included
+    void
+    Update();
+
+    // compare the sampled neighbors of every node with each other, return the number of pool updates
+    size_t
+    Join();
+
+    // try nn as a neighbor of node n, return whether the pool of n changed
+    bool
+    Insert(node_t n, const Neighbor& nn);
+
+    float
+    Compare(node_t a, node_t b) const {
+        return distance_->Compare(data_ + dimension_ * a, data_ + dimension_ * b, dimension_);
+    }
+
+ private:
+    const float* data_;
+    size_t ntotal_;
+    size_t dimension_;
+    const Distance* distance_;
+
+    NNDescentParams params_;
+    std::vector<Nhood> nhoods_;
+};
+
+}  // namespace impl
+}  // namespace knowhere
+}  // namespace milvus
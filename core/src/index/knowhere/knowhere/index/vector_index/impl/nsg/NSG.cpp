@@ -860,7 +860,7 @@ NsgIndex::Search(const float* query, const unsigned& nq, const unsigned& dim, co
         for (unsigned int j = 0; j < resset[i].size(); ++j) {
             if (pos >= k)
                 break;  // already top k
-            if (!bitset || !bitset->test((faiss::ConcurrentBitset::id_type_t)resset[i][j].id)) {
+            if (!bitset || !bitset->test((faiss::ConcurrentBitset::id_type_t)ids_[resset[i][j].id])) {
                 ids[i * k + pos] = ids_[resset[i][j].id];
                 dist[i * k + pos] = is_ip ? -resset[i][j].distance : resset[i][j].distance;
                 ++pos;
@@ -875,6 +875,56 @@ NsgIndex::Search(const float* query, const unsigned& nq, const unsigned& dim, co
     rc.RecordSection("merge");
 }
 
+void
+NsgIndex::Reorder() {
+    if (ntotal == 0) {
+        return;
+    }
+
+    // nodes reached from the navigation point first, the graph is connected by CheckConnectivity
+    const node_t unvisited = -1;
+    std::vector<node_t> old_to_new(ntotal, unvisited);
+    std::vector<node_t> new_to_old;
+    new_to_old.reserve(ntotal);
+    for (size_t root = 0; new_to_old.size() < ntotal; ++root) {
+        node_t start = (root == 0) ? navigation_point : (node_t)(root - 1);
+        if (old_to_new[start] != unvisited) {
+            continue;
+        }
+        size_t head = new_to_old.size();
+        old_to_new[start] = new_to_old.size();
+        new_to_old.push_back(start);
+        while (head < new_to_old.size()) {
+            for (auto id : nsg[new_to_old[head++]]) {
+                if (old_to_new[id] == unvisited) {
+                    old_to_new[id] = new_to_old.size();
+                    new_to_old.push_back(id);
+                }
+            }
+        }
+    }
+
+    auto new_data = new float[ntotal * dimension];
+    auto new_ids = new int64_t[ntotal];
+    Graph new_nsg(ntotal);
+    for (size_t i = 0; i < ntotal; ++i) {
+        node_t old_id = new_to_old[i];
+        memcpy(new_data + i * dimension, ori_data_ + old_id * dimension, sizeof(float) * dimension);
+        new_ids[i] = ids_[old_id];
+        new_nsg[i] = std::move(nsg[old_id]);
+        for (auto& id : new_nsg[i]) {
+            id = old_to_new[id];
+        }
+    }
+
+    delete[] ori_data_;
+    delete[] ids_;
+    ori_data_ = new_data;
+    ids_ = new_ids;
+    nsg.swap(new_nsg);
+    navigation_point = old_to_new[navigation_point];
+}
+
 void
 NsgIndex::SetKnnGraph(Graph& g) {
     knng = std::move(g);
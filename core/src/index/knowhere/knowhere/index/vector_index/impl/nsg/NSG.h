@@ -82,6 +82,10 @@ class NsgIndex {
     virtual void
     Build(size_t nb, const float* data, const int64_t* ids, const BuildParams& parameters);
 
+    // renumber the nodes in BFS order from the navigation point, ids_ keeps the original offsets
+    void
+    Reorder();
+
     void
     Search(const float* query, const unsigned& nq, const unsigned& dim, const unsigned& k, float* dist, int64_t* ids,
            SearchParams& params, faiss::ConcurrentBitsetPtr bitset = nullptr);
@@ -13,6 +13,9 @@
 #include <faiss/utils/distances_avx.h>
 #include <faiss/utils/distances_avx512.h>
 #include <faiss/utils/instruction_set.h>
+#include <faiss/utils/pq4_fast_scan.h>
+#include <faiss/utils/pq4_fast_scan_avx.h>
+#include <faiss/utils/pq4_fast_scan_avx512.h>
 
 namespace faiss {
 
@@ -30,6 +33,8 @@ sq_get_distance_computer_func_ptr sq_get_distance_computer = sq_get_distance_com
 sq_sel_quantizer_func_ptr sq_sel_quantizer = sq_select_quantizer_avx;
 sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx;
 
+pq4_accumulate_func_ptr pq4_accumulate = pq4_accumulate_avx;
+
 /*****************************************************************************/
 
 bool support_avx512() {
@@ -71,6 +76,9 @@ bool hook_init(std::string& cpu_flag) {
         sq_sel_quantizer = sq_select_quantizer_avx512;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx512;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_avx512;
+
         cpu_flag = "AVX512";
     } else if (support_avx2()) {
         /* for IVFFLAT */
@@ -84,6 +92,9 @@ bool hook_init(std::string& cpu_flag) {
         sq_sel_quantizer = sq_select_quantizer_avx;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_avx;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_avx;
+
         cpu_flag = "AVX2";
     } else if (support_sse()) {
         /* for IVFFLAT */
@@ -97,6 +108,9 @@ bool hook_init(std::string& cpu_flag) {
         sq_sel_quantizer = sq_select_quantizer_ref;
         sq_sel_inv_list_scanner = sq_select_inverted_list_scanner_ref;
 
+        /* for IVFPQ fast scan */
+        pq4_accumulate = pq4_accumulate_ref;
+
         cpu_flag = "SSE42";
     } else {
         cpu_flag = "UNSUPPORTED";
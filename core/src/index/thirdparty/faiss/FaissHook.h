@@ -18,6 +18,8 @@ typedef SQDistanceComputer* (*sq_get_distance_computer_func_ptr)(MetricType, Qua
 typedef Quantizer* (*sq_sel_quantizer_func_ptr)(QuantizerType, size_t, const std::vector<float>&);
 typedef InvertedListScanner* (*sq_sel_inv_list_scanner_func_ptr)(MetricType, const ScalarQuantizer*, const Index*, size_t, bool, bool);
 
+typedef void (*pq4_accumulate_func_ptr)(size_t, size_t, const uint8_t*, const uint8_t*, uint16_t*);
+
 extern bool faiss_use_avx512;
 extern bool faiss_use_avx2;
 extern bool faiss_use_sse;
@@ -31,6 +33,8 @@ extern sq_get_distance_computer_func_ptr sq_get_distance_computer;
 extern sq_sel_quantizer_func_ptr sq_sel_quantizer;
 extern sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner;
 
+extern pq4_accumulate_func_ptr pq4_accumulate;
+
 extern bool support_avx512();
 extern bool support_avx2();
 extern bool support_sse();
@@ -115,6 +115,13 @@ struct IndexBinaryIVF : IndexBinary {
     void search(idx_t n, const uint8_t *x, idx_t k,
                 int32_t *distances, idx_t *labels, ConcurrentBitsetPtr bitset = nullptr) const override;
 
+    /** same as search, with params overriding the object's search
+     * parameters, so concurrent searches do not modify the index */
+    void search_with_parameters(idx_t n, const uint8_t *x, idx_t k,
+                                int32_t *distances, idx_t *labels,
+                                const IVFSearchParameters *params,
+                                ConcurrentBitsetPtr bitset = nullptr) const;
+
 #if 0
     /** get raw vectors by ids */
     void get_vector_by_id(idx_t n, const idx_t *xid, uint8_t *x, ConcurrentBitsetPtr bitset = nullptr) override;
@@ -14,6 +14,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <iostream>
 #include <sstream>
 
@@ -302,6 +303,15 @@ void IndexIVF::search (idx_t n, const float *x, idx_t k,
                        float *distances, idx_t *labels,
                        ConcurrentBitsetPtr bitset) const
 {
+    search_with_parameters (n, x, k, distances, labels, nullptr, bitset);
+}
+
+void IndexIVF::search_with_parameters (idx_t n, const float *x, idx_t k,
+                                       float *distances, idx_t *labels,
+                                       const IVFSearchParameters *params,
+                                       ConcurrentBitsetPtr bitset) const
+{
+    size_t nprobe = params ? params->nprobe : this->nprobe;
     std::unique_ptr<idx_t[]> idx(new idx_t[n * nprobe]);
     std::unique_ptr<float[]> coarse_dis(new float[n * nprobe]);
 
@@ -313,7 +323,7 @@ void IndexIVF::search (idx_t n, const float *x, idx_t k,
     invlists->prefetch_lists (idx.get(), n * nprobe);
 
     search_preassigned (n, x, k, idx.get(), coarse_dis.get(),
-                        distances, labels, false, nullptr, bitset);
+                        distances, labels, false, params, bitset);
     indexIVF_stats.search_time += getmillisecs() - t0;
 
     // string
@@ -378,8 +388,10 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
     bool interrupt = false;
 
-    int pmode = this->parallel_mode & ~PARALLEL_MODE_NO_HEAP_INIT;
-    bool do_heap_init = !(this->parallel_mode & PARALLEL_MODE_NO_HEAP_INIT);
+    int parallel_mode = params && params->parallel_mode >= 0 ?
+        params->parallel_mode : this->parallel_mode;
+    int pmode = parallel_mode & ~PARALLEL_MODE_NO_HEAP_INIT;
+    bool do_heap_init = !(parallel_mode & PARALLEL_MODE_NO_HEAP_INIT);
 
     // don't start parallel section if single query
     bool do_parallel =
@@ -387,6 +399,47 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
         pmode == 1 ? nprobe > 1 :
         nprobe * n > 1;
 
+    // parallel_mode 3: the queries are taken by batches of
+    // query_batch. The (query, probe) pairs of a batch are grouped by
+    // list, slot = batch * nlist + list, and probed_slots keeps the
+    // slots with at least one pair, batch after batch
+    const size_t query_batch = 256;
+    size_t nbatch = (n + query_batch - 1) / query_batch;
+    std::vector<size_t> slot_pairs_offset;
+    std::vector<idx_t> slot_pairs;
+    std::vector<size_t> probed_slots;
+    std::vector<size_t> batch_offset;
+    std::unique_ptr<std::mutex[]> query_locks;
+    if (pmode == 3) {
+        slot_pairs_offset.resize (nbatch * nlist + 1, 0);
+        for (size_t p = 0; p < n * nprobe; p++) {
+            FAISS_THROW_IF_NOT_FMT (keys[p] < (idx_t) nlist,
+                                    "Invalid key=%ld nlist=%ld\n",
+                                    keys[p], nlist);
+            if (keys[p] >= 0) {
+                slot_pairs_offset[p / nprobe / query_batch * nlist + keys[p] + 1]++;
+            }
+        }
+        batch_offset.push_back (0);
+        for (size_t slot = 0; slot < nbatch * nlist; slot++) {
+            if (slot_pairs_offset[slot + 1] > 0) {
+                probed_slots.push_back (slot);
+            }
+            if ((slot + 1) % nlist == 0) {
+                batch_offset.push_back (probed_slots.size());
+            }
+            slot_pairs_offset[slot + 1] += slot_pairs_offset[slot];
+        }
+        slot_pairs.resize (slot_pairs_offset[nbatch * nlist]);
+        std::vector<size_t> fill (slot_pairs_offset.begin(), slot_pairs_offset.end() - 1);
+        for (size_t p = 0; p < n * nprobe; p++) {
+            if (keys[p] >= 0) {
+                slot_pairs[fill[p / nprobe / query_batch * nlist + keys[p]]++] = p;
+            }
+        }
+        query_locks.reset (new std::mutex[n]);
+    }
+
 #pragma omp parallel if(do_parallel) reduction(+: nlistv, ndis, nheap)
     {
         InvertedListScanner *scanner = get_InvertedListScanner(store_pairs);
@@ -544,6 +597,89 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 #pragma omp single
                 reorder_result (simi, idxi);
             }
+        } else if (pmode == 3) {
+#pragma omp for
+            for (size_t i = 0; i < n; i++) {
+                init_result (distances + i * k, labels + i * k);
+            }
+
+            // one scanner per query of the batch, so that the query is
+            // set once and only the list changes (e.g. for IVFPQ the
+            // query tables are computed once per query)
+            std::vector<std::unique_ptr<InvertedListScanner>> scanners (
+                 std::min (n, (idx_t) query_batch));
+            std::vector<idx_t> scanner_query (scanners.size(), -1);
+
+            // with store_pairs the labels are offsets in the whole list
+            size_t block_size = store_pairs ? (size_t) -1 :
+                std::max ((size_t) 1, (size_t) (64 * 1024) / code_size);
+
+            for (size_t batch = 0; batch < nbatch; batch++) {
+
+#pragma omp for schedule(dynamic)
+                for (size_t s = batch_offset[batch]; s < batch_offset[batch + 1]; s++) {
+                    if (interrupt) {
+                        continue;
+                    }
+
+                    size_t slot = probed_slots[s];
+                    idx_t key = slot % nlist;
+                    size_t list_size = invlists->list_size(key);
+                    if (list_size == 0) {
+                        continue;
+                    }
+
+                    const idx_t *pairs = slot_pairs.data() + slot_pairs_offset[slot];
+                    size_t npairs = slot_pairs_offset[slot + 1] - slot_pairs_offset[slot];
+                    for (size_t q = 0; q < npairs; q++) {
+                        idx_t i = pairs[q] / nprobe;
+                        auto & qscanner = scanners[i % query_batch];
+                        if (!qscanner) {
+                            qscanner.reset (get_InvertedListScanner (store_pairs));
+                        }
+                        if (scanner_query[i % query_batch] != i) {
+                            qscanner->set_query (x + i * d);
+                            scanner_query[i % query_batch] = i;
+                        }
+                        qscanner->set_list (key, coarse_dis[pairs[q]]);
+                    }
+                    nlistv += npairs;
+
+                    InvertedLists::ScopedCodes scodes (invlists, key);
+
+                    std::unique_ptr<InvertedLists::ScopedIds> sids;
+                    const Index::idx_t * ids = nullptr;
+
+                    if (!store_pairs)  {
+                        sids.reset (new InvertedLists::ScopedIds (invlists, key));
+                        ids = sids->get();
+                    }
+
+                    // a block of codes stays in cache while it is compared
+                    // to all the queries, the list is read from memory once
+                    for (size_t j0 = 0; j0 < list_size; j0 += block_size) {
+                        size_t j1 = std::min (list_size, j0 + block_size);
+                        for (size_t q = 0; q < npairs; q++) {
+                            idx_t i = pairs[q] / nprobe;
+                            std::lock_guard<std::mutex> lock (query_locks[i]);
+                            nheap += scanners[i % query_batch]->scan_codes (
+                                 j1 - j0, scodes.get() + j0 * code_size,
+                                 ids ? ids + j0 : nullptr,
+                                 distances + i * k, labels + i * k, k, bitset);
+                        }
+                    }
+                    ndis += list_size * npairs;
+
+                    if (InterruptCallback::is_interrupted ()) {
+                        interrupt = true;
+                    }
+                }
+            }
+
+#pragma omp for
+            for (size_t i = 0; i < n; i++) {
+                reorder_result (distances + i * k, labels + i * k);
+            }
         } else {
             FAISS_THROW_FMT ("parallel_mode %d not supported\n",
                              pmode);
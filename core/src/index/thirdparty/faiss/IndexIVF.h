@@ -69,6 +69,8 @@ struct Level1Quantizer {
 struct IVFSearchParameters {
     size_t nprobe;            ///< number of probes at query time
     size_t max_codes;         ///< max nb of codes to visit to do a query
+    int parallel_mode;        ///< overrides the index parallel_mode if >= 0
+    IVFSearchParameters(): nprobe(1), max_codes(0), parallel_mode(-1) {}
     virtual ~IVFSearchParameters () {}
 };
 
@@ -111,6 +113,8 @@ struct IndexIVF: Index, Level1Quantizer {
      * 0 (default): parallelize over queries
      * 1: parallelize over inverted lists
      * 2: parallelize over both
+     * 3: parallelize over inverted lists, each probed list is scanned
+     *    once for all the queries that probe it (max_codes is ignored)
      *
      * PARALLEL_MODE_NO_HEAP_INIT: binary or with the previous to
      * prevent the heap to be initialized and finalized
@@ -192,6 +196,13 @@ struct IndexIVF: Index, Level1Quantizer {
                  float *distances, idx_t *labels,
                  ConcurrentBitsetPtr bitset = nullptr) const override;
 
+    /** same as search, with params overriding the object's search
+     * parameters, so concurrent searches do not modify the index */
+    void search_with_parameters (idx_t n, const float *x, idx_t k,
+                                 float *distances, idx_t *labels,
+                                 const IVFSearchParameters *params,
+                                 ConcurrentBitsetPtr bitset = nullptr) const;
+
 #if 0
     /** get raw vectors by ids */
     void get_vector_by_id (idx_t n, const idx_t *xid, float *x, ConcurrentBitsetPtr bitset = nullptr) override;
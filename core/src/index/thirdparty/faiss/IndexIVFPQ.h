@@ -22,6 +22,7 @@ namespace faiss {
 struct IVFPQSearchParameters: IVFSearchParameters {
     size_t scan_table_threshold;   ///< use table computation or on-the-fly?
     int polysemous_ht;             ///< Hamming thresh for polysemous filtering
+    IVFPQSearchParameters (): scan_table_threshold(0), polysemous_ht(0) {}
     ~IVFPQSearchParameters () {}
 };
 
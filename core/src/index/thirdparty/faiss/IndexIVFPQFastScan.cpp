@@ -0,0 +1,429 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#include <faiss/IndexIVFPQFastScan.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <faiss/FaissHook.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/distances.h>
+#include <faiss/utils/pq4_fast_scan.h>
+#include <faiss/utils/utils.h>
+#include <faiss/impl/AuxIndexStructures.h>
+#include <faiss/impl/FaissAssert.h>
+
+
+namespace faiss {
+
+IndexIVFPQFastScan::IndexIVFPQFastScan (Index * quantizer, size_t d,
+                                        size_t nlist, size_t M,
+                                        MetricType metric):
+    IndexIVFPQ (quantizer, d, nlist, M, 4, metric)
+{
+}
+
+IndexIVFPQFastScan::IndexIVFPQFastScan ()
+{
+}
+
+
+/*****************************************************
+ * Block layout of the inverted lists
+ *****************************************************/
+
+void IndexIVFPQFastScan::pack_list (idx_t list_no, size_t begin)
+{
+    size_t list_size = invlists->list_size (list_no);
+    if (begin + bbs > list_size) {
+        return;
+    }
+    size_t nsq = code_size * 2;
+    std::vector<uint8_t> block (bbs * code_size);
+
+    InvertedLists::ScopedCodes codes (invlists, list_no);
+    InvertedLists::ScopedIds ids (invlists, list_no);
+    for (size_t j0 = begin; j0 + bbs <= list_size; j0 += bbs) {
+        pq4_pack_block (bbs, nsq, codes.get() + j0 * code_size, block.data());
+        invlists->update_entries (list_no, j0, bbs, ids.get() + j0,
+                                  block.data());
+    }
+}
+
+void IndexIVFPQFastScan::unpack_list (idx_t list_no)
+{
+    size_t list_size = invlists->list_size (list_no);
+    size_t nsq = code_size * 2;
+    std::vector<uint8_t> plain (bbs * code_size);
+
+    InvertedLists::ScopedCodes codes (invlists, list_no);
+    InvertedLists::ScopedIds ids (invlists, list_no);
+    for (size_t j0 = 0; j0 + bbs <= list_size; j0 += bbs) {
+        const uint8_t *block = codes.get() + j0 * code_size;
+        for (size_t j = 0; j < bbs; j++) {
+            pq4_get_code (nsq, block, j, plain.data() + j * code_size);
+        }
+        invlists->update_entries (list_no, j0, bbs, ids.get() + j0,
+                                  plain.data());
+    }
+}
+
+void IndexIVFPQFastScan::get_code (idx_t list_no, size_t offset,
+                                   uint8_t *code) const
+{
+    size_t list_size = invlists->list_size (list_no);
+    InvertedLists::ScopedCodes codes (invlists, list_no);
+    if (offset < list_size / bbs * bbs) {
+        const uint8_t *block = codes.get() + offset / bbs * bbs * code_size;
+        pq4_get_code (code_size * 2, block, offset % bbs, code);
+    } else {
+        memcpy (code, codes.get() + offset * code_size, code_size);
+    }
+}
+
+
+/*****************************************************
+ * Adding and moving entries
+ *****************************************************/
+
+void IndexIVFPQFastScan::add_with_ids (idx_t n, const float * x,
+                                       const idx_t *xids)
+{
+    // the tail of a list stays in the PQ layout, the new codes are
+    // appended after it and the blocks they complete are packed
+    std::vector<size_t> old_sizes (nlist);
+    for (size_t list_no = 0; list_no < nlist; list_no++) {
+        old_sizes[list_no] = invlists->list_size (list_no);
+    }
+
+    IndexIVFPQ::add_with_ids (n, x, xids);
+
+#pragma omp parallel for
+    for (size_t list_no = 0; list_no < nlist; list_no++) {
+        pack_list (list_no, old_sizes[list_no] / bbs * bbs);
+    }
+}
+
+void IndexIVFPQFastScan::merge_from (IndexIVF &other, idx_t add_id)
+{
+    IndexIVFPQFastScan *other_fs = dynamic_cast<IndexIVFPQFastScan *> (&other);
+    FAISS_THROW_IF_NOT_MSG (other_fs,
+                            "can only merge an IndexIVFPQFastScan");
+
+    std::vector<size_t> old_sizes (nlist);
+    for (size_t list_no = 0; list_no < nlist; list_no++) {
+        old_sizes[list_no] = invlists->list_size (list_no);
+        other_fs->unpack_list (list_no);
+    }
+
+    IndexIVF::merge_from (other, add_id);
+
+    for (size_t list_no = 0; list_no < nlist; list_no++) {
+        pack_list (list_no, old_sizes[list_no] / bbs * bbs);
+    }
+}
+
+size_t IndexIVFPQFastScan::remove_ids (const IDSelector & /* sel */)
+{
+    FAISS_THROW_MSG ("remove_ids not supported by IndexIVFPQFastScan");
+}
+
+void IndexIVFPQFastScan::update_vectors (int /* nv */,
+                                         const idx_t * /* idx */,
+                                         const float * /* v */)
+{
+    FAISS_THROW_MSG ("update_vectors not supported by IndexIVFPQFastScan");
+}
+
+void IndexIVFPQFastScan::copy_subset_to (IndexIVF & /* other */,
+                                         int /* subset_type */,
+                                         idx_t /* a1 */,
+                                         idx_t /* a2 */) const
+{
+    FAISS_THROW_MSG ("copy_subset_to not supported by IndexIVFPQFastScan");
+}
+
+void IndexIVFPQFastScan::reconstruct_from_offset (int64_t list_no,
+                                                  int64_t offset,
+                                                  float* recons) const
+{
+    std::vector<uint8_t> code (code_size);
+    get_code (list_no, offset, code.data());
+
+    pq.decode (code.data(), recons);
+    if (by_residual) {
+        std::vector<float> centroid (d);
+        quantizer->reconstruct (list_no, centroid.data());
+        for (int i = 0; i < d; ++i) {
+            recons[i] += centroid[i];
+        }
+    }
+}
+
+
+/*****************************************************
+ * Search
+ *****************************************************/
+
+namespace {
+
+/** quantize a float table of nsq * 16 entries (M used sub-quantizers)
+ * to uint8. The table entries are minimized, the distance of a code is
+ * approximately bias + sum (LUT) / scale. The scale is chosen so that
+ * the sum of the M entries of a code fits in 16 bits, rounding each entry
+ * adds at most 0.5 so M is kept as a margin. */
+void quantize_LUT (size_t M, const float *table, uint8_t *LUT,
+                   float & bias, float & scale)
+{
+    std::vector<float> mins (M);
+    float max_range = 0, total_range = 0;
+    bias = 0;
+    for (size_t m = 0; m < M; m++) {
+        const float *t = table + m * 16;
+        float vmin = t[0], vmax = t[0];
+        for (size_t j = 1; j < 16; j++) {
+            vmin = std::min (vmin, t[j]);
+            vmax = std::max (vmax, t[j]);
+        }
+        mins[m] = vmin;
+        bias += vmin;
+        max_range = std::max (max_range, vmax - vmin);
+        total_range += vmax - vmin;
+    }
+
+    scale = max_range > 0 ? 255.0f / max_range : 1.0f;
+    float max_sum = 65535.0f - M;
+    if (total_range * scale > max_sum) {
+        scale = max_sum / total_range;
+    }
+
+    for (size_t m = 0; m < M; m++) {
+        const float *t = table + m * 16;
+        for (size_t j = 0; j < 16; j++) {
+            float v = std::floor ((t[j] - mins[m]) * scale + 0.5f);
+            LUT[m * 16 + j] = (uint8_t) std::min (v, 255.0f);
+        }
+    }
+}
+
+} // anonymous namespace
+
+
+void IndexIVFPQFastScan::search_preassigned (idx_t n, const float *x, idx_t k,
+                                             const idx_t *keys,
+                                             const float *coarse_dis,
+                                             float *distances, idx_t *labels,
+                                             bool store_pairs,
+                                             const IVFSearchParameters *params,
+                                             ConcurrentBitsetPtr bitset) const
+{
+    long nprobe = params ? params->nprobe : this->nprobe;
+    size_t nsq = code_size * 2;
+    size_t M = pq.M;
+    bool is_ip = metric_type == METRIC_INNER_PRODUCT;
+    // L2 on residuals: ||x - c||^2 (the coarse distance) + the table of
+    // ||r||^2 + 2 <c, r> precomputed for the list - 2 <x, r>
+    bool use_precomputed = !is_ip && by_residual &&
+        use_precomputed_table == 1;
+
+    // the heaps are kept on costs to minimize, for the inner product the
+    // cost is the negated similarity
+    using HeapForCost = CMax<float, idx_t>;
+
+    size_t nlistv = 0, ndis = 0, nheap = 0;
+
+#pragma omp parallel if (n > 1) reduction(+: nlistv, ndis, nheap)
+    {
+        // the tables of the missing last sub-quantizer stay 0
+        std::vector<float> table (nsq * 16, 0);
+        std::vector<uint8_t> LUT (nsq * 16, 0);
+        std::vector<float> ip_table (nsq * 16, 0);
+        std::vector<float> residual (d);
+        std::vector<uint8_t> tail_block (bbs * code_size);
+        std::vector<uint16_t> dis;
+
+#pragma omp for
+        for (idx_t i = 0; i < n; i++) {
+            const float *xi = x + i * d;
+            float *heap_dis = distances + i * k;
+            idx_t *heap_ids = labels + i * k;
+            heap_heapify<HeapForCost> (k, heap_dis, heap_ids);
+
+            float bias = 0, scale = 1;
+            if (is_ip) {
+                // same table for all the lists, only the centroid term
+                // depends on the list
+                pq.compute_inner_prod_table (xi, table.data());
+                for (size_t j = 0; j < M * 16; j++) {
+                    table[j] = -table[j];
+                }
+                quantize_LUT (M, table.data(), LUT.data(), bias, scale);
+            } else if (use_precomputed) {
+                pq.compute_inner_prod_table (xi, ip_table.data());
+            } else if (!by_residual) {
+                pq.compute_distance_table (xi, table.data());
+                quantize_LUT (M, table.data(), LUT.data(), bias, scale);
+            }
+
+            for (long ik = 0; ik < nprobe; ik++) {
+                idx_t key = keys[i * nprobe + ik];
+                if (key < 0) {
+                    continue;
+                }
+                FAISS_THROW_IF_NOT_FMT (key < (idx_t) nlist,
+                                        "Invalid key=%ld nlist=%ld\n",
+                                        key, nlist);
+                size_t list_size = invlists->list_size (key);
+                if (list_size == 0) {
+                    continue;
+                }
+                nlistv++;
+
+                float dis0 = 0;
+                if (is_ip) {
+                    if (by_residual) {
+                        quantizer->reconstruct (key, residual.data());
+                        dis0 = -fvec_inner_product (xi, residual.data(), d);
+                    }
+                } else if (use_precomputed) {
+                    dis0 = coarse_dis[i * nprobe + ik];
+                    fvec_madd (M * 16, &precomputed_table[key * M * 16],
+                               -2.0, ip_table.data(), table.data());
+                    quantize_LUT (M, table.data(), LUT.data(), bias, scale);
+                } else if (by_residual) {
+                    quantizer->compute_residual (xi, residual.data(), key);
+                    pq.compute_distance_table (residual.data(), table.data());
+                    quantize_LUT (M, table.data(), LUT.data(), bias, scale);
+                }
+
+                InvertedLists::ScopedCodes scodes (invlists, key);
+                std::unique_ptr<InvertedLists::ScopedIds> sids;
+                const idx_t *ids = nullptr;
+                if (!store_pairs) {
+                    sids.reset (new InvertedLists::ScopedIds (invlists, key));
+                    ids = sids->get();
+                }
+
+                size_t nblock = list_size / bbs;
+                size_t ntail = list_size % bbs;
+                dis.resize ((nblock + 1) * bbs);
+                pq4_accumulate (nblock, nsq, scodes.get(), LUT.data(),
+                                dis.data());
+                if (ntail > 0) {
+                    pq4_pack_block (ntail, nsq,
+                                    scodes.get() + nblock * bbs * code_size,
+                                    tail_block.data());
+                    pq4_accumulate (1, nsq, tail_block.data(), LUT.data(),
+                                    dis.data() + nblock * bbs);
+                }
+
+                float base = bias + dis0;
+                float inv_scale = 1.0f / scale;
+                for (size_t j = 0; j < list_size; j++) {
+                    float cost = base + dis[j] * inv_scale;
+                    if (!HeapForCost::cmp (heap_dis[0], cost)) {
+                        continue;
+                    }
+                    idx_t id = store_pairs ? lo_build (key, j) : ids[j];
+                    if (bitset != nullptr &&
+                        bitset->test ((ConcurrentBitset::id_type_t) id)) {
+                        continue;
+                    }
+                    heap_swap_top<HeapForCost> (k, heap_dis, heap_ids, cost, id);
+                    nheap++;
+                }
+                ndis += list_size;
+            }
+
+            heap_reorder<HeapForCost> (k, heap_dis, heap_ids);
+            if (is_ip) {
+                for (idx_t j = 0; j < k; j++) {
+                    heap_dis[j] = -heap_dis[j];
+                }
+            }
+        }
+    }
+
+    indexIVF_stats.nq += n;
+    indexIVF_stats.nlist += nlistv;
+    indexIVF_stats.ndis += ndis;
+    indexIVF_stats.nheap_updates += nheap;
+}
+
+
+namespace {
+
+/// converts the blocks of a whole list back to the PQ layout and hands
+/// the codes to the IndexIVFPQ scanner
+struct IVFPQFastScanScanner: InvertedListScanner {
+    std::unique_ptr<InvertedListScanner> scanner;
+    size_t code_size;
+    mutable std::vector<uint8_t> plain;
+
+    IVFPQFastScanScanner (InvertedListScanner *scanner, size_t code_size):
+        scanner (scanner), code_size (code_size)
+    {}
+
+    const uint8_t *unpack (size_t n, const uint8_t *codes) const {
+        size_t nblocked = n / IndexIVFPQFastScan::bbs * IndexIVFPQFastScan::bbs;
+        plain.resize (n * code_size);
+        for (size_t j = 0; j < nblocked; j++) {
+            const uint8_t *block = codes + j / IndexIVFPQFastScan::bbs *
+                IndexIVFPQFastScan::bbs * code_size;
+            pq4_get_code (code_size * 2, block, j % IndexIVFPQFastScan::bbs,
+                          plain.data() + j * code_size);
+        }
+        memcpy (plain.data() + nblocked * code_size,
+                codes + nblocked * code_size, (n - nblocked) * code_size);
+        return plain.data();
+    }
+
+    void set_query (const float *query) override {
+        scanner->set_query (query);
+    }
+
+    void set_list (idx_t list_no, float coarse_dis) override {
+        scanner->set_list (list_no, coarse_dis);
+    }
+
+    float distance_to_code (const uint8_t *code) const override {
+        return scanner->distance_to_code (code);
+    }
+
+    size_t scan_codes (size_t n, const uint8_t *codes, const idx_t *ids,
+                       float *distances, idx_t *labels, size_t k,
+                       ConcurrentBitsetPtr bitset) const override {
+        return scanner->scan_codes (n, unpack (n, codes), ids,
+                                    distances, labels, k, bitset);
+    }
+
+    void scan_codes_range (size_t n, const uint8_t *codes, const idx_t *ids,
+                           float radius, RangeQueryResult &result,
+                           ConcurrentBitsetPtr bitset) const override {
+        scanner->scan_codes_range (n, unpack (n, codes), ids,
+                                   radius, result, bitset);
+    }
+};
+
+} // anonymous namespace
+
+
+InvertedListScanner *
+IndexIVFPQFastScan::get_InvertedListScanner (bool store_pairs) const
+{
+    return new IVFPQFastScanScanner (
+        IndexIVFPQ::get_InvertedListScanner (store_pairs), code_size);
+}
+
+
+} // namespace faiss
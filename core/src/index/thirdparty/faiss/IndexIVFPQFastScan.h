@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#ifndef FAISS_INDEX_IVFPQ_FAST_SCAN_H
+#define FAISS_INDEX_IVFPQ_FAST_SCAN_H
+
+#include <stdint.h>
+
+#include <faiss/IndexIVFPQ.h>
+
+
+namespace faiss {
+
+/** IVFPQ with 4-bit sub-quantizers, whose inverted lists are scanned
+ * 32 codes at a time with lookup tables held in SIMD registers (see
+ * utils/pq4_fast_scan.h).
+ *
+ * The codes are kept in the inverted lists with the IndexIVFPQ
+ * code_size, but the full blocks of 32 vectors of a list are stored in
+ * the block layout, only the last list_size % 32 codes are in the PQ
+ * layout. The distance tables are quantized to 8 bits so the returned
+ * distances are approximate, the caller may refine them on the raw
+ * vectors.
+ */
+struct IndexIVFPQFastScan: IndexIVFPQ {
+    static const size_t bbs = 32;  ///< nb of vectors per block
+
+    IndexIVFPQFastScan (Index * quantizer, size_t d, size_t nlist,
+                        size_t M, MetricType metric = METRIC_L2);
+
+    IndexIVFPQFastScan ();
+
+    /// adds the codes, then packs the lists that got new full blocks
+    void add_with_ids (idx_t n, const float* x, const idx_t* xids = nullptr)
+        override;
+
+    /// parallel over the queries, params->parallel_mode and max_codes are
+    /// ignored
+    void search_preassigned (idx_t n, const float *x, idx_t k,
+                             const idx_t *assign,
+                             const float *centroid_dis,
+                             float *distances, idx_t *labels,
+                             bool store_pairs,
+                             const IVFSearchParameters *params=nullptr,
+                             ConcurrentBitsetPtr bitset = nullptr
+                             ) const override;
+
+    /// scanner for the codes of a whole list (used by range_search)
+    InvertedListScanner *get_InvertedListScanner (bool store_pairs)
+        const override;
+
+    void reconstruct_from_offset (int64_t list_no, int64_t offset,
+                                  float* recons) const override;
+
+    /// other must be an IndexIVFPQFastScan
+    void merge_from (IndexIVF &other, idx_t add_id) override;
+
+    /// not supported, entries cannot be moved inside a block
+    size_t remove_ids (const IDSelector & sel) override;
+
+    void update_vectors (int nv, const idx_t *idx, const float *v) override;
+
+    void copy_subset_to (IndexIVF & other, int subset_type,
+                         idx_t a1, idx_t a2) const override;
+
+    /// code of entry offset of a list, in the PQ layout
+    void get_code (idx_t list_no, size_t offset, uint8_t *code) const;
+
+    /// convert the entries [begin, list_size / bbs * bbs) of a list to
+    /// the block layout, begin is a multiple of bbs
+    void pack_list (idx_t list_no, size_t begin);
+
+    /// convert the full blocks of a list back to the PQ layout
+    void unpack_list (idx_t list_no);
+};
+
+
+} // namespace faiss
+
+
+#endif
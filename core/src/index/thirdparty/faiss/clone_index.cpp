@@ -22,6 +22,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -71,6 +72,7 @@ VectorTransform *Cloner::clone_VectorTransform (const VectorTransform *vt)
 IndexIVF * Cloner::clone_IndexIVF (const IndexIVF *ivf)
 {
     TRYCLONE (IndexIVFPQR, ivf)
+    TRYCLONE (IndexIVFPQFastScan, ivf)
     TRYCLONE (IndexIVFPQ, ivf)
     TRYCLONE (IndexIVFFlat, ivf)
     TRYCLONE (IndexIVFScalarQuantizer, ivf)
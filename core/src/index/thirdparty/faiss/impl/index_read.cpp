@@ -29,6 +29,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -444,7 +445,8 @@ static IndexIVFPQ *read_ivfpq (IOReader *f, uint32_t h, int io_flags)
     IndexIVFPQR *ivfpqr =
         h == fourcc ("IvQR") || h == fourcc ("IwQR") ?
         new IndexIVFPQR () : nullptr;
-    IndexIVFPQ * ivpq = ivfpqr ? ivfpqr : new IndexIVFPQ ();
+    IndexIVFPQ * ivpq = ivfpqr ? ivfpqr :
+        h == fourcc ("IwPf") ? new IndexIVFPQFastScan () : new IndexIVFPQ ();
 
     std::vector<std::vector<Index::idx_t> > ids;
     read_ivf_header (ivpq, f, legacy ? &ids : nullptr);
@@ -645,7 +647,8 @@ Index *read_index (IOReader *f, int io_flags) {
         read_InvertedLists (ivsp, f, io_flags);
         idx = ivsp;
     } else if(h == fourcc ("IvPQ") || h == fourcc ("IvQR") ||
-              h == fourcc ("IwPQ") || h == fourcc ("IwQR")) {
+              h == fourcc ("IwPQ") || h == fourcc ("IwQR") ||
+              h == fourcc ("IwPf")) {
 
         idx = read_ivfpq (f, h, io_flags);
 
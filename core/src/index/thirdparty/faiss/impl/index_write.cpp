@@ -29,6 +29,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -442,8 +443,10 @@ void write_index (const Index *idx, IOWriter *f) {
     } else if(const IndexIVFPQ * ivpq =
               dynamic_cast<const IndexIVFPQ *> (idx)) {
         const IndexIVFPQR * ivfpqr = dynamic_cast<const IndexIVFPQR *> (idx);
+        const IndexIVFPQFastScan * ivfpqfs =
+            dynamic_cast<const IndexIVFPQFastScan *> (idx);
 
-        uint32_t h = fourcc (ivfpqr ? "IwQR" : "IwPQ");
+        uint32_t h = fourcc (ivfpqr ? "IwQR" : ivfpqfs ? "IwPf" : "IwPQ");
         WRITE1 (h);
         write_ivf_header (ivpq, f);
         WRITE1 (ivpq->by_residual);
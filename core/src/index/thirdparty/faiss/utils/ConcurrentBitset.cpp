@@ -17,39 +17,138 @@
 
 #include "ConcurrentBitset.h"
 
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace faiss {
 
-ConcurrentBitset::ConcurrentBitset(id_type_t capacity) : capacity_(capacity), bitset_((capacity + 8 - 1) >> 3) {
+namespace {
+
+enum class WordOp { AND, OR, AND_NOT };
+
+template <WordOp op>
+void
+word_op(uint64_t* dst, const uint64_t* src, size_t n) {
+    size_t i = 0;
+#ifdef __AVX2__
+    for (; i + 4 <= n; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i r;
+        if (op == WordOp::AND) {
+            r = _mm256_and_si256(a, b);
+        } else if (op == WordOp::OR) {
+            r = _mm256_or_si256(a, b);
+        } else {
+            r = _mm256_andnot_si256(b, a);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+    }
+#endif
+    for (; i < n; ++i) {
+        if (op == WordOp::AND) {
+            dst[i] &= src[i];
+        } else if (op == WordOp::OR) {
+            dst[i] |= src[i];
+        } else {
+            dst[i] &= ~src[i];
+        }
+    }
 }
 
-bool
-ConcurrentBitset::test(id_type_t id) {
-    return bitset_[id >> 3].load() & (0x1 << (id & 0x7));
+}  // namespace
+
+ConcurrentBitset::ConcurrentBitset(id_type_t capacity) : capacity_(capacity), words_((capacity + 64 - 1) >> 6, 0) {
 }
 
 void
 ConcurrentBitset::set(id_type_t id) {
-    bitset_[id >> 3].fetch_or(0x1 << (id & 0x7));
+    __atomic_fetch_or(&words_[id >> 6], (uint64_t)0x1 << (id & 0x3f), __ATOMIC_RELAXED);
+}
+
+void
+ConcurrentBitset::set(const int32_t* ids, size_t n) {
+    size_t i = 0;
+    while (i < n) {
+        auto word = ids[i] >> 6;
+        uint64_t mask = 0;
+        for (; i < n && (ids[i] >> 6) == word; ++i) {
+            mask |= (uint64_t)0x1 << (ids[i] & 0x3f);
+        }
+        __atomic_fetch_or(&words_[word], mask, __ATOMIC_RELAXED);
+    }
+}
+
+void
+ConcurrentBitset::set_word(size_t word, uint64_t mask) {
+    __atomic_fetch_or(&words_[word], mask, __ATOMIC_RELAXED);
 }
 
 void
 ConcurrentBitset::clear(id_type_t id) {
-    bitset_[id >> 3].fetch_and(~(0x1 << (id & 0x7)));
+    __atomic_fetch_and(&words_[id >> 6], ~((uint64_t)0x1 << (id & 0x3f)), __ATOMIC_RELAXED);
+}
+
+size_t
+ConcurrentBitset::count() const {
+    size_t ret = 0;
+    for (auto word : words_) {
+        ret += __builtin_popcountll(word);
+    }
+    return ret;
+}
+
+double
+ConcurrentBitset::ratio() const {
+    return capacity_ == 0 ? 0.0 : (double)count() / capacity_;
+}
+
+ConcurrentBitset&
+ConcurrentBitset::operator&=(const ConcurrentBitset& other) {
+    auto n = std::min(words_.size(), other.words_.size());
+    word_op<WordOp::AND>(words_.data(), other.words_.data(), n);
+    std::fill(words_.begin() + n, words_.end(), 0);
+    return *this;
+}
+
+ConcurrentBitset&
+ConcurrentBitset::operator|=(const ConcurrentBitset& other) {
+    word_op<WordOp::OR>(words_.data(), other.words_.data(), std::min(words_.size(), other.words_.size()));
+    return *this;
+}
+
+ConcurrentBitset&
+ConcurrentBitset::and_not(const ConcurrentBitset& other) {
+    word_op<WordOp::AND_NOT>(words_.data(), other.words_.data(), std::min(words_.size(), other.words_.size()));
+    return *this;
 }
 
 size_t
-ConcurrentBitset::capacity() {
+ConcurrentBitset::capacity() const {
     return capacity_;
 }
 
 size_t
-ConcurrentBitset::size() {
+ConcurrentBitset::size() const {
     return ((capacity_ + 8 - 1) >> 3);
 }
 
 const uint8_t*
-ConcurrentBitset::data() {
-    return reinterpret_cast<const uint8_t*>(bitset_.data());
+ConcurrentBitset::data() const {
+    return reinterpret_cast<const uint8_t*>(words_.data());
+}
+
+size_t
+ConcurrentBitset::word_count() const {
+    return words_.size();
+}
+
+const uint64_t*
+ConcurrentBitset::words() const {
+    return words_.data();
 }
 
 }  // namespace faiss
@@ -17,12 +17,15 @@
 
 #pragma once
 
-#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 namespace faiss {
 
+// bits are packed into 64-bit words, the byte layout of data() is the same as a byte array on little endian,
+// set() and clear() are atomic on the word, test() is a plain load: a bitset is filled before it is handed to
+// searches and stays unmodified while it is shared, so readers need no synchronization
 class ConcurrentBitset {
  public:
     using id_type_t = int64_t;
@@ -34,27 +37,67 @@ class ConcurrentBitset {
     //    operator=(const ConcurrentBitset&) = delete;
 
     bool
-    test(id_type_t id);
+    test(id_type_t id) const {
+        return (words_[id >> 6] >> (id & 0x3f)) & 0x1;
+    }
+
+    // whether all the 64 ids of the word holding id are set, lets scans skip a whole block
+    bool
+    test_word(id_type_t id) const {
+        return words_[id >> 6] == ~(uint64_t)0;
+    }
 
     void
     set(id_type_t id);
 
+    // set a batch of ids, consecutive ids falling into the same word are written at once,
+    // so sorted ids cost one write per word
+    void
+    set(const int32_t* ids, size_t n);
+
+    // set the bits of mask in the word holding ids [word << 6, (word << 6) + 64), for producers computing 64 ids at once
+    void
+    set_word(size_t word, uint64_t mask);
+
     void
     clear(id_type_t id);
 
+    // number of set bits
+    size_t
+    count() const;
+
+    // count() / capacity()
+    double
+    ratio() const;
+
+    ConcurrentBitset&
+    operator&=(const ConcurrentBitset& other);
+
+    ConcurrentBitset&
+    operator|=(const ConcurrentBitset& other);
+
+    // clear the bits set in other
+    ConcurrentBitset&
+    and_not(const ConcurrentBitset& other);
+
     size_t
-    capacity();
+    capacity() const;
 
     size_t
-    size();
+    size() const;
 
     const uint8_t*
-    data();
+    data() const;
+
+    size_t
+    word_count() const;
+
+    const uint64_t*
+    words() const;
 
  private:
     size_t capacity_;
-    std::vector<std::atomic<uint8_t>> bitset_;
-
+    std::vector<uint64_t> words_;
 };
 
 using ConcurrentBitsetPtr = std::shared_ptr<ConcurrentBitset>;
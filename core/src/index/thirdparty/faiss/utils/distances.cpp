@@ -233,6 +233,12 @@ static void knn_inner_product_sse (const float * x,
             }
 
             for (size_t j = 0; j < ny; j++) {
+                if (bitset && (j & 0x3f) == 0 && j + 64 <= ny && bitset->test_word(j)) {
+                    // skip a block of 64 deleted vectors at once
+                    j += 63;
+                    y_j += 64 * d;
+                    continue;
+                }
                 if (!bitset || !bitset->test(j)) {
                     float disij = fvec_inner_product (x_i, y_j, d);
                     if (disij > val_[0]) {
@@ -346,6 +352,12 @@ static void knn_L2sqr_sse (
             }
 
             for (size_t j = 0; j < ny; j++) {
+                if (bitset && (j & 0x3f) == 0 && j + 64 <= ny && bitset->test_word(j)) {
+                    // skip a block of 64 deleted vectors at once
+                    j += 63;
+                    y_j += 64 * d;
+                    continue;
+                }
                 if (!bitset || !bitset->test(j)) {
                     float disij = fvec_L2sqr (x_i, y_j, d);
                     if (disij < val_[0]) {
@@ -0,0 +1,57 @@
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan.h>
+
+#include <cstring>
+
+namespace faiss {
+
+namespace {
+
+inline uint8_t get_sub_code (const uint8_t *code, size_t m) {
+    return (code[m / 2] >> ((m & 1) * 4)) & 15;
+}
+
+} // anonymous namespace
+
+void
+pq4_pack_block(size_t n, size_t nsq, const uint8_t* codes, uint8_t* block) {
+    size_t code_size = nsq / 2;
+    memset (block, 0, 16 * nsq);
+    for (size_t j = 0; j < n; j++) {
+        const uint8_t *code = codes + j * code_size;
+        int shift = j < 16 ? 0 : 4;
+        for (size_t m = 0; m < nsq; m++) {
+            block[16 * m + (j & 15)] |= get_sub_code (code, m) << shift;
+        }
+    }
+}
+
+void
+pq4_get_code(size_t nsq, const uint8_t* block, size_t j, uint8_t* code) {
+    int shift = j < 16 ? 0 : 4;
+    memset (code, 0, nsq / 2);
+    for (size_t m = 0; m < nsq; m++) {
+        uint8_t c = (block[16 * m + (j & 15)] >> shift) & 15;
+        code[m / 2] |= c << ((m & 1) * 4);
+    }
+}
+
+void
+pq4_accumulate_ref(size_t nblock, size_t nsq, const uint8_t* codes, const uint8_t* LUT, uint16_t* dis) {
+    for (size_t b = 0; b < nblock; b++) {
+        memset (dis, 0, 32 * sizeof (*dis));
+        for (size_t m = 0; m < nsq; m++) {
+            const uint8_t *c = codes + 16 * m;
+            const uint8_t *lut = LUT + 16 * m;
+            for (size_t j = 0; j < 16; j++) {
+                dis[j] += lut[c[j] & 15];
+                dis[16 + j] += lut[c[j] >> 4];
+            }
+        }
+        codes += 16 * nsq;
+        dis += 32;
+    }
+}
+
+} // namespace faiss
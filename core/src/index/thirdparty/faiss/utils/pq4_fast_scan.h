@@ -0,0 +1,42 @@
+// -*- c++ -*-
+
+/* 4-bit PQ codes scanned 32 at a time with in-register lookup tables.
+ * The SIMD versions are implemented in pq4_fast_scan_avx.cpp and
+ * pq4_fast_scan_avx512.cpp */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+/*********************************************************
+ * Block layout
+ *
+ * A block holds the codes of 32 vectors for nsq sub-quantizers (nsq is
+ * even, a missing last sub-quantizer has code 0). It takes 16 * nsq
+ * bytes, ie. the size of 32 codes of nsq / 2 bytes. For sub-quantizer m,
+ * byte j of bytes [16 * m, 16 * m + 16) holds the code of vector j in
+ * its low nibble and the code of vector 16 + j in its high nibble.
+ *********************************************************/
+
+/// pack n <= 32 codes of nsq / 2 bytes, in the ProductQuantizer layout
+/// (sub-quantizer 2 * i in the low nibble of byte i), into a block.
+/// Missing vectors get code 0
+void
+pq4_pack_block(size_t n, size_t nsq, const uint8_t* codes, uint8_t* block);
+
+/// extract the code of vector j of a block, in the ProductQuantizer layout
+void
+pq4_get_code(size_t nsq, const uint8_t* block, size_t j, uint8_t* code);
+
+/** sum the lookup table entries of the codes of nblock consecutive blocks
+ *
+ * @param LUT   nsq * 16 quantized distances
+ * @param dis   output sums, size nblock * 32
+ */
+void
+pq4_accumulate_ref(size_t nblock, size_t nsq, const uint8_t* codes, const uint8_t* LUT, uint16_t* dis);
+
+} // namespace faiss
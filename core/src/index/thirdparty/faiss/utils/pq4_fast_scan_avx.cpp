@@ -0,0 +1,46 @@
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan_avx.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+void
+pq4_accumulate_avx(size_t nblock, size_t nsq, const uint8_t* codes, const uint8_t* LUT, uint16_t* dis) {
+    const __m256i mask = _mm256_set1_epi8 (0x0f);
+    const __m256i zero = _mm256_setzero_si256 ();
+
+    for (size_t b = 0; b < nblock; b++) {
+        // u16 sums of vectors 0..7, 8..15, 16..23 and 24..31, the low
+        // lane sums the even sub-quantizers and the high lane the odd ones
+        __m256i acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+
+        for (size_t m = 0; m < nsq; m += 2) {
+            __m256i c = _mm256_loadu_si256 ((const __m256i *)(codes + 16 * m));
+            __m256i lut = _mm256_loadu_si256 ((const __m256i *)(LUT + 16 * m));
+            __m256i clo = _mm256_and_si256 (c, mask);
+            __m256i chi = _mm256_and_si256 (_mm256_srli_epi16 (c, 4), mask);
+            __m256i dlo = _mm256_shuffle_epi8 (lut, clo);
+            __m256i dhi = _mm256_shuffle_epi8 (lut, chi);
+            acc0 = _mm256_add_epi16 (acc0, _mm256_unpacklo_epi8 (dlo, zero));
+            acc1 = _mm256_add_epi16 (acc1, _mm256_unpackhi_epi8 (dlo, zero));
+            acc2 = _mm256_add_epi16 (acc2, _mm256_unpacklo_epi8 (dhi, zero));
+            acc3 = _mm256_add_epi16 (acc3, _mm256_unpackhi_epi8 (dhi, zero));
+        }
+
+        _mm_storeu_si128 ((__m128i *)(dis + 0), _mm_add_epi16 (
+            _mm256_castsi256_si128 (acc0), _mm256_extracti128_si256 (acc0, 1)));
+        _mm_storeu_si128 ((__m128i *)(dis + 8), _mm_add_epi16 (
+            _mm256_castsi256_si128 (acc1), _mm256_extracti128_si256 (acc1, 1)));
+        _mm_storeu_si128 ((__m128i *)(dis + 16), _mm_add_epi16 (
+            _mm256_castsi256_si128 (acc2), _mm256_extracti128_si256 (acc2, 1)));
+        _mm_storeu_si128 ((__m128i *)(dis + 24), _mm_add_epi16 (
+            _mm256_castsi256_si128 (acc3), _mm256_extracti128_si256 (acc3, 1)));
+
+        codes += 16 * nsq;
+        dis += 32;
+    }
+}
+
+} // namespace faiss
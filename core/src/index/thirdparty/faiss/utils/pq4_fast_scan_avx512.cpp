@@ -0,0 +1,76 @@
+// -*- c++ -*-
+
+#include <faiss/utils/pq4_fast_scan_avx512.h>
+
+#include <immintrin.h>
+
+namespace faiss {
+
+namespace {
+
+inline __m256i reduce_512 (__m512i acc) {
+    return _mm256_add_epi16 (_mm512_castsi512_si256 (acc),
+                             _mm512_extracti64x4_epi64 (acc, 1));
+}
+
+inline void store_256 (uint16_t *dis, __m256i acc) {
+    _mm_storeu_si128 ((__m128i *)dis, _mm_add_epi16 (
+        _mm256_castsi256_si128 (acc), _mm256_extracti128_si256 (acc, 1)));
+}
+
+} // anonymous namespace
+
+void
+pq4_accumulate_avx512(size_t nblock, size_t nsq, const uint8_t* codes, const uint8_t* LUT, uint16_t* dis) {
+    const __m512i mask = _mm512_set1_epi8 (0x0f);
+    const __m512i zero = _mm512_setzero_si512 ();
+    const __m256i mask_256 = _mm256_set1_epi8 (0x0f);
+    const __m256i zero_256 = _mm256_setzero_si256 ();
+    size_t nsq_4 = nsq & ~(size_t)3;
+
+    for (size_t b = 0; b < nblock; b++) {
+        // u16 sums of vectors 0..7, 8..15, 16..23 and 24..31, lane l of
+        // the accumulators sums the sub-quantizers m = l mod 4
+        __m512i acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+
+        for (size_t m = 0; m < nsq_4; m += 4) {
+            __m512i c = _mm512_loadu_si512 ((const void *)(codes + 16 * m));
+            __m512i lut = _mm512_loadu_si512 ((const void *)(LUT + 16 * m));
+            __m512i clo = _mm512_and_si512 (c, mask);
+            __m512i chi = _mm512_and_si512 (_mm512_srli_epi16 (c, 4), mask);
+            __m512i dlo = _mm512_shuffle_epi8 (lut, clo);
+            __m512i dhi = _mm512_shuffle_epi8 (lut, chi);
+            acc0 = _mm512_add_epi16 (acc0, _mm512_unpacklo_epi8 (dlo, zero));
+            acc1 = _mm512_add_epi16 (acc1, _mm512_unpackhi_epi8 (dlo, zero));
+            acc2 = _mm512_add_epi16 (acc2, _mm512_unpacklo_epi8 (dhi, zero));
+            acc3 = _mm512_add_epi16 (acc3, _mm512_unpackhi_epi8 (dhi, zero));
+        }
+
+        __m256i s0 = reduce_512 (acc0), s1 = reduce_512 (acc1);
+        __m256i s2 = reduce_512 (acc2), s3 = reduce_512 (acc3);
+
+        if (nsq_4 < nsq) {
+            // last 2 sub-quantizers
+            __m256i c = _mm256_loadu_si256 ((const __m256i *)(codes + 16 * nsq_4));
+            __m256i lut = _mm256_loadu_si256 ((const __m256i *)(LUT + 16 * nsq_4));
+            __m256i clo = _mm256_and_si256 (c, mask_256);
+            __m256i chi = _mm256_and_si256 (_mm256_srli_epi16 (c, 4), mask_256);
+            __m256i dlo = _mm256_shuffle_epi8 (lut, clo);
+            __m256i dhi = _mm256_shuffle_epi8 (lut, chi);
+            s0 = _mm256_add_epi16 (s0, _mm256_unpacklo_epi8 (dlo, zero_256));
+            s1 = _mm256_add_epi16 (s1, _mm256_unpackhi_epi8 (dlo, zero_256));
+            s2 = _mm256_add_epi16 (s2, _mm256_unpacklo_epi8 (dhi, zero_256));
+            s3 = _mm256_add_epi16 (s3, _mm256_unpackhi_epi8 (dhi, zero_256));
+        }
+
+        store_256 (dis + 0, s0);
+        store_256 (dis + 8, s1);
+        store_256 (dis + 16, s2);
+        store_256 (dis + 24, s3);
+
+        codes += 16 * nsq;
+        dis += 32;
+    }
+}
+
+} // namespace faiss
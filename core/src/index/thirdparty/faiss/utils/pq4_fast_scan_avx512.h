@@ -0,0 +1,14 @@
+// -*- c++ -*-
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace faiss {
+
+/// same as pq4_accumulate_ref, 4 sub-quantizers per AVX512 shuffle
+void
+pq4_accumulate_avx512(size_t nblock, size_t nsq, const uint8_t* codes, const uint8_t* LUT, uint16_t* dis);
+
+} // namespace faiss
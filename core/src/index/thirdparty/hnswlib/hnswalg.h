@@ -32,6 +32,8 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
             metric_type_ = 0;
         } else if (auto x = dynamic_cast<InnerProductSpace*>(s)) {
             metric_type_ = 1;
+        } else if (auto x = dynamic_cast<SQ8Space*>(s)) {
+            metric_type_ = x->is_ip() ? 3 : 2;
         } else {
             metric_type_ = 100;
         }
@@ -41,6 +43,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
         has_deletions_=false;
         data_size_ = s->get_data_size();
         fstdistfunc_ = s->get_dist_func();
+        fstqdistfunc_ = s->get_query_dist_func();
         dist_func_param_ = s->get_dist_func_param();
         M_ = M;
         maxM_ = M_;
@@ -100,7 +103,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
 
     // linxj: use for free resource
     SpaceInterface<dist_t> *space;
-    size_t metric_type_; // 0:l2, 1:ip
+    size_t metric_type_; // 0:l2, 1:ip, 2:l2 on sq8 codes, 3:ip on sq8 codes
 
     size_t max_elements_;
     size_t cur_element_count;
@@ -138,6 +141,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
 
     size_t label_offset_;
     DISTFUNC<dist_t> fstdistfunc_;
+    DISTFUNC<dist_t> fstqdistfunc_;  // query to element, differs from fstdistfunc_ when elements are encoded
     void *dist_func_param_;
     std::unordered_map<labeltype, tableint> label_lookup_;
 
@@ -262,7 +266,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
         dist_t lowerBound;
 //        if (!has_deletions || !isMarkedDeleted(ep_id)) {
           if (!has_deletions || !bitset->test((faiss::ConcurrentBitset::id_type_t)getExternalLabel(ep_id))) {
-            dist_t dist = fstdistfunc_(data_point, getDataByInternalId(ep_id), dist_func_param_);
+            dist_t dist = fstqdistfunc_(data_point, getDataByInternalId(ep_id), dist_func_param_);
             lowerBound = dist;
             top_candidates.emplace(dist, ep_id);
             candidate_set.emplace(-dist, ep_id);
@@ -307,7 +311,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
                     visited_array[candidate_id] = visited_array_tag;
 
                     char *currObj1 = (getDataByInternalId(candidate_id));
-                    dist_t dist = fstdistfunc_(data_point, currObj1, dist_func_param_);
+                    dist_t dist = fstqdistfunc_(data_point, currObj1, dist_func_param_);
 
                     if (top_candidates.size() < ef || lowerBound > dist) {
                         candidate_set.emplace(-dist, candidate_id);
@@ -505,7 +509,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
         std::priority_queue<std::pair<dist_t, tableint  >> top_candidates;
         if (cur_element_count == 0) return top_candidates;
         tableint currObj = enterpoint_node_;
-        dist_t curdist = fstdistfunc_(query_data, getDataByInternalId(enterpoint_node_), dist_func_param_);
+        dist_t curdist = fstqdistfunc_(query_data, getDataByInternalId(enterpoint_node_), dist_func_param_);
 
         for (size_t level = maxlevel_; level > 0; level--) {
             bool changed = true;
@@ -519,7 +523,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
                     tableint cand = datal[i];
                     if (cand < 0 || cand > max_elements_)
                         throw std::runtime_error("cand error");
-                    dist_t d = fstdistfunc_(query_data, getDataByInternalId(cand), dist_func_param_);
+                    dist_t d = fstqdistfunc_(query_data, getDataByInternalId(cand), dist_func_param_);
 
                     if (d < curdist) {
                         curdist = d;
@@ -576,11 +580,87 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
 
     }
 
+    // Renumber the elements in BFS order of the base layer from the entry point, so that neighbors
+    // are mostly stored next to each other and a search touches fewer cache lines. The labels move
+    // with the elements, only the internal ids change.
+    void reorderByBFS() {
+        if (cur_element_count == 0) return;
+
+        tableint unvisited = (tableint) cur_element_count;
+        std::vector<tableint> old_to_new(cur_element_count, unvisited);
+        std::vector<tableint> new_to_old;
+        new_to_old.reserve(cur_element_count);
+        auto bfs = [&](tableint root) {
+            size_t head = new_to_old.size();
+            old_to_new[root] = (tableint) new_to_old.size();
+            new_to_old.push_back(root);
+            while (head < new_to_old.size()) {
+                linklistsizeint *ll = get_linklist0(new_to_old[head++]);
+                size_t size = getListCount(ll);
+                tableint *datal = (tableint *) (ll + 1);
+                for (size_t j = 0; j < size; j++) {
+                    if (old_to_new[datal[j]] == unvisited) {
+                        old_to_new[datal[j]] = (tableint) new_to_old.size();
+                        new_to_old.push_back(datal[j]);
+                    }
+                }
+            }
+        };
+        bfs(enterpoint_node_);
+        for (tableint i = 0; i < cur_element_count; i++) {
+            if (old_to_new[i] == unvisited) bfs(i);
+        }
+
+        auto remap = [&](linklistsizeint *ll) {
+            size_t size = getListCount(ll);
+            tableint *datal = (tableint *) (ll + 1);
+            for (size_t j = 0; j < size; j++) {
+                datal[j] = old_to_new[datal[j]];
+            }
+        };
+
+        char *data_level0_memory_new = (char *) malloc(max_elements_ * size_data_per_element_);
+        if (data_level0_memory_new == nullptr)
+            throw std::runtime_error("Not enough memory: reorderByBFS failed to allocate base layer");
+        char **linkLists_new = (char **) malloc(sizeof(void *) * max_elements_);
+        if (linkLists_new == nullptr) {
+            free(data_level0_memory_new);
+            throw std::runtime_error("Not enough memory: reorderByBFS failed to allocate other layers");
+        }
+        std::vector<int> element_levels_new(element_levels_.size());
+
+        for (tableint i = 0; i < cur_element_count; i++) {
+            tableint old_id = new_to_old[i];
+            memcpy(data_level0_memory_new + i * size_data_per_element_,
+                   data_level0_memory_ + old_id * size_data_per_element_, size_data_per_element_);
+            remap(get_linklist0(i, data_level0_memory_new));
+            linkLists_new[i] = linkLists_[old_id];
+            element_levels_new[i] = element_levels_[old_id];
+            for (int level = 1; level <= element_levels_new[i]; level++) {
+                remap((linklistsizeint *) (linkLists_new[i] + (level - 1) * size_links_per_element_));
+            }
+        }
+
+        free(data_level0_memory_);
+        free(linkLists_);
+        data_level0_memory_ = data_level0_memory_new;
+        linkLists_ = linkLists_new;
+        element_levels_.swap(element_levels_new);
+        enterpoint_node_ = old_to_new[enterpoint_node_];
+        for (auto &it : label_lookup_) {
+            it.second = old_to_new[it.second];
+        }
+    }
+
     void saveIndex(milvus::knowhere::MemoryIOWriter& output) {
         // write l2/ip calculator
         writeBinaryPOD(output, metric_type_);
         writeBinaryPOD(output, data_size_);
         writeBinaryPOD(output, *((size_t *) dist_func_param_));
+        if (auto x = dynamic_cast<SQ8Space*>(space)) {
+            const std::vector<float>& trained = x->get_trained();
+            output.write(trained.data(), trained.size() * sizeof(float));
+        }
 
         writeBinaryPOD(output, offsetLevel0_);
         writeBinaryPOD(output, max_elements_);
@@ -618,10 +698,15 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
             space = new hnswlib::L2Space(dim);
         } else if (metric_type_ == 1) {
             space = new hnswlib::InnerProductSpace(dim);
+        } else if (metric_type_ == 2 || metric_type_ == 3) {
+            std::vector<float> trained(2 * dim);
+            input.read(trained.data(), trained.size() * sizeof(float));
+            space = new hnswlib::SQ8Space(dim, metric_type_ == 3, std::move(trained));
         } else {
             // throw exception
         }
         fstdistfunc_ = space->get_dist_func();
+        fstqdistfunc_ = space->get_query_dist_func();
         dist_func_param_ = space->get_dist_func_param();
 
         readBinaryPOD(input, offsetLevel0_);
@@ -791,6 +876,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
 
         data_size_ = s->get_data_size();
         fstdistfunc_ = s->get_dist_func();
+        fstqdistfunc_ = s->get_query_dist_func();
         dist_func_param_ = s->get_dist_func_param();
 
         auto pos=input.tellg();
@@ -1046,11 +1132,17 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
     
     std::priority_queue<std::pair<dist_t, labeltype >>
     searchKnn(const void *query_data, size_t k, faiss::ConcurrentBitsetPtr bitset) const {
+        return searchKnn(query_data, k, bitset, ef_);
+    };
+
+    // ef given per call instead of the shared ef_, concurrent searches may use different values
+    std::priority_queue<std::pair<dist_t, labeltype >>
+    searchKnn(const void *query_data, size_t k, faiss::ConcurrentBitsetPtr bitset, size_t ef) const {
         std::priority_queue<std::pair<dist_t, labeltype >> result;
         if (cur_element_count == 0) return result;
 
         tableint currObj = enterpoint_node_;
-        dist_t curdist = fstdistfunc_(query_data, getDataByInternalId(enterpoint_node_), dist_func_param_);
+        dist_t curdist = fstqdistfunc_(query_data, getDataByInternalId(enterpoint_node_), dist_func_param_);
 
         for (int level = maxlevel_; level > 0; level--) {
             bool changed = true;
@@ -1065,7 +1157,7 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
                     tableint cand = datal[i];
                     if (cand < 0 || cand > max_elements_)
                         throw std::runtime_error("cand error");
-                    dist_t d = fstdistfunc_(query_data, getDataByInternalId(cand), dist_func_param_);
+                    dist_t d = fstqdistfunc_(query_data, getDataByInternalId(cand), dist_func_param_);
 
                     if (d < curdist) {
                         curdist = d;
@@ -1079,12 +1171,12 @@ class HierarchicalNSW : public AlgorithmInterface<dist_t> {
         std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates;
         if (bitset != nullptr) {
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst>
-                top_candidates1 = searchBaseLayerST<true>(currObj, query_data, std::max(ef_, k), bitset);
+                top_candidates1 = searchBaseLayerST<true>(currObj, query_data, std::max(ef, k), bitset);
             top_candidates.swap(top_candidates1);
         }
         else{
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst>
-                top_candidates1 = searchBaseLayerST<false>(currObj, query_data, std::max(ef_, k), bitset);
+                top_candidates1 = searchBaseLayerST<false>(currObj, query_data, std::max(ef, k), bitset);
             top_candidates.swap(top_candidates1);
         }
         while (top_candidates.size() > k) {
@@ -73,6 +73,9 @@ namespace hnswlib {
 
         virtual DISTFUNC<MTYPE> get_dist_func() = 0;
 
+        // distance from a query passed to searchKnn to a stored element
+        virtual DISTFUNC<MTYPE> get_query_dist_func() { return get_dist_func(); }
+
         virtual void *get_dist_func_param() = 0;
 
         virtual ~SpaceInterface() {}
@@ -117,5 +120,6 @@ namespace hnswlib {
 
 #include "space_l2.h"
 #include "space_ip.h"
+#include "space_sq8.h"
 #include "bruteforce.h"
 #include "hnswalg.h"
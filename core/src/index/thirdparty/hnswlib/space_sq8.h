@@ -0,0 +1,113 @@
+#pragma once
+#include "hnswlib.h"
+#include <faiss/FaissHook.h>
+#include <faiss/impl/ScalarQuantizerOp.h>
+
+namespace hnswlib {
+
+// Elements are stored as 8-bit codes of faiss::ScalarQuantizer (QT_8bit), one byte per dimension.
+// Component i of code c decodes to vmin[i] + (c[i] + 0.5) / 255 * vdiff[i].
+struct SQ8Param {
+    size_t dim;                  // must stay first, HierarchicalNSW reads the dimension through the param
+    std::vector<float> trained;  // vmin of every dimension followed by vdiff
+    std::vector<float> scale;    // vdiff / 255
+    std::vector<float> offset;   // decoded value of code 0, vmin + 0.5 * scale
+};
+
+// code to code distances, used while building the graph
+static float
+SQ8L2Sqr(const void *pCode1, const void *pCode2, const void *param_ptr) {
+    const SQ8Param *param = (const SQ8Param *) param_ptr;
+    const uint8_t *c1 = (const uint8_t *) pCode1;
+    const uint8_t *c2 = (const uint8_t *) pCode2;
+    const float *scale = param->scale.data();
+    float res = 0;
+    for (size_t i = 0; i < param->dim; i++) {
+        float t = ((int) c1[i] - (int) c2[i]) * scale[i];
+        res += t * t;
+    }
+    return res;
+}
+
+static float
+SQ8InnerProduct(const void *pCode1, const void *pCode2, const void *param_ptr) {
+    const SQ8Param *param = (const SQ8Param *) param_ptr;
+    const uint8_t *c1 = (const uint8_t *) pCode1;
+    const uint8_t *c2 = (const uint8_t *) pCode2;
+    const float *scale = param->scale.data();
+    const float *offset = param->offset.data();
+    float res = 0;
+    for (size_t i = 0; i < param->dim; i++) {
+        res += (offset[i] + c1[i] * scale[i]) * (offset[i] + c2[i] * scale[i]);
+    }
+    return (1.0f - res);
+}
+
+// query to code distances, the query passed to searchKnn is a faiss::SQDistanceComputer created by
+// SQ8Space::get_query_computer, which picks the simd implementation according to the cpu
+static float
+SQ8QueryL2Sqr(const void *pQuery, const void *pCode, const void *param_ptr) {
+    faiss::SQDistanceComputer *dc = (faiss::SQDistanceComputer *) pQuery;
+    dc->codes = (const uint8_t *) pCode;
+    return (*dc)(0);
+}
+
+static float
+SQ8QueryInnerProduct(const void *pQuery, const void *pCode, const void *param_ptr) {
+    faiss::SQDistanceComputer *dc = (faiss::SQDistanceComputer *) pQuery;
+    dc->codes = (const uint8_t *) pCode;
+    return (1.0f - (*dc)(0));
+}
+
+class SQ8Space : public SpaceInterface<float> {
+    SQ8Param param_;
+    bool is_ip_;
+ public:
+    SQ8Space(size_t dim, bool is_ip, std::vector<float> trained) : is_ip_(is_ip) {
+        param_.dim = dim;
+        param_.trained = std::move(trained);
+        param_.scale.resize(dim);
+        param_.offset.resize(dim);
+        for (size_t i = 0; i < dim; i++) {
+            param_.scale[i] = param_.trained[dim + i] / 255.0f;
+            param_.offset[i] = param_.trained[i] + 0.5f * param_.scale[i];
+        }
+    }
+
+    size_t get_data_size() {
+        return param_.dim;
+    }
+
+    DISTFUNC<float> get_dist_func() {
+        return is_ip_ ? SQ8InnerProduct : SQ8L2Sqr;
+    }
+
+    DISTFUNC<float> get_query_dist_func() override {
+        return is_ip_ ? SQ8QueryInnerProduct : SQ8QueryL2Sqr;
+    }
+
+    void *get_dist_func_param() {
+        return &param_;
+    }
+
+    bool is_ip() const {
+        return is_ip_;
+    }
+
+    const std::vector<float> &get_trained() const {
+        return param_.trained;
+    }
+
+    // the returned computer is owned by the caller and must not be shared between concurrent searches
+    faiss::SQDistanceComputer *get_query_computer(const float *query) const {
+        faiss::SQDistanceComputer *dc = faiss::sq_get_distance_computer(
+            is_ip_ ? faiss::METRIC_INNER_PRODUCT : faiss::METRIC_L2, faiss::QuantizerType::QT_8bit, param_.dim,
+            param_.trained);
+        dc->code_size = param_.dim;
+        dc->set_query(query);
+        return dc;
+    }
+
+    ~SQ8Space() {}
+};
+}
@@ -11,9 +11,13 @@
 
 #include <gtest/gtest.h>
 #include <knowhere/index/vector_index/IndexHNSW.h>
+#include <knowhere/index/vector_index/IndexHNSWSQ8.h>
 #include <src/index/knowhere/knowhere/index/vector_index/helpers/IndexParameter.h>
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <thread>
+#include <vector>
 #include "knowhere/common/Exception.h"
 #include "unittest/utils.h"
 
@@ -122,6 +126,46 @@ TEST_P(HNSWTest, HNSW_delete) {
     */
 }
 
+TEST_P(HNSWTest, HNSW_concurrent_query_params) {
+    index_->Train(base_dataset, conf);
+    index_->AddWithoutIds(base_dataset, conf);
+
+    // queries with different ef on the same index must not affect each other
+    std::vector<int64_t> efs = {10, 200};
+    std::vector<std::vector<int64_t>> expect_ids(efs.size());
+    for (size_t i = 0; i < efs.size(); ++i) {
+        auto query_conf = conf;
+        query_conf[milvus::knowhere::IndexParams::ef] = efs[i];
+        auto result = index_->Query(query_dataset, query_conf, nullptr);
+        auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        expect_ids[i].assign(ids, ids + nq * k);
+        ReleaseQueryResult(result);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> matched(efs.size(), 1);
+    for (size_t i = 0; i < efs.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            auto query_conf = conf;
+            query_conf[milvus::knowhere::IndexParams::ef] = efs[i];
+            for (int round = 0; round < 10; ++round) {
+                auto result = index_->Query(query_dataset, query_conf, nullptr);
+                auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+                if (!std::equal(ids, ids + nq * k, expect_ids[i].begin())) {
+                    matched[i] = 0;
+                }
+                ReleaseQueryResult(result);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < efs.size(); ++i) {
+        ASSERT_EQ(matched[i], 1);
+    }
+}
+
 TEST_P(HNSWTest, HNSW_serialize) {
     auto serialize = [](const std::string& filename, milvus::knowhere::BinaryPtr& bin, uint8_t* ret) {
         {
@@ -156,6 +200,123 @@ TEST_P(HNSWTest, HNSW_serialize) {
     }
 }
 
+TEST_P(HNSWTest, HNSW_reorder) {
+    // results are still reported by the labels after the elements are renumbered
+    auto reorder_conf = conf;
+    reorder_conf[milvus::knowhere::IndexParams::reorder] = true;
+    index_->Train(base_dataset, reorder_conf);
+    index_->AddWithoutIds(base_dataset, reorder_conf);
+    EXPECT_EQ(index_->Count(), nb);
+    auto result1 = index_->Query(query_dataset, conf, nullptr);
+    AssertAnns(result1, nq, k);
+
+    faiss::ConcurrentBitsetPtr bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (auto i = 0; i < nq; ++i) {
+        bitset->set(i);
+    }
+    auto result2 = index_->Query(query_dataset, conf, bitset);
+    AssertAnns(result2, nq, k, CheckMode::CHECK_NOT_EQUAL);
+    ReleaseQueryResult(result2);
+
+    // the new numbering is what gets serialized
+    auto binaryset = index_->Serialize();
+    auto new_index = std::make_shared<milvus::knowhere::IndexHNSW>();
+    new_index->Load(binaryset);
+    auto result3 = new_index->Query(query_dataset, conf, nullptr);
+    auto ids1 = result1->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto ids3 = result3->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; i++) {
+        ASSERT_EQ(ids1[i], ids3[i]);
+    }
+    ReleaseQueryResult(result1);
+    ReleaseQueryResult(result3);
+}
+
+TEST_P(HNSWTest, HNSW_SQ8_basic) {
+    auto index = std::make_shared<milvus::knowhere::IndexHNSWSQ8>();
+    ASSERT_ANY_THROW(index->Query(query_dataset, conf, nullptr));
+
+    index->Train(base_dataset, conf);
+    index->AddWithoutIds(base_dataset, conf);
+    EXPECT_EQ(index->Count(), nb);
+    EXPECT_EQ(index->Dim(), dim);
+
+    // codes take a byte per dimension instead of a float
+    index->UpdateIndexSize();
+    index_->Train(base_dataset, conf);
+    index_->AddWithoutIds(base_dataset, conf);
+    index_->UpdateIndexSize();
+    EXPECT_LT(index->Size(), index_->Size());
+
+    auto result1 = index->Query(query_dataset, conf, nullptr);
+    AssertAnns(result1, nq, k);
+    ReleaseQueryResult(result1);
+
+    // re-ranked results are exact distances, the same as the float index
+    std::shared_ptr<uint8_t[]> raw_data(new uint8_t[nb * dim * sizeof(float)]);
+    memcpy(raw_data.get(), xb.data(), nb * dim * sizeof(float));
+    index->SetRawData(raw_data);
+    EXPECT_GT(index->Size(), index_->Size() / 2);
+    auto result2 = index->Query(query_dataset, conf, nullptr);
+    auto result3 = index_->Query(query_dataset, conf, nullptr);
+    AssertAnns(result2, nq, k);
+    auto ids2 = result2->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dist2 = result2->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    auto ids3 = result3->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dist3 = result3->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    int64_t hits = 0;
+    for (int64_t i = 0; i < nq; i++) {
+        ASSERT_FLOAT_EQ(dist2[i * k], dist3[i * k]);
+        for (int64_t j = 0; j < k; j++) {
+            hits += std::count(ids3 + i * k, ids3 + (i + 1) * k, ids2[i * k + j]);
+        }
+    }
+    EXPECT_GE(hits, nq * k * 9 / 10);
+    ReleaseQueryResult(result2);
+    ReleaseQueryResult(result3);
+
+    // deleted vectors are skipped as by IndexHNSW
+    faiss::ConcurrentBitsetPtr bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (auto i = 0; i < nq; ++i) {
+        bitset->set(i);
+    }
+    auto result4 = index->Query(query_dataset, conf, bitset);
+    AssertAnns(result4, nq, k, CheckMode::CHECK_NOT_EQUAL);
+    ReleaseQueryResult(result4);
+}
+
+TEST_P(HNSWTest, HNSW_SQ8_serialize) {
+    auto index = std::make_shared<milvus::knowhere::IndexHNSWSQ8>();
+    auto ip_conf = conf;
+    ip_conf[milvus::knowhere::Metric::TYPE] = milvus::knowhere::Metric::IP;
+    index->Train(base_dataset, ip_conf);
+    index->AddWithoutIds(base_dataset, ip_conf);
+    auto result1 = index->Query(query_dataset, ip_conf, nullptr);
+
+    auto binaryset = index->Serialize();
+    auto bin = binaryset.GetByName("HNSW_SQ8");
+    std::shared_ptr<uint8_t[]> data(new uint8_t[bin->size]);
+    memcpy(data.get(), bin->data.get(), bin->size);
+    binaryset.clear();
+    binaryset.Append("HNSW_SQ8", data, bin->size);
+
+    auto loaded = std::make_shared<milvus::knowhere::IndexHNSWSQ8>();
+    loaded->Load(binaryset);
+    EXPECT_EQ(loaded->Count(), nb);
+    EXPECT_EQ(loaded->Dim(), dim);
+    auto result2 = loaded->Query(query_dataset, ip_conf, nullptr);
+    auto ids1 = result1->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto ids2 = result2->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dist1 = result1->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    auto dist2 = result2->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < nq * k; i++) {
+        ASSERT_EQ(ids1[i], ids2[i]);
+        ASSERT_FLOAT_EQ(dist1[i], dist2[i]);
+    }
+    ReleaseQueryResult(result1);
+    ReleaseQueryResult(result2);
+}
+
 /*
  * faiss style test
  * keep it
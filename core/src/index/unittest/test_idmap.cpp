@@ -119,6 +119,22 @@ TEST_P(IDMAPTest, idmap_basic) {
     AssertAnns(result_bs_1, nq, k, CheckMode::CHECK_NOT_EQUAL);
     ReleaseQueryResult(result_bs_1);
 
+    // all but the last 64 vectors deleted, the scan skips the fully deleted blocks
+    std::vector<int32_t> deleted_offsets;
+    for (int32_t i = 0; i < nb - 64; ++i) {
+        deleted_offsets.push_back(i);
+    }
+    auto block_bitset_ptr = std::make_shared<faiss::ConcurrentBitset>(nb);
+    block_bitset_ptr->set(deleted_offsets.data(), deleted_offsets.size());
+    ASSERT_EQ(block_bitset_ptr->count(), deleted_offsets.size());
+
+    auto result_bs_4 = index_->Query(query_dataset, conf, block_bitset_ptr);
+    auto ids = result_bs_4->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        EXPECT_GE(ids[i], nb - 64);
+    }
+    ReleaseQueryResult(result_bs_4);
+
 #if 0
     auto result_bs_2 = index_->QueryById(id_dataset, conf);
     AssertAnns(result_bs_2, nq, k, CheckMode::CHECK_NOT_EQUAL);
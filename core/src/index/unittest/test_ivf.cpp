@@ -13,8 +13,10 @@
 
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <algorithm>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuIndexIVFFlat.h>
@@ -24,6 +26,7 @@
 #include "knowhere/common/Timer.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 #include "knowhere/index/vector_index/IndexType.h"
 #include "knowhere/index/vector_index/adapter/VectorAdapter.h"
@@ -150,6 +153,204 @@ TEST_P(IVFTest, ivf_basic_cpu) {
 #endif
 }
 
+TEST_P(IVFTest, ivf_concurrent_query_params) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+
+    // queries with different nprobe on the same index must not affect each other
+    std::vector<int64_t> nprobes = {1, 100};
+    std::vector<std::vector<int64_t>> expect_ids(nprobes.size());
+    for (size_t i = 0; i < nprobes.size(); ++i) {
+        auto conf = conf_;
+        conf[milvus::knowhere::IndexParams::nprobe] = nprobes[i];
+        auto result = index_->Query(query_dataset, conf, nullptr);
+        auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+        expect_ids[i].assign(ids, ids + nq * k);
+        ReleaseQueryResult(result);
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> matched(nprobes.size(), 1);
+    for (size_t i = 0; i < nprobes.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            auto conf = conf_;
+            conf[milvus::knowhere::IndexParams::nprobe] = nprobes[i];
+            for (int round = 0; round < 10; ++round) {
+                auto result = index_->Query(query_dataset, conf, nullptr);
+                auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+                if (!std::equal(ids, ids + nq * k, expect_ids[i].begin())) {
+                    matched[i] = 0;
+                }
+                ReleaseQueryResult(result);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < nprobes.size(); ++i) {
+        ASSERT_EQ(matched[i], 1);
+    }
+}
+
+TEST_P(IVFTest, ivf_batched_scan) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+
+    // nq * nprobe covers every list more than twice, the batch scans each probed list once for all the queries
+    auto conf = conf_;
+    conf[milvus::knowhere::IndexParams::nprobe] = 50;
+    auto result = index_->Query(query_dataset, conf, nullptr);
+    AssertAnns(result, nq, k);
+    auto dist = result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+
+    // the same queries one by one, ties aside the ids are the same so compare the distances
+    for (int64_t i = 0; i < nq; ++i) {
+        auto one_query = milvus::knowhere::GenDataset(1, dim, xq.data() + i * dim);
+        auto one_result = index_->Query(one_query, conf, nullptr);
+        auto one_dist = one_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+        for (int64_t j = 0; j < k; ++j) {
+            ASSERT_EQ(dist[i * k + j], one_dist[j]);
+        }
+        ReleaseQueryResult(one_result);
+    }
+    ReleaseQueryResult(result);
+}
+
+class IVFPQFastScanTest : public DataGen, public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        Generate(DIM, NB, NQ);
+        index_ = std::make_shared<milvus::knowhere::IVFPQFastScan>();
+        conf_ = milvus::knowhere::Config{
+            {milvus::knowhere::meta::DIM, DIM},
+            {milvus::knowhere::meta::TOPK, K},
+            {milvus::knowhere::IndexParams::nlist, 100},
+            {milvus::knowhere::IndexParams::nprobe, 8},
+            {milvus::knowhere::IndexParams::m, 32},
+            {milvus::knowhere::Metric::TYPE, milvus::knowhere::Metric::L2},
+        };
+    }
+
+ protected:
+    milvus::knowhere::Config conf_;
+    milvus::knowhere::IVFPQFastScanPtr index_ = nullptr;
+};
+
+TEST_F(IVFPQFastScanTest, basic_serialize_rerank) {
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+    EXPECT_EQ(index_->Count(), nb);
+    EXPECT_EQ(index_->Dim(), dim);
+    EXPECT_EQ(index_->index_type(), milvus::knowhere::IndexEnum::INDEX_FAISS_IVFPQ_FASTSCAN);
+
+    auto result = index_->Query(query_dataset, conf_, nullptr);
+    auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        ASSERT_TRUE(ids[i] >= 0 && ids[i] < nb);
+    }
+
+    // the codes are written in the block layout and read back as is
+    auto binaryset = index_->Serialize(conf_);
+    auto loaded = std::make_shared<milvus::knowhere::IVFPQFastScan>();
+    loaded->Load(binaryset);
+    auto loaded_result = loaded->Query(query_dataset, conf_, nullptr);
+    auto loaded_ids = loaded_result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        ASSERT_EQ(ids[i], loaded_ids[i]);
+    }
+
+    // with the raw vectors the candidates are re-ranked by exact distances, the queries are base vectors
+    std::shared_ptr<uint8_t[]> raw_data(new uint8_t[nb * dim * sizeof(float)]);
+    memcpy(raw_data.get(), xb.data(), nb * dim * sizeof(float));
+    loaded->SetRawData(raw_data);
+    auto conf = conf_;
+    conf[milvus::knowhere::IndexParams::k_factor] = 8;
+    auto rerank_result = loaded->Query(query_dataset, conf, nullptr);
+    AssertAnns(rerank_result, nq, k);
+    auto rerank_dist = rerank_result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_FLOAT_EQ(rerank_dist[i * k], 0.0f);
+        for (int64_t j = 1; j < k; ++j) {
+            ASSERT_LE(rerank_dist[i * k + j - 1], rerank_dist[i * k + j]);
+        }
+    }
+
+    ASSERT_ANY_THROW(index_->CopyCpuToGpu(DEVICEID, conf_));
+    ReleaseQueryResult(result);
+    ReleaseQueryResult(loaded_result);
+    ReleaseQueryResult(rerank_result);
+}
+
+TEST_F(IVFPQFastScanTest, large_m) {
+    // one dimension per sub-quantizer, the table entries of the all-ones corner are the largest ones for a query
+    // at the origin, their sum is at the 16-bit limit of the accumulator
+    const int64_t large_dim = 512;
+    const int64_t large_nb = 2000;
+    std::vector<float> base(large_nb * large_dim);
+    for (int64_t i = 0; i < large_nb * large_dim; ++i) {
+        base[i] = static_cast<float>((i * 7 + i / large_dim) % 2);
+    }
+    std::fill(base.end() - large_dim, base.end(), 1.0f);
+    std::vector<float> query(large_dim, 0.0f);
+
+    auto conf = conf_;
+    conf[milvus::knowhere::meta::DIM] = large_dim;
+    conf[milvus::knowhere::IndexParams::m] = large_dim;
+    conf[milvus::knowhere::IndexParams::nlist] = 1;
+    conf[milvus::knowhere::IndexParams::nprobe] = 1;
+    auto dataset = milvus::knowhere::GenDataset(large_nb, large_dim, base.data());
+    index_->Train(dataset, conf);
+    index_->AddWithoutIds(dataset, conf);
+
+    // the farthest vector must not wrap around to a small distance
+    auto result = index_->Query(milvus::knowhere::GenDataset(1, large_dim, query.data()), conf, nullptr);
+    auto ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    auto dist = result->Get<float*>(milvus::knowhere::meta::DISTANCE);
+    for (int64_t j = 0; j < k; ++j) {
+        ASSERT_NE(ids[j], large_nb - 1);
+        ASSERT_LT(dist[j], large_dim * 0.75f);
+    }
+    ReleaseQueryResult(result);
+}
+
+TEST_P(IVFTest, ivf_compact_inverted_lists) {
+    if (index_mode_ != milvus::knowhere::IndexMode::MODE_CPU) {
+        return;
+    }
+
+    index_->Train(base_dataset, conf_);
+    index_->AddWithoutIds(base_dataset, conf_);
+
+    // drop odd ids and renumber the rest
+    std::vector<int64_t> even_ids(nb, -1);
+    for (int64_t i = 0; i < nb; i += 2) {
+        even_ids[i] = i / 2;
+    }
+    index_->CompactInvertedLists(even_ids);
+    EXPECT_EQ(index_->Count(), (nb + 1) / 2);
+    auto result = index_->Query(query_dataset, conf_, nullptr);
+    auto result_ids = result->Get<int64_t*>(milvus::knowhere::meta::IDS);
+    for (int64_t i = 0; i < nq * k; ++i) {
+        EXPECT_LT(result_ids[i], (nb + 1) / 2);
+    }
+    ReleaseQueryResult(result);
+
+    // drop everything
+    std::vector<int64_t> no_ids(nb, -1);
+    index_->CompactInvertedLists(no_ids);
+    EXPECT_EQ(index_->Count(), 0);
+}
+
 TEST_P(IVFTest, ivf_basic_gpu) {
     assert(!xb.empty());
 
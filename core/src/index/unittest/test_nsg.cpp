@@ -12,7 +12,10 @@
 #include <fiu-control.h>
 #include <fiu-local.h>
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
@@ -25,6 +28,7 @@
 #endif
 
 #include "knowhere/common/Timer.h"
+#include "knowhere/index/vector_index/impl/nsg/NNDescent.h"
 #include "knowhere/index/vector_index/impl/nsg/NSGIO.h"
 
 #include "unittest/utils.h"
@@ -168,3 +172,98 @@ TEST_F(NSGInterfaceTest, delete_test) {
     ReleaseQueryResult(result);
     ReleaseQueryResult(result_after);
 }
+
+TEST_F(NSGInterfaceTest, reorder_test) {
+    assert(!xb.empty());
+
+    // results are reported by the original offsets after the nodes are renumbered
+    train_conf[milvus::knowhere::meta::DEVICEID] = -1;
+    train_conf[milvus::knowhere::IndexParams::reorder] = true;
+    index_->BuildAll(base_dataset, train_conf);
+    auto result = index_->Query(query_dataset, search_conf, nullptr);
+    AssertAnns(result, nq, k);
+    ReleaseQueryResult(result);
+
+    faiss::ConcurrentBitsetPtr bitset = std::make_shared<faiss::ConcurrentBitset>(nb);
+    for (int i = 0; i < nq; i++) {
+        bitset->set(i);
+    }
+    auto result_delete = index_->Query(query_dataset, search_conf, bitset);
+    AssertAnns(result_delete, nq, k, CheckMode::CHECK_NOT_EQUAL);
+    ReleaseQueryResult(result_delete);
+
+    auto new_index = std::make_shared<milvus::knowhere::NSG>();
+    new_index->Load(index_->Serialize());
+    auto new_result = new_index->Query(query_dataset, search_conf, nullptr);
+    AssertAnns(new_result, nq, k);
+    ReleaseQueryResult(new_result);
+
+    // the navigation point and its neighbors take the first ids
+    const size_t n = 2000;
+    milvus::knowhere::impl::NsgIndex nsg(dim, n, milvus::knowhere::impl::NsgIndex::Metric_Type_L2);
+    milvus::knowhere::impl::NNDescentParams nnd_params;
+    nnd_params.k = 20;
+    milvus::knowhere::impl::Graph knng;
+    milvus::knowhere::impl::NNDescent nnd(xb.data(), n, dim, nsg.distance_);
+    nnd.Build(nnd_params, knng);
+    nsg.SetKnnGraph(knng);
+    milvus::knowhere::impl::BuildParams b_params{40, 30, 100};
+    nsg.Build(n, xb.data(), nullptr, b_params);
+
+    auto navigation_id = nsg.navigation_point;
+    auto navigation_degree = nsg.nsg[navigation_id].size();
+    nsg.Reorder();
+    ASSERT_EQ(nsg.navigation_point, 0);
+    ASSERT_EQ(nsg.ids_[0], navigation_id);
+    ASSERT_EQ(nsg.nsg[0].size(), navigation_degree);
+    for (auto id : nsg.nsg[0]) {
+        ASSERT_LE(id, (int64_t)navigation_degree);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(memcmp(nsg.ori_data_ + i * dim, xb.data() + nsg.ids_[i] * dim, sizeof(float) * dim), 0);
+    }
+}
+
+TEST_F(NSGInterfaceTest, nndescent_test) {
+    assert(!xb.empty());
+
+    const size_t n = 2000;
+    const size_t knn = 10;
+    milvus::knowhere::impl::DistanceL2 distanceL2;
+    milvus::knowhere::impl::NNDescentParams params;
+    params.k = knn;
+    params.pool_size = 2 * knn;
+    milvus::knowhere::impl::Graph knng;
+    milvus::knowhere::impl::NNDescent nnd(xb.data(), n, dim, &distanceL2);
+    nnd.Build(params, knng);
+    ASSERT_EQ(knng.size(), n);
+
+    // compare with the exact neighbors
+    size_t hit = 0;
+    const size_t check_count = 100;
+    for (size_t i = 0; i < check_count; ++i) {
+        ASSERT_EQ(knng[i].size(), knn);
+        std::vector<std::pair<float, int64_t>> exact;
+        for (size_t j = 0; j < n; ++j) {
+            if (j != i) {
+                exact.emplace_back(distanceL2.Compare(xb.data() + i * dim, xb.data() + j * dim, dim), j);
+            }
+        }
+        std::partial_sort(exact.begin(), exact.begin() + knn, exact.end());
+        for (size_t j = 0; j < knn; ++j) {
+            ASSERT_NE(knng[i][j], (int64_t)i);
+            if (std::find(knng[i].begin(), knng[i].end(), exact[j].second) != knng[i].end()) {
+                ++hit;
+            }
+        }
+    }
+    ASSERT_GT(hit, check_count * knn * 0.9);
+
+    // all the other nodes are the neighbors when there are not enough
+    milvus::knowhere::impl::Graph small_knng;
+    milvus::knowhere::impl::NNDescent small_nnd(xb.data(), 5, dim, &distanceL2);
+    small_nnd.Build(params, small_knng);
+    for (auto& node : small_knng) {
+        ASSERT_EQ(node.size(), 4);
+    }
+}
@@ -59,6 +59,10 @@ class MetricsBase {
     CpuCacheUsageGaugeSet(double value) {
     }
 
+    virtual void
+    CpuCacheShardGaugeSet(size_t shard, uint64_t hit_count, uint64_t miss_count, uint64_t eviction_count) {
+    }
+
     virtual void
     GpuCacheUsageGaugeSet() {
     }
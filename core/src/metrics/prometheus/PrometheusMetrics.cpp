@@ -251,6 +251,19 @@ PrometheusMetrics::CPUTemperature() {
     //    }
 }
 
+void
+PrometheusMetrics::CpuCacheShardGaugeSet(size_t shard, uint64_t hit_count, uint64_t miss_count,
+                                         uint64_t eviction_count) {
+    if (!startup_) {
+        return;
+    }
+
+    auto shard_id = std::to_string(shard);
+    cpu_cache_shard_.Add({{"shard", shard_id}, {"outcome", "hit"}}).Set(hit_count);
+    cpu_cache_shard_.Add({{"shard", shard_id}, {"outcome", "miss"}}).Set(miss_count);
+    cpu_cache_shard_.Add({{"shard", shard_id}, {"outcome", "eviction"}}).Set(eviction_count);
+}
+
 void
 PrometheusMetrics::GpuCacheUsageGaugeSet() {
     //    std::vector<uint64_t > gpu_ids = {0};
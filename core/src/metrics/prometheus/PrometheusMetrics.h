@@ -101,6 +101,9 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    CpuCacheShardGaugeSet(size_t shard, uint64_t hit_count, uint64_t miss_count, uint64_t eviction_count) override;
+
     void
     GpuCacheUsageGaugeSet() override;
 
@@ -548,6 +551,12 @@ class PrometheusMetrics : public MetricsBase {
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
     prometheus::Gauge& cpu_cache_usage_gauge_ = cpu_cache_usage_.Add({});
 
+    // record CPU cache hit/miss/eviction count of each shard
+    prometheus::Family<prometheus::Gauge>& cpu_cache_shard_ = prometheus::BuildGauge()
+                                                                  .Name("cache_shard_access_count")
+                                                                  .Help("hit/miss/eviction count of cache shards")
+                                                                  .Register(*registry_);
+
     // record GPU cache usage and %
     prometheus::Family<prometheus::Gauge>& gpu_cache_usage_ = prometheus::BuildGauge()
                                                                   .Name("gpu_cache_usage_bytes")
@@ -0,0 +1,704 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "query/AttrFilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace milvus {
+namespace query {
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 64;  // rows of a bitset word
+constexpr size_t SMALL_TERM_NUM = 8;
+constexpr double TWO_POW_63 = 9223372036854775808.0;
+
+using Words = std::vector<uint64_t>;
+
+template <typename T>
+using Wide = typename std::conditional<std::is_integral<T>::value, int64_t, double>::type;
+
+// result of a query node, absent if the node has no term or range query
+struct Matches {
+    bool absent = true;
+    ZoneMapResult zone = ZoneMapResult::ALL;
+    Words words;  // matching rows, filled when scanning and zone is SOME
+};
+
+// values a range query accepts: [lo, hi] except the excluded ones
+template <typename T>
+struct RangeBounds {
+    bool empty = false;
+    T lo = std::numeric_limits<T>::lowest();
+    T hi = std::numeric_limits<T>::max();
+    std::vector<T> excluded;
+};
+
+void
+ZoneOf(const segment::ZoneMap& zone_map, int64_t& min, int64_t& max) {
+    min = zone_map.int_min_;
+    max = zone_map.int_max_;
+}
+
+void
+ZoneOf(const segment::ZoneMap& zone_map, double& min, double& max) {
+    min = zone_map.float_min_;
+    max = zone_map.float_max_;
+}
+
+// the operand as an exact integer if it is one, as a double otherwise
+bool
+ParseOperand(const std::string& operand, bool& is_int, int64_t& int_value, double& float_value) {
+    size_t pos = 0;
+    try {
+        int_value = std::stoll(operand, &pos);
+        if (pos == operand.size()) {
+            is_int = true;
+            float_value = static_cast<double>(int_value);
+            return true;
+        }
+    } catch (std::exception& e) {
+        // not an integer, or out of range
+    }
+
+    try {
+        float_value = std::stod(operand, &pos);
+    } catch (std::exception& e) {
+        return false;
+    }
+    is_int = false;
+    return pos == operand.size();
+}
+
+// smallest integer not less than d, or greater than d if strict; false if beyond int64
+bool
+IntLowerBound(double d, bool strict, int64_t& bound) {
+    double b = strict ? std::floor(d) + 1 : std::ceil(d);
+    if (b >= TWO_POW_63) {
+        return false;
+    }
+    bound = b < -TWO_POW_63 ? std::numeric_limits<int64_t>::min() : static_cast<int64_t>(b);
+    return true;
+}
+
+// largest integer not greater than d, or less than d if strict; false if beyond int64
+bool
+IntUpperBound(double d, bool strict, int64_t& bound) {
+    double b = strict ? std::ceil(d) - 1 : std::floor(d);
+    if (b < -TWO_POW_63) {
+        return false;
+    }
+    bound = b >= TWO_POW_63 ? std::numeric_limits<int64_t>::max() : static_cast<int64_t>(b);
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, RangeBounds<T>>::type
+MakeRangeBounds(const std::vector<CompareExpr>& exprs) {
+    RangeBounds<T> bounds;
+    int64_t lo = std::numeric_limits<int64_t>::min();
+    int64_t hi = std::numeric_limits<int64_t>::max();
+    std::vector<int64_t> excluded;
+    for (auto& expr : exprs) {
+        bool is_int = false;
+        int64_t int_value = 0;
+        double float_value = 0.0;
+        if (!ParseOperand(expr.operand, is_int, int_value, float_value) ||
+            (std::isnan(float_value) && expr.compare_operator != CompareOperator::NE)) {
+            bounds.empty = true;
+            return bounds;
+        }
+
+        int64_t bound = 0;
+        bool satisfiable = true;
+        switch (expr.compare_operator) {
+            case CompareOperator::LT:
+                if (is_int) {
+                    satisfiable = int_value != std::numeric_limits<int64_t>::min();
+                    bound = int_value - (satisfiable ? 1 : 0);
+                } else {
+                    satisfiable = IntUpperBound(float_value, true, bound);
+                }
+                hi = std::min(hi, bound);
+                break;
+            case CompareOperator::LTE:
+                if (is_int) {
+                    bound = int_value;
+                } else {
+                    satisfiable = IntUpperBound(float_value, false, bound);
+                }
+                hi = std::min(hi, bound);
+                break;
+            case CompareOperator::GT:
+                if (is_int) {
+                    satisfiable = int_value != std::numeric_limits<int64_t>::max();
+                    bound = int_value + (satisfiable ? 1 : 0);
+                } else {
+                    satisfiable = IntLowerBound(float_value, true, bound);
+                }
+                lo = std::max(lo, bound);
+                break;
+            case CompareOperator::GTE:
+                if (is_int) {
+                    bound = int_value;
+                } else {
+                    satisfiable = IntLowerBound(float_value, false, bound);
+                }
+                lo = std::max(lo, bound);
+                break;
+            case CompareOperator::EQ:
+                satisfiable = is_int;
+                lo = std::max(lo, int_value);
+                hi = std::min(hi, int_value);
+                break;
+            case CompareOperator::NE:
+                if (is_int) {
+                    excluded.push_back(int_value);
+                }
+                break;
+        }
+        if (!satisfiable) {
+            bounds.empty = true;
+            return bounds;
+        }
+    }
+
+    auto t_min = static_cast<int64_t>(std::numeric_limits<T>::min());
+    auto t_max = static_cast<int64_t>(std::numeric_limits<T>::max());
+    if (lo > hi || lo > t_max || hi < t_min) {
+        bounds.empty = true;
+        return bounds;
+    }
+    bounds.lo = static_cast<T>(std::max(lo, t_min));
+    bounds.hi = static_cast<T>(std::min(hi, t_max));
+    for (auto value : excluded) {
+        if (value >= bounds.lo && value <= bounds.hi) {
+            bounds.excluded.push_back(static_cast<T>(value));
+        }
+    }
+    return bounds;
+}
+
+// smallest T not less than d, or greater than d if strict
+template <typename T>
+T
+FloatLowerBound(double d, bool strict) {
+    using limits = std::numeric_limits<T>;
+    if (d > static_cast<double>(limits::max())) {
+        return limits::infinity();
+    }
+    T t = d < static_cast<double>(limits::lowest()) ? -limits::infinity() : static_cast<T>(d);
+    if (static_cast<double>(t) < d || (strict && static_cast<double>(t) == d)) {
+        t = std::nextafter(t, limits::infinity());
+    }
+    return t;
+}
+
+// largest T not greater than d, or less than d if strict
+template <typename T>
+T
+FloatUpperBound(double d, bool strict) {
+    using limits = std::numeric_limits<T>;
+    if (d < static_cast<double>(limits::lowest())) {
+        return -limits::infinity();
+    }
+    T t = d > static_cast<double>(limits::max()) ? limits::infinity() : static_cast<T>(d);
+    if (static_cast<double>(t) > d || (strict && static_cast<double>(t) == d)) {
+        t = std::nextafter(t, -limits::infinity());
+    }
+    return t;
+}
+
+// whether d has an exact T representation, which is then stored in t
+template <typename T>
+bool
+ExactFloat(double d, T& t) {
+    if (std::isnan(d)) {
+        return false;
+    }
+    if (std::isinf(d)) {
+        t = d > 0 ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+        return true;
+    }
+    if (std::abs(d) > static_cast<double>(std::numeric_limits<T>::max())) {
+        return false;
+    }
+    t = static_cast<T>(d);
+    return static_cast<double>(t) == d;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, RangeBounds<T>>::type
+MakeRangeBounds(const std::vector<CompareExpr>& exprs) {
+    RangeBounds<T> bounds;
+    bounds.lo = -std::numeric_limits<T>::infinity();
+    bounds.hi = std::numeric_limits<T>::infinity();
+    for (auto& expr : exprs) {
+        bool is_int = false;
+        int64_t int_value = 0;
+        double value = 0.0;
+        if (!ParseOperand(expr.operand, is_int, int_value, value) ||
+            (std::isnan(value) && expr.compare_operator != CompareOperator::NE)) {
+            bounds.empty = true;
+            return bounds;
+        }
+
+        T exact;
+        switch (expr.compare_operator) {
+            case CompareOperator::LT:
+                bounds.hi = std::min(bounds.hi, FloatUpperBound<T>(value, true));
+                break;
+            case CompareOperator::LTE:
+                bounds.hi = std::min(bounds.hi, FloatUpperBound<T>(value, false));
+                break;
+            case CompareOperator::GT:
+                bounds.lo = std::max(bounds.lo, FloatLowerBound<T>(value, true));
+                break;
+            case CompareOperator::GTE:
+                bounds.lo = std::max(bounds.lo, FloatLowerBound<T>(value, false));
+                break;
+            case CompareOperator::EQ:
+                if (!ExactFloat(value, exact)) {
+                    bounds.empty = true;
+                    return bounds;
+                }
+                bounds.lo = std::max(bounds.lo, exact);
+                bounds.hi = std::min(bounds.hi, exact);
+                break;
+            case CompareOperator::NE:
+                if (ExactFloat(value, exact)) {
+                    bounds.excluded.push_back(exact);
+                }
+                break;
+        }
+    }
+    bounds.empty = bounds.lo > bounds.hi;
+    return bounds;
+}
+
+// term values in the column type, the ones the column type can't hold exactly are dropped since they match nothing
+template <typename T>
+std::vector<T>
+MakeTermValues(const std::vector<uint8_t>& field_value) {
+    size_t num = field_value.size() / sizeof(int64_t);
+    std::vector<T> values;
+    values.reserve(num);
+    for (size_t i = 0; i < num; ++i) {
+        if (std::is_integral<T>::value) {
+            int64_t value;
+            memcpy(&value, field_value.data() + i * sizeof(int64_t), sizeof(int64_t));
+            if (value >= static_cast<int64_t>(std::numeric_limits<T>::lowest()) &&
+                value <= static_cast<int64_t>(std::numeric_limits<T>::max())) {
+                values.push_back(static_cast<T>(value));
+            }
+        } else {
+            double value;
+            memcpy(&value, field_value.data() + i * sizeof(double), sizeof(double));
+            T exact;
+            if (ExactFloat(value, exact)) {
+                values.push_back(exact);
+            }
+        }
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+// whether the column holds a value for each of the rows, and the result of its zone map may be ALL;
+// floating point columns may hold NaN which the zone map doesn't cover
+template <typename T>
+bool
+FullColumn(const segment::Attr& attr, size_t row_count) {
+    return std::is_integral<T>::value && attr.GetNullCount() == 0 && attr.GetCount() >= row_count;
+}
+
+template <typename T>
+ZoneMapResult
+RangeZone(const RangeBounds<T>& bounds, const segment::Attr& attr, size_t row_count) {
+    if (bounds.empty) {
+        return ZoneMapResult::NONE;
+    }
+    Wide<T> min, max;
+    ZoneOf(attr.GetZoneMap(), min, max);
+    if (static_cast<Wide<T>>(bounds.hi) < min || static_cast<Wide<T>>(bounds.lo) > max) {
+        return ZoneMapResult::NONE;
+    }
+    if (FullColumn<T>(attr, row_count) && static_cast<Wide<T>>(bounds.lo) <= min &&
+        static_cast<Wide<T>>(bounds.hi) >= max) {
+        bool excluded_inside = std::any_of(bounds.excluded.begin(), bounds.excluded.end(), [&](T value) {
+            return static_cast<Wide<T>>(value) >= min && static_cast<Wide<T>>(value) <= max;
+        });
+        if (!excluded_inside) {
+            return ZoneMapResult::ALL;
+        }
+    }
+    return ZoneMapResult::SOME;
+}
+
+template <typename T>
+ZoneMapResult
+TermZone(const std::vector<T>& terms, const segment::Attr& attr, size_t row_count) {
+    Wide<T> min, max;
+    ZoneOf(attr.GetZoneMap(), min, max);
+    bool inside = std::any_of(terms.begin(), terms.end(), [&](T value) {
+        return static_cast<Wide<T>>(value) >= min && static_cast<Wide<T>>(value) <= max;
+    });
+    if (!inside) {
+        return ZoneMapResult::NONE;
+    }
+    if (FullColumn<T>(attr, row_count) && min == max) {
+        return ZoneMapResult::ALL;
+    }
+    return ZoneMapResult::SOME;
+}
+
+// evaluate pred on the values of rows [0, count) block by block: the flags of a block are computed by a loop free
+// of branches, which the compiler vectorizes, then packed into the word of the block
+template <typename T, typename Pred>
+void
+ScanColumn(const T* values, size_t count, const Pred& pred, uint64_t* words) {
+    uint8_t flags[BLOCK_SIZE];
+    for (size_t base = 0; base < count; base += BLOCK_SIZE) {
+        size_t n = std::min(BLOCK_SIZE, count - base);
+        const T* block = values + base;
+        for (size_t j = 0; j < n; ++j) {
+            flags[j] = pred(block[j]);
+        }
+        uint64_t word = 0;
+        for (size_t j = 0; j < n; ++j) {
+            word |= static_cast<uint64_t>(flags[j]) << j;
+        }
+        words[base / BLOCK_SIZE] = word;
+    }
+}
+
+template <typename T>
+void
+ScanRange(const RangeBounds<T>& bounds, const T* values, size_t count, uint64_t* words) {
+    T lo = bounds.lo;
+    T hi = bounds.hi;
+    if (bounds.excluded.empty()) {
+        ScanColumn(values, count, [lo, hi](T v) -> uint8_t { return (v >= lo) & (v <= hi); }, words);
+    } else {
+        auto& excluded = bounds.excluded;
+        ScanColumn(values, count,
+                   [lo, hi, &excluded](T v) -> uint8_t {
+                       uint8_t match = (v >= lo) & (v <= hi);
+                       for (auto value : excluded) {
+                           match &= (v != value);
+                       }
+                       return match;
+                   },
+                   words);
+    }
+}
+
+template <typename T>
+void
+ScanTerms(const std::vector<T>& terms, const T* values, size_t count, uint64_t* words) {
+    if (terms.size() <= SMALL_TERM_NUM) {
+        ScanColumn(values, count,
+                   [&terms](T v) -> uint8_t {
+                       uint8_t match = 0;
+                       for (auto value : terms) {
+                           match |= (v == value);
+                       }
+                       return match;
+                   },
+                   words);
+    } else {
+        ScanColumn(values, count,
+                   [&terms](T v) -> uint8_t { return std::binary_search(terms.begin(), terms.end(), v); }, words);
+    }
+}
+
+// zone map result of a leaf on a column of type T, scanning the column when words is given and the result is SOME
+template <typename T>
+ZoneMapResult
+EvalColumn(const LeafQuery& leaf, const segment::Attr& attr, size_t row_count, Words* words) {
+    const T* values = reinterpret_cast<const T*>(attr.GetData().data());
+    size_t count = std::min(attr.GetCount(), row_count);
+    ZoneMapResult result;
+    if (leaf.range_query != nullptr) {
+        auto bounds = MakeRangeBounds<T>(leaf.range_query->compare_expr);
+        result = RangeZone(bounds, attr, row_count);
+        if (result == ZoneMapResult::SOME && words != nullptr) {
+            words->assign((row_count + BLOCK_SIZE - 1) / BLOCK_SIZE, 0);
+            ScanRange(bounds, values, count, words->data());
+        }
+    } else {
+        auto terms = MakeTermValues<T>(leaf.term_query->field_value);
+        result = TermZone(terms, attr, row_count);
+        if (result == ZoneMapResult::SOME && words != nullptr) {
+            words->assign((row_count + BLOCK_SIZE - 1) / BLOCK_SIZE, 0);
+            ScanTerms(terms, values, count, words->data());
+        }
+    }
+
+    // nulls hold zero values, which may have matched
+    if (result == ZoneMapResult::SOME && words != nullptr) {
+        for (auto offset : attr.GetNulls()) {
+            if ((size_t)offset < row_count) {
+                (*words)[offset / BLOCK_SIZE] &= ~(static_cast<uint64_t>(1) << (offset % BLOCK_SIZE));
+            }
+        }
+    }
+    return result;
+}
+
+void
+EvalLeaf(const LeafQueryPtr& leaf, const segment::Attrs& attrs, size_t row_count, bool scan, Matches& matches) {
+    if (leaf == nullptr || (leaf->term_query == nullptr && leaf->range_query == nullptr)) {
+        matches.absent = true;
+        return;
+    }
+
+    matches.absent = false;
+    auto& field_name = leaf->range_query != nullptr ? leaf->range_query->field_name : leaf->term_query->field_name;
+    auto attr = attrs.GetAttr(field_name);
+    if (attr == nullptr || !attr->HasValue()) {
+        matches.zone = ZoneMapResult::NONE;
+        return;
+    }
+
+    Words* words = scan ? &matches.words : nullptr;
+    switch (attr->GetType()) {
+        case engine::DataType::INT8:
+            matches.zone = EvalColumn<int8_t>(*leaf, *attr, row_count, words);
+            break;
+        case engine::DataType::INT16:
+            matches.zone = EvalColumn<int16_t>(*leaf, *attr, row_count, words);
+            break;
+        case engine::DataType::INT32:
+            matches.zone = EvalColumn<int32_t>(*leaf, *attr, row_count, words);
+            break;
+        case engine::DataType::INT64:
+            matches.zone = EvalColumn<int64_t>(*leaf, *attr, row_count, words);
+            break;
+        case engine::DataType::FLOAT:
+            matches.zone = EvalColumn<float>(*leaf, *attr, row_count, words);
+            break;
+        case engine::DataType::DOUBLE:
+            matches.zone = EvalColumn<double>(*leaf, *attr, row_count, words);
+            break;
+        default:
+            matches.zone = ZoneMapResult::NONE;
+            break;
+    }
+}
+
+// words of matches whatever its zone map result is
+void
+Materialize(Matches& matches, size_t row_count) {
+    if (matches.zone == ZoneMapResult::SOME) {
+        return;
+    }
+    size_t word_count = (row_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if (matches.zone == ZoneMapResult::NONE) {
+        matches.words.assign(word_count, 0);
+    } else {
+        matches.words.assign(word_count, ~static_cast<uint64_t>(0));
+        if (row_count % BLOCK_SIZE != 0) {
+            matches.words.back() = (static_cast<uint64_t>(1) << (row_count % BLOCK_SIZE)) - 1;
+        }
+    }
+}
+
+// rows matching left but not right when negate is set
+void
+Combine(Matches& left, Matches& right, bool intersect, bool negate, size_t row_count) {
+    Materialize(left, row_count);
+    Materialize(right, row_count);
+    auto& dst = left.words;
+    auto& src = right.words;
+    if (negate) {
+        for (size_t i = 0; i < dst.size(); ++i) {
+            dst[i] &= ~src[i];
+        }
+    } else if (intersect) {
+        for (size_t i = 0; i < dst.size(); ++i) {
+            dst[i] &= src[i];
+        }
+    } else {
+        for (size_t i = 0; i < dst.size(); ++i) {
+            dst[i] |= src[i];
+        }
+    }
+}
+
+void
+Evaluate(const GeneralQueryPtr& query, const segment::Attrs& attrs, size_t row_count, bool scan, Matches& matches) {
+    matches = Matches();
+    if (query == nullptr) {
+        return;
+    }
+    if (query->leaf != nullptr) {
+        EvalLeaf(query->leaf, attrs, row_count, scan, matches);
+        return;
+    }
+    if (query->bin == nullptr) {
+        return;
+    }
+
+    Matches left, right;
+    Evaluate(query->bin->left_query, attrs, row_count, scan, left);
+    Evaluate(query->bin->right_query, attrs, row_count, scan, right);
+
+    auto relation = query->bin->relation;
+    if (relation == QueryRelation::R4) {
+        if (right.absent) {
+            matches = std::move(left);
+            return;
+        }
+        if (left.absent) {
+            // every entity except the ones matching right
+            left.absent = false;
+            left.zone = ZoneMapResult::ALL;
+        }
+        if (left.zone == ZoneMapResult::NONE || right.zone == ZoneMapResult::ALL) {
+            matches.zone = ZoneMapResult::NONE;
+        } else if (right.zone == ZoneMapResult::NONE) {
+            matches.zone = left.zone;
+            matches.words = std::move(left.words);
+        } else {
+            matches.zone = ZoneMapResult::SOME;
+            if (scan) {
+                Combine(left, right, true, true, row_count);
+                matches.words = std::move(left.words);
+            }
+        }
+        matches.absent = false;
+        return;
+    }
+
+    // should clauses are optional along with must clauses
+    if (relation == QueryRelation::R3) {
+        matches = left.absent ? std::move(right) : std::move(left);
+        return;
+    }
+
+    if (left.absent || right.absent) {
+        matches = left.absent ? std::move(right) : std::move(left);
+        return;
+    }
+
+    // a relation left unset by the query builder intersects like AND
+    matches.absent = false;
+    bool intersect = (relation != QueryRelation::OR && relation != QueryRelation::R2);
+    ZoneMapResult dominant = intersect ? ZoneMapResult::NONE : ZoneMapResult::ALL;
+    if (left.zone == dominant || right.zone == dominant) {
+        matches.zone = dominant;
+    } else if (left.zone != ZoneMapResult::SOME && left.zone == right.zone) {
+        matches.zone = left.zone;
+    } else if (left.zone != ZoneMapResult::SOME || right.zone != ZoneMapResult::SOME) {
+        // the neutral side leaves the other one unchanged
+        auto& some = left.zone == ZoneMapResult::SOME ? left : right;
+        matches.zone = ZoneMapResult::SOME;
+        matches.words = std::move(some.words);
+    } else {
+        matches.zone = ZoneMapResult::SOME;
+        if (scan) {
+            Combine(left, right, intersect, false, row_count);
+            matches.words = std::move(left.words);
+        }
+    }
+}
+
+Status
+ValidateQuery(const GeneralQueryPtr& query) {
+    if (query == nullptr) {
+        return Status::OK();
+    }
+    if (query->leaf != nullptr) {
+        auto& leaf = query->leaf;
+        if (leaf->term_query != nullptr) {
+            if (leaf->term_query->field_name.empty()) {
+                return Status(SERVER_INVALID_ARGUMENT, "Field name of term query is empty");
+            }
+            if (leaf->term_query->field_value.size() % sizeof(int64_t) != 0) {
+                return Status(SERVER_INVALID_ARGUMENT,
+                              "Values of term query on " + leaf->term_query->field_name + " are not 8 bytes each");
+            }
+        }
+        if (leaf->range_query != nullptr) {
+            auto& range_query = leaf->range_query;
+            if (range_query->field_name.empty()) {
+                return Status(SERVER_INVALID_ARGUMENT, "Field name of range query is empty");
+            }
+            for (auto& expr : range_query->compare_expr) {
+                bool is_int = false;
+                int64_t int_value = 0;
+                double float_value = 0.0;
+                if (!ParseOperand(expr.operand, is_int, int_value, float_value)) {
+                    return Status(SERVER_INVALID_ARGUMENT, "Invalid operand of range query on " +
+                                                               range_query->field_name + ": " + expr.operand);
+                }
+            }
+        }
+        return Status::OK();
+    }
+    if (query->bin == nullptr) {
+        return Status::OK();
+    }
+
+    auto status = ValidateQuery(query->bin->left_query);
+    if (!status.ok()) {
+        return status;
+    }
+    return ValidateQuery(query->bin->right_query);
+}
+
+}  // namespace
+
+ZoneMapResult
+CheckZoneMaps(const GeneralQueryPtr& general_query, const segment::Attrs& attrs, size_t row_count) {
+    Matches matches;
+    Evaluate(general_query, attrs, row_count, false, matches);
+    return matches.absent ? ZoneMapResult::ALL : matches.zone;
+}
+
+Status
+FilterAttrs(const GeneralQueryPtr& general_query, const segment::Attrs& attrs, faiss::ConcurrentBitset& bitset) {
+    size_t row_count = bitset.capacity();
+    Matches matches;
+    Evaluate(general_query, attrs, row_count, true, matches);
+    if (matches.absent || matches.zone == ZoneMapResult::ALL) {
+        return Status::OK();
+    }
+
+    Materialize(matches, row_count);
+    for (size_t i = 0; i < matches.words.size(); ++i) {
+        uint64_t filtered = ~matches.words[i];
+        if (i == matches.words.size() - 1 && row_count % BLOCK_SIZE != 0) {
+            filtered &= (static_cast<uint64_t>(1) << (row_count % BLOCK_SIZE)) - 1;
+        }
+        if (filtered != 0) {
+            bitset.set_word(i, filtered);
+        }
+    }
+    return Status::OK();
+}
+
+Status
+ValidateAttrQuery(const GeneralQueryPtr& general_query) {
+    return ValidateQuery(general_query);
+}
+
+}  // namespace query
+}  // namespace milvus
@@ -0,0 +1,45 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <faiss/utils/ConcurrentBitset.h>
+
+#include "query/GeneralQuery.h"
+#include "segment/Attrs.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace query {
+
+// what the zone maps of a segment tell about the entities matching a query
+enum class ZoneMapResult {
+    NONE = 0,  // no entity matches, the segment can be skipped
+    SOME,      // the columns need to be scanned
+    ALL,       // all the entities match, no filtering needed
+};
+
+// check the term and range queries of general_query against the zone maps of attrs, which may be read without values;
+// vector queries put no restriction, fields absent from the segment match no entity
+ZoneMapResult
+CheckZoneMaps(const GeneralQueryPtr& general_query, const segment::Attrs& attrs, size_t row_count);
+
+// scan the columns of attrs and set the bits of the entities not matching the term and range queries of
+// general_query, the capacity of bitset is the row count of the segment
+Status
+FilterAttrs(const GeneralQueryPtr& general_query, const segment::Attrs& attrs, faiss::ConcurrentBitset& bitset);
+
+// check the operands of the term and range queries before searching any segment
+Status
+ValidateAttrQuery(const GeneralQueryPtr& general_query);
+
+}  // namespace query
+}  // namespace milvus
@@ -44,7 +44,7 @@ ConstructLeafBinTree(std::vector<LeafQueryPtr> leaf_queries, BinaryQueryPtr bina
     }
     binary_query->left_query = std::make_shared<GeneralQuery>();
     binary_query->right_query = std::make_shared<GeneralQuery>();
-    if (leaf_queries.size() == leaf_queries.size() - 1) {
+    if (idx == leaf_queries.size() - 1) {
         binary_query->left_query->leaf = leaf_queries[idx];
         return Status::OK();
     } else if (idx == leaf_queries.size() - 2) {
@@ -98,7 +98,13 @@ GenBinaryQuery(BooleanQueryPtr query, BinaryQueryPtr& binary_query) {
                 binary_query->relation = QueryRelation::AND;
                 return GenBinaryQuery(bc, binary_query);
             }
-            case Occur::MUST_NOT:
+            case Occur::MUST_NOT: {
+                // nothing at left, all the entities except the ones matching any of the clause
+                binary_query->relation = QueryRelation::R4;
+                binary_query->right_query = std::make_shared<GeneralQuery>();
+                binary_query->right_query->bin->relation = QueryRelation::OR;
+                return GenBinaryQuery(bc, binary_query->right_query->bin);
+            }
             case Occur::SHOULD: {
                 binary_query->relation = QueryRelation::OR;
                 return GenBinaryQuery(bc, binary_query);
@@ -149,8 +155,8 @@ GenBinaryQuery(BooleanQueryPtr query, BinaryQueryPtr& binary_query) {
     }
 
     if (must_not_queries.size() > 1) {
-        // Construct a must_not binary tree
-        must_not_bquery = ConstructBinTree(must_not_queries, QueryRelation::R1, 0);
+        // Construct a must_not binary tree, matching any of them excludes an entity
+        must_not_bquery = ConstructBinTree(must_not_queries, QueryRelation::R2, 0);
         ++bquery_num;
     } else if (must_not_queries.size() == 1) {
         must_not_bquery = must_not_queries[0]->getBinaryQuery();
@@ -166,14 +172,14 @@ GenBinaryQuery(BooleanQueryPtr query, BinaryQueryPtr& binary_query) {
         must_should_query->relation = QueryRelation::R3;
         must_should_query->left_query->bin = must_bquery;
         must_should_query->right_query->bin = should_bquery;
-        binary_query->relation = QueryRelation::R1;
+        binary_query->relation = QueryRelation::R4;
         binary_query->left_query->bin = must_should_query;
         binary_query->right_query->bin = must_not_bquery;
     } else if (bquery_num == 2) {
         if (must_bquery == nullptr) {
-            binary_query->relation = QueryRelation::R3;
-            binary_query->left_query->bin = must_not_bquery;
-            binary_query->right_query->bin = should_bquery;
+            binary_query->relation = QueryRelation::R4;
+            binary_query->left_query->bin = should_bquery;
+            binary_query->right_query->bin = must_not_bquery;
         } else if (should_bquery == nullptr) {
             binary_query->relation = QueryRelation::R4;
             binary_query->left_query->bin = must_bquery;
@@ -189,7 +195,8 @@ GenBinaryQuery(BooleanQueryPtr query, BinaryQueryPtr& binary_query) {
         } else if (should_bquery != nullptr) {
             binary_query = should_bquery;
         } else {
-            binary_query = must_not_bquery;
+            binary_query->relation = QueryRelation::R4;
+            binary_query->right_query->bin = must_not_bquery;
         }
     }
 
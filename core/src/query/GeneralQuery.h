@@ -29,6 +29,9 @@ enum class CompareOperator {
     NE,
 };
 
+// R1: intersection of must clauses, R2: union of should clauses,
+// R3: must clauses with should clauses, the should clauses are optional then,
+// R4: left clauses excluding the must_not clauses at right
 enum class QueryRelation {
     INVALID = 0,
     R1,
@@ -44,6 +47,7 @@ struct QueryColumn {
     std::string column_value;
 };
 
+// field_value holds int64 values for integer fields and double values for floating point fields
 struct TermQuery {
     std::string field_name;
     std::vector<uint8_t> field_value;
@@ -96,10 +100,11 @@ struct LeafQuery {
     float query_boost;
 };
 
+// a side without term or range query puts no restriction, the other side decides the result alone
 struct BinaryQuery {
     GeneralQueryPtr left_query;
     GeneralQueryPtr right_query;
-    QueryRelation relation;
+    QueryRelation relation = QueryRelation::INVALID;
     float query_boost;
 };
 
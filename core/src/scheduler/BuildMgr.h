@@ -51,6 +51,7 @@ class BuildMgr {
 
     int64_t
     NumOfAvailable() {
+        std::lock_guard<std::mutex> lock(mutex_);
         return available_;
     }
 
@@ -98,14 +98,16 @@ JobMgr::worker_function() {
                     engine::utils::GetParentPath(location, segment_dir);
                     segment::SegmentReader segment_reader(segment_dir);
                     segment::IdBloomFilterPtr id_bloom_filter_ptr;
-                    segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false);
+                    auto status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr, false);
 
-                    // Check if the id is present.
-                    bool pass = true;
+                    // Check if the id is present, keep the task if the bloom filter is unavailable.
+                    bool pass = status.ok();
                     for (auto& id : search_job->vectors().id_array_) {
+                        if (!pass) {
+                            break;
+                        }
                         if (id_bloom_filter_ptr->Check(id)) {
                             pass = false;
-                            break;
                         }
                     }
 
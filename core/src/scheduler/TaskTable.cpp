@@ -159,29 +159,39 @@ TaskTableItem::Dump() const {
 }
 
 std::vector<uint64_t>
-TaskTable::PickToLoad(uint64_t limit) {
+TaskTable::PickToLoad(uint64_t limit, uint64_t max_loaded, uint64_t max_loaded_bytes) {
 #if 1
     // TimeRecorder rc("");
     std::vector<uint64_t> indexes;
     bool cross = false;
 
     uint64_t available_begin = table_.front() + 1;
+    uint64_t loaded_bytes = 0;
     for (uint64_t i = 0, loaded_count = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
         auto index = available_begin + i;
         if (not table_[index])
             break;
         if (index % table_.capacity() == table_.rear())
             break;
+        auto state = table_[index]->state;
         if (not cross && table_[index]->IsFinish()) {
             table_.set_front(index);
-        } else if (table_[index]->state == TaskTableItemState::LOADED) {
+        } else if (state == TaskTableItemState::LOADING || state == TaskTableItemState::LOADED) {
+            // tasks already ahead of the executors
             cross = true;
             ++loaded_count;
-            if (loaded_count >= 1)
+            loaded_bytes += table_[index]->get_task()->LoadSize();
+            if (loaded_count >= max_loaded || loaded_bytes > max_loaded_bytes)
                 return std::vector<uint64_t>();
-        } else if (table_[index]->state == TaskTableItemState::START) {
+        } else if (state == TaskTableItemState::START) {
             auto task = table_[index]->get_task();
 
+            // a task larger than the budget is still loaded when nothing else is ahead
+            auto load_size = task->LoadSize();
+            if (loaded_count + pick_count > 0 && loaded_bytes + load_size > max_loaded_bytes) {
+                break;
+            }
+
             // if task is a build index task, limit it
             if (task->Type() == TaskType::BuildIndexTask && task->path().Current() == "cpu") {
                 if (BuildMgrInst::GetInstance()->NumOfAvailable() < 1) {
@@ -191,6 +201,7 @@ TaskTable::PickToLoad(uint64_t limit) {
             }
             cross = true;
             indexes.push_back(index);
+            loaded_bytes += load_size;
             ++pick_count;
         } else {
             cross = true;
@@ -13,6 +13,7 @@
 
 #include <deque>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -127,8 +128,14 @@ class TaskTable : public interface::dumpable {
     size_t
     TaskToExecute();
 
+    /*
+     * Pick tasks to load;
+     * Nothing is picked while there are already max_loaded tasks loading or waiting for execution,
+     * or while their load size exceeds max_loaded_bytes;
+     */
     std::vector<uint64_t>
-    PickToLoad(uint64_t limit);
+    PickToLoad(uint64_t limit, uint64_t max_loaded = 1,
+               uint64_t max_loaded_bytes = std::numeric_limits<uint64_t>::max());
 
     std::vector<uint64_t>
     PickToExecute(uint64_t limit);
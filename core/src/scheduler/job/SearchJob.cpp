@@ -11,20 +11,25 @@
 
 #include "scheduler/job/SearchJob.h"
 
+#include <omp.h>
+#include <algorithm>
+#include <utility>
+
 #include "utils/Log.h"
 
 namespace milvus {
 namespace scheduler {
 
 SearchJob::SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, const milvus::json& extra_params,
-                     const engine::VectorsData& vectors)
-    : Job(JobType::SEARCH), context_(context), topk_(topk), extra_params_(extra_params), vectors_(vectors) {
-}
-
-SearchJob::SearchJob(const std::shared_ptr<server::Context>& context, milvus::query::GeneralQueryPtr general_query,
-                     std::unordered_map<std::string, engine::meta::hybrid::DataType>& attr_type,
-                     const engine::VectorsData& vectors)
-    : Job(JobType::SEARCH), context_(context), vectors_(vectors), general_query_(general_query), attr_type_(attr_type) {
+                     const engine::VectorsData& vectors, query::GeneralQueryPtr general_query,
+                     std::unordered_set<engine::IDNumber> deleted_ids)
+    : Job(JobType::SEARCH),
+      context_(context),
+      topk_(topk),
+      extra_params_(extra_params),
+      vectors_(vectors),
+      general_query_(std::move(general_query)),
+      deleted_ids_(std::move(deleted_ids)) {
 }
 
 bool
@@ -37,6 +42,7 @@ SearchJob::AddIndexFile(const SegmentSchemaPtr& index_file) {
     LOG_SERVER_DEBUG_ << LogOut("[%s][%ld] SearchJob %ld add index file: %ld", "search", 0, id(), index_file->id_);
 
     index_files_[index_file->id_] = index_file;
+    task_results_[index_file->id_] = SearchTaskResult();
     return true;
 }
 
@@ -45,6 +51,10 @@ SearchJob::WaitResult() {
     std::unique_lock<std::mutex> lock(mutex_);
     cv_.wait(lock, [this] { return index_files_.empty(); });
     LOG_SERVER_DEBUG_ << LogOut("[%s][%ld] SearchJob %ld all done", "search", 0, id());
+
+    // all tasks finished, no one touches the task results now
+    ReduceTaskResults(task_results_, nq(), topk_, result_ids_, result_distances_);
+    task_results_.clear();
 }
 
 void
@@ -58,6 +68,17 @@ SearchJob::SearchDone(size_t index_id) {
     LOG_SERVER_DEBUG_ << LogOut("[%s][%ld] SearchJob %ld finish index file: %ld", "search", 0, id(), index_id);
 }
 
+SearchTaskResult&
+SearchJob::GetTaskResult(size_t index_id) {
+    return task_results_.at(index_id);
+}
+
+void
+SearchJob::AddTaskResult(size_t index_id, SearchTaskResult& task_result) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_results_[index_id] = std::move(task_result);
+}
+
 ResultIds&
 SearchJob::GetResultIds() {
     return result_ids_;
@@ -90,5 +111,76 @@ SearchJob::GetContext() const {
     return context_;
 }
 
+void
+SearchJob::ReduceTaskResults(SearchTaskResultMap& task_results, uint64_t nq, uint64_t topk, ResultIds& result_ids,
+                             ResultDistances& result_distances) {
+    std::vector<SearchTaskResult*> sources;
+    size_t total_k = 0;
+    bool ascending = true;
+    for (auto& pair : task_results) {
+        SearchTaskResult& task_result = pair.second;
+        if (task_result.k_ == 0 || task_result.ids_.empty()) {
+            continue;
+        }
+        sources.push_back(&task_result);
+        total_k += task_result.k_;
+        ascending = task_result.ascending_;
+    }
+
+    if (nq == 0 || sources.empty()) {
+        LOG_ENGINE_DEBUG_ << LogOut("[%s][%d] Search result is empty.", "search", 0);
+        return;
+    }
+
+    // the initial result ids are -1, they only fill the tail when there are not enough results
+    size_t tar_k = result_ids.size() / nq;
+    size_t buf_k = std::min(static_cast<size_t>(topk), tar_k + total_k);
+    ResultIds buf_ids(nq * buf_k, -1);
+    ResultDistances buf_distances(nq * buf_k, 0.0);
+
+    // k-way merge, heap top is the best candidate among all sources
+    using Candidate = std::pair<float, size_t>;
+    auto worse = [ascending](const Candidate& left, const Candidate& right) {
+        return ascending ? left.first > right.first : left.first < right.first;
+    };
+
+#pragma omp parallel for if (nq > 1)
+    for (int64_t i = 0; i < static_cast<int64_t>(nq); ++i) {
+        std::vector<size_t> cursors(sources.size(), 0);
+        std::vector<Candidate> heap;
+        heap.reserve(sources.size());
+        for (size_t s = 0; s < sources.size(); ++s) {
+            heap.emplace_back(sources[s]->distances_[i * topk], s);
+        }
+        std::make_heap(heap.begin(), heap.end(), worse);
+
+        size_t buf_offset = i * buf_k;
+        size_t buf_k_j = 0;
+        while (buf_k_j < buf_k && !heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), worse);
+            size_t s = heap.back().second;
+            heap.pop_back();
+
+            size_t src_idx = i * topk + cursors[s];
+            buf_ids[buf_offset + buf_k_j] = sources[s]->ids_[src_idx];
+            buf_distances[buf_offset + buf_k_j] = sources[s]->distances_[src_idx];
+            buf_k_j++;
+
+            if (++cursors[s] < sources[s]->k_) {
+                heap.emplace_back(sources[s]->distances_[src_idx + 1], s);
+                std::push_heap(heap.begin(), heap.end(), worse);
+            }
+        }
+
+        for (size_t tar_k_j = 0; buf_k_j < buf_k && tar_k_j < tar_k; ++buf_k_j, ++tar_k_j) {
+            buf_ids[buf_offset + buf_k_j] = result_ids[i * tar_k + tar_k_j];
+            buf_distances[buf_offset + buf_k_j] = result_distances[i * tar_k + tar_k_j];
+        }
+    }
+
+    result_ids.swap(buf_ids);
+    result_distances.swap(buf_distances);
+}
+
 }  // namespace scheduler
 }  // namespace milvus
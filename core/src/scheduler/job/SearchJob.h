@@ -19,6 +19,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -40,14 +41,16 @@ using Id2IndexMap = std::unordered_map<size_t, SegmentSchemaPtr>;
 using ResultIds = engine::ResultIds;
 using ResultDistances = engine::ResultDistances;
 
+using SearchTaskResult = engine::TopkResult;
+using SearchTaskResultMap = engine::TopkResultMap;
+
 class SearchJob : public Job {
  public:
+    // general_query filters the entities searched by its term and range queries, if given;
+    // deleted_ids are the deletes not applied to the segments yet, each segment excludes the ones it holds
     SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, const milvus::json& extra_params,
-              const engine::VectorsData& vectors);
-
-    SearchJob(const std::shared_ptr<server::Context>& context, query::GeneralQueryPtr general_query,
-              std::unordered_map<std::string, engine::meta::hybrid::DataType>& attr_type,
-              const engine::VectorsData& vectorsData);
+              const engine::VectorsData& vectors, query::GeneralQueryPtr general_query = nullptr,
+              std::unordered_set<engine::IDNumber> deleted_ids = {});
 
  public:
     bool
@@ -59,6 +62,20 @@ class SearchJob : public Job {
     void
     SearchDone(size_t index_id);
 
+    /*
+     * Slot owned by the search task of index_id;
+     * Slots are created by AddIndexFile(), so tasks can fill them concurrently without lock;
+     */
+    SearchTaskResult&
+    GetTaskResult(size_t index_id);
+
+    /*
+     * Add result searched outside the scheduler, such as the unflushed insert buffers;
+     * Must be called before the job is put into scheduler;
+     */
+    void
+    AddTaskResult(size_t index_id, SearchTaskResult& task_result);
+
     ResultIds&
     GetResultIds();
 
@@ -71,6 +88,13 @@ class SearchJob : public Job {
     json
     Dump() const override;
 
+    /*
+     * Merge results of all tasks into result ids and distances;
+     */
+    static void
+    ReduceTaskResults(SearchTaskResultMap& task_results, uint64_t nq, uint64_t topk, ResultIds& result_ids,
+                      ResultDistances& result_distances);
+
  public:
     const std::shared_ptr<server::Context>&
     GetContext() const;
@@ -105,19 +129,14 @@ class SearchJob : public Job {
         return mutex_;
     }
 
-    query::GeneralQueryPtr
-    general_query() {
+    const query::GeneralQueryPtr&
+    general_query() const {
         return general_query_;
     }
 
-    std::unordered_map<std::string, engine::meta::hybrid::DataType>&
-    attr_type() {
-        return attr_type_;
-    }
-
-    uint64_t&
-    vector_count() {
-        return vector_count_;
+    const std::unordered_set<engine::IDNumber>&
+    deleted_ids() const {
+        return deleted_ids_;
     }
 
  private:
@@ -129,14 +148,14 @@ class SearchJob : public Job {
     const engine::VectorsData& vectors_;
 
     Id2IndexMap index_files_;
+    SearchTaskResultMap task_results_;
     // TODO: column-base better ?
     ResultIds result_ids_;
     ResultDistances result_distances_;
     Status status_;
 
     query::GeneralQueryPtr general_query_;
-    std::unordered_map<std::string, engine::meta::hybrid::DataType> attr_type_;
-    uint64_t vector_count_;
+    std::unordered_set<engine::IDNumber> deleted_ids_;
 
     std::mutex mutex_;
     std::condition_variable cv_;
@@ -10,7 +10,15 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "scheduler/resource/CpuResource.h"
+#include "cache/CpuCacheMgr.h"
+#include "config/Config.h"
+#include "scheduler/job/SearchJob.h"
+#include "utils/CommonUtil.h"
 
+#include <omp.h>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
 #include <utility>
 
 namespace milvus {
@@ -24,6 +32,32 @@ operator<<(std::ostream& out, const CpuResource& resource) {
 
 CpuResource::CpuResource(std::string name, uint64_t device_id, bool enable_executor)
     : Resource(std::move(name), ResourceType::CPU, device_id, enable_executor) {
+    int64_t executor_num = 0;
+    server::Config& config = server::Config::GetInstance();
+    config.GetEngineConfigSearchExecutorNum(executor_num);
+    if (executor_num <= 0) {
+        // same as the default omp thread number
+        int64_t sys_thread_cnt = 8;
+        server::CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+        executor_num = static_cast<int64_t>(ceil(sys_thread_cnt * 0.5));
+    }
+    executor_num_ = std::max<int64_t>(1, executor_num);
+
+    int64_t loader_num = 1;
+    config.GetEngineConfigSearchLoaderNum(loader_num);
+    loader_num_ = std::max<int64_t>(1, loader_num);
+
+    int64_t prefetch_depth = 0;
+    config.GetEngineConfigSearchPrefetchDepth(prefetch_depth);
+    prefetch_depth_ = std::max<int64_t>(0, prefetch_depth);
+}
+
+uint64_t
+CpuResource::LoadBudget() {
+    // prefetched segments stay within half of the cpu cache, so they never evict each other
+    // or the segments being searched
+    auto capacity = cache::CpuCacheMgr::GetInstance()->CacheCapacity();
+    return capacity > 0 ? capacity / 2 : Resource::LoadBudget();
 }
 
 void
@@ -33,8 +67,57 @@ CpuResource::LoadFile(TaskPtr task) {
 
 void
 CpuResource::Process(TaskPtr task) {
+    if (executor_num_ <= 1 || task->Type() != TaskType::SearchTask) {
+        task->Execute();
+        return;
+    }
+
+    uint64_t nq = 0;
+    if (auto job = task->job_.lock()) {
+        nq = std::static_pointer_cast<SearchJob>(job)->nq();
+    }
+
+    // a task with enough queries asks for all omp threads, it gets the ones that are free,
+    // but never less than an equal share, so it neither waits for the small tasks to drain nor starves them
+    int32_t omp_thread_num = omp_get_max_threads();
+    auto share = std::max<int32_t>(1, omp_thread_num / static_cast<int32_t>(executor_num_));
+    auto wanted = (nq >= static_cast<uint64_t>(omp_thread_num)) ? omp_thread_num : share;
+    ThreadsGrant grant(*this, share, wanted);
     task->Execute();
 }
 
+CpuResource::ThreadsGrant::ThreadsGrant(CpuResource& resource, int32_t min_num, int32_t max_num)
+    : resource_(resource), omp_thread_num_(omp_get_max_threads()) {
+    granted_ = resource_.AcquireThreads(min_num, max_num);
+    // omp_set_num_threads() only affects the calling executor thread
+    omp_set_num_threads(granted_);
+}
+
+CpuResource::ThreadsGrant::~ThreadsGrant() {
+    omp_set_num_threads(omp_thread_num_);
+    resource_.ReleaseThreads(granted_);
+}
+
+int32_t
+CpuResource::AcquireThreads(int32_t min_num, int32_t max_num) {
+    std::unique_lock<std::mutex> lock(threads_mutex_);
+    if (free_threads_ < 0) {
+        free_threads_ = omp_get_max_threads();
+    }
+    threads_cv_.wait(lock, [&] { return free_threads_ >= min_num; });
+    auto granted = std::min(max_num, free_threads_);
+    free_threads_ -= granted;
+    return granted;
+}
+
+void
+CpuResource::ReleaseThreads(int32_t num) {
+    {
+        std::lock_guard<std::mutex> lock(threads_mutex_);
+        free_threads_ += num;
+    }
+    threads_cv_.notify_all();
+}
+
 }  // namespace scheduler
 }  // namespace milvus
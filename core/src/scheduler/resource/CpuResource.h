@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <string>
 
 #include "Resource.h"
@@ -31,6 +33,44 @@ class CpuResource : public Resource {
 
     void
     Process(TaskPtr task) override;
+
+    uint64_t
+    LoadBudget() override;
+
+ private:
+    // takes at least min_num and at most max_num of the free omp threads, waits until min_num are free
+    int32_t
+    AcquireThreads(int32_t min_num, int32_t max_num);
+
+    void
+    ReleaseThreads(int32_t num);
+
+    // holds the omp threads granted to the executor thread, gives them back even if the task throws
+    class ThreadsGrant {
+     public:
+        ThreadsGrant(CpuResource& resource, int32_t min_num, int32_t max_num);
+
+        ~ThreadsGrant();
+
+        ThreadsGrant(const ThreadsGrant&) = delete;
+
+        ThreadsGrant&
+        operator=(const ThreadsGrant&) = delete;
+
+     private:
+        CpuResource& resource_;
+        int32_t omp_thread_num_;
+        int32_t granted_;
+    };
+
+ private:
+    /*
+     * Search tasks with small nq run in parallel across segments, each with a share of omp threads;
+     * Search tasks with large nq take all the free omp threads, parallel across queries;
+     */
+    std::mutex threads_mutex_;
+    std::condition_variable threads_cv_;
+    int32_t free_threads_ = -1;
 };
 
 }  // namespace scheduler
@@ -57,20 +57,38 @@ Resource::Resource(std::string name, ResourceType type, uint64_t device_id, bool
 void
 Resource::Start() {
     running_ = true;
-    loader_thread_ = std::thread(&Resource::loader_function, this);
+    for (uint64_t i = 0; i < loader_num_; ++i) {
+        loader_threads_.emplace_back(&Resource::loader_function, this);
+    }
     if (enable_executor_) {
-        executor_thread_ = std::thread(&Resource::executor_function, this);
+        for (uint64_t i = 0; i < executor_num_; ++i) {
+            executor_threads_.emplace_back(&Resource::executor_function, this);
+        }
     }
 }
 
 void
 Resource::Stop() {
     running_ = false;
-    WakeupLoader();
-    loader_thread_.join();
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        load_flag_ = true;
+    }
+    load_cv_.notify_all();
+    for (auto& loader_thread : loader_threads_) {
+        loader_thread.join();
+    }
+    loader_threads_.clear();
     if (enable_executor_) {
-        WakeupExecutor();
-        executor_thread_.join();
+        {
+            std::lock_guard<std::mutex> lock(exec_mutex_);
+            exec_flag_ = true;
+        }
+        exec_cv_.notify_all();
+        for (auto& executor_thread : executor_threads_) {
+            executor_thread.join();
+        }
+        executor_threads_.clear();
     }
 }
 
@@ -99,10 +117,13 @@ Resource::Dump() const {
         {"name", name_},
         {"type", ToString(type_)},
         {"task_average_cost", TaskAvgCost()},
-        {"task_total_cost", total_cost_},
-        {"total_tasks", total_task_},
+        {"task_total_cost", total_cost_.load()},
+        {"total_tasks", total_task_.load()},
         {"running", running_},
         {"enable_executor", enable_executor_},
+        {"executor_num", executor_num_},
+        {"loader_num", loader_num_},
+        {"prefetch_depth", prefetch_depth_},
     };
     return ret;
 }
@@ -112,14 +133,34 @@ Resource::NumOfTaskToExec() {
     return task_table_.TaskToExecute();
 }
 
+uint64_t
+Resource::LoadBudget() {
+    return std::numeric_limits<uint64_t>::max();
+}
+
 TaskTableItemPtr
 Resource::pick_task_load() {
-    auto indexes = task_table_.PickToLoad(10);
+    // keep one loaded task for each executor plus prefetch_depth_ more, within the memory budget,
+    // loaders pick under a lock since picking moves the table front
+    std::lock_guard<std::mutex> lock(pick_load_mutex_);
+    auto indexes = task_table_.PickToLoad(10, executor_num_ + prefetch_depth_, LoadBudget());
     for (auto index : indexes) {
+        // a build index task takes its slot under the pick lock, so that loaders don't go past the limit
+        bool take_build_slot = task_table_[index]->get_task()->Type() == TaskType::BuildIndexTask && name() == "cpu";
+        if (take_build_slot && !BuildMgrInst::GetInstance()->Take()) {
+            continue;
+        }
+
         // try to set one task loading, then return
         if (task_table_.Load(index)) {
+            if (take_build_slot) {
+                LOG_SERVER_DEBUG_ << name() << " load BuildIndexTask";
+            }
             return task_table_.at(index);
         }
+        if (take_build_slot) {
+            BuildMgrInst::GetInstance()->Put();
+        }
         // else try next
     }
     return nullptr;
@@ -158,7 +199,7 @@ Resource::loader_function() {
     SetThreadName("taskloader_th");
     while (running_) {
         std::unique_lock<std::mutex> lock(load_mutex_);
-        load_cv_.wait(lock, [&] { return load_flag_; });
+        load_cv_.wait(lock, [&] { return load_flag_ || !running_; });
         load_flag_ = false;
         lock.unlock();
         while (true) {
@@ -166,9 +207,9 @@ Resource::loader_function() {
             if (task_item == nullptr) {
                 break;
             }
-            if (task_item->get_task()->Type() == TaskType::BuildIndexTask && name() == "cpu") {
-                BuildMgrInst::GetInstance()->Take();
-                LOG_SERVER_DEBUG_ << name() << " load BuildIndexTask";
+            if (loader_num_ > 1) {
+                // pass the wakeup to an idle loader, segments are read in parallel
+                WakeupLoader();
             }
             LoadFile(task_item->get_task());
             task_item->Loaded();
@@ -199,7 +240,7 @@ Resource::executor_function() {
     }
     while (running_) {
         std::unique_lock<std::mutex> lock(exec_mutex_);
-        exec_cv_.wait(lock, [&] { return exec_flag_; });
+        exec_cv_.wait(lock, [&] { return exec_flag_ || !running_; });
         exec_flag_ = false;
         lock.unlock();
         while (true) {
@@ -207,6 +248,11 @@ Resource::executor_function() {
             if (task_item == nullptr) {
                 break;
             }
+            if (executor_num_ > 1) {
+                // pass the wakeup to an idle executor, there might be more loaded tasks
+                WakeupExecutor();
+            }
+
             auto start = get_current_timestamp();
             Process(task_item->get_task());
             task_item->set_task(std::move(FinishedTask::Create(task_item->get_task())));
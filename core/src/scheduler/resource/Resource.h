@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -102,6 +103,16 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
         return enable_executor_;
     }
 
+    inline uint64_t
+    NumOfExecutor() const {
+        return executor_num_;
+    }
+
+    inline uint64_t
+    NumOfLoader() const {
+        return loader_num_;
+    }
+
     // TODO(wxyu): const
     uint64_t
     NumOfTaskToExec();
@@ -140,6 +151,12 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     virtual void
     Process(TaskPtr task) = 0;
 
+    /*
+     * Max bytes of tasks loading or loaded but not executed yet;
+     */
+    virtual uint64_t
+    LoadBudget();
+
  private:
     /*
      * Pick one task to load;
@@ -172,24 +189,32 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     uint64_t device_id_;
     std::string name_;
 
+    // number of executor threads, set by inherit class before Start()
+    uint64_t executor_num_ = 1;
+
+    // number of loader threads and tasks loaded ahead of the executors, set by inherit class before Start()
+    uint64_t loader_num_ = 1;
+    uint64_t prefetch_depth_ = 0;
+
  private:
     ResourceType type_;
 
     TaskTable task_table_;
 
-    uint64_t total_cost_ = 0;
-    uint64_t total_task_ = 0;
+    std::atomic<uint64_t> total_cost_{0};
+    std::atomic<uint64_t> total_task_{0};
 
     std::function<void(EventPtr)> subscriber_ = nullptr;
 
     bool running_ = false;
     bool enable_executor_ = true;
-    std::thread loader_thread_;
-    std::thread executor_thread_;
+    std::vector<std::thread> loader_threads_;
+    std::vector<std::thread> executor_threads_;
 
     bool load_flag_ = false;
     bool exec_flag_ = false;
     std::mutex load_mutex_;
+    std::mutex pick_load_mutex_;
     std::mutex exec_mutex_;
     std::condition_variable load_cv_;
     std::condition_variable exec_cv_;
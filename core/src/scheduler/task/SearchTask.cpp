@@ -228,7 +228,7 @@ XSearchTask::Execute() {
         }
 
         // step 1: allocate memory
-        query::GeneralQueryPtr general_query = search_job->general_query();
+        const query::GeneralQueryPtr& general_query = search_job->general_query();
 
         uint64_t nq = search_job->nq();
         uint64_t topk = search_job->topk();
@@ -284,40 +284,27 @@ XSearchTask::Execute() {
             // step 2: search
             bool hybrid = std::dynamic_pointer_cast<SpecResLabel>(label_)->IsHybrid();
             Status s;
-#if 0
             if (general_query != nullptr) {
-                std::unordered_map<std::string, engine::DataType> types;
-                auto attr_type = search_job->attr_type();
-                auto type_it = attr_type.begin();
-                for (; type_it != attr_type.end(); type_it++) {
-                    types.insert(std::make_pair(type_it->first, (engine::DataType)(type_it->second)));
-                }
-                faiss::ConcurrentBitsetPtr bitset;
-                s = index_engine_->ExecBinaryQuery(general_query, bitset, types, nq, topk, output_distance, output_ids);
-
+                bool all_filtered = false;
+                s = index_engine_->ExecBinaryQuery(general_query, all_filtered);
                 if (!s.ok()) {
                     search_job->GetStatus() = s;
                     search_job->SearchDone(index_id_);
                     return;
                 }
-
-                auto spec_k = file_->row_count_ < topk ? file_->row_count_ : topk;
-                if (spec_k == 0) {
-                    LOG_ENGINE_WARNING_ << "Searching in an empty file. file location = " << file_->location_;
-                } else {
-                    std::unique_lock<std::mutex> lock(search_job->mutex());
-                    search_job->vector_count() = nq;
-                    XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
-                                                      search_job->GetResultIds(), search_job->GetResultDistances());
-
-                    if (search_job->GetResultIds().empty()) {
-                        LOG_ENGINE_ERROR_ << "Result reduce error: result id array is empty";
-                    }
+                if (all_filtered) {
+                    // no entity of the segment matches, leave the result slot empty
+                    search_job->SearchDone(index_id_);
+                    return;
                 }
+            }
+            s = index_engine_->ExecDeletedIds(search_job->deleted_ids());
+            if (!s.ok()) {
+                search_job->GetStatus() = s;
                 search_job->SearchDone(index_id_);
                 return;
             }
-#endif
+
             if (!vectors.float_data_.empty()) {
                 s = index_engine_->Search(nq, vectors.float_data_.data(), topk, extra_params, output_distance.data(),
                                           output_ids.data(), hybrid);
@@ -343,16 +330,14 @@ XSearchTask::Execute() {
                 LOG_ENGINE_WARNING_ << LogOut("[%s][%ld] Searching in an empty file. file location = %s", "search", 0,
                                               file_->location_.c_str());
             } else {
-                std::unique_lock<std::mutex> lock(search_job->mutex());
-                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
-                                                  search_job->GetResultIds(), search_job->GetResultDistances());
-                LOG_ENGINE_DEBUG_ << "Merged result: "
-                                  << "nq = " << nq << ", topk = " << topk << ", len of ids = " << output_ids.size()
-                                  << ", len of distance = " << output_distance.size();
-
-                if (search_job->GetResultIds().empty()) {
-                    LOG_ENGINE_ERROR_ << "Result reduce error: result id array is empty!";
-                }
+                // the task owns its result slot, results are merged once all tasks finished
+                SearchTaskResult& task_result = search_job->GetTaskResult(index_id_);
+                task_result.ids_.swap(output_ids);
+                task_result.distances_.swap(output_distance);
+                task_result.k_ = spec_k;
+                task_result.ascending_ = ascending_reduce;
+                LOG_ENGINE_DEBUG_ << "Task result: "
+                                  << "nq = " << nq << ", topk = " << topk << ", k = " << spec_k;
             }
 
             // span = rc.RecordSection(hdr + ", reduce topk");
@@ -437,6 +422,11 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     tar_distances.swap(buf_distances);
 }
 
+uint64_t
+XSearchTask::LoadSize() const {
+    return file_ ? file_->file_size_ : 0;
+}
+
 const std::string&
 XSearchTask::GetLocation() const {
     return file_->location_;
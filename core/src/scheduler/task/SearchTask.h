@@ -33,6 +33,9 @@ class XSearchTask : public Task {
     void
     Execute() override;
 
+    uint64_t
+    LoadSize() const override;
+
  public:
     static void
     MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
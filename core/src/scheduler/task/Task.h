@@ -73,6 +73,14 @@ class Task {
     virtual void
     Execute() = 0;
 
+    /*
+     * Estimated memory held by the task once loaded, 0 if unknown;
+     */
+    virtual uint64_t
+    LoadSize() const {
+        return 0;
+    }
+
  public:
     Path task_path_;
     scheduler::JobWPtr job_;
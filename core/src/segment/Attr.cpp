@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/Attr.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace milvus {
+namespace segment {
+
+namespace {
+
+// NaN is never taken as min or max, it matches no range anyway
+template <typename T, typename W>
+void
+MergeMinMax(const uint8_t* data, size_t count, W& min, W& max, bool& has_value) {
+    using limits = std::numeric_limits<T>;
+    auto values = reinterpret_cast<const T*>(data);
+    T lo = limits::has_infinity ? limits::infinity() : limits::max();
+    T hi = limits::has_infinity ? -limits::infinity() : limits::lowest();
+    for (size_t i = 0; i < count; ++i) {
+        lo = values[i] < lo ? values[i] : lo;
+        hi = values[i] > hi ? values[i] : hi;
+    }
+    if (count == 0) {
+        return;
+    }
+    if (!has_value) {
+        min = lo;
+        max = hi;
+        has_value = true;
+    } else {
+        min = std::min(min, static_cast<W>(lo));
+        max = std::max(max, static_cast<W>(hi));
+    }
+}
+
+void
+MergeZoneMap(engine::DataType type, const uint8_t* data, size_t count, ZoneMap& zone_map, bool& has_value) {
+    switch (type) {
+        case engine::DataType::INT8:
+            MergeMinMax<int8_t>(data, count, zone_map.int_min_, zone_map.int_max_, has_value);
+            break;
+        case engine::DataType::INT16:
+            MergeMinMax<int16_t>(data, count, zone_map.int_min_, zone_map.int_max_, has_value);
+            break;
+        case engine::DataType::INT32:
+            MergeMinMax<int32_t>(data, count, zone_map.int_min_, zone_map.int_max_, has_value);
+            break;
+        case engine::DataType::INT64:
+            MergeMinMax<int64_t>(data, count, zone_map.int_min_, zone_map.int_max_, has_value);
+            break;
+        case engine::DataType::FLOAT:
+            MergeMinMax<float>(data, count, zone_map.float_min_, zone_map.float_max_, has_value);
+            break;
+        case engine::DataType::DOUBLE:
+            MergeMinMax<double>(data, count, zone_map.float_min_, zone_map.float_max_, has_value);
+            break;
+        default:
+            break;
+    }
+}
+
+}  // namespace
+
+Attr::Attr(const std::string& name, engine::DataType type) : name_(name), type_(type), nbytes_(DataTypeSize(type)) {
+}
+
+size_t
+Attr::DataTypeSize(engine::DataType type) {
+    switch (type) {
+        case engine::DataType::INT8:
+            return sizeof(int8_t);
+        case engine::DataType::INT16:
+            return sizeof(int16_t);
+        case engine::DataType::INT32:
+            return sizeof(int32_t);
+        case engine::DataType::INT64:
+            return sizeof(int64_t);
+        case engine::DataType::FLOAT:
+            return sizeof(float);
+        case engine::DataType::DOUBLE:
+            return sizeof(double);
+        default:
+            return 0;
+    }
+}
+
+bool
+Attr::IsFloatType(engine::DataType type) {
+    return type == engine::DataType::FLOAT || type == engine::DataType::DOUBLE;
+}
+
+void
+Attr::AddData(const uint8_t* data, size_t count) {
+    auto old_size = data_.size();
+    data_.resize(old_size + count * nbytes_);
+    memcpy(data_.data() + old_size, data, count * nbytes_);
+    bool has_value = HasValue();
+    MergeZoneMap(type_, data, count, zone_map_, has_value);
+    count_ += count;
+}
+
+void
+Attr::AddNulls(size_t count) {
+    data_.resize(data_.size() + count * nbytes_, 0);
+    nulls_.reserve(nulls_.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        nulls_.push_back(count_ + i);
+    }
+    count_ += count;
+    null_count_ += count;
+}
+
+void
+Attr::Append(const Attr& other) {
+    data_.insert(data_.end(), other.data_.begin(), other.data_.end());
+    nulls_.reserve(nulls_.size() + other.nulls_.size());
+    for (auto offset : other.nulls_) {
+        nulls_.push_back(count_ + offset);
+    }
+    bool has_value = HasValue();
+    count_ += other.count_;
+    null_count_ += other.null_count_;
+
+    if (other.HasValue()) {
+        if (!has_value) {
+            zone_map_ = other.zone_map_;
+        } else {
+            zone_map_.int_min_ = std::min(zone_map_.int_min_, other.zone_map_.int_min_);
+            zone_map_.int_max_ = std::max(zone_map_.int_max_, other.zone_map_.int_max_);
+            zone_map_.float_min_ = std::min(zone_map_.float_min_, other.zone_map_.float_min_);
+            zone_map_.float_max_ = std::max(zone_map_.float_max_, other.zone_map_.float_max_);
+        }
+    }
+}
+
+void
+Attr::Erase(const std::vector<offset_t>& offsets) {
+    if (offsets.empty()) {
+        return;
+    }
+
+    // offsets are sorted and unique, as erased from the vectors before
+    std::vector<uint8_t> new_data;
+    new_data.reserve(data_.size());
+    std::vector<offset_t> new_nulls;
+    auto skip = offsets.cbegin();
+    auto null = nulls_.cbegin();
+    size_t new_count = 0;
+    for (size_t i = 0; i < count_; ++i) {
+        bool is_null = (null != nulls_.cend() && (size_t)(*null) == i);
+        if (is_null) {
+            ++null;
+        }
+        if (skip != offsets.cend() && (size_t)(*skip) == i) {
+            ++skip;
+            continue;
+        }
+        if (is_null) {
+            new_nulls.push_back(new_count);
+        }
+        new_data.insert(new_data.end(), data_.begin() + i * nbytes_, data_.begin() + (i + 1) * nbytes_);
+        ++new_count;
+    }
+
+    data_.swap(new_data);
+    nulls_.swap(new_nulls);
+    count_ = new_count;
+    null_count_ = nulls_.size();
+    RebuildZoneMap();
+}
+
+void
+Attr::RebuildZoneMap() {
+    zone_map_ = ZoneMap();
+    bool has_value = false;
+    size_t begin = 0;
+    for (auto offset : nulls_) {
+        MergeZoneMap(type_, data_.data() + begin * nbytes_, offset - begin, zone_map_, has_value);
+        begin = offset + 1;
+    }
+    MergeZoneMap(type_, data_.data() + begin * nbytes_, count_ - begin, zone_map_, has_value);
+}
+
+const std::string&
+Attr::GetName() const {
+    return name_;
+}
+
+engine::DataType
+Attr::GetType() const {
+    return type_;
+}
+
+size_t
+Attr::GetNbytes() const {
+    return nbytes_;
+}
+
+size_t
+Attr::GetCount() const {
+    return count_;
+}
+
+const std::vector<uint8_t>&
+Attr::GetData() const {
+    return data_;
+}
+
+const std::vector<offset_t>&
+Attr::GetNulls() const {
+    return nulls_;
+}
+
+size_t
+Attr::GetNullCount() const {
+    return null_count_;
+}
+
+const ZoneMap&
+Attr::GetZoneMap() const {
+    return zone_map_;
+}
+
+bool
+Attr::HasValue() const {
+    return count_ > null_count_;
+}
+
+void
+Attr::SetContent(size_t count, size_t null_count, std::vector<uint8_t>&& data, std::vector<offset_t>&& nulls,
+                 const ZoneMap& zone_map) {
+    count_ = count;
+    null_count_ = null_count;
+    data_ = std::move(data);
+    nulls_ = std::move(nulls);
+    zone_map_ = zone_map;
+}
+
+size_t
+Attr::Size() const {
+    return data_.size() + nulls_.size() * sizeof(offset_t);
+}
+
+}  // namespace segment
+}  // namespace milvus
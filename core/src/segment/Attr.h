@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "db/engine/ExecutionEngine.h"
+#include "segment/DeletedDocs.h"
+
+namespace milvus {
+namespace segment {
+
+// min and max of the values of a column, integers are widened to int64 and floating points to double,
+// lets a query skip a segment without reading the values
+struct ZoneMap {
+    int64_t int_min_ = 0;
+    int64_t int_max_ = 0;
+    double float_min_ = 0.0;
+    double float_max_ = 0.0;
+};
+
+// values of an attribute field of the segment stored as one column, the n-th value belongs to the n-th vector;
+// rows added without the field hold nulls, which match no term or range query
+class Attr {
+ public:
+    Attr(const std::string& name, engine::DataType type);
+
+    // bytes of a value of type, 0 if the type can't be stored as an attribute column
+    static size_t
+    DataTypeSize(engine::DataType type);
+
+    static bool
+    IsFloatType(engine::DataType type);
+
+    // append count values, data holds count * GetNbytes() bytes
+    void
+    AddData(const uint8_t* data, size_t count);
+
+    // append count nulls
+    void
+    AddNulls(size_t count);
+
+    // append all values and nulls of other, which has the same type
+    void
+    Append(const Attr& other);
+
+    void
+    Erase(const std::vector<offset_t>& offsets);
+
+    const std::string&
+    GetName() const;
+
+    engine::DataType
+    GetType() const;
+
+    size_t
+    GetNbytes() const;
+
+    size_t
+    GetCount() const;
+
+    const std::vector<uint8_t>&
+    GetData() const;
+
+    // sorted offsets of the nulls, their values in GetData() are zero
+    const std::vector<offset_t>&
+    GetNulls() const;
+
+    size_t
+    GetNullCount() const;
+
+    const ZoneMap&
+    GetZoneMap() const;
+
+    // whether the column holds a non-null value, the zone map is meaningless otherwise
+    bool
+    HasValue() const;
+
+    // set by the codec, data and nulls are taken over, they are left empty when only the zone map is read
+    void
+    SetContent(size_t count, size_t null_count, std::vector<uint8_t>&& data, std::vector<offset_t>&& nulls,
+               const ZoneMap& zone_map);
+
+    size_t
+    Size() const;
+
+    // No copy and move
+    Attr(const Attr&) = delete;
+    Attr(Attr&&) = delete;
+
+    Attr&
+    operator=(const Attr&) = delete;
+    Attr&
+    operator=(Attr&&) = delete;
+
+ private:
+    void
+    RebuildZoneMap();
+
+ private:
+    std::string name_;
+    engine::DataType type_;
+    size_t nbytes_;
+    size_t count_ = 0;
+    size_t null_count_ = 0;
+    std::vector<uint8_t> data_;
+    std::vector<offset_t> nulls_;
+    ZoneMap zone_map_;
+};
+
+using AttrPtr = std::shared_ptr<Attr>;
+
+}  // namespace segment
+}  // namespace milvus
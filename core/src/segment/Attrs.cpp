@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/Attrs.h"
+
+#include "utils/Log.h"
+
+namespace milvus {
+namespace segment {
+
+AttrPtr
+Attrs::GetColumn(const std::string& name, engine::DataType type, size_t row_offset) {
+    AttrPtr attr;
+    auto it = attrs_.find(name);
+    if (it == attrs_.end()) {
+        attr = std::make_shared<Attr>(name, type);
+        attrs_.insert(std::make_pair(name, attr));
+    } else {
+        attr = it->second;
+        if (attr->GetType() != type) {
+            LOG_ENGINE_WARNING_ << "Attribute " << name << " of type " << (int32_t)type << " mismatch with type "
+                                << (int32_t)attr->GetType() << " in segment, stored as nulls";
+            return nullptr;
+        }
+    }
+
+    if (attr->GetCount() < row_offset) {
+        attr->AddNulls(row_offset - attr->GetCount());
+    }
+    return attr;
+}
+
+void
+Attrs::AddAttrs(size_t row_offset, const std::unordered_map<std::string, engine::DataType>& attr_types,
+                const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data, size_t offset, size_t count) {
+    for (auto& pair : attr_data) {
+        auto type_it = attr_types.find(pair.first);
+        if (type_it == attr_types.end()) {
+            continue;
+        }
+        auto attr = GetColumn(pair.first, type_it->second, row_offset);
+        if (attr != nullptr) {
+            attr->AddData(pair.second.data() + offset * attr->GetNbytes(), count);
+        }
+    }
+}
+
+void
+Attrs::Append(size_t row_offset, const Attrs& other) {
+    for (auto& pair : other.attrs_) {
+        auto attr = GetColumn(pair.first, pair.second->GetType(), row_offset);
+        if (attr != nullptr) {
+            attr->Append(*pair.second);
+        }
+    }
+}
+
+void
+Attrs::Pad(size_t row_count) {
+    for (auto& pair : attrs_) {
+        auto& attr = pair.second;
+        if (attr->GetCount() < row_count) {
+            attr->AddNulls(row_count - attr->GetCount());
+        }
+    }
+}
+
+void
+Attrs::Erase(const std::vector<offset_t>& offsets) {
+    for (auto& pair : attrs_) {
+        pair.second->Erase(offsets);
+    }
+}
+
+void
+Attrs::AddAttr(const AttrPtr& attr) {
+    attrs_[attr->GetName()] = attr;
+}
+
+AttrPtr
+Attrs::GetAttr(const std::string& name) const {
+    auto it = attrs_.find(name);
+    return it == attrs_.end() ? nullptr : it->second;
+}
+
+const std::unordered_map<std::string, AttrPtr>&
+Attrs::GetAttrs() const {
+    return attrs_;
+}
+
+bool
+Attrs::Empty() const {
+    return attrs_.empty();
+}
+
+int64_t
+Attrs::Size() {
+    int64_t size = sizeof(Attrs);
+    for (auto& pair : attrs_) {
+        size += pair.first.size() + sizeof(Attr) + pair.second->Size();
+    }
+    return size;
+}
+
+}  // namespace segment
+}  // namespace milvus
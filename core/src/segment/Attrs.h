@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/DataObj.h"
+#include "segment/Attr.h"
+
+namespace milvus {
+namespace segment {
+
+// attribute columns of a segment keyed by field name, rows are aligned with the vectors of the segment;
+// a field given with another type than the one of its column in the segment is stored as nulls
+class Attrs : public cache::DataObj {
+ public:
+    Attrs() = default;
+
+    // add rows [offset, offset + count) of a batch as the rows starting at row_offset of the segment,
+    // attr_data of a field holds the values of all the rows of the batch
+    void
+    AddAttrs(size_t row_offset, const std::unordered_map<std::string, engine::DataType>& attr_types,
+             const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data, size_t offset, size_t count);
+
+    // add all the rows of other as the rows starting at row_offset of the segment
+    void
+    Append(size_t row_offset, const Attrs& other);
+
+    // fill every column with nulls up to row_count rows
+    void
+    Pad(size_t row_count);
+
+    void
+    Erase(const std::vector<offset_t>& offsets);
+
+    void
+    AddAttr(const AttrPtr& attr);
+
+    // nullptr if the segment has no such field
+    AttrPtr
+    GetAttr(const std::string& name) const;
+
+    const std::unordered_map<std::string, AttrPtr>&
+    GetAttrs() const;
+
+    bool
+    Empty() const;
+
+    int64_t
+    Size() override;
+
+    // No copy and move
+    Attrs(const Attrs&) = delete;
+    Attrs(Attrs&&) = delete;
+
+    Attrs&
+    operator=(const Attrs&) = delete;
+    Attrs&
+    operator=(Attrs&&) = delete;
+
+ private:
+    // column of name padded with nulls up to row_offset rows, nullptr if the column has another type
+    AttrPtr
+    GetColumn(const std::string& name, engine::DataType type, size_t row_offset);
+
+ private:
+    std::unordered_map<std::string, AttrPtr> attrs_;
+};
+
+using AttrsPtr = std::shared_ptr<Attrs>;
+
+}  // namespace segment
+}  // namespace milvus
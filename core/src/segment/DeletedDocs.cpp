@@ -26,6 +26,12 @@ DeletedDocs::DeletedDocs(std::vector<offset_t>&& deleted_doc_offsets) : deleted_
 void
 DeletedDocs::AddDeletedDoc(offset_t offset) {
     deleted_doc_offsets_.emplace_back(offset);
+    if (!bitmap_outdated_) {
+        if ((size_t)offset >= deleted_bitmap_.size()) {
+            deleted_bitmap_.resize(offset + 1, false);
+        }
+        deleted_bitmap_[offset] = true;
+    }
 }
 
 const std::vector<offset_t>&
@@ -35,6 +41,7 @@ DeletedDocs::GetDeletedDocs() const {
 
 std::vector<offset_t>&
 DeletedDocs::GetMutableDeletedDocs() {
+    bitmap_outdated_ = true;
     return deleted_doc_offsets_;
 }
 
@@ -43,5 +50,20 @@ DeletedDocs::GetSize() const {
     return deleted_doc_offsets_.size();
 }
 
+bool
+DeletedDocs::IsDeleted(offset_t offset) {
+    if (bitmap_outdated_) {
+        deleted_bitmap_.clear();
+        for (auto deleted_offset : deleted_doc_offsets_) {
+            if ((size_t)deleted_offset >= deleted_bitmap_.size()) {
+                deleted_bitmap_.resize(deleted_offset + 1, false);
+            }
+            deleted_bitmap_[deleted_offset] = true;
+        }
+        bitmap_outdated_ = false;
+    }
+    return offset >= 0 && (size_t)offset < deleted_bitmap_.size() && deleted_bitmap_[offset];
+}
+
 }  // namespace segment
 }  // namespace milvus
@@ -43,6 +43,10 @@ class DeletedDocs {
     size_t
     GetSize() const;
 
+    // answered by a bitmap of the offsets, rebuilt after the offsets are modified through GetMutableDeletedDocs
+    bool
+    IsDeleted(offset_t offset);
+
     // No copy and move
     DeletedDocs(const DeletedDocs&) = delete;
     DeletedDocs(DeletedDocs&&) = delete;
@@ -54,6 +58,8 @@ class DeletedDocs {
 
  private:
     std::vector<offset_t> deleted_doc_offsets_;
+    std::vector<bool> deleted_bitmap_;
+    bool bitmap_outdated_ = true;
 };
 
 using DeletedDocsPtr = std::shared_ptr<DeletedDocs>;
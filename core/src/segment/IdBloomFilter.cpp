@@ -20,49 +20,111 @@
 #include "utils/Status.h"
 
 #include <algorithm>
-#include <string>
 
 namespace milvus {
 namespace segment {
 
-IdBloomFilter::IdBloomFilter(scaling_bloom_t* bloom_filter) : bloom_filter_(bloom_filter) {
+namespace {
+
+// 16 bits per id keeps the false positive rate of the 8-bit blocked filter around 0.5%
+constexpr int64_t BITS_PER_ID = 16;
+constexpr int64_t BITS_PER_BLOCK = IdBloomFilter::WORDS_PER_BLOCK * 64;
+
+// odd multipliers picking the bit of each word from the low half of the hash
+constexpr uint32_t BLOCK_SALT[IdBloomFilter::WORDS_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                               0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+inline uint64_t
+HashId(doc_id_t uid) {
+    // splitmix64 finalizer
+    auto x = static_cast<uint64_t>(uid);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+inline void
+MakeMask(uint64_t hash, uint64_t* mask) {
+    auto key = static_cast<uint32_t>(hash);
+    for (size_t i = 0; i < IdBloomFilter::WORDS_PER_BLOCK; ++i) {
+        mask[i] = (uint64_t)1 << ((key * BLOCK_SALT[i]) >> 26);
+    }
+}
+
+}  // namespace
+
+IdBloomFilter::IdBloomFilter(int64_t capacity) {
+    block_num_ = std::max<int64_t>(1, (std::max<int64_t>(capacity, 1) * BITS_PER_ID + BITS_PER_BLOCK - 1) /
+                                          BITS_PER_BLOCK);
+    blocks_.resize(block_num_ * WORDS_PER_BLOCK, 0);
+}
+
+IdBloomFilter::IdBloomFilter(std::vector<uint64_t>&& blocks) : blocks_(std::move(blocks)) {
+    block_num_ = blocks_.size() / WORDS_PER_BLOCK;
+}
+
+size_t
+IdBloomFilter::BlockOf(uint64_t hash) const {
+    // map the high half of the hash onto [0, block_num_) without a division
+    return static_cast<size_t>(((hash >> 32) * block_num_) >> 32);
 }
 
-IdBloomFilter::~IdBloomFilter() {
-    if (bloom_filter_) {
-        free_scaling_bloom(bloom_filter_);
+void
+IdBloomFilter::AddHash(uint64_t hash) {
+    uint64_t mask[WORDS_PER_BLOCK];
+    MakeMask(hash, mask);
+    auto block = blocks_.data() + BlockOf(hash) * WORDS_PER_BLOCK;
+    for (size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+        block[i] |= mask[i];
     }
 }
 
-scaling_bloom_t*
-IdBloomFilter::GetBloomFilter() {
-    return bloom_filter_;
+bool
+IdBloomFilter::CheckHash(uint64_t hash) const {
+    uint64_t mask[WORDS_PER_BLOCK];
+    MakeMask(hash, mask);
+    auto block = blocks_.data() + BlockOf(hash) * WORDS_PER_BLOCK;
+    uint64_t missed = 0;
+    for (size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+        missed |= mask[i] & ~block[i];
+    }
+    return missed == 0;
 }
 
 bool
-IdBloomFilter::Check(doc_id_t uid) {
-    if (bloom_filter_ == nullptr) {
+IdBloomFilter::Check(doc_id_t uid) const {
+    if (block_num_ == 0) {
         return true;
     }
+    return CheckHash(HashId(uid));
+}
 
-    std::string s = std::to_string(uid);
-    const std::lock_guard<std::mutex> lock(mutex_);
-    return static_cast<bool>(scaling_bloom_check(bloom_filter_, s.c_str(), s.size()));
+void
+IdBloomFilter::CheckMany(const doc_id_t* uids, size_t n, uint8_t* results) const {
+    if (block_num_ == 0) {
+        std::fill(results, results + n, 1);
+        return;
+    }
+
+    // hash a batch first and prefetch its blocks, so the cache misses of a batch overlap
+    constexpr size_t BATCH = 16;
+    uint64_t hashes[BATCH];
+    for (size_t from = 0; from < n; from += BATCH) {
+        auto to = std::min(n, from + BATCH);
+        for (size_t i = from; i < to; ++i) {
+            hashes[i - from] = HashId(uids[i]);
+            __builtin_prefetch(blocks_.data() + BlockOf(hashes[i - from]) * WORDS_PER_BLOCK);
+        }
+        for (size_t i = from; i < to; ++i) {
+            results[i] = CheckHash(hashes[i - from]) ? 1 : 0;
+        }
+    }
 }
 
 Status
 IdBloomFilter::Add(const std::vector<doc_id_t>& uids) {
-    if (bloom_filter_ == nullptr) {
-        return Status(DB_ERROR, "bloom filter is null pointer");  // bloom filter doesn't work
-    }
-
-    const std::lock_guard<std::mutex> lock(mutex_);
     for (auto uid : uids) {
-        std::string s = std::to_string(uid);
-        if (scaling_bloom_add(bloom_filter_, s.c_str(), s.size(), uid) == -1) {
-            // Counter overflow does not affect bloom filter's normal functionality
-            LOG_ENGINE_WARNING_ << "Warning adding id=" << s << " to bloom filter: 4 bit counter Overflow";
-        }
+        AddHash(HashId(uid));
     }
     return Status::OK();
 }
@@ -70,41 +132,28 @@ IdBloomFilter::Add(const std::vector<doc_id_t>& uids) {
 Status
 IdBloomFilter::Add(const std::vector<doc_id_t>& uids, std::vector<offset_t>& delete_docs) {
     std::sort(delete_docs.begin(), delete_docs.end());
-    for (offset_t i = 0, j = 0; i < uids.size();) {
-        if (j < delete_docs.size() && i >= delete_docs[j]) {
-            j++;
+    size_t j = 0;
+    for (size_t i = 0; i < uids.size(); ++i) {
+        while (j < delete_docs.size() && (size_t)delete_docs[j] < i) {
+            ++j;
+        }
+        if (j < delete_docs.size() && (size_t)delete_docs[j] == i) {
             continue;
         }
 
-        auto uid = uids[i++];
-        std::string s = std::to_string(uid);
-        if (scaling_bloom_add(bloom_filter_, s.c_str(), s.size(), uid) == -1) {
-            // Counter overflow does not affect bloom filter's normal functionality
-            LOG_ENGINE_WARNING_ << "Warning adding id=" << s << " to bloom filter: 4 bit counter Overflow";
-        }
+        AddHash(HashId(uids[i]));
     }
     return Status::OK();
 }
 
-Status
-IdBloomFilter::Remove(doc_id_t uid) {
-    if (bloom_filter_ == nullptr) {
-        return Status(DB_ERROR, "bloom filter is null pointer");  // bloom filter doesn't work
-    }
-
-    std::string s = std::to_string(uid);
-    const std::lock_guard<std::mutex> lock(mutex_);
-    if (scaling_bloom_remove(bloom_filter_, s.c_str(), s.size(), uid) == -1) {
-        // Should never go in here, but just to be safe
-        LOG_ENGINE_WARNING_ << "Warning removing id=" << s << " in bloom filter: Decrementing zero in counter";
-    }
-    return Status::OK();
+const std::vector<uint64_t>&
+IdBloomFilter::GetBlocks() const {
+    return blocks_;
 }
 
 int64_t
 IdBloomFilter::Size() {
-    const std::lock_guard<std::mutex> lock(mutex_);
-    return bloom_size(bloom_filter_);
+    return blocks_.size() * sizeof(uint64_t);
 }
 
 }  // namespace segment
@@ -18,11 +18,9 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 #include <vector>
 
 #include "cache/DataObj.h"
-#include "dablooms/dablooms.h"
 #include "segment/DeletedDocs.h"
 #include "utils/Status.h"
 
@@ -31,17 +29,27 @@ namespace segment {
 
 using doc_id_t = int64_t;
 
+// blocked bloom filter over 64-bit ids, every id maps to one 64-byte block (a cache line) and sets one bit
+// in each of its 8 words, so a check touches a single cache line.
+// bits are only added while the filter is built, a filter shared through cache is read without locking.
+// removing is not supported by a plain bloom filter, a removed id is still reported as maybe present.
+// the filter is built again without the deleted ids when deletes are applied, and a merged or compacted
+// segment gets a new filter from its remaining ids.
 class IdBloomFilter : public cache::DataObj {
  public:
-    explicit IdBloomFilter(scaling_bloom_t* bloom_filter);
+    static constexpr size_t WORDS_PER_BLOCK = 8;
 
-    ~IdBloomFilter();
+    // sized for the expected number of ids
+    explicit IdBloomFilter(int64_t capacity);
 
-    scaling_bloom_t*
-    GetBloomFilter();
+    explicit IdBloomFilter(std::vector<uint64_t>&& blocks);
 
     bool
-    Check(doc_id_t uid);
+    Check(doc_id_t uid) const;
+
+    // results[i] tells whether uids[i] may be present
+    void
+    CheckMany(const doc_id_t* uids, size_t n, uint8_t* results) const;
 
     Status
     Add(const std::vector<doc_id_t>& uids);
@@ -49,8 +57,8 @@ class IdBloomFilter : public cache::DataObj {
     Status
     Add(const std::vector<doc_id_t>& uids, std::vector<offset_t>& delete_docs);
 
-    Status
-    Remove(doc_id_t uid);
+    const std::vector<uint64_t>&
+    GetBlocks() const;
 
     int64_t
     Size() override;
@@ -65,8 +73,18 @@ class IdBloomFilter : public cache::DataObj {
     operator=(IdBloomFilter&&) = delete;
 
  private:
-    scaling_bloom_t* bloom_filter_;
-    std::mutex mutex_;
+    void
+    AddHash(uint64_t hash);
+
+    bool
+    CheckHash(uint64_t hash) const;
+
+    size_t
+    BlockOf(uint64_t hash) const;
+
+ private:
+    std::vector<uint64_t> blocks_;  // WORDS_PER_BLOCK words per block
+    size_t block_num_;
 };
 
 using IdBloomFilterPtr = std::shared_ptr<IdBloomFilter>;
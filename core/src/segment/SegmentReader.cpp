@@ -23,6 +23,7 @@
 #include "cache/CpuCacheMgr.h"
 #include "codecs/default/DefaultCodec.h"
 #include "config/Config.h"
+#include "utils/Exception.h"
 #include "utils/Log.h"
 
 namespace milvus {
@@ -48,6 +49,7 @@ SegmentReader::Load() {
         default_codec.GetVectorsFormat()->read(fs_ptr_, segment_ptr_->vectors_ptr_);
         // default_codec.GetVectorIndexFormat()->read(fs_ptr_, segment_ptr_->vector_index_ptr_);
         default_codec.GetDeletedDocsFormat()->read(fs_ptr_, segment_ptr_->deleted_docs_ptr_);
+        default_codec.GetAttrsFormat()->read(fs_ptr_, segment_ptr_->attrs_ptr_);
     } catch (std::exception& e) {
         return Status(DB_ERROR, e.what());
     }
@@ -83,6 +85,20 @@ SegmentReader::LoadsSingleVector(off_t offset, size_t num_bytes, std::vector<uin
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadsSharedVectors(std::shared_ptr<uint8_t[]>& raw_vectors, size_t& num_bytes) {
+    codec::DefaultCodec default_codec;
+    try {
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetVectorsFormat()->read_shared_vectors(fs_ptr_, raw_vectors, num_bytes);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load raw vectors: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentReader::LoadUids(UidsPtr& uids_ptr) {
     codec::DefaultCodec default_codec;
@@ -98,6 +114,78 @@ SegmentReader::LoadUids(UidsPtr& uids_ptr) {
     return Status::OK();
 }
 
+Status
+SegmentReader::LoadUidIndex(segment::UidIndexPtr& uid_index_ptr) {
+    std::string cache_key = fs_ptr_->operation_ptr_->GetDirectory() + cache::UidIndex_Suffix;
+    uid_index_ptr = std::static_pointer_cast<segment::UidIndex>(cache::CpuCacheMgr::GetInstance()->GetItem(cache_key));
+    if (uid_index_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    UidsPtr uids_ptr;
+    auto status = LoadUids(uids_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    uid_index_ptr = std::make_shared<segment::UidIndex>(*uids_ptr);
+    cache::CpuCacheMgr::GetInstance()->InsertItemIfNotExist(cache_key, uid_index_ptr);
+    return Status::OK();
+}
+
+Status
+SegmentReader::LoadAttrs(segment::AttrsPtr& attrs_ptr) {
+    std::string cache_key = fs_ptr_->operation_ptr_->GetDirectory() + cache::Attrs_Suffix;
+    attrs_ptr = std::static_pointer_cast<segment::Attrs>(cache::CpuCacheMgr::GetInstance()->GetItem(cache_key));
+    if (attrs_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    codec::DefaultCodec default_codec;
+    try {
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsFormat()->read(fs_ptr_, attrs_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load attributes: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+
+    cache::CpuCacheMgr::GetInstance()->InsertItemIfNotExist(cache_key, attrs_ptr);
+    return Status::OK();
+}
+
+Status
+SegmentReader::LoadAttrsZoneMaps(segment::AttrsPtr& attrs_ptr) {
+    // the loaded columns carry their zone maps too
+    std::string directory = fs_ptr_->operation_ptr_->GetDirectory();
+    attrs_ptr = std::static_pointer_cast<segment::Attrs>(
+        cache::CpuCacheMgr::GetInstance()->GetItem(directory + cache::Attrs_Suffix));
+    if (attrs_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    // zone maps are checked by every query with attribute filter, keep them apart from the columns
+    std::string cache_key = directory + cache::ZoneMaps_Suffix;
+    attrs_ptr = std::static_pointer_cast<segment::Attrs>(cache::CpuCacheMgr::GetInstance()->GetItem(cache_key));
+    if (attrs_ptr != nullptr) {
+        return Status::OK();
+    }
+
+    codec::DefaultCodec default_codec;
+    try {
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsFormat()->read_zone_maps(fs_ptr_, attrs_ptr);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to load attribute zone maps: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+        return Status(DB_ERROR, err_msg);
+    }
+
+    cache::CpuCacheMgr::GetInstance()->InsertItemIfNotExist(cache_key, attrs_ptr);
+    return Status::OK();
+}
+
 Status
 SegmentReader::GetSegment(SegmentPtr& segment_ptr) {
     segment_ptr = segment_ptr_;
@@ -129,7 +217,15 @@ SegmentReader::LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr, b
 
         if (id_bloom_filter_ptr == nullptr) {
             fs_ptr_->operation_ptr_->CreateDirectory();
-            default_codec.GetIdBloomFilterFormat()->read(fs_ptr_, id_bloom_filter_ptr);
+            try {
+                default_codec.GetIdBloomFilterFormat()->read(fs_ptr_, id_bloom_filter_ptr);
+            } catch (std::exception& e) {
+                // missing, broken or written in an older format, build it again from uids
+                auto status = RebuildBloomFilter(id_bloom_filter_ptr);
+                if (!status.ok()) {
+                    throw Exception(status.code(), status.message());
+                }
+            }
 
             // add id_bloom_filter into cache
             if (cache_force) {
@@ -146,6 +242,26 @@ SegmentReader::LoadBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr, b
     return Status::OK();
 }
 
+Status
+SegmentReader::RebuildBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr) {
+    UidsPtr uids_ptr;
+    auto status = LoadUids(uids_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+    segment::DeletedDocsPtr deleted_docs_ptr;
+    status = LoadDeletedDocs(deleted_docs_ptr);
+    if (!status.ok()) {
+        return status;
+    }
+
+    codec::DefaultCodec default_codec;
+    default_codec.GetIdBloomFilterFormat()->create(uids_ptr->size(), id_bloom_filter_ptr);
+    id_bloom_filter_ptr->Add(*uids_ptr, deleted_docs_ptr->GetMutableDeletedDocs());
+    LOG_ENGINE_DEBUG_ << "Bloom filter rebuilt in memory for " << fs_ptr_->operation_ptr_->GetDirectory();
+    return Status::OK();
+}
+
 Status
 SegmentReader::LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr) {
     codec::DefaultCodec default_codec;
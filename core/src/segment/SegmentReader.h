@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "segment/Types.h"
+#include "segment/UidIndex.h"
 #include "storage/FSHandler.h"
 #include "utils/Status.h"
 
@@ -45,9 +46,17 @@ class SegmentReader {
     Status
     LoadsSingleVector(off_t offset, size_t num_bytes, std::vector<uint8_t>& raw_vectors);
 
+    // raw vectors without the intermediate copy, they stay valid as long as raw_vectors is referenced
+    Status
+    LoadsSharedVectors(std::shared_ptr<uint8_t[]>& raw_vectors, size_t& num_bytes);
+
     Status
     LoadUids(UidsPtr& uids);
 
+    // load the uid to offset index from cache, build and cache it from the uids file if absent
+    Status
+    LoadUidIndex(segment::UidIndexPtr& uid_index_ptr);
+
     Status
     LoadVectorIndex(const std::string& location, segment::VectorIndexPtr& vector_index_ptr);
 
@@ -57,12 +66,24 @@ class SegmentReader {
     Status
     LoadDeletedDocs(segment::DeletedDocsPtr& deleted_docs_ptr);
 
+    // load the attribute columns from cache, read and cache them if absent
+    Status
+    LoadAttrs(segment::AttrsPtr& attrs_ptr);
+
+    // columns without values if they are not in cache, enough to check the zone maps
+    Status
+    LoadAttrsZoneMaps(segment::AttrsPtr& attrs_ptr);
+
     Status
     GetSegment(SegmentPtr& segment_ptr);
 
     Status
     ReadDeletedDocsSize(size_t& size);
 
+ private:
+    Status
+    RebuildBloomFilter(segment::IdBloomFilterPtr& id_bloom_filter_ptr);
+
  private:
     storage::FSHandlerPtr fs_ptr_;
     SegmentPtr segment_ptr_;
@@ -57,6 +57,14 @@ SegmentWriter::AddVectors(const std::string& name, const uint8_t* data, uint64_t
     return Status::OK();
 }
 
+Status
+SegmentWriter::AddAttrs(const std::unordered_map<std::string, engine::DataType>& attr_types,
+                        const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data, size_t offset,
+                        size_t count) {
+    segment_ptr_->attrs_ptr_->AddAttrs(VectorCount(), attr_types, attr_data, offset, count);
+    return Status::OK();
+}
+
 Status
 SegmentWriter::SetVectorIndex(const milvus::knowhere::VecIndexPtr& index) {
     segment_ptr_->vector_index_ptr_->SetVectorIndex(index);
@@ -83,6 +91,14 @@ SegmentWriter::Serialize() {
 
     recorder.RecordSection("Writing vectors and uids done");
 
+    status = WriteAttrs();
+    if (!status.ok()) {
+        LOG_ENGINE_ERROR_ << "Write attributes fail: " << status.message();
+        return status;
+    }
+
+    recorder.RecordSection("Writing attributes done");
+
     // Write an empty deleted doc
     status = WriteDeletedDocs();
 
@@ -107,6 +123,30 @@ SegmentWriter::WriteVectors() {
     return Status::OK();
 }
 
+Status
+SegmentWriter::WriteAttrs() {
+    auto& attrs = segment_ptr_->attrs_ptr_;
+    if (attrs->Empty()) {
+        return Status::OK();
+    }
+
+    // rows added without some fields hold nulls for them
+    attrs->Pad(VectorCount());
+
+    codec::DefaultCodec default_codec;
+    try {
+        fs_ptr_->operation_ptr_->CreateDirectory();
+        default_codec.GetAttrsFormat()->write(fs_ptr_, attrs);
+    } catch (std::exception& e) {
+        std::string err_msg = "Failed to write attributes: " + std::string(e.what());
+        LOG_ENGINE_ERROR_ << err_msg;
+
+        engine::utils::SendExitSignal();
+        return Status(SERVER_WRITE_ERROR, err_msg);
+    }
+    return Status::OK();
+}
+
 Status
 SegmentWriter::WriteVectorIndex(const std::string& location) {
     if (location.empty()) {
@@ -200,6 +240,10 @@ SegmentWriter::WriteBloomFilter(const IdBloomFilterPtr& id_bloom_filter_ptr) {
     try {
         fs_ptr_->operation_ptr_->CreateDirectory();
         default_codec.GetIdBloomFilterFormat()->write(fs_ptr_, id_bloom_filter_ptr);
+
+        // replace the cached filter, readers holding the old one keep using it
+        std::string cache_key = fs_ptr_->operation_ptr_->GetDirectory() + cache::BloomFilter_Suffix;
+        cache::CpuCacheMgr::GetInstance()->InsertItem(cache_key, id_bloom_filter_ptr);
     } catch (std::exception& e) {
         std::string err_msg = "Failed to write bloom filter: " + std::string(e.what());
         LOG_ENGINE_ERROR_ << err_msg;
@@ -223,7 +267,7 @@ SegmentWriter::GetSegment(SegmentPtr& segment_ptr) {
 }
 
 Status
-SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
+SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name, std::vector<int64_t>* offset_map) {
     if (dir_to_merge == fs_ptr_->operation_ptr_->GetDirectory()) {
         return Status(DB_ERROR, "Cannot Merge Self");
     }
@@ -249,15 +293,33 @@ SegmentWriter::Merge(const std::string& dir_to_merge, const std::string& name) {
 
     recorder.RecordSection("Loading segment");
 
+    auto rows_to_merge = segment_to_merge->vectors_ptr_->GetCount();
+    std::vector<offset_t> offsets_to_delete;
     if (segment_to_merge->deleted_docs_ptr_ != nullptr) {
-        auto offsets_to_delete = segment_to_merge->deleted_docs_ptr_->GetDeletedDocs();
+        offsets_to_delete = segment_to_merge->deleted_docs_ptr_->GetDeletedDocs();
 
         // Erase from raw data
         segment_to_merge->vectors_ptr_->Erase(offsets_to_delete);
+        segment_to_merge->attrs_ptr_->Erase(offsets_to_delete);
     }
 
     recorder.RecordSection("erase");
 
+    if (offset_map != nullptr) {
+        // erase keeps the order of remaining vectors, they are appended after the vectors merged before
+        offset_map->assign(rows_to_merge, -1);
+        auto skip = offsets_to_delete.cbegin();
+        int64_t next_offset = VectorCount();
+        for (size_t i = 0; i < rows_to_merge; ++i) {
+            if (skip != offsets_to_delete.cend() && (size_t)(*skip) == i) {
+                ++skip;
+                continue;
+            }
+            (*offset_map)[i] = next_offset++;
+        }
+    }
+
+    segment_ptr_->attrs_ptr_->Append(VectorCount(), *segment_to_merge->attrs_ptr_);
     AddVectors(name, segment_to_merge->vectors_ptr_->GetData(), segment_to_merge->vectors_ptr_->GetUids());
 
     auto rows = segment_to_merge->vectors_ptr_->GetCount();
@@ -278,7 +340,8 @@ SegmentWriter::Size() {
         ret += segment_ptr_->id_bloom_filter_ptr_->Size();
     }
      */
-    return (vectors_size * sizeof(uint8_t) + uids_size * sizeof(doc_id_t));
+    size_t attrs_size = segment_ptr_->attrs_ptr_->Empty() ? 0 : segment_ptr_->attrs_ptr_->Size();
+    return (vectors_size * sizeof(uint8_t) + uids_size * sizeof(doc_id_t) + attrs_size);
 }
 
 size_t
@@ -39,6 +39,11 @@ class SegmentWriter {
     Status
     AddVectors(const std::string& name, const uint8_t* data, uint64_t size, const std::vector<doc_id_t>& uids);
 
+    // attributes of the rows added by the next AddVectors, rows [offset, offset + count) of attr_data
+    Status
+    AddAttrs(const std::unordered_map<std::string, engine::DataType>& attr_types,
+             const std::unordered_map<std::string, std::vector<uint8_t>>& attr_data, size_t offset, size_t count);
+
     Status
     SetVectorIndex(const knowhere::VecIndexPtr& index);
 
@@ -57,8 +62,10 @@ class SegmentWriter {
     Status
     GetSegment(SegmentPtr& segment_ptr);
 
+    // offset_map, if given, receives the new offset of every vector in the merged segment, -1 for deleted ones
     Status
-    Merge(const std::string& segment_dir_to_merge, const std::string& name);
+    Merge(const std::string& segment_dir_to_merge, const std::string& name,
+          std::vector<int64_t>* offset_map = nullptr);
 
     size_t
     Size();
@@ -79,6 +86,9 @@ class SegmentWriter {
     Status
     WriteDeletedDocs();
 
+    Status
+    WriteAttrs();
+
  private:
     storage::FSHandlerPtr fs_ptr_;
     SegmentPtr segment_ptr_;
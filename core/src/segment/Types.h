@@ -20,6 +20,7 @@
 #include <memory>
 #include <vector>
 
+#include "segment/Attrs.h"
 #include "segment/DeletedDocs.h"
 #include "segment/IdBloomFilter.h"
 #include "segment/VectorIndex.h"
@@ -33,6 +34,7 @@ struct Segment {
     VectorIndexPtr vector_index_ptr_ = std::make_shared<VectorIndex>();
     DeletedDocsPtr deleted_docs_ptr_ = nullptr;
     IdBloomFilterPtr id_bloom_filter_ptr_ = nullptr;
+    AttrsPtr attrs_ptr_ = std::make_shared<Attrs>();
 };
 
 using SegmentPtr = std::shared_ptr<Segment>;
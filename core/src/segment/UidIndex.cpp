@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "segment/UidIndex.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace milvus {
+namespace segment {
+
+UidIndex::UidIndex(const std::vector<doc_id_t>& uids) {
+    offsets_.resize(uids.size());
+    std::iota(offsets_.begin(), offsets_.end(), 0);
+    std::stable_sort(offsets_.begin(), offsets_.end(),
+                     [&uids](offset_t lhs, offset_t rhs) { return uids[lhs] < uids[rhs]; });
+
+    sorted_uids_.resize(uids.size());
+    for (size_t i = 0; i < offsets_.size(); ++i) {
+        sorted_uids_[i] = uids[offsets_[i]];
+    }
+}
+
+UidIndex::OffsetRange
+UidIndex::Find(doc_id_t uid) const {
+    auto range = std::equal_range(sorted_uids_.begin(), sorted_uids_.end(), uid);
+    return OffsetRange(offsets_.begin() + (range.first - sorted_uids_.begin()),
+                       offsets_.begin() + (range.second - sorted_uids_.begin()));
+}
+
+size_t
+UidIndex::Count() const {
+    return sorted_uids_.size();
+}
+
+int64_t
+UidIndex::Size() {
+    return sorted_uids_.size() * sizeof(doc_id_t) + offsets_.size() * sizeof(offset_t);
+}
+
+}  // namespace segment
+}  // namespace milvus
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cache/DataObj.h"
+#include "segment/DeletedDocs.h"
+#include "segment/Vectors.h"
+
+namespace milvus {
+namespace segment {
+
+// uid to offset lookup of a segment, uids sorted together with their offsets,
+// a segment never changes its uids so the index is built once and kept in cache
+class UidIndex : public cache::DataObj {
+ public:
+    using OffsetRange = std::pair<std::vector<offset_t>::const_iterator, std::vector<offset_t>::const_iterator>;
+
+    explicit UidIndex(const std::vector<doc_id_t>& uids);
+
+    // offsets of the uid in ascending order, empty range if the uid is absent
+    OffsetRange
+    Find(doc_id_t uid) const;
+
+    size_t
+    Count() const;
+
+    int64_t
+    Size() override;
+
+    // No copy and move
+    UidIndex(const UidIndex&) = delete;
+    UidIndex(UidIndex&&) = delete;
+
+    UidIndex&
+    operator=(const UidIndex&) = delete;
+    UidIndex&
+    operator=(UidIndex&&) = delete;
+
+ private:
+    std::vector<doc_id_t> sorted_uids_;
+    std::vector<offset_t> offsets_;
+};
+
+using UidIndexPtr = std::shared_ptr<UidIndex>;
+
+}  // namespace segment
+}  // namespace milvus
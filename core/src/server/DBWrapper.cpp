@@ -75,6 +75,18 @@ DBWrapper::StartService() {
         return s;
     }
 
+    s = config.GetCacheConfigWarmUpEnable(opt.cache_warmup_enable_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetCacheConfigWarmUpInterval(opt.cache_warmup_interval_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     int64_t insert_buffer_size = 1 * engine::GB;
     s = config.GetCacheConfigInsertBufferSize(insert_buffer_size);
     if (!s.ok()) {
@@ -130,6 +142,27 @@ DBWrapper::StartService() {
             std::cerr << s.ToString() << std::endl;
             kill(0, SIGUSR1);
         }
+
+        s = config.GetWalConfigSyncEnable(opt.wal_sync_enable_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get sync_enable configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
+
+        s = config.GetWalConfigSyncInterval(opt.wal_sync_interval_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get sync_interval configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
+
+        s = config.GetWalConfigSyncBatchSize(opt.wal_sync_batch_size_);
+        if (!s.ok()) {
+            std::cerr << "ERROR! Failed to get sync_batch_size configuration." << std::endl;
+            std::cerr << s.ToString() << std::endl;
+            kill(0, SIGUSR1);
+        }
     }
 
     // engine config
@@ -138,6 +138,18 @@ RequestHandler::Search(const std::shared_ptr<Context>& context, const std::strin
     return request_ptr->status();
 }
 
+Status
+RequestHandler::HybridSearch(const std::shared_ptr<Context>& context, const std::string& collection_name,
+                             const std::vector<std::string>& partition_list, const query::GeneralQueryPtr& general_query,
+                             const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                             TopKQueryResult& result) {
+    BaseRequestPtr request_ptr = SearchRequest::Create(context, collection_name, vectors, topk, extra_params,
+                                                       partition_list, {}, result, general_query);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
 Status
 RequestHandler::SearchByID(const std::shared_ptr<Context>& context, const std::string& collection_name,
                            const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
@@ -68,6 +68,12 @@ class RequestHandler {
            const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
            TopKQueryResult& result);
 
+    Status
+    HybridSearch(const std::shared_ptr<Context>& context, const std::string& collection_name,
+                 const std::vector<std::string>& partition_list, const query::GeneralQueryPtr& general_query,
+                 const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
+                 TopKQueryResult& result);
+
     Status
     SearchByID(const std::shared_ptr<Context>& context, const std::string& collection_name,
                const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
@@ -10,10 +10,14 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "server/delivery/RequestScheduler.h"
+#include "config/Config.h"
+#include "utils/CommonUtil.h"
 #include "utils/Log.h"
 
 #include <fiu-local.h>
 #include <unistd.h>
+#include <algorithm>
+#include <functional>
 #include <utility>
 
 namespace milvus {
@@ -49,7 +53,7 @@ RequestScheduler::Start() {
 
 void
 RequestScheduler::Stop() {
-    if (stopped_ && request_groups_.empty() && execute_threads_.empty()) {
+    if (stopped_ && request_groups_.empty() && execute_threads_.empty() && dql_workers_.empty()) {
         return;
     }
 
@@ -61,6 +65,9 @@ RequestScheduler::Stop() {
                 iter.second->Put(nullptr);
             }
         }
+        for (auto& worker : dql_workers_) {
+            worker->queue_->Put(nullptr);
+        }
     }
 
     for (auto& iter : execute_threads_) {
@@ -68,8 +75,12 @@ RequestScheduler::Stop() {
             continue;
         iter->join();
     }
+    for (auto& worker : dql_workers_) {
+        worker->thread_->join();
+    }
     request_groups_.clear();
     execute_threads_.clear();
+    dql_workers_.clear();
     stopped_ = true;
     LOG_SERVER_INFO_ << "Scheduler stopped";
 }
@@ -108,7 +119,7 @@ RequestScheduler::ExecuteRequest(const BaseRequestPtr& request_ptr) {
 }
 
 void
-RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
+RequestScheduler::TakeToExecute(RequestQueuePtr request_queue, DqlWorkerPtr worker) {
     SetThreadName("reqsched_thread");
     if (request_queue == nullptr) {
         return;
@@ -121,6 +132,10 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
             break;  // stop the thread
         }
 
+        if (worker != nullptr) {
+            worker->busy_ = true;
+        }
+
         try {
             fiu_do_on("RequestScheduler.TakeToExecute.throw_std_exception1", throw std::exception());
             auto status = request->Execute();
@@ -132,6 +147,10 @@ RequestScheduler::TakeToExecute(RequestQueuePtr request_queue) {
         } catch (std::exception& ex) {
             LOG_SERVER_ERROR_ << "Request failed to execute: " << ex.what();
         }
+
+        if (worker != nullptr) {
+            worker->busy_ = false;
+        }
     }
 }
 
@@ -140,6 +159,10 @@ RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
     std::lock_guard<std::mutex> lock(queue_mtx_);
 
     std::string group_name = request_ptr->RequestGroup();
+    if (group_name == DQL_REQUEST_GROUP) {
+        return PutToDqlQueue(request_ptr);
+    }
+
     if (request_groups_.count(group_name) > 0) {
         request_groups_[group_name]->PutRequest(request_ptr);
     } else {
@@ -149,7 +172,7 @@ RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
         fiu_do_on("RequestScheduler.PutToQueue.null_queue", queue = nullptr);
 
         // start a thread
-        ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue);
+        ThreadPtr thread = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, queue, nullptr);
 
         fiu_do_on("RequestScheduler.PutToQueue.push_null_thread", execute_threads_.push_back(nullptr));
         execute_threads_.push_back(thread);
@@ -159,5 +182,64 @@ RequestScheduler::PutToQueue(const BaseRequestPtr& request_ptr) {
     return Status::OK();
 }
 
+Status
+RequestScheduler::PutToDqlQueue(const BaseRequestPtr& request_ptr) {
+    if (dql_workers_.empty()) {
+        int64_t worker_num = 0;
+        Config& config = Config::GetInstance();
+        config.GetEngineConfigDqlWorkerNum(worker_num);
+        if (worker_num <= 0) {
+            // 0 means a quarter of system cpu cores, the rest are left for omp threads inside each search
+            int64_t sys_thread_cnt = 8;
+            CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+            worker_num = std::max<int64_t>(1, sys_thread_cnt / 4);
+        }
+
+        for (int64_t i = 0; i < worker_num; ++i) {
+            auto worker = std::make_shared<DqlWorker>();
+            worker->queue_ = std::make_shared<RequestQueue>();
+            worker->thread_ = std::make_shared<std::thread>(&RequestScheduler::TakeToExecute, this, worker->queue_,
+                                                            worker);
+            dql_workers_.push_back(worker);
+        }
+        LOG_SERVER_INFO_ << "Create " << worker_num << " threads for request group: " << DQL_REQUEST_GROUP;
+    }
+
+    DqlWorkerPtr worker = PickDqlWorker(request_ptr);
+    return worker->queue_->PutRequest(request_ptr);
+}
+
+DqlWorkerPtr
+RequestScheduler::PickDqlWorker(const BaseRequestPtr& request_ptr) {
+    auto worker_load = [](const DqlWorkerPtr& worker) -> size_t {
+        return worker->queue_->Size() + (worker->busy_ ? 1 : 0);
+    };
+
+    // requests of the same collection prefer the same worker, so that search requests can be combined in its queue,
+    // but if any other worker is less loaded, a search request goes there instead of waiting behind other requests
+    size_t home = std::hash<std::string>()(request_ptr->CollectionName()) % dql_workers_.size();
+    DqlWorkerPtr target = dql_workers_[home];
+
+    // preload, release and reload always run on the home worker, in the order they arrive
+    auto type = request_ptr->GetRequestType();
+    if (type != BaseRequest::kSearch && type != BaseRequest::kSearchByID && type != BaseRequest::kSearchCombine) {
+        return target;
+    }
+
+    size_t min_load = worker_load(target);
+    for (auto& worker : dql_workers_) {
+        if (min_load == 0) {
+            break;
+        }
+        size_t load = worker_load(worker);
+        if (load < min_load) {
+            target = worker;
+            min_load = load;
+        }
+    }
+
+    return target;
+}
+
 }  // namespace server
 }  // namespace milvus
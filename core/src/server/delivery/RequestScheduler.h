@@ -14,6 +14,7 @@
 #include "server/delivery/RequestQueue.h"
 #include "utils/Status.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -25,6 +26,15 @@ namespace server {
 
 using ThreadPtr = std::shared_ptr<std::thread>;
 
+// a dql worker owns a request queue and a thread, search combination happens inside each queue
+struct DqlWorker {
+    RequestQueuePtr queue_;
+    ThreadPtr thread_;
+    std::atomic<bool> busy_{false};
+};
+
+using DqlWorkerPtr = std::shared_ptr<DqlWorker>;
+
 class RequestScheduler {
  public:
     static RequestScheduler&
@@ -51,11 +61,17 @@ class RequestScheduler {
     virtual ~RequestScheduler();
 
     void
-    TakeToExecute(RequestQueuePtr request_queue);
+    TakeToExecute(RequestQueuePtr request_queue, DqlWorkerPtr worker);
 
     Status
     PutToQueue(const BaseRequestPtr& request_ptr);
 
+    Status
+    PutToDqlQueue(const BaseRequestPtr& request_ptr);
+
+    DqlWorkerPtr
+    PickDqlWorker(const BaseRequestPtr& request_ptr);
+
  private:
     mutable std::mutex queue_mtx_;
 
@@ -63,6 +79,8 @@ class RequestScheduler {
 
     std::vector<ThreadPtr> execute_threads_;
 
+    std::vector<DqlWorkerPtr> dql_workers_;
+
     bool stopped_;
 };
 
@@ -21,9 +21,9 @@
 namespace milvus {
 namespace server {
 
-static const char* DQL_REQUEST_GROUP = "dql";
-static const char* DDL_DML_REQUEST_GROUP = "ddl_dml";
-static const char* INFO_REQUEST_GROUP = "info";
+const char* DQL_REQUEST_GROUP = "dql";
+const char* DDL_DML_REQUEST_GROUP = "ddl_dml";
+const char* INFO_REQUEST_GROUP = "info";
 
 namespace {
 std::string
@@ -112,6 +112,12 @@ BaseRequest::PostExecute() {
     return OnPostExecute();
 }
 
+const std::string&
+BaseRequest::CollectionName() const {
+    static const std::string s_empty_name;
+    return s_empty_name;
+}
+
 Status
 BaseRequest::OnPreExecute() {
     return Status::OK();
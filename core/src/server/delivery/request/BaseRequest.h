@@ -104,6 +104,10 @@ struct PartitionParam {
 
 class Context;
 
+extern const char* DQL_REQUEST_GROUP;
+extern const char* DDL_DML_REQUEST_GROUP;
+extern const char* INFO_REQUEST_GROUP;
+
 class BaseRequest {
  public:
     enum RequestType {
@@ -178,6 +182,10 @@ class BaseRequest {
         return request_group_;
     }
 
+    // the collection this request works on, used by scheduler to dispatch dql requests
+    virtual const std::string&
+    CollectionName() const;
+
     const Status&
     status() const {
         return status_;
@@ -143,6 +143,12 @@ InsertRequest::OnExecute() {
             return status;
         }
 
+        status = ValidationUtil::ValidateAttrData(vectors_data_);
+        if (!status.ok()) {
+            LOG_SERVER_ERROR_ << LogOut("[%s][%d] Invalid attribute data: %s", "insert", 0, status.message().c_str());
+            return status;
+        }
+
         // step 5: check insert data limitation
         status = ValidationUtil::ValidateVectorDataSize(vectors_data_, collection_schema);
         if (!status.ok()) {
@@ -26,6 +26,11 @@ class PreloadCollectionRequest : public BaseRequest {
     Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
            const std::vector<std::string>& partition_tags);
 
+    const std::string&
+    CollectionName() const override {
+        return collection_name_;
+    }
+
  protected:
     PreloadCollectionRequest(const std::shared_ptr<milvus::server::Context>& context,
                              const std::string& collection_name, const std::vector<std::string>& partition_tags);
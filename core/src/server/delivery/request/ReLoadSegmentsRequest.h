@@ -26,6 +26,11 @@ class ReLoadSegmentsRequest : public BaseRequest {
     Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
            const std::vector<std::string>& segment_ids);
 
+    const std::string&
+    CollectionName() const override {
+        return collection_name_;
+    }
+
  protected:
     ReLoadSegmentsRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                           const std::vector<std::string>& segment_ids);
@@ -33,6 +33,11 @@ class SearchByIDRequest : public BaseRequest {
            const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
            const std::vector<std::string>& partition_list, TopKQueryResult& result);
 
+    const std::string&
+    CollectionName() const override {
+        return collection_name_;
+    }
+
  protected:
     SearchByIDRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                       const std::vector<int64_t>& id_array, int64_t topk, const milvus::json& extra_params,
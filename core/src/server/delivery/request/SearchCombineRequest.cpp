@@ -140,6 +140,11 @@ SearchCombineRequest::Combine(const SearchRequestPtr& request) {
 
 bool
 SearchCombineRequest::CanCombine(const SearchRequestPtr& request) {
+    // the filter of a hybrid search applies to its own vectors only
+    if (request->GeneralQuery() != nullptr) {
+        return false;
+    }
+
     if (collection_name_ != request->CollectionName()) {
         return false;
     }
@@ -181,6 +186,10 @@ SearchCombineRequest::CanCombine(const SearchRequestPtr& request) {
 
 bool
 SearchCombineRequest::CanCombine(const SearchRequestPtr& left, const SearchRequestPtr& right, int64_t max_nq) {
+    if (left->GeneralQuery() != nullptr || right->GeneralQuery() != nullptr) {
+        return false;
+    }
+
     if (left->CollectionName() != right->CollectionName()) {
         return false;
     }
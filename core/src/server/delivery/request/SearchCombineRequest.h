@@ -37,6 +37,11 @@ class SearchCombineRequest : public BaseRequest {
     static bool
     CanCombine(const SearchRequestPtr& left, const SearchRequestPtr& right, int64_t max_nq = COMBINE_MAX_NQ);
 
+    const std::string&
+    CollectionName() const override {
+        return collection_name_;
+    }
+
  protected:
     Status
     OnExecute() override;
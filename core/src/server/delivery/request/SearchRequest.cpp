@@ -32,7 +32,8 @@ namespace server {
 SearchRequest::SearchRequest(const std::shared_ptr<milvus::server::Context>& context,
                              const std::string& collection_name, const engine::VectorsData& vectors, int64_t topk,
                              const milvus::json& extra_params, const std::vector<std::string>& partition_list,
-                             const std::vector<std::string>& file_id_list, TopKQueryResult& result)
+                             const std::vector<std::string>& file_id_list, TopKQueryResult& result,
+                             const query::GeneralQueryPtr& general_query)
     : BaseRequest(context, BaseRequest::kSearch),
       collection_name_(collection_name),
       vectors_data_(vectors),
@@ -40,6 +41,7 @@ SearchRequest::SearchRequest(const std::shared_ptr<milvus::server::Context>& con
       extra_params_(extra_params),
       partition_list_(partition_list),
       file_id_list_(file_id_list),
+      general_query_(general_query),
       result_(result) {
 }
 
@@ -47,9 +49,9 @@ BaseRequestPtr
 SearchRequest::Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                       const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
                       const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
-                      TopKQueryResult& result) {
-    return std::shared_ptr<BaseRequest>(
-        new SearchRequest(context, collection_name, vectors, topk, extra_params, partition_list, file_id_list, result));
+                      TopKQueryResult& result, const query::GeneralQueryPtr& general_query) {
+    return std::shared_ptr<BaseRequest>(new SearchRequest(context, collection_name, vectors, topk, extra_params,
+                                                          partition_list, file_id_list, result, general_query));
 }
 
 Status
@@ -150,7 +152,11 @@ SearchRequest::OnExecute() {
         engine::ResultIds result_ids;
         engine::ResultDistances result_distances;
 
-        if (file_id_list_.empty()) {
+        if (general_query_ != nullptr) {
+            status = DBWrapper::DB()->HybridQuery(context_, collection_name_, partition_list_, general_query_,
+                                                  (size_t)topk_, extra_params_, vectors_data_, result_ids,
+                                                  result_distances);
+        } else if (file_id_list_.empty()) {
             status = DBWrapper::DB()->Query(context_, collection_name_, partition_list_, (size_t)topk_, extra_params_,
                                             vectors_data_, result_ids, result_distances);
         } else {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "query/GeneralQuery.h"
 #include "server/delivery/request/BaseRequest.h"
 
 #include <memory>
@@ -26,10 +27,10 @@ class SearchRequest : public BaseRequest {
     Create(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
            const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
            const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
-           TopKQueryResult& result);
+           TopKQueryResult& result, const query::GeneralQueryPtr& general_query = nullptr);
 
     const std::string&
-    CollectionName() const {
+    CollectionName() const override {
         return collection_name_;
     }
 
@@ -58,6 +59,11 @@ class SearchRequest : public BaseRequest {
         return file_id_list_;
     }
 
+    const query::GeneralQueryPtr&
+    GeneralQuery() const {
+        return general_query_;
+    }
+
     TopKQueryResult&
     QueryResult() {
         return result_;
@@ -72,7 +78,7 @@ class SearchRequest : public BaseRequest {
     SearchRequest(const std::shared_ptr<milvus::server::Context>& context, const std::string& collection_name,
                   const engine::VectorsData& vectors, int64_t topk, const milvus::json& extra_params,
                   const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
-                  TopKQueryResult& result);
+                  TopKQueryResult& result, const query::GeneralQueryPtr& general_query);
 
     Status
     OnPreExecute() override;
@@ -87,6 +93,7 @@ class SearchRequest : public BaseRequest {
     milvus::json extra_params_;
     const std::vector<std::string> partition_list_;
     const std::vector<std::string> file_id_list_;
+    const query::GeneralQueryPtr general_query_;  // filters the entities searched
 
     TopKQueryResult& result_;
 
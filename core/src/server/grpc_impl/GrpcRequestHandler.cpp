@@ -13,6 +13,7 @@
 
 #include <fiu-local.h>
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -20,6 +21,7 @@
 #include <vector>
 
 #include "query/BinaryQuery.h"
+#include "query/BooleanQuery.h"
 #include "server/context/ConnectionContext.h"
 #include "tracing/TextMapCarrier.h"
 #include "tracing/TracerUtil.h"
@@ -63,6 +65,7 @@ ErrorMap(ErrorCode code) {
         {SERVER_ILLEGAL_SEARCH_RESULT, ::milvus::grpc::ErrorCode::ILLEGAL_SEARCH_RESULT},
         {SERVER_CACHE_FULL, ::milvus::grpc::ErrorCode::CACHE_FAILED},
         {DB_META_TRANSACTION_FAILED, ::milvus::grpc::ErrorCode::META_FAILED},
+        {DB_INSERT_BUFFER_FULL, ::milvus::grpc::ErrorCode::CACHE_FAILED},
         {SERVER_BUILD_INDEX_ERROR, ::milvus::grpc::ErrorCode::BUILD_INDEX_ERROR},
         {SERVER_OUT_OF_MEMORY, ::milvus::grpc::ErrorCode::OUT_OF_MEMORY},
     };
@@ -130,6 +133,285 @@ CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecor
     vectors.id_array_.swap(id_array);
 }
 
+Status
+CopyPackedRecords(::milvus::grpc::VectorDataType data_type, int64_t dimension, const std::string& packed_data,
+                  const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
+                  engine::VectorsData& vectors) {
+    // step 1: check packed data size against dimension
+    bool is_binary = (data_type == ::milvus::grpc::VECTOR_BINARY);
+    if (dimension <= 0 || (is_binary && dimension % 8 != 0)) {
+        return Status(SERVER_INVALID_VECTOR_DIMENSION, "Invalid packed vector dimension: " + std::to_string(dimension));
+    }
+
+    int64_t row_bytes = is_binary ? dimension / 8 : dimension * static_cast<int64_t>(sizeof(float));
+    int64_t data_size = packed_data.size();
+    if (data_size == 0 || data_size % row_bytes != 0) {
+        std::string msg = "Packed vector data size " + std::to_string(data_size) + " is not a multiple of row size " +
+                          std::to_string(row_bytes);
+        return Status(SERVER_INVALID_ROWRECORD_ARRAY, msg);
+    }
+
+    // step 2: copy vector data, the packed buffer is already row-major so one memcpy is enough
+    if (is_binary) {
+        std::vector<uint8_t> binary_array(data_size);
+        memcpy(binary_array.data(), packed_data.data(), data_size);
+        vectors.binary_data_.swap(binary_array);
+    } else {
+        std::vector<float> float_array(data_size / sizeof(float));
+        memcpy(float_array.data(), packed_data.data(), data_size);
+        vectors.float_data_.swap(float_array);
+    }
+
+    // step 3: copy id array
+    std::vector<int64_t> id_array;
+    if (grpc_id_array.size() > 0) {
+        id_array.resize(grpc_id_array.size());
+        memcpy(id_array.data(), grpc_id_array.data(), grpc_id_array.size() * sizeof(int64_t));
+    }
+
+    vectors.vector_count_ = data_size / row_bytes;
+    vectors.id_array_.swap(id_array);
+    return Status::OK();
+}
+
+// attribute types of an entity insert are given in the extra params, e.g. {"field_types": {"age": "INT32"}}
+const char* FIELD_TYPES_KEY = "field_types";
+
+Status
+ParseFieldTypes(const google::protobuf::RepeatedPtrField<::milvus::grpc::KeyValuePair>& grpc_params,
+                std::unordered_map<std::string, engine::DataType>& field_types) {
+    static const std::unordered_map<std::string, engine::DataType> type_names = {
+        {"INT8", engine::DataType::INT8},   {"INT16", engine::DataType::INT16}, {"INT32", engine::DataType::INT32},
+        {"INT64", engine::DataType::INT64}, {"FLOAT", engine::DataType::FLOAT}, {"DOUBLE", engine::DataType::DOUBLE},
+    };
+
+    for (auto& extra : grpc_params) {
+        if (extra.key() != EXTRA_PARAM_KEY) {
+            continue;
+        }
+        try {
+            auto json_params = json::parse(extra.value());
+            if (!json_params.contains(FIELD_TYPES_KEY)) {
+                continue;
+            }
+            for (auto& item : json_params[FIELD_TYPES_KEY].items()) {
+                auto iter = type_names.find(item.value().get<std::string>());
+                if (iter == type_names.end()) {
+                    return Status(SERVER_INVALID_ARGUMENT, "Unsupported type of field " + item.key());
+                }
+                field_types[item.key()] = iter->second;
+            }
+        } catch (std::exception& e) {
+            return Status(SERVER_INVALID_ARGUMENT, "Invalid field types: " + std::string(e.what()));
+        }
+    }
+    return Status::OK();
+}
+
+template <typename T>
+void
+AppendValue(std::vector<uint8_t>& column, T value) {
+    auto ptr = reinterpret_cast<const uint8_t*>(&value);
+    column.insert(column.end(), ptr, ptr + sizeof(T));
+}
+
+// the attribute records hold the columns one after another, int64 values for integer fields and double values for
+// floating point fields, they are converted to the field types here
+Status
+CopyEntities(const ::milvus::grpc::HEntity& grpc_entities,
+             const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
+             const google::protobuf::RepeatedPtrField<::milvus::grpc::KeyValuePair>& grpc_params,
+             engine::VectorsData& vectors) {
+    // step 1: copy vector data
+    bool has_vector = false;
+    for (auto& field_value : grpc_entities.result_values()) {
+        if (field_value.has_vector_value()) {
+            CopyRowRecords(field_value.vector_value().value(), grpc_id_array, vectors);
+            has_vector = true;
+            break;
+        }
+    }
+    if (!has_vector) {
+        return Status(SERVER_INVALID_ROWRECORD_ARRAY, "No vector field in entities");
+    }
+
+    // step 2: copy attributes
+    std::unordered_map<std::string, engine::DataType> field_types;
+    auto status = ParseFieldTypes(grpc_params, field_types);
+    if (!status.ok()) {
+        return status;
+    }
+
+    size_t row_num = vectors.vector_count_;
+    auto& attr_records = grpc_entities.attr_records();
+    if (attr_records.size() != grpc_entities.field_names_size() * row_num * sizeof(int64_t)) {
+        return Status(SERVER_INVALID_ROWRECORD_ARRAY, "The number of attribute values mismatch with vectors");
+    }
+
+    auto data = reinterpret_cast<const uint8_t*>(attr_records.data());
+    for (int i = 0; i < grpc_entities.field_names_size(); ++i) {
+        auto& name = grpc_entities.field_names(i);
+        auto iter = field_types.find(name);
+        if (iter == field_types.end()) {
+            return Status(SERVER_INVALID_ARGUMENT, "Type of field " + name + " is not specified in field_types");
+        }
+        auto type = iter->second;
+
+        std::vector<uint8_t> column;
+        column.reserve(row_num * sizeof(int64_t));
+        const uint8_t* values = data + i * row_num * sizeof(int64_t);
+        for (size_t j = 0; j < row_num; ++j) {
+            int64_t int_value;
+            double float_value;
+            memcpy(&int_value, values + j * sizeof(int64_t), sizeof(int64_t));
+            memcpy(&float_value, values + j * sizeof(double), sizeof(double));
+            bool in_range = true;
+            switch (type) {
+                case engine::DataType::INT8:
+                    in_range = (int_value == static_cast<int8_t>(int_value));
+                    AppendValue(column, static_cast<int8_t>(int_value));
+                    break;
+                case engine::DataType::INT16:
+                    in_range = (int_value == static_cast<int16_t>(int_value));
+                    AppendValue(column, static_cast<int16_t>(int_value));
+                    break;
+                case engine::DataType::INT32:
+                    in_range = (int_value == static_cast<int32_t>(int_value));
+                    AppendValue(column, static_cast<int32_t>(int_value));
+                    break;
+                case engine::DataType::INT64:
+                    AppendValue(column, int_value);
+                    break;
+                case engine::DataType::FLOAT:
+                    AppendValue(column, static_cast<float>(float_value));
+                    break;
+                default:
+                    AppendValue(column, float_value);
+                    break;
+            }
+            if (!in_range) {
+                return Status(SERVER_INVALID_ARGUMENT,
+                              "Value " + std::to_string(int_value) + " out of the range of field " + name);
+            }
+        }
+        vectors.attr_types_[name] = type;
+        vectors.attr_data_[name].swap(column);
+    }
+
+    return Status::OK();
+}
+
+query::Occur
+ToOccur(::milvus::grpc::Occur grpc_occur) {
+    switch (grpc_occur) {
+        case ::milvus::grpc::MUST:
+            return query::Occur::MUST;
+        case ::milvus::grpc::SHOULD:
+            return query::Occur::SHOULD;
+        case ::milvus::grpc::MUST_NOT:
+            return query::Occur::MUST_NOT;
+        default:
+            return query::Occur::INVALID;
+    }
+}
+
+// convert a general query of a hybrid search into clauses of boolean_clause, the query vectors, topk and search
+// params are taken from its only vector query
+Status
+DeserializeGeneralQuery(const ::milvus::grpc::GeneralQuery& grpc_query, const query::BooleanQueryPtr& boolean_clause,
+                        query::VectorQueryPtr& vector_query, engine::VectorsData& vectors) {
+    switch (grpc_query.query_case()) {
+        case ::milvus::grpc::GeneralQuery::kBooleanQuery: {
+            auto& grpc_boolean_query = grpc_query.boolean_query();
+            auto clause = std::make_shared<query::BooleanQuery>(ToOccur(grpc_boolean_query.occur()));
+            for (auto& grpc_sub_query : grpc_boolean_query.general_query()) {
+                auto status = DeserializeGeneralQuery(grpc_sub_query, clause, vector_query, vectors);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+            if (!clause->getBooleanQuerys().empty() && !clause->getLeafQueries().empty()) {
+                return Status(SERVER_INVALID_ARGUMENT, "A boolean query can't mix leaf queries and boolean queries");
+            }
+            boolean_clause->AddBooleanQuery(clause);
+            break;
+        }
+        case ::milvus::grpc::GeneralQuery::kTermQuery: {
+            auto& grpc_term_query = grpc_query.term_query();
+            auto term_query = std::make_shared<query::TermQuery>();
+            term_query->field_name = grpc_term_query.field_name();
+            term_query->field_value.assign(grpc_term_query.values().begin(), grpc_term_query.values().end());
+            term_query->boost = grpc_term_query.boost();
+            auto leaf = std::make_shared<query::LeafQuery>();
+            leaf->term_query = term_query;
+            boolean_clause->AddLeafQuery(leaf);
+            break;
+        }
+        case ::milvus::grpc::GeneralQuery::kRangeQuery: {
+            auto& grpc_range_query = grpc_query.range_query();
+            auto range_query = std::make_shared<query::RangeQuery>();
+            range_query->field_name = grpc_range_query.field_name();
+            for (auto& grpc_expr : grpc_range_query.operand()) {
+                query::CompareExpr expr;
+                expr.compare_operator = static_cast<query::CompareOperator>(grpc_expr.operator_());
+                expr.operand = grpc_expr.operand();
+                range_query->compare_expr.emplace_back(expr);
+            }
+            range_query->boost = grpc_range_query.boost();
+            auto leaf = std::make_shared<query::LeafQuery>();
+            leaf->range_query = range_query;
+            boolean_clause->AddLeafQuery(leaf);
+            break;
+        }
+        case ::milvus::grpc::GeneralQuery::kVectorQuery: {
+            if (vector_query != nullptr) {
+                return Status(SERVER_INVALID_ARGUMENT, "Only one vector query is supported in a hybrid search");
+            }
+            auto& grpc_vector_query = grpc_query.vector_query();
+            vector_query = std::make_shared<query::VectorQuery>();
+            vector_query->field_name = grpc_vector_query.field_name();
+            vector_query->topk = grpc_vector_query.topk();
+            vector_query->boost = grpc_vector_query.query_boost();
+            for (auto& extra : grpc_vector_query.extra_params()) {
+                if (extra.key() == EXTRA_PARAM_KEY) {
+                    try {
+                        vector_query->extra_params = json::parse(extra.value());
+                    } catch (std::exception& e) {
+                        return Status(SERVER_INVALID_ARGUMENT, "Invalid search params: " + std::string(e.what()));
+                    }
+                }
+            }
+            CopyRowRecords(grpc_vector_query.records(), google::protobuf::RepeatedField<google::protobuf::int64>(),
+                           vectors);
+            auto leaf = std::make_shared<query::LeafQuery>();
+            leaf->vector_query = vector_query;
+            boolean_clause->AddLeafQuery(leaf);
+            break;
+        }
+        default:
+            return Status(SERVER_INVALID_ARGUMENT, "Empty query in hybrid search");
+    }
+    return Status::OK();
+}
+
+void
+ConstructIdRanges(const engine::IDNumbers& id_array, ::milvus::grpc::InsertStreamResult* response) {
+    // ids of a chunk are mostly consecutive, return them as runs instead of one by one
+    for (auto id : id_array) {
+        int size = response->id_ranges_size();
+        if (size > 0) {
+            ::milvus::grpc::IdRange* range = response->mutable_id_ranges(size - 1);
+            if (range->first_id() + range->count() == id) {
+                range->set_count(range->count() + 1);
+                continue;
+            }
+        }
+        ::milvus::grpc::IdRange* range = response->add_id_ranges();
+        range->set_first_id(id);
+        range->set_count(1);
+    }
+}
+
 void
 ConstructResults(const TopKQueryResult& result, ::milvus::grpc::TopKQueryResult* response) {
     if (!response) {
@@ -932,6 +1214,232 @@ GrpcRequestHandler::Compact(::grpc::ServerContext* context, const ::milvus::grpc
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedInsertParam* request,
+                                 ::milvus::grpc::VectorIds* response) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: copy vector data
+    engine::VectorsData vectors;
+    Status status = CopyPackedRecords(request->data_type(), request->dimension(), request->vector_data(),
+                                      request->row_id_array(), vectors);
+
+    // step 2: insert vectors
+    if (status.ok()) {
+        status =
+            request_handler_.Insert(GetContext(context), request->collection_name(), vectors, request->partition_tag());
+    }
+
+    // step 3: return id array
+    response->mutable_vector_id_array()->Resize(static_cast<int>(vectors.id_array_.size()), 0);
+    memcpy(response->mutable_vector_id_array()->mutable_data(), vectors.id_array_.data(),
+           vectors.id_array_.size() * sizeof(int64_t));
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::SearchPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedSearchParam* request,
+                                 ::milvus::grpc::TopKQueryResult* response) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: copy vector data
+    engine::VectorsData vectors;
+    Status status = CopyPackedRecords(request->data_type(), request->dimension(), request->query_data(),
+                                      google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+    if (!status.ok()) {
+        LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+        SET_RESPONSE(response->mutable_status(), status, context);
+        return ::grpc::Status::OK;
+    }
+
+    // step 2: partition tags
+    std::vector<std::string> partitions;
+    std::copy(request->partition_tag_array().begin(), request->partition_tag_array().end(),
+              std::back_inserter(partitions));
+
+    // step 3: parse extra parameters
+    milvus::json json_params;
+    for (int i = 0; i < request->extra_params_size(); i++) {
+        const ::milvus::grpc::KeyValuePair& extra = request->extra_params(i);
+        if (extra.key() == EXTRA_PARAM_KEY) {
+            json_params = json::parse(extra.value());
+        }
+    }
+
+    // step 4: search vectors
+    std::vector<std::string> file_ids;
+    TopKQueryResult result;
+    status = request_handler_.Search(GetContext(context), request->collection_name(), vectors, request->topk(),
+                                     json_params, partitions, file_ids, result);
+
+    // step 5: construct and return result
+    ConstructResults(result, response);
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::InsertStream(::grpc::ServerContext* context,
+                                 ::grpc::ServerReader<::milvus::grpc::PackedInsertParam>* reader,
+                                 ::milvus::grpc::InsertStreamResult* response) {
+    return InsertStream(context, static_cast<::grpc::ServerReaderInterface<::milvus::grpc::PackedInsertParam>*>(reader),
+                        response);
+}
+
+::grpc::Status
+GrpcRequestHandler::InsertStream(::grpc::ServerContext* context,
+                                 ::grpc::ServerReaderInterface<::milvus::grpc::PackedInsertParam>* reader,
+                                 ::milvus::grpc::InsertStreamResult* response) {
+    if (nullptr == reader || nullptr == response) {
+        return ::grpc::Status::OK;
+    }
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // chunks are inserted in order, the insert of one chunk overlaps with receiving the next one,
+    // the stream stalls when the insert buffer is full since no more chunk is read from it
+    auto request_context = GetContext(context);
+    std::string collection_name, partition_tag;
+    engine::VectorsData chunks[2];
+    std::future<Status> inserting;
+    int current = 0;
+    int64_t row_count = 0;
+    uint64_t lsn = 0;
+
+    auto wait_inserting = [&](engine::VectorsData& vectors) -> Status {
+        Status insert_status = inserting.get();
+        if (insert_status.ok()) {
+            ConstructIdRanges(vectors.id_array_, response);
+            row_count += vectors.vector_count_;
+            lsn = std::max(lsn, vectors.lsn_);
+        }
+        return insert_status;
+    };
+
+    Status status;
+    ::milvus::grpc::PackedInsertParam chunk;
+    for (bool first = true; reader->Read(&chunk); first = false) {
+        if (first) {
+            collection_name = chunk.collection_name();
+            partition_tag = chunk.partition_tag();
+        }
+
+        // step 1: copy vector data of the chunk
+        engine::VectorsData& vectors = chunks[current];
+        vectors = engine::VectorsData();
+        status = CopyPackedRecords(chunk.data_type(), chunk.dimension(), chunk.vector_data(), chunk.row_id_array(),
+                                   vectors);
+        if (!status.ok()) {
+            break;
+        }
+
+        // step 2: wait the previous chunk, stop at the first failure
+        if (inserting.valid()) {
+            status = wait_inserting(chunks[1 - current]);
+            if (!status.ok()) {
+                break;
+            }
+        }
+
+        // step 3: insert the chunk in background
+        inserting = std::async(std::launch::async, [&, current]() {
+            return request_handler_.Insert(request_context, collection_name, chunks[current], partition_tag);
+        });
+        current = 1 - current;
+    }
+
+    if (inserting.valid()) {
+        Status last_status = wait_inserting(chunks[1 - current]);
+        if (status.ok()) {
+            status = last_status;
+        }
+    }
+
+    response->set_row_count(row_count);
+    response->set_lsn(lsn);
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::InsertEntity(::grpc::ServerContext* context, const ::milvus::grpc::HInsertParam* request,
+                                 ::milvus::grpc::HEntityIDs* response) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: copy vector data and attributes
+    engine::VectorsData vectors;
+    Status status =
+        CopyEntities(request->entities(), request->entity_id_array(), request->extra_params(), vectors);
+
+    // step 2: insert entities
+    if (status.ok()) {
+        status =
+            request_handler_.Insert(GetContext(context), request->collection_name(), vectors, request->partition_tag());
+    }
+
+    // step 3: return id array
+    response->mutable_entity_id_array()->Resize(static_cast<int>(vectors.id_array_.size()), 0);
+    memcpy(response->mutable_entity_id_array()->mutable_data(), vectors.id_array_.data(),
+           vectors.id_array_.size() * sizeof(int64_t));
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::HybridSearch(::grpc::ServerContext* context, const ::milvus::grpc::HSearchParam* request,
+                                 ::milvus::grpc::TopKQueryResult* response) {
+    CHECK_NULLPTR_RETURN(request);
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s begin.", GetContext(context)->RequestID().c_str(), __func__);
+
+    // step 1: convert the boolean query into a binary query
+    engine::VectorsData vectors;
+    query::VectorQueryPtr vector_query;
+    auto boolean_query = std::make_shared<query::BooleanQuery>(query::Occur::MUST);
+    Status status = DeserializeGeneralQuery(request->general_query(), boolean_query, vector_query, vectors);
+    if (status.ok() && vector_query == nullptr) {
+        status = Status(SERVER_INVALID_ARGUMENT, "No vector query in hybrid search");
+    }
+    auto general_query = std::make_shared<query::GeneralQuery>();
+    if (status.ok()) {
+        status = query::GenBinaryQuery(boolean_query, general_query->bin);
+    }
+    if (!status.ok()) {
+        LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+        SET_RESPONSE(response->mutable_status(), status, context);
+        return ::grpc::Status::OK;
+    }
+
+    // step 2: partition tags
+    std::vector<std::string> partitions;
+    std::copy(request->partition_tag_array().begin(), request->partition_tag_array().end(),
+              std::back_inserter(partitions));
+
+    // step 3: search vectors among the entities matching the query
+    TopKQueryResult result;
+    status = request_handler_.HybridSearch(GetContext(context), request->collection_name(), partitions, general_query,
+                                           vectors, vector_query->topk, vector_query->extra_params, result);
+
+    // step 4: construct and return result
+    ConstructResults(result, response);
+
+    LOG_SERVER_INFO_ << LogOut("Request [%s] %s end.", GetContext(context)->RequestID().c_str(), __func__);
+    SET_RESPONSE(response->mutable_status(), status, context);
+
+    return ::grpc::Status::OK;
+}
+
 }  // namespace grpc
 }  // namespace server
 }  // namespace milvus
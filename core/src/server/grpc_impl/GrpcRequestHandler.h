@@ -336,6 +336,64 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service,
     Compact(::grpc::ServerContext* context, const ::milvus::grpc::CollectionName* request,
             ::milvus::grpc::Status* response);
 
+    // *
+    // @brief This method is used to add vectors packed in one buffer to collection.
+    //
+    // @param PackedInsertParam, vectors and ids to be inserted.
+    //
+    // @return VectorIds
+    ::grpc::Status
+    InsertPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedInsertParam* request,
+                 ::milvus::grpc::VectorIds* response) override;
+
+    // *
+    // @brief This method is used to query vectors packed in one buffer in collection.
+    //
+    // @param PackedSearchParam, search parameters.
+    //
+    // @return TopKQueryResult
+    ::grpc::Status
+    SearchPacked(::grpc::ServerContext* context, const ::milvus::grpc::PackedSearchParam* request,
+                 ::milvus::grpc::TopKQueryResult* response) override;
+
+    // *
+    // @brief This method is used to insert a stream of packed vector chunks into collection.
+    //        Collection name and partition tag are taken from the first chunk.
+    //
+    // @param PackedInsertParam, stream of vectors and ids to be inserted.
+    //
+    // @return InsertStreamResult
+    ::grpc::Status
+    InsertStream(::grpc::ServerContext* context, ::grpc::ServerReader<::milvus::grpc::PackedInsertParam>* reader,
+                 ::milvus::grpc::InsertStreamResult* response) override;
+
+    // the stream is read through its interface, so that the chunks can be fed without a grpc call
+    ::grpc::Status
+    InsertStream(::grpc::ServerContext* context,
+                 ::grpc::ServerReaderInterface<::milvus::grpc::PackedInsertParam>* reader,
+                 ::milvus::grpc::InsertStreamResult* response);
+
+    // *
+    // @brief This method is used to insert vectors along with their attributes into collection.
+    //        Types of the attributes are given by "field_types" in extra params.
+    //
+    // @param HInsertParam, vectors, attributes and ids to be inserted.
+    //
+    // @return HEntityIDs
+    ::grpc::Status
+    InsertEntity(::grpc::ServerContext* context, const ::milvus::grpc::HInsertParam* request,
+                 ::milvus::grpc::HEntityIDs* response) override;
+
+    // *
+    // @brief This method is used to search vectors among the entities matching the term and range queries.
+    //
+    // @param HSearchParam, boolean query holding one vector query.
+    //
+    // @return TopKQueryResult
+    ::grpc::Status
+    HybridSearch(::grpc::ServerContext* context, const ::milvus::grpc::HSearchParam* request,
+                 ::milvus::grpc::TopKQueryResult* response) override;
+
     void
     RegisterRequestHandler(const RequestHandler& handler) {
         request_handler_ = handler;
@@ -23,6 +23,8 @@ const char* NAME_ENGINE_TYPE_RNSG = "RNSG";
 const char* NAME_ENGINE_TYPE_IVFPQ = "IVFPQ";
 const char* NAME_ENGINE_TYPE_HNSW = "HNSW";
 const char* NAME_ENGINE_TYPE_ANNOY = "ANNOY";
+const char* NAME_ENGINE_TYPE_HNSW_SQ8 = "HNSW_SQ8";
+const char* NAME_ENGINE_TYPE_IVFPQ_FASTSCAN = "IVFPQ_FASTSCAN";
 
 const char* NAME_METRIC_TYPE_L2 = "L2";
 const char* NAME_METRIC_TYPE_IP = "IP";
@@ -32,6 +34,9 @@ const char* NAME_METRIC_TYPE_TANIMOTO = "TANIMOTO";
 const char* NAME_METRIC_TYPE_SUBSTRUCTURE = "SUBSTRUCTURE";
 const char* NAME_METRIC_TYPE_SUPERSTRUCTURE = "SUPERSTRUCTURE";
 
+const char* CONTENT_TYPE_OCTET_STREAM = "application/octet-stream";
+const char* CONTENT_TYPE_NPY = "application/x-npy";
+
 ////////////////////////////////////////////////////
 const int64_t VALUE_COLLECTION_INDEX_FILE_SIZE_DEFAULT = 1024;
 const char* VALUE_COLLECTION_METRIC_TYPE_DEFAULT = "L2";
@@ -54,6 +59,8 @@ const std::unordered_map<engine::EngineType, std::string> IndexMap = {
     {engine::EngineType::FAISS_PQ, NAME_ENGINE_TYPE_IVFPQ},
     {engine::EngineType::HNSW, NAME_ENGINE_TYPE_HNSW},
     {engine::EngineType::ANNOY, NAME_ENGINE_TYPE_ANNOY},
+    {engine::EngineType::HNSW_SQ8, NAME_ENGINE_TYPE_HNSW_SQ8},
+    {engine::EngineType::FAISS_PQ_FASTSCAN, NAME_ENGINE_TYPE_IVFPQ_FASTSCAN},
 };
 
 const std::unordered_map<std::string, engine::EngineType> IndexNameMap = {
@@ -65,6 +72,8 @@ const std::unordered_map<std::string, engine::EngineType> IndexNameMap = {
     {NAME_ENGINE_TYPE_IVFPQ, engine::EngineType::FAISS_PQ},
     {NAME_ENGINE_TYPE_HNSW, engine::EngineType::HNSW},
     {NAME_ENGINE_TYPE_ANNOY, engine::EngineType::ANNOY},
+    {NAME_ENGINE_TYPE_HNSW_SQ8, engine::EngineType::HNSW_SQ8},
+    {NAME_ENGINE_TYPE_IVFPQ_FASTSCAN, engine::EngineType::FAISS_PQ_FASTSCAN},
 };
 
 const std::unordered_map<engine::MetricType, std::string> MetricMap = {
@@ -28,6 +28,8 @@ extern const char* NAME_ENGINE_TYPE_RNSG;
 extern const char* NAME_ENGINE_TYPE_IVFPQ;
 extern const char* NAME_ENGINE_TYPE_HNSW;
 extern const char* NAME_ENGINE_TYPE_ANNOY;
+extern const char* NAME_ENGINE_TYPE_HNSW_SQ8;
+extern const char* NAME_ENGINE_TYPE_IVFPQ_FASTSCAN;
 
 extern const char* NAME_METRIC_TYPE_L2;
 extern const char* NAME_METRIC_TYPE_IP;
@@ -37,6 +39,9 @@ extern const char* NAME_METRIC_TYPE_TANIMOTO;
 extern const char* NAME_METRIC_TYPE_SUBSTRUCTURE;
 extern const char* NAME_METRIC_TYPE_SUPERSTRUCTURE;
 
+extern const char* CONTENT_TYPE_OCTET_STREAM;
+extern const char* CONTENT_TYPE_NPY;
+
 ////////////////////////////////////////////////////
 extern const int64_t VALUE_COLLECTION_INDEX_FILE_SIZE_DEFAULT;
 extern const char* VALUE_COLLECTION_METRIC_TYPE_DEFAULT;
@@ -26,6 +26,7 @@
 #include "server/web_impl/dto/PartitionDto.hpp"
 #include "server/web_impl/dto/VectorDto.hpp"
 #include "server/web_impl/handler/WebRequestHandler.h"
+#include "server/web_impl/utils/Util.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
@@ -596,7 +597,7 @@ class WebController : public oatpp::web::server::api::ApiController {
     ADD_CORS(Insert)
 
     ENDPOINT("POST", "/collections/{collection_name}/vectors", Insert, PATH(String, collection_name),
-             BODY_STRING(String, body)) {
+             QUERIES(const QueryParams&, query_params), REQUEST(std::shared_ptr<IncomingRequest>, request)) {
         TimeRecorder tr(std::string(WEB_LOG_PREFIX) + "POST \'/collections/" + collection_name->std_str() +
                         "/vectors\'");
         tr.RecordSection("Received request.");
@@ -604,8 +605,17 @@ class WebController : public oatpp::web::server::api::ApiController {
         auto ids_dto = VectorIdsDto::createShared();
         WebRequestHandler handler = WebRequestHandler();
 
+        // vectors in octet-stream or npy body skip json parsing
+        auto body = request->readBodyToString();
+        auto content_type = request->getHeader(Header::CONTENT_TYPE);
+        StatusDto::ObjectWrapper status_dto;
+        if (IsContentType(content_type, CONTENT_TYPE_OCTET_STREAM) || IsContentType(content_type, CONTENT_TYPE_NPY)) {
+            status_dto = handler.InsertBinary(collection_name, content_type, query_params, body, ids_dto);
+        } else {
+            status_dto = handler.Insert(collection_name, body, ids_dto);
+        }
+
         std::shared_ptr<OutgoingResponse> response;
-        auto status_dto = handler.Insert(collection_name, body, ids_dto);
         switch (status_dto->code->getValue()) {
             case StatusCode::SUCCESS:
                 response = createDtoResponse(Status::CODE_201, ids_dto);
@@ -626,19 +636,34 @@ class WebController : public oatpp::web::server::api::ApiController {
     ADD_CORS(VectorsOp)
 
     ENDPOINT("PUT", "/collections/{collection_name}/vectors", VectorsOp, PATH(String, collection_name),
-             BODY_STRING(String, body)) {
+             QUERIES(const QueryParams&, query_params), REQUEST(std::shared_ptr<IncomingRequest>, request)) {
         TimeRecorder tr(std::string(WEB_LOG_PREFIX) + "PUT \'/collections/" + collection_name->std_str() +
                         "/vectors\'");
         tr.RecordSection("Received request.");
 
         WebRequestHandler handler = WebRequestHandler();
 
+        // query vectors in octet-stream or npy body are searched, search parameters are in query params
+        auto body = request->readBodyToString();
+        auto content_type = request->getHeader(Header::CONTENT_TYPE);
+        bool binary_body =
+            IsContentType(content_type, CONTENT_TYPE_OCTET_STREAM) || IsContentType(content_type, CONTENT_TYPE_NPY);
+        bool binary_result = binary_body && IsContentType(request->getHeader("Accept"), CONTENT_TYPE_OCTET_STREAM);
+
         OString result;
         std::shared_ptr<OutgoingResponse> response;
-        auto status_dto = handler.VectorsOp(collection_name, body, result);
+        StatusDto::ObjectWrapper status_dto;
+        if (binary_body) {
+            status_dto = handler.SearchBinary(collection_name, content_type, query_params, body, binary_result, result);
+        } else {
+            status_dto = handler.VectorsOp(collection_name, body, result);
+        }
         switch (status_dto->code->getValue()) {
             case StatusCode::SUCCESS:
                 response = createResponse(Status::CODE_200, result);
+                if (binary_result) {
+                    response->putHeader(Header::CONTENT_TYPE, CONTENT_TYPE_OCTET_STREAM);
+                }
                 break;
             case StatusCode::COLLECTION_NOT_EXISTS:
                 response = createDtoResponse(Status::CODE_404, status_dto);
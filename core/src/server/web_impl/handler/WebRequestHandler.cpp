@@ -12,6 +12,7 @@
 #include "server/web_impl/handler/WebRequestHandler.h"
 
 #include <algorithm>
+#include <cstring>
 #include <ctime>
 #include <string>
 #include <unordered_map>
@@ -68,6 +69,7 @@ WebErrorMap(ErrorCode code) {
 
         {DB_NOT_FOUND, StatusCode::COLLECTION_NOT_EXISTS},
         {DB_META_TRANSACTION_FAILED, StatusCode::META_FAILED},
+        {DB_INSERT_BUFFER_FULL, StatusCode::CACHE_FAILED},
     };
     if (code < StatusCode::MAX) {
         return StatusCode(code);
@@ -80,6 +82,16 @@ WebErrorMap(ErrorCode code) {
 
 using FloatJson = nlohmann::basic_json<std::map, std::vector, std::string, bool, std::int64_t, std::uint64_t, float>;
 
+namespace {
+bool
+IsBinaryMetric(int32_t metric_type) {
+    auto metric = engine::MetricType(metric_type);
+    return engine::MetricType::HAMMING == metric || engine::MetricType::JACCARD == metric ||
+           engine::MetricType::TANIMOTO == metric || engine::MetricType::SUPERSTRUCTURE == metric ||
+           engine::MetricType::SUBSTRUCTURE == metric;
+}
+}  // namespace
+
 /////////////////////////////////// Private methods ///////////////////////////////////////
 void
 WebRequestHandler::AddStatusToJson(nlohmann::json& json, int64_t code, const std::string& msg) {
@@ -92,10 +104,7 @@ WebRequestHandler::IsBinaryCollection(const std::string& collection_name, bool&
     CollectionSchema schema;
     auto status = request_handler_.DescribeCollection(context_ptr_, collection_name, schema);
     if (status.ok()) {
-        auto metric = engine::MetricType(schema.metric_type_);
-        bin = engine::MetricType::HAMMING == metric || engine::MetricType::JACCARD == metric ||
-              engine::MetricType::TANIMOTO == metric || engine::MetricType::SUPERSTRUCTURE == metric ||
-              engine::MetricType::SUBSTRUCTURE == metric;
+        bin = IsBinaryMetric(schema.metric_type_);
     }
 
     return status;
@@ -108,8 +117,10 @@ WebRequestHandler::CopyRecordsFromJson(const nlohmann::json& json, engine::Vecto
     }
 
     vectors.vector_count_ = json.size();
+    size_t reserve_size = json.empty() || !json[0].is_array() ? 0 : json.size() * json[0].size();
 
     if (!bin) {
+        vectors.float_data_.reserve(reserve_size);
         for (auto& vec : json) {
             if (!vec.is_array()) {
                 return Status(ILLEGAL_BODY, "A vector in field \"vectors\" must be a float array");
@@ -119,6 +130,7 @@ WebRequestHandler::CopyRecordsFromJson(const nlohmann::json& json, engine::Vecto
             }
         }
     } else {
+        vectors.binary_data_.reserve(reserve_size);
         for (auto& vec : json) {
             if (!vec.is_array()) {
                 return Status(ILLEGAL_BODY, "A vector in field \"vectors\" must be a float array");
@@ -132,6 +144,90 @@ WebRequestHandler::CopyRecordsFromJson(const nlohmann::json& json, engine::Vecto
     return Status::OK();
 }
 
+Status
+WebRequestHandler::CopyRecordsFromBinary(const std::string& collection_name, const OString& content_type,
+                                         const OQueryParams& query_params, const OString& body,
+                                         engine::VectorsData& vectors) {
+    if (nullptr == body.get() || body->getSize() == 0) {
+        return Status(BODY_FIELD_LOSS, "Request payload is required.");
+    }
+
+    CollectionSchema schema;
+    auto status = request_handler_.DescribeCollection(context_ptr_, collection_name, schema);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // binary vector dimension is in bits, each row is packed into bytes
+    bool bin = IsBinaryMetric(schema.metric_type_);
+    int64_t row_size = bin ? schema.dimension_ / 8 : schema.dimension_;
+    size_t elem_size = bin ? sizeof(uint8_t) : sizeof(float);
+    const char* data = reinterpret_cast<const char*>(body->getData());
+    size_t data_size = body->getSize();
+
+    if (IsContentType(content_type, CONTENT_TYPE_NPY)) {
+        // shape and dtype come with the npy header
+        std::string descr;
+        std::vector<int64_t> shape;
+        size_t header_size = 0;
+        status = ParseNpyHeader(data, data_size, descr, shape, header_size);
+        if (!status.ok()) {
+            return status;
+        }
+
+        bool descr_match = bin ? (descr == "|u1" || descr == "<u1") : descr == "<f4";
+        if (!descr_match) {
+            return Status(ILLEGAL_BODY, "Npy dtype " + descr + " doesn't match collection, " +
+                                            (bin ? "uint8" : "little-endian float32") + " is required");
+        }
+        if (shape.empty() || shape.size() > 2 || shape.back() != row_size) {
+            return Status(ILLEGAL_DIMENSION, "Npy shape doesn't match collection dimension");
+        }
+
+        data += header_size;
+        data_size -= header_size;
+        int64_t row_count = shape.size() == 2 ? shape[0] : 1;
+        if (data_size != static_cast<size_t>(row_count * row_size) * elem_size) {
+            return Status(ILLEGAL_BODY, "Npy data size doesn't match its shape");
+        }
+    } else {
+        // raw row-major buffer, the optional dim and dtype are checked against collection
+        int64_t dim = schema.dimension_;
+        status = ParseQueryInteger(query_params, "dim", dim);
+        if (!status.ok()) {
+            return status;
+        }
+        if (dim != schema.dimension_) {
+            return Status(ILLEGAL_DIMENSION, "Query param \'dim\' doesn't match collection dimension");
+        }
+
+        std::string dtype = bin ? "uint8" : "float32";
+        status = ParseQueryStr(query_params, "dtype", dtype);
+        if (!status.ok()) {
+            return status;
+        }
+        if (dtype != (bin ? "uint8" : "float32")) {
+            return Status(ILLEGAL_QUERY_PARAM, "Query param \'dtype\' doesn't match collection");
+        }
+
+        if (row_size <= 0 || data_size % (row_size * elem_size) != 0) {
+            return Status(ILLEGAL_BODY, "Request body size is not a multiple of vector size");
+        }
+    }
+
+    // one copy from the request body into the insert/search buffer
+    vectors.vector_count_ = data_size / (row_size * elem_size);
+    if (bin) {
+        vectors.binary_data_.resize(data_size);
+        memcpy(vectors.binary_data_.data(), data, data_size);
+    } else {
+        vectors.float_data_.resize(data_size / sizeof(float));
+        memcpy(vectors.float_data_.data(), data, data_size);
+    }
+
+    return Status::OK();
+}
+
 ///////////////////////// WebRequestHandler methods ///////////////////////////////////////
 Status
 WebRequestHandler::GetCollectionMetaInfo(const std::string& collection_name, nlohmann::json& json_out) {
@@ -521,12 +617,18 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
         return status;
     }
 
+    ConstructSearchResult(result, result_str);
+    return Status::OK();
+}
+
+void
+WebRequestHandler::ConstructSearchResult(const TopKQueryResult& result, std::string& result_str) {
     nlohmann::json result_json;
     result_json["num"] = result.row_num_;
     if (result.row_num_ == 0) {
         result_json["result"] = std::vector<int64_t>();
         result_str = result_json.dump();
-        return Status::OK();
+        return;
     }
 
     auto step = result.id_list_.size() / result.row_num_;
@@ -543,8 +645,6 @@ WebRequestHandler::Search(const std::string& collection_name, const nlohmann::js
     }
     result_json["result"] = search_result_json;
     result_str = result_json.dump();
-
-    return Status::OK();
 }
 
 Status
@@ -1399,6 +1499,120 @@ WebRequestHandler::VectorsOp(const OString& collection_name, const OString& payl
     ASSIGN_RETURN_STATUS_DTO(status)
 }
 
+StatusDto::ObjectWrapper
+WebRequestHandler::InsertBinary(const OString& collection_name, const OString& content_type,
+                                const OQueryParams& query_params, const OString& body,
+                                VectorIdsDto::ObjectWrapper& ids_dto) {
+    try {
+        // step 1: copy vectors
+        engine::VectorsData vectors;
+        auto status = CopyRecordsFromBinary(collection_name->std_str(), content_type, query_params, body, vectors);
+        if (!status.ok()) {
+            ASSIGN_RETURN_STATUS_DTO(status)
+        }
+
+        // step 2: copy id array
+        std::string ids_str;
+        ParseQueryStr(query_params, "ids", ids_str);
+        if (!ids_str.empty()) {
+            std::vector<std::string> ids;
+            StringHelpFunctions::SplitStringByDelimeter(ids_str, ",", ids);
+            for (auto& id : ids) {
+                vectors.id_array_.emplace_back(std::stol(id));
+            }
+        }
+
+        // step 3: copy partition tag
+        std::string tag;
+        ParseQueryStr(query_params, "partition_tag", tag);
+
+        // step 4: construct result
+        status = request_handler_.Insert(context_ptr_, collection_name->std_str(), vectors, tag);
+        if (status.ok()) {
+            ids_dto->ids = ids_dto->ids->createShared();
+            for (auto& id : vectors.id_array_) {
+                ids_dto->ids->pushBack(std::to_string(id).c_str());
+            }
+        }
+
+        ASSIGN_RETURN_STATUS_DTO(status)
+    } catch (std::exception& e) {
+        RETURN_STATUS_DTO(SERVER_UNEXPECTED_ERROR, e.what());
+    }
+}
+
+StatusDto::ObjectWrapper
+WebRequestHandler::SearchBinary(const OString& collection_name, const OString& content_type,
+                                const OQueryParams& query_params, const OString& body, bool binary_result,
+                                OString& response) {
+    try {
+        // step 1: parse search parameters
+        int64_t topk = 0;
+        auto status = ParseQueryInteger(query_params, "topk", topk, false);
+        if (!status.ok()) {
+            ASSIGN_RETURN_STATUS_DTO(status)
+        }
+
+        std::string params_str;
+        status = ParseQueryStr(query_params, "params", params_str, false);
+        if (!status.ok()) {
+            ASSIGN_RETURN_STATUS_DTO(status)
+        }
+        auto params_json = nlohmann::json::parse(params_str);
+
+        std::string tags_str;
+        std::vector<std::string> partition_tags;
+        ParseQueryStr(query_params, "partition_tags", tags_str);
+        if (!tags_str.empty()) {
+            StringHelpFunctions::SplitStringByDelimeter(tags_str, ",", partition_tags);
+        }
+
+        // step 2: copy vectors
+        engine::VectorsData vectors;
+        status = CopyRecordsFromBinary(collection_name->std_str(), content_type, query_params, body, vectors);
+        if (!status.ok()) {
+            ASSIGN_RETURN_STATUS_DTO(status)
+        }
+
+        // step 3: search
+        TopKQueryResult result;
+        std::vector<std::string> file_ids;
+        status = request_handler_.Search(context_ptr_, collection_name->std_str(), vectors, topk, params_json,
+                                         partition_tags, file_ids, result);
+        if (!status.ok()) {
+            response = "NULL";
+            ASSIGN_RETURN_STATUS_DTO(status)
+        }
+
+        // step 4: construct result
+        int64_t nq = result.row_num_;
+        int64_t k = nq > 0 ? result.id_list_.size() / nq : 0;
+        if (binary_result) {
+            // layout: int64 nq, int64 topk, int64 ids[nq * topk], float distances[nq * topk]
+            size_t ids_size = result.id_list_.size() * sizeof(int64_t);
+            size_t dist_size = result.distance_list_.size() * sizeof(float);
+            std::string result_str(2 * sizeof(int64_t) + ids_size + dist_size, '\0');
+            char* ptr = &result_str[0];
+            memcpy(ptr, &nq, sizeof(int64_t));
+            memcpy(ptr + sizeof(int64_t), &k, sizeof(int64_t));
+            memcpy(ptr + 2 * sizeof(int64_t), result.id_list_.data(), ids_size);
+            memcpy(ptr + 2 * sizeof(int64_t) + ids_size, result.distance_list_.data(), dist_size);
+            response = OString(result_str.data(), result_str.size(), true);
+        } else {
+            std::string result_str;
+            ConstructSearchResult(result, result_str);
+            response = result_str.c_str();
+        }
+
+        ASSIGN_RETURN_STATUS_DTO(status)
+    } catch (nlohmann::detail::parse_error& e) {
+        std::string emsg = "json error: code=" + std::to_string(e.id) + ", reason=" + e.what();
+        RETURN_STATUS_DTO(ILLEGAL_QUERY_PARAM, emsg.c_str());
+    } catch (std::exception& e) {
+        RETURN_STATUS_DTO(SERVER_UNEXPECTED_ERROR, e.what());
+    }
+}
+
 /**********
  *
  * System {
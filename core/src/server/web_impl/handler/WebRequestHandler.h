@@ -87,6 +87,10 @@ class WebRequestHandler {
     Status
     CopyRecordsFromJson(const nlohmann::json& json, engine::VectorsData& vectors, bool bin);
 
+    Status
+    CopyRecordsFromBinary(const std::string& collection_name, const OString& content_type,
+                          const OQueryParams& query_params, const OString& body, engine::VectorsData& vectors);
+
  protected:
     Status
     GetCollectionMetaInfo(const std::string& collection_name, nlohmann::json& json_out);
@@ -129,6 +133,9 @@ class WebRequestHandler {
     Status
     Search(const std::string& collection_name, const nlohmann::json& json, std::string& result_str);
 
+    void
+    ConstructSearchResult(const TopKQueryResult& result, std::string& result_str);
+
     Status
     DeleteByIDs(const std::string& collection_name, const nlohmann::json& json, std::string& result_str);
 
@@ -214,6 +221,17 @@ class WebRequestHandler {
     StatusDto::ObjectWrapper
     VectorsOp(const OString& collection_name, const OString& payload, OString& response);
 
+    /**
+     * Vectors in application/octet-stream or application/x-npy body, other fields in query params
+     */
+    StatusDto::ObjectWrapper
+    InsertBinary(const OString& collection_name, const OString& content_type, const OQueryParams& query_params,
+                 const OString& body, VectorIdsDto::ObjectWrapper& ids_dto);
+
+    StatusDto::ObjectWrapper
+    SearchBinary(const OString& collection_name, const OString& content_type, const OQueryParams& query_params,
+                 const OString& body, bool binary_result, OString& response);
+
     /**
      *
      * System
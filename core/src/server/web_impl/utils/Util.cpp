@@ -12,6 +12,9 @@
 #include "server/web_impl/utils/Util.h"
 #include <fiu-local.h>
 
+#include <cstring>
+
+#include "utils/StringHelpFunctions.h"
 #include "utils/ValidationUtil.h"
 
 namespace milvus {
@@ -70,6 +73,96 @@ ParseQueryBool(const OQueryParams& query_params, const std::string& key, bool& v
     return Status::OK();
 }
 
+bool
+IsContentType(const OString& content_type, const char* expected) {
+    if (nullptr == content_type.get()) {
+        return false;
+    }
+
+    // ignore parameters such as "; charset=..."
+    std::string type = content_type->std_str();
+    return type.compare(0, type.find(';'), expected) == 0;
+}
+
+Status
+ParseNpyHeader(const char* data, size_t size, std::string& descr, std::vector<int64_t>& shape, size_t& header_size) {
+    // format: magic "\x93NUMPY", major, minor, header length (2 bytes in v1, 4 bytes in v2/v3), python dict literal
+    static const char NPY_MAGIC[] = "\x93NUMPY";
+    const size_t magic_size = sizeof(NPY_MAGIC) - 1;
+    if (size < magic_size + 4 || memcmp(data, NPY_MAGIC, magic_size) != 0) {
+        return Status(ILLEGAL_BODY, "Request body is not a npy array");
+    }
+
+    auto byte = [&](size_t i) -> size_t { return static_cast<uint8_t>(data[i]); };
+    size_t major = byte(magic_size);
+    size_t dict_offset = 0, dict_size = 0;
+    if (major == 1) {
+        dict_offset = magic_size + 4;
+        dict_size = byte(magic_size + 2) | (byte(magic_size + 3) << 8);
+    } else if (major == 2 || major == 3) {
+        dict_offset = magic_size + 6;
+        if (size < dict_offset) {
+            return Status(ILLEGAL_BODY, "Npy header is truncated");
+        }
+        dict_size = byte(magic_size + 2) | (byte(magic_size + 3) << 8) | (byte(magic_size + 4) << 16) |
+                    (byte(magic_size + 5) << 24);
+    } else {
+        return Status(ILLEGAL_BODY, "Unsupported npy version " + std::to_string(major));
+    }
+    if (size < dict_offset + dict_size) {
+        return Status(ILLEGAL_BODY, "Npy header is truncated");
+    }
+    header_size = dict_offset + dict_size;
+
+    // header dict looks like {'descr': '<f4', 'fortran_order': False, 'shape': (100, 128), }
+    std::string dict(data + dict_offset, dict_size);
+    auto value_of = [&](const std::string& key) -> size_t {
+        auto pos = dict.find("'" + key + "'");
+        if (pos == std::string::npos) {
+            return pos;
+        }
+        pos = dict.find(':', pos);
+        return pos == std::string::npos ? pos : dict.find_first_not_of(' ', pos + 1);
+    };
+
+    auto descr_pos = value_of("descr");
+    auto order_pos = value_of("fortran_order");
+    auto shape_pos = value_of("shape");
+    if (descr_pos == std::string::npos || order_pos == std::string::npos || shape_pos == std::string::npos) {
+        return Status(ILLEGAL_BODY, "Npy header lacks descr, fortran_order or shape");
+    }
+
+    auto descr_end = dict.find('\'', descr_pos + 1);
+    if (dict[descr_pos] != '\'' || descr_end == std::string::npos) {
+        return Status(ILLEGAL_BODY, "Illegal descr in npy header");
+    }
+    descr = dict.substr(descr_pos + 1, descr_end - descr_pos - 1);
+
+    if (dict.compare(order_pos, 5, "False") != 0) {
+        return Status(ILLEGAL_BODY, "Only C-ordered npy array is supported");
+    }
+
+    auto shape_end = dict.find(')', shape_pos);
+    if (dict[shape_pos] != '(' || shape_end == std::string::npos) {
+        return Status(ILLEGAL_BODY, "Illegal shape in npy header");
+    }
+    std::vector<std::string> dims;
+    StringHelpFunctions::SplitStringByDelimeter(dict.substr(shape_pos + 1, shape_end - shape_pos - 1), ",", dims);
+    shape.clear();
+    for (auto& dim : dims) {
+        StringHelpFunctions::TrimStringBlank(dim);
+        if (dim.empty()) {
+            continue;
+        }
+        if (!ValidationUtil::ValidateStringIsNumber(dim).ok()) {
+            return Status(ILLEGAL_BODY, "Illegal shape in npy header");
+        }
+        shape.push_back(std::stol(dim));
+    }
+
+    return Status::OK();
+}
+
 }  // namespace web
 }  // namespace server
 }  // namespace milvus
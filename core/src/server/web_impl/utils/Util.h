@@ -31,6 +31,12 @@ ParseQueryStr(const OQueryParams& query_params, const std::string& key, std::str
 Status
 ParseQueryBool(const OQueryParams& query_params, const std::string& key, bool& value, bool nullable = true);
 
+bool
+IsContentType(const OString& content_type, const char* expected);
+
+Status
+ParseNpyHeader(const char* data, size_t size, std::string& descr, std::vector<int64_t>& shape, size_t& header_size);
+
 }  // namespace web
 }  // namespace server
 }  // namespace milvus
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,15 @@ class IOReader {
 
     virtual void
     close() = 0;
+
+    // return the next size bytes and move forward, the buffer is still valid after close(),
+    // readers able to expose their storage directly override it to avoid the copy
+    virtual std::shared_ptr<uint8_t[]>
+    read_shared(int64_t size) {
+        std::shared_ptr<uint8_t[]> data(new uint8_t[size]);
+        read(data.get(), size);
+        return data;
+    }
 };
 
 using IOReaderPtr = std::shared_ptr<IOReader>;
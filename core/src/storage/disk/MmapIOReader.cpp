@@ -0,0 +1,112 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/disk/MmapIOReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "utils/Error.h"
+#include "utils/Exception.h"
+
+namespace milvus {
+namespace storage {
+
+bool
+MmapIOReader::open(const std::string& name) {
+    close();
+    name_ = name;
+
+    int fd = ::open(name_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // an empty file cannot be mapped, it is opened with nothing to read
+    if (st.st_size > 0) {
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        size_t map_size = st.st_size;
+        mapping_ = std::shared_ptr<uint8_t>(static_cast<uint8_t*>(addr),
+                                            [map_size](uint8_t* p) { munmap(p, map_size); });
+        length_ = st.st_size;
+    }
+
+    ::close(fd);
+    return true;
+}
+
+void
+MmapIOReader::read(void* ptr, int64_t size) {
+    if (size <= 0) {
+        return;
+    }
+    if (pos_ < 0 || pos_ + size > length_) {
+        std::string err_msg = "Failed to read " + std::to_string(size) + " bytes at offset " + std::to_string(pos_) +
+                              " from file: " + name_ + ", file length is " + std::to_string(length_);
+        throw Exception(SERVER_UNEXPECTED_ERROR, err_msg);
+    }
+    memcpy(ptr, mapping_.get() + pos_, size);
+    pos_ += size;
+}
+
+void
+MmapIOReader::seekg(int64_t pos) {
+    pos_ = pos;
+}
+
+int64_t
+MmapIOReader::length() {
+    return length_;
+}
+
+void
+MmapIOReader::close() {
+    mapping_ = nullptr;
+    length_ = 0;
+    pos_ = 0;
+}
+
+std::shared_ptr<uint8_t[]>
+MmapIOReader::read_shared(int64_t size) {
+    if (size <= 0 || pos_ < 0 || pos_ + size > length_) {
+        return IOReader::read_shared(size);
+    }
+
+    // the whole range is about to be used, e.g. an index or all the raw vectors of a segment, read it ahead;
+    // small reads through read() only fault in the pages they touch
+    static const int64_t page_size = sysconf(_SC_PAGESIZE);
+    int64_t begin = pos_ / page_size * page_size;
+    madvise(mapping_.get() + begin, pos_ + size - begin, MADV_WILLNEED);
+
+    // aliasing constructor, shares ownership of the whole mapping
+    std::shared_ptr<uint8_t[]> data(mapping_, mapping_.get() + pos_);
+    pos_ += size;
+    return data;
+}
+
+}  // namespace storage
+}  // namespace milvus
@@ -0,0 +1,65 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include "storage/IOReader.h"
+
+namespace milvus {
+namespace storage {
+
+// read-only memory mapped file, buffers returned by read_shared() point into the mapping
+// and keep it alive, so the file is unmapped when both the reader and the buffers are gone
+class MmapIOReader : public IOReader {
+ public:
+    MmapIOReader() = default;
+    ~MmapIOReader() = default;
+
+    // No copy and move
+    MmapIOReader(const MmapIOReader&) = delete;
+    MmapIOReader(MmapIOReader&&) = delete;
+
+    MmapIOReader&
+    operator=(const MmapIOReader&) = delete;
+    MmapIOReader&
+    operator=(MmapIOReader&&) = delete;
+
+    bool
+    open(const std::string& name) override;
+
+    void
+    read(void* ptr, int64_t size) override;
+
+    void
+    seekg(int64_t pos) override;
+
+    int64_t
+    length() override;
+
+    void
+    close() override;
+
+    std::shared_ptr<uint8_t[]>
+    read_shared(int64_t size) override;
+
+ public:
+    std::string name_;
+    std::shared_ptr<uint8_t> mapping_;
+    int64_t length_ = 0;
+    int64_t pos_ = 0;
+};
+
+using MmapIOReaderPtr = std::shared_ptr<MmapIOReader>;
+
+}  // namespace storage
+}  // namespace milvus
@@ -271,6 +271,8 @@ CommonUtil::EraseFromCache(const std::string& item_key) {
     cache::CpuCacheMgr::GetInstance()->EraseItem(item_key);
     cache::CpuCacheMgr::GetInstance()->EraseItem(segment_dir + cache::BloomFilter_Suffix);
     cache::CpuCacheMgr::GetInstance()->EraseItem(segment_dir + cache::Blacklist_Suffix);
+    cache::CpuCacheMgr::GetInstance()->EraseItem(segment_dir + cache::Attrs_Suffix);
+    cache::CpuCacheMgr::GetInstance()->EraseItem(segment_dir + cache::ZoneMaps_Suffix);
 
 #ifdef MILVUS_GPU_VERSION
     server::Config& config = server::Config::GetInstance();
@@ -97,6 +97,7 @@ constexpr ErrorCode DB_EMPTY_COLLECTION = ToDbErrorCode(8);
 constexpr ErrorCode DB_BLOOM_FILTER_ERROR = ToDbErrorCode(9);
 constexpr ErrorCode DB_PARTITION_NOT_FOUND = ToDbErrorCode(10);
 constexpr ErrorCode DB_OUT_OF_STORAGE = ToDbErrorCode(11);
+constexpr ErrorCode DB_INSERT_BUFFER_FULL = ToDbErrorCode(12);
 
 // knowhere error code
 constexpr ErrorCode KNOWHERE_ERROR = ToKnowhereErrorCode(1);
@@ -109,6 +110,7 @@ constexpr ErrorCode WAL_ERROR = ToWalErrorCode(1);
 constexpr ErrorCode WAL_META_ERROR = ToWalErrorCode(2);
 constexpr ErrorCode WAL_FILE_ERROR = ToWalErrorCode(3);
 constexpr ErrorCode WAL_PATH_ERROR = ToWalErrorCode(4);
+constexpr ErrorCode WAL_SYNC_ERROR = ToWalErrorCode(5);
 
 namespace server {
 class ServerException : public std::exception {
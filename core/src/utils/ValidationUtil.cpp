@@ -16,6 +16,7 @@
 #include "db/engine/ExecutionEngine.h"
 #include "knowhere/index/vector_index/ConfAdapter.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "segment/Attr.h"
 #include "utils/StringHelpFunctions.h"
 
 #include <arpa/inet.h>
@@ -88,6 +89,23 @@ CheckParameterRange(const milvus::json& json_params, const std::string& param_na
     return Status::OK();
 }
 
+Status
+CheckParameterBoolean(const milvus::json& json_params, const std::string& param_name) {
+    // an optional switch, 1 or "true" is refused since the index reads it as a json boolean
+    if (json_params.find(param_name) == json_params.end()) {
+        return Status::OK();
+    }
+
+    if (!json_params[param_name].is_boolean()) {
+        std::string msg =
+            "Invalid " + param_name + " value: " + json_params[param_name].dump() + ". Valid values are true and false";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    return Status::OK();
+}
+
 Status
 CheckParameterExistence(const milvus::json& json_params, const std::string& param_name) {
     if (json_params.find(param_name) == json_params.end()) {
@@ -256,6 +274,30 @@ ValidationUtil::ValidateIndexParams(const milvus::json& index_params,
             }*/
             break;
         }
+        case (int32_t)engine::EngineType::FAISS_PQ_FASTSCAN: {
+            auto status = CheckParameterRange(index_params, knowhere::IndexParams::nlist, 1, 65536);
+            if (!status.ok()) {
+                return status;
+            }
+
+            status = CheckParameterExistence(index_params, knowhere::IndexParams::m);
+            if (!status.ok()) {
+                return status;
+            }
+
+            int64_t m_value = index_params[knowhere::IndexParams::m];
+            if (!milvus::knowhere::IVFPQConfAdapter::IsValidForCPU(collection_schema.dimension_, m_value)) {
+                std::string msg = "Invalid collection dimension, dimension can not be divided by m";
+                LOG_SERVER_ERROR_ << msg;
+                return Status(SERVER_INVALID_COLLECTION_DIMENSION, msg);
+            }
+
+            status = CheckParameterBoolean(index_params, knowhere::IndexParams::rerank);
+            if (!status.ok()) {
+                return status;
+            }
+            break;
+        }
         case (int32_t)engine::EngineType::NSG_MIX: {
             auto status = CheckParameterRange(index_params, knowhere::IndexParams::search_length, 10, 300);
             if (!status.ok()) {
@@ -273,9 +315,14 @@ ValidationUtil::ValidateIndexParams(const milvus::json& index_params,
             if (!status.ok()) {
                 return status;
             }
+            status = CheckParameterBoolean(index_params, knowhere::IndexParams::reorder);
+            if (!status.ok()) {
+                return status;
+            }
             break;
         }
-        case (int32_t)engine::EngineType::HNSW: {
+        case (int32_t)engine::EngineType::HNSW:
+        case (int32_t)engine::EngineType::HNSW_SQ8: {
             auto status = CheckParameterRange(index_params, knowhere::IndexParams::M, 4, 64);
             if (!status.ok()) {
                 return status;
@@ -284,6 +331,16 @@ ValidationUtil::ValidateIndexParams(const milvus::json& index_params,
             if (!status.ok()) {
                 return status;
             }
+            status = CheckParameterBoolean(index_params, knowhere::IndexParams::reorder);
+            if (!status.ok()) {
+                return status;
+            }
+            if (index_type == (int32_t)engine::EngineType::HNSW_SQ8) {
+                status = CheckParameterBoolean(index_params, knowhere::IndexParams::rerank);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
             break;
         }
         case (int32_t)engine::EngineType::ANNOY: {
@@ -316,6 +373,17 @@ ValidationUtil::ValidateSearchParams(const milvus::json& search_params,
             }
             break;
         }
+        case (int32_t)engine::EngineType::FAISS_PQ_FASTSCAN: {
+            auto status = CheckParameterRange(search_params, knowhere::IndexParams::nprobe, 1, 65536);
+            if (!status.ok()) {
+                return status;
+            }
+            status = CheckParameterRange(search_params, knowhere::IndexParams::k_factor, 1, 64, true);
+            if (!status.ok()) {
+                return status;
+            }
+            break;
+        }
         case (int32_t)engine::EngineType::NSG_MIX: {
             auto status = CheckParameterRange(search_params, knowhere::IndexParams::search_length, 10, 300);
             if (!status.ok()) {
@@ -323,7 +391,8 @@ ValidationUtil::ValidateSearchParams(const milvus::json& search_params,
             }
             break;
         }
-        case (int32_t)engine::EngineType::HNSW: {
+        case (int32_t)engine::EngineType::HNSW:
+        case (int32_t)engine::EngineType::HNSW_SQ8: {
             auto status = CheckParameterRange(search_params, knowhere::IndexParams::ef, topk, 32768);
             if (!status.ok()) {
                 return status;
@@ -397,6 +466,79 @@ ValidationUtil::ValidateVectorDataSize(const engine::VectorsData& vectors,
     return Status::OK();
 }
 
+Status
+ValidationUtil::ValidateFieldName(const std::string& field_name) {
+    // the field name is the file name of the attribute column
+    if (field_name.empty()) {
+        std::string msg = "Field name should not be empty.";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    std::string invalid_msg = "Invalid field name: " + field_name + ". ";
+    if (field_name.size() > COLLECTION_NAME_SIZE_LIMIT) {
+        std::string msg = invalid_msg + "The length of a field name must be less than 255 characters.";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    char first_char = field_name[0];
+    if (first_char != '_' && std::isalpha(first_char) == 0) {
+        std::string msg = invalid_msg + "The first character of a field name must be an underscore or letter.";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    for (size_t i = 1; i < field_name.size(); ++i) {
+        char name_char = field_name[i];
+        if (name_char != '_' && std::isalnum(name_char) == 0) {
+            std::string msg = invalid_msg + "Field name can only contain numbers, letters, and underscores.";
+            LOG_SERVER_ERROR_ << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+ValidationUtil::ValidateAttrData(const engine::VectorsData& vectors) {
+    if (vectors.attr_types_.size() != vectors.attr_data_.size()) {
+        std::string msg = "Attribute types mismatch with attribute data";
+        LOG_SERVER_ERROR_ << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    for (auto& pair : vectors.attr_data_) {
+        auto status = ValidateFieldName(pair.first);
+        if (!status.ok()) {
+            return status;
+        }
+
+        auto iter = vectors.attr_types_.find(pair.first);
+        if (iter == vectors.attr_types_.end()) {
+            std::string msg = "Type of field " + pair.first + " is not specified";
+            LOG_SERVER_ERROR_ << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        size_t type_size = segment::Attr::DataTypeSize(iter->second);
+        if (type_size == 0) {
+            std::string msg = "Unsupported type of field " + pair.first + ", only integer and float types supported";
+            LOG_SERVER_ERROR_ << msg;
+            return Status(SERVER_INVALID_ARGUMENT, msg);
+        }
+
+        if (pair.second.size() != vectors.vector_count_ * type_size) {
+            std::string msg = "The number of values of field " + pair.first + " mismatch with vectors";
+            LOG_SERVER_ERROR_ << msg;
+            return Status(SERVER_INVALID_ROWRECORD_ARRAY, msg);
+        }
+    }
+
+    return Status::OK();
+}
+
 Status
 ValidationUtil::ValidateCollectionIndexFileSize(int64_t index_file_size) {
     if (index_file_size <= 0 || index_file_size > INDEX_FILE_SIZE_LIMIT) {
@@ -54,6 +54,12 @@ class ValidationUtil {
     static Status
     ValidateVectorDataSize(const engine::VectorsData& vectors, const engine::meta::CollectionSchema& collection_schema);
 
+    static Status
+    ValidateFieldName(const std::string& field_name);
+
+    static Status
+    ValidateAttrData(const engine::VectorsData& vectors);
+
     static Status
     ValidateCollectionIndexFileSize(int64_t index_file_size);
 
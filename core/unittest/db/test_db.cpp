@@ -25,6 +25,7 @@
 #include "db/DBImpl.h"
 #include "db/IDGenerator.h"
 #include "db/meta/MetaConsts.h"
+#include "query/GeneralQuery.h"
 #include "db/utils.h"
 #include <faiss/IndexFlat.h>
 #include "index/knowhere/knowhere/index/vector_index/IndexIDMAP.h"
@@ -504,10 +505,17 @@ TEST_F(DBTest, PRELOAD_TEST) {
     ASSERT_FALSE(stat.ok());
     fiu_disable("DBImpl.PreloadCollection.null_engine");
 
+    // a cancelled pre-load doesn't pin the file over the room
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
     FIU_ENABLE_FIU("DBImpl.PreloadCollection.exceed_cache");
     stat = db_->PreloadCollection(dummy_context_, COLLECTION_NAME, partition_tags);
     ASSERT_FALSE(stat.ok());
     fiu_disable("DBImpl.PreloadCollection.exceed_cache");
+    auto hot_items = milvus::cache::CpuCacheMgr::GetInstance()->HotItems();
+    ASSERT_FALSE(hot_items.empty());
+    for (auto& item : hot_items) {
+        ASSERT_FALSE(milvus::cache::CpuCacheMgr::GetInstance()->UnpinItem(item.first));
+    }
 
     FIU_ENABLE_FIU("DBImpl.PreloadCollection.engine_throw_exception");
     stat = db_->PreloadCollection(dummy_context_, COLLECTION_NAME, partition_tags);
@@ -515,6 +523,48 @@ TEST_F(DBTest, PRELOAD_TEST) {
     fiu_disable("DBImpl.PreloadCollection.engine_throw_exception");
 }
 
+TEST_F(DBTest, CACHE_WARMUP_TEST) {
+    auto options = GetOptions();
+    options.cache_warmup_enable_ = true;
+    BuildDB(options);
+
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    for (auto i = 0; i < 2; ++i) {
+        milvus::engine::VectorsData xb;
+        BuildVectors(VECTOR_COUNT, i, xb);
+        stat = db_->InsertVectors(COLLECTION_NAME, "", xb);
+        ASSERT_TRUE(stat.ok());
+    }
+
+    milvus::engine::CollectionIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(dummy_context_, COLLECTION_NAME, index);  // wait until build index finish
+
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+    stat = db_->PreloadCollection(dummy_context_, COLLECTION_NAME, {});
+    ASSERT_TRUE(stat.ok());
+    int64_t cache_usage = milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage();
+    ASSERT_GT(cache_usage, 0);
+
+    // the hot files are recorded when db stops
+    db_->Stop();
+    ASSERT_TRUE(boost::filesystem::exists(options.meta_.path_ + "/cache_manifest"));
+
+    // the hot files are reloaded in background after restart
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+    db_->Start();
+    for (int i = 0; i < 100; ++i) {
+        if (milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage() >= cache_usage) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_EQ(milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage(), cache_usage);
+}
+
 TEST_F(DBTest, SHUTDOWN_TEST) {
     db_->Stop();
 
@@ -1121,6 +1171,84 @@ TEST_F(DBTestWAL, DB_STOP_TEST) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTestWAL, INSERT_BUFFER_TEST) {
+    // a small insert buffer makes the writers wait for the wal thread to apply and flush
+    auto options = GetOptions();
+    options.insert_buffer_size_ = milvus::engine::MB;
+    options.auto_flush_interval_ = 0;
+    BuildDB(options);
+
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    // each batch is the size of the insert buffer
+    const uint64_t qb = milvus::engine::MB / (COLLECTION_DIM * sizeof(float));
+    const int64_t thread_count = 4;
+    const int64_t batch_count = 5;
+    std::vector<std::thread> threads;
+    std::vector<milvus::Status> statuses(thread_count * batch_count);
+    for (int64_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int64_t i = 0; i < batch_count; ++i) {
+                milvus::engine::VectorsData qxb;
+                BuildVectors(qb, t * batch_count + i, qxb);
+                statuses[t * batch_count + i] = db_->InsertVectors(collection_info.collection_id_, "", qxb);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& status : statuses) {
+        ASSERT_TRUE(status.ok()) << status.message();
+    }
+
+    stat = db_->Flush(collection_info.collection_id_);
+    ASSERT_TRUE(stat.ok());
+    uint64_t row_count = 0;
+    stat = db_->GetCollectionRowCount(collection_info.collection_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, qb * thread_count * batch_count);
+
+    // the wait is bounded, an insert is rejected when the buffer never drains and nothing is written
+    fiu_init(0);
+    fiu_enable("DBImpl.WaitInsertBuffer.buffer_full", 1, nullptr, 0);
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+    auto start = std::chrono::steady_clock::now();
+    stat = db_->InsertVectors(collection_info.collection_id_, "", qxb);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    fiu_disable("DBImpl.WaitInsertBuffer.buffer_full");
+    ASSERT_FALSE(stat.ok());
+    ASSERT_EQ(stat.code(), milvus::DB_INSERT_BUFFER_FULL);
+    ASSERT_LT(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count(), 10);
+
+    stat = db_->Flush(collection_info.collection_id_);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->GetCollectionRowCount(collection_info.collection_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, qb * thread_count * batch_count);
+
+    // the rejected insert can be retried, each insert gets the lsn of its own wal records
+    stat = db_->InsertVectors(collection_info.collection_id_, "", qxb);
+    ASSERT_TRUE(stat.ok()) << stat.message();
+    uint64_t first_lsn = qxb.lsn_;
+    ASSERT_GT(first_lsn, 0);
+
+    milvus::engine::VectorsData qxb2;
+    BuildVectors(qb, 1, qxb2);
+    stat = db_->InsertVectors(collection_info.collection_id_, "", qxb2);
+    ASSERT_TRUE(stat.ok()) << stat.message();
+    ASSERT_GT(qxb2.lsn_, first_lsn);
+
+    stat = db_->Flush(collection_info.collection_id_);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->GetCollectionRowCount(collection_info.collection_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, qb * (thread_count * batch_count + 2));
+}
+
 TEST_F(DBTestWALRecovery, RECOVERY_WITH_NO_ERROR) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
@@ -1150,12 +1278,13 @@ TEST_F(DBTestWALRecovery, RECOVERY_WITH_NO_ERROR) {
     auto options = GetOptions();
     BuildDB(options);
 
+    // recovered vectors are searchable before flush
     result_ids.clear();
     result_distances.clear();
     stat = db_->Query(dummy_context_,
             collection_info.collection_id_, {}, topk, json_params, qxb, result_ids, result_distances);
     ASSERT_TRUE(stat.ok());
-    ASSERT_EQ(result_ids.size(), 0);
+    ASSERT_EQ(result_ids.size() / topk, qb);
 
     db_->Flush();
     result_ids.clear();
@@ -1166,6 +1295,48 @@ TEST_F(DBTestWALRecovery, RECOVERY_WITH_NO_ERROR) {
     ASSERT_EQ(result_ids.size() / topk, qb);
 }
 
+TEST_F(DBTestWALRecovery, RECOVERY_WITH_BUFFER_FULL) {
+    const int64_t collection_count = 3;
+    const uint64_t qb = 1000;
+    const int64_t batch_count = 5;
+    std::vector<std::string> collection_ids;
+    for (int64_t i = 0; i < collection_count; ++i) {
+        milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+        collection_info.collection_id_ += "_" + std::to_string(i);
+        auto stat = db_->CreateCollection(collection_info);
+        ASSERT_TRUE(stat.ok());
+        collection_ids.push_back(collection_info.collection_id_);
+    }
+
+    for (int64_t i = 0; i < batch_count; ++i) {
+        for (auto& collection_id : collection_ids) {
+            milvus::engine::VectorsData qxb;
+            BuildVectors(qb, i, qxb);
+            auto stat = db_->InsertVectors(collection_id, "", qxb);
+            ASSERT_TRUE(stat.ok());
+        }
+    }
+
+    fiu_init(0);
+    fiu_enable("DBImpl.ExexWalRecord.return", 1, nullptr, 0);
+    db_ = nullptr;  // don't use FreeDB(), this case needs keep the meta
+    fiu_disable("DBImpl.ExexWalRecord.return");
+
+    // the buffer is exceeded by every record, the collections are flushed one by one while being applied
+    auto options = GetOptions();
+    options.insert_buffer_size_ = 1;
+    BuildDB(options);
+
+    for (auto& collection_id : collection_ids) {
+        auto stat = db_->Flush(collection_id);
+        ASSERT_TRUE(stat.ok());
+        uint64_t row_count = 0;
+        stat = db_->GetCollectionRowCount(collection_id, row_count);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(row_count, qb * batch_count);
+    }
+}
+
 TEST_F(DBTestWALRecovery_Error, RECOVERY_WITH_INVALID_LOG_FILE) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
@@ -1189,6 +1360,39 @@ TEST_F(DBTestWALRecovery_Error, RECOVERY_WITH_INVALID_LOG_FILE) {
     ASSERT_ANY_THROW(BuildDB(options));
 }
 
+TEST_F(DBTestWALRecovery_Error, RECOVERY_WITH_APPLY_ERROR) {
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t qb = 100;
+    milvus::engine::VectorsData qxb;
+    BuildVectors(qb, 0, qxb);
+
+    stat = db_->InsertVectors(collection_info.collection_id_, "", qxb);
+    ASSERT_TRUE(stat.ok());
+
+    fiu_init(0);
+    fiu_enable("DBImpl.ExexWalRecord.return", 1, nullptr, 0);
+    FreeDB();
+    fiu_disable("DBImpl.ExexWalRecord.return");
+
+    // a record failed to apply fails the recovery
+    auto options = GetOptions();
+    fiu_enable("DBImpl.ExecWalRecordBatch.apply_failed", 1, nullptr, 0);
+    ASSERT_ANY_THROW(BuildDB(options));
+    fiu_disable("DBImpl.ExecWalRecordBatch.apply_failed");
+
+    // nothing is marked as flushed by the failed recovery, the next one applies all records
+    BuildDB(options);
+    stat = db_->Flush(collection_info.collection_id_);
+    ASSERT_TRUE(stat.ok());
+    uint64_t row_count = 0;
+    stat = db_->GetCollectionRowCount(collection_info.collection_id_, row_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(row_count, qb);
+}
+
 TEST_F(DBTest2, FLUSH_NON_EXISTING_COLLECTION) {
     auto status = db_->Flush("non_existing");
     ASSERT_FALSE(status.ok());
@@ -1404,6 +1608,74 @@ TEST_F(DBTest2, INSERT_DUPLICATE_ID) {
     ASSERT_TRUE(stat.ok());
 }
 
+TEST_F(DBTest2, HYBRID_SEARCH_TEST) {
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_schema);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t size = 1000;
+    milvus::engine::VectorsData vector;
+    BuildVectors(size, 0, vector);
+    std::vector<int64_t> ages(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        ages[i] = static_cast<int64_t>(i);
+    }
+    vector.attr_types_["age"] = milvus::engine::DataType::INT64;
+    vector.attr_data_["age"].resize(size * sizeof(int64_t));
+    memcpy(vector.attr_data_["age"].data(), ages.data(), size * sizeof(int64_t));
+
+    stat = db_->InsertVectors(COLLECTION_NAME, "", vector);
+    ASSERT_TRUE(stat.ok());
+
+    // the first vectors are the nearest, but only entities with age >= 500 may be returned
+    uint64_t nq = 5, topk = 10;
+    milvus::engine::VectorsData query_vector;
+    query_vector.vector_count_ = nq;
+    query_vector.float_data_.assign(vector.float_data_.begin(), vector.float_data_.begin() + nq * COLLECTION_DIM);
+
+    auto range_query = std::make_shared<milvus::query::RangeQuery>();
+    range_query->field_name = "age";
+    range_query->compare_expr.push_back({milvus::query::CompareOperator::GTE, "500"});
+    auto general_query = std::make_shared<milvus::query::GeneralQuery>();
+    general_query->leaf = std::make_shared<milvus::query::LeafQuery>();
+    general_query->leaf->range_query = range_query;
+
+    auto check_result = [&]() {
+        std::vector<std::string> tags;
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        stat = db_->HybridQuery(dummy_context_, COLLECTION_NAME, tags, general_query, topk, milvus::json(),
+                                query_vector, result_ids, result_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(result_ids.size(), nq * topk);
+        for (auto id : result_ids) {
+            ASSERT_GE(id, 500);
+        }
+    };
+
+    stat = db_->Flush(COLLECTION_NAME);
+    ASSERT_TRUE(stat.ok());
+    check_result();
+
+    // no segment is searched when the zone maps exclude all the entities
+    range_query->compare_expr[0] = {milvus::query::CompareOperator::GT, "5000"};
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->HybridQuery(dummy_context_, COLLECTION_NAME, tags, general_query, topk, milvus::json(), query_vector,
+                            result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    for (auto id : result_ids) {
+        ASSERT_EQ(id, -1);
+    }
+
+    // operands not parsed as the field type are rejected
+    range_query->compare_expr[0] = {milvus::query::CompareOperator::GT, "abc"};
+    stat = db_->HybridQuery(dummy_context_, COLLECTION_NAME, tags, general_query, topk, milvus::json(), query_vector,
+                            result_ids, result_distances);
+    ASSERT_FALSE(stat.ok());
+}
+
 /*
 TEST_F(DBTest2, SEARCH_WITH_DIFFERENT_INDEX) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
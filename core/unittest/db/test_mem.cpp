@@ -9,6 +9,7 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cmath>
@@ -16,20 +17,24 @@
 #include <iostream>
 #include <random>
 #include <thread>
+#include <unordered_set>
 #include <fiu-control.h>
 #include <fiu-local.h>
 #include <src/db/DBFactory.h>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "db/insert/MemTable.h"
 #include "db/insert/MemTableFile.h"
 #include "db/insert/VectorSource.h"
+#include "db/meta/FilesHolder.h"
 #include "db/meta/MetaConsts.h"
 #include "db/utils.h"
 #include "gtest/gtest.h"
 #include "metrics/Metrics.h"
+#include "segment/SegmentReader.h"
 
 namespace {
 
@@ -173,6 +178,62 @@ TEST_F(MemManagerTest, MEM_TABLE_FILE_TEST) {
     }
 }
 
+TEST_F(MemManagerTest, MEM_TABLE_FILE_SEARCH_TEST) {
+    auto options = GetOptions();
+
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto status = impl_->CreateCollection(collection_schema);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::MemTableFile mem_table_file(GetCollectionName(), impl_, options);
+
+    int64_t nb = 100;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    for (int64_t i = 0; i < nb; i++) {
+        xb.id_array_.push_back(i * 10);
+    }
+    milvus::engine::VectorSourcePtr source = std::make_shared<milvus::engine::VectorSource>(xb);
+    status = mem_table_file.Add(source);
+    ASSERT_TRUE(status.ok());
+
+    int64_t nq = 5;
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * COLLECTION_DIM);
+
+    const uint64_t topk = 10;
+    milvus::engine::TopkResult result;
+    status = mem_table_file.Search(xq, topk, nullptr, {}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.k_, topk);
+    ASSERT_TRUE(result.ascending_);
+    for (int64_t i = 0; i < nq; i++) {
+        ASSERT_EQ(result.ids_[i * topk], xb.id_array_[i]);
+        ASSERT_LT(result.distances_[i * topk], 1e-4);
+    }
+
+    // deleted vectors are skipped
+    std::unordered_set<milvus::segment::doc_id_t> deleted_ids = {xb.id_array_[0]};
+    status = mem_table_file.Search(xq, topk, nullptr, deleted_ids, result);
+    ASSERT_TRUE(status.ok());
+    for (uint64_t j = 0; j < topk; j++) {
+        ASSERT_NE(result.ids_[j], xb.id_array_[0]);
+    }
+
+    // topk larger than vector count, padded with -1
+    status = mem_table_file.Search(xq, nb + 10, nullptr, {}, result);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result.k_, nb);
+    ASSERT_EQ(result.ids_[nb + 9], -1);
+
+    milvus::engine::VectorsData invalid_xq;
+    invalid_xq.vector_count_ = 1;
+    invalid_xq.float_data_.resize(COLLECTION_DIM - 1);
+    status = mem_table_file.Search(invalid_xq, topk, nullptr, {}, result);
+    ASSERT_FALSE(status.ok());
+}
+
 TEST_F(MemManagerTest, MEM_TABLE_TEST) {
     auto options = GetOptions();
 
@@ -244,6 +305,72 @@ TEST_F(MemManagerTest, MEM_TABLE_TEST) {
     fiu_disable("SqliteMetaImpl.UpdateCollectionFiles.throw_exception");
 }
 
+TEST_F(MemManagerTest, MEM_TABLE_DELETE_BLOOM_FILTER_TEST) {
+    auto options = GetOptions();
+
+    milvus::engine::meta::CollectionSchema collection_schema = BuildCollectionSchema();
+    auto status = impl_->CreateCollection(collection_schema);
+    ASSERT_TRUE(status.ok());
+
+    int64_t n = 10000;
+    milvus::engine::VectorsData vectors;
+    BuildVectors(n, vectors);
+    for (int64_t i = 0; i < n; i++) {
+        vectors.id_array_.push_back(i);
+    }
+
+    milvus::engine::VectorSourcePtr source = std::make_shared<milvus::engine::VectorSource>(vectors);
+    milvus::engine::MemTable mem_table(GetCollectionName(), impl_, options);
+    status = mem_table.Add(source);
+    ASSERT_TRUE(status.ok());
+    status = mem_table.Serialize(0);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::meta::FilesHolder files_holder;
+    status = impl_->FilesToSearch(GetCollectionName(), files_holder);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files_holder.HoldFiles().size(), 1);
+    std::string segment_dir;
+    milvus::engine::utils::GetParentPath(files_holder.HoldFiles()[0].location_, segment_dir);
+    std::string cache_key = segment_dir + milvus::cache::BloomFilter_Suffix;
+    std::string bloom_filter_path = segment_dir + "/bloom_filter";
+
+    // a missing filter is rebuilt in memory, loading doesn't write into the segment
+    boost::filesystem::remove(bloom_filter_path);
+    milvus::cache::CpuCacheMgr::GetInstance()->EraseItem(cache_key);
+    milvus::segment::SegmentReader segment_reader(segment_dir);
+    milvus::segment::IdBloomFilterPtr id_bloom_filter_ptr;
+    status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr, true);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(boost::filesystem::exists(bloom_filter_path));
+    for (int64_t i = 0; i < n; i++) {
+        ASSERT_TRUE(id_bloom_filter_ptr->Check(i));
+    }
+
+    // applying deletes writes a filter without the deleted ids
+    std::vector<milvus::segment::doc_id_t> ids_to_delete;
+    for (int64_t i = 0; i < n / 2; i++) {
+        ids_to_delete.push_back(i);
+    }
+    status = mem_table.Delete(ids_to_delete);
+    ASSERT_TRUE(status.ok());
+    status = mem_table.Serialize(1);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(boost::filesystem::exists(bloom_filter_path));
+
+    milvus::cache::CpuCacheMgr::GetInstance()->EraseItem(cache_key);
+    status = segment_reader.LoadBloomFilter(id_bloom_filter_ptr, true);
+    ASSERT_TRUE(status.ok());
+    int64_t false_positives = 0;
+    for (int64_t i = 0; i < n / 2; i++) {
+        false_positives += id_bloom_filter_ptr->Check(i) ? 1 : 0;
+    }
+    ASSERT_LT(false_positives, n / 20);
+    for (int64_t i = n / 2; i < n; i++) {
+        ASSERT_TRUE(id_bloom_filter_ptr->Check(i));
+    }
+}
+
 TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
@@ -308,6 +435,97 @@ TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
     }
 }
 
+TEST_F(MemManagerTest2, SEARCH_WITHOUT_FLUSH_TEST) {
+    milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
+    auto stat = db_->CreateCollection(collection_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    for (int64_t i = 0; i < nb; i++) {
+        xb.id_array_.push_back(i);
+    }
+
+    // half of the vectors are flushed
+    milvus::engine::VectorsData xb_flushed;
+    xb_flushed.vector_count_ = nb / 2;
+    xb_flushed.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nb / 2 * COLLECTION_DIM);
+    xb_flushed.id_array_.assign(xb.id_array_.begin(), xb.id_array_.begin() + nb / 2);
+    stat = db_->InsertVectors(GetCollectionName(), "", xb_flushed);
+    ASSERT_TRUE(stat.ok());
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::VectorsData xb_buffered;
+    xb_buffered.vector_count_ = nb - nb / 2;
+    xb_buffered.float_data_.assign(xb.float_data_.begin() + nb / 2 * COLLECTION_DIM, xb.float_data_.end());
+    xb_buffered.id_array_.assign(xb.id_array_.begin() + nb / 2, xb.id_array_.end());
+    stat = db_->InsertVectors(GetCollectionName(), "", xb_buffered);
+    ASSERT_TRUE(stat.ok());
+
+    const int64_t topk = 10;
+    milvus::json json_params = {{"nprobe", 10}};
+    auto search = [&](int64_t index, milvus::engine::ResultIds& result_ids) {
+        milvus::engine::VectorsData xq;
+        xq.vector_count_ = 1;
+        xq.float_data_.assign(xb.float_data_.begin() + index * COLLECTION_DIM,
+                              xb.float_data_.begin() + (index + 1) * COLLECTION_DIM);
+        milvus::engine::ResultDistances result_distances;
+        std::vector<std::string> tags;
+        return db_->Query(dummy_context_, GetCollectionName(), tags, topk, json_params, xq, result_ids,
+                          result_distances);
+    };
+
+    milvus::engine::ResultIds result_ids;
+    stat = search(0, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids[0], 0);
+
+    // vectors in insert buffer are searchable
+    stat = search(nb - 1, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids[0], nb - 1);
+
+    // deletes are visible before flush, both for flushed and buffered vectors
+    milvus::engine::IDNumbers delete_ids = {0, nb - 1};
+    stat = db_->DeleteVectors(GetCollectionName(), "", delete_ids);
+    ASSERT_TRUE(stat.ok());
+
+    stat = search(0, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(std::find(result_ids.begin(), result_ids.end(), 0), result_ids.end());
+
+    // the segment excludes the deleted ones in its own search, topk results are still returned
+    ASSERT_EQ(result_ids.size(), static_cast<size_t>(topk));
+    ASSERT_EQ(std::count(result_ids.begin(), result_ids.end(), -1), 0);
+
+    stat = search(nb - 1, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(std::find(result_ids.begin(), result_ids.end(), nb - 1), result_ids.end());
+
+    // an id inserted again after its delete is searchable before flush, the deleted copy in the segment is not
+    milvus::engine::VectorsData xb_reinserted;
+    xb_reinserted.vector_count_ = 1;
+    xb_reinserted.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + COLLECTION_DIM);
+    xb_reinserted.id_array_ = {0};
+    stat = db_->InsertVectors(GetCollectionName(), "", xb_reinserted);
+    ASSERT_TRUE(stat.ok());
+
+    stat = search(0, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids[0], 0);
+    ASSERT_EQ(std::count(result_ids.begin(), result_ids.end(), 0), 1);
+
+    // results are the same after flush
+    stat = db_->Flush();
+    ASSERT_TRUE(stat.ok());
+    stat = search(nb / 2, result_ids);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids[0], nb / 2);
+    ASSERT_EQ(std::count(result_ids.begin(), result_ids.end(), nb / 2), 1);
+}
+
 TEST_F(MemManagerTest2, INSERT_TEST) {
     milvus::engine::meta::CollectionSchema collection_info = BuildCollectionSchema();
     auto stat = db_->CreateCollection(collection_info);
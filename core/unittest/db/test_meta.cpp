@@ -12,6 +12,7 @@
 #include "db/Constants.h"
 #include "db/Utils.h"
 #include "db/meta/MetaConsts.h"
+#include "db/meta/SnapshotMetaImpl.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
 
@@ -766,3 +767,111 @@ TEST_F(MetaTest, LSN_TEST) {
     status = impl_->GetGlobalLastLSN(temp_lsb);
     ASSERT_EQ(temp_lsb, lsn);
 }
+
+TEST_F(MetaTest, SNAPSHOT_TEST) {
+    auto collection_id = "snapshot_test";
+    auto snapshot_meta = std::make_shared<milvus::engine::meta::SnapshotMetaImpl>(impl_);
+
+    milvus::engine::meta::CollectionSnapshotPtr snapshot;
+    auto status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_FALSE(status.ok());
+
+    milvus::engine::meta::CollectionSchema collection;
+    collection.collection_id_ = collection_id;
+    collection.dimension_ = 256;
+    status = snapshot_meta->CreateCollection(collection);
+    ASSERT_TRUE(status.ok());
+
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(snapshot->partitions_.empty());
+    ASSERT_TRUE(snapshot->files_.at(collection_id).empty());
+
+    // snapshot is cached until meta changes
+    milvus::engine::meta::CollectionSnapshotPtr same_snapshot;
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, same_snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(snapshot, same_snapshot);
+
+    // new file is not searchable
+    milvus::engine::meta::SegmentSchema table_file;
+    table_file.collection_id_ = collection_id;
+    status = snapshot_meta->CreateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, same_snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(snapshot, same_snapshot);
+
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::RAW;
+    status = snapshot_meta->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_NE(snapshot, same_snapshot);
+    ASSERT_EQ(snapshot->files_.at(collection_id).size(), 1UL);
+    ASSERT_TRUE(same_snapshot->files_.at(collection_id).empty());  // old readers are not affected
+
+    // the modification publishes the new snapshot itself, readers don't load it
+    table_file.row_count_ = 1;
+    status = snapshot_meta->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    fiu_enable("SnapshotMetaImpl.GetCollectionSnapshot.load_fail", 1, NULL, 0);
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    fiu_disable("SnapshotMetaImpl.GetCollectionSnapshot.load_fail");
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(snapshot->files_.at(collection_id).at(0).row_count_, 1UL);
+
+    // a snapshot failed to rebuild is loaded again on use
+    fiu_enable("SnapshotMetaImpl.Refresh.load_fail", 1, NULL, 0);
+    status = snapshot_meta->UpdateCollectionFile(table_file);
+    fiu_disable("SnapshotMetaImpl.Refresh.load_fail");
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, same_snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_NE(snapshot, same_snapshot);
+    ASSERT_EQ(same_snapshot->files_.at(collection_id).size(), 1UL);
+
+    // files of a snapshot in use are kept from TTL clean up
+    auto raw_file = snapshot->files_.at(collection_id).at(0);
+    ASSERT_FALSE(milvus::engine::meta::FilesHolder::CanBeDeleted(raw_file));
+    table_file.file_type_ = milvus::engine::meta::SegmentSchema::TO_DELETE;
+    status = snapshot_meta->UpdateCollectionFile(table_file);
+    ASSERT_TRUE(status.ok());
+    ASSERT_FALSE(milvus::engine::meta::FilesHolder::CanBeDeleted(raw_file));
+    same_snapshot.reset();
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(snapshot->files_.at(collection_id).empty());
+    ASSERT_TRUE(milvus::engine::meta::FilesHolder::CanBeDeleted(raw_file));
+
+    // partition files are kept in the snapshot of root collection
+    std::string partition_name = "snapshot_test_partition";
+    status = snapshot_meta->CreatePartition(collection_id, partition_name, "0", 0);
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(snapshot->partitions_.size(), 1UL);
+    ASSERT_TRUE(snapshot->files_.at(partition_name).empty());
+
+    milvus::engine::meta::SegmentSchema partition_file;
+    partition_file.collection_id_ = partition_name;
+    status = snapshot_meta->CreateCollectionFile(partition_file);
+    ASSERT_TRUE(status.ok());
+    partition_file.file_type_ = milvus::engine::meta::SegmentSchema::INDEX;
+    status = snapshot_meta->UpdateCollectionFile(partition_file);
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(snapshot->files_.at(partition_name).size(), 1UL);
+
+    status = snapshot_meta->DropPartition(partition_name);
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(snapshot->partitions_.empty());
+
+    status = snapshot_meta->DropCollections({collection_id});
+    ASSERT_TRUE(status.ok());
+    status = snapshot_meta->GetCollectionSnapshot(collection_id, snapshot);
+    ASSERT_FALSE(status.ok());
+}
@@ -21,6 +21,13 @@
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
 #include "db/meta/SqliteMetaImpl.h"
+#include "query/AttrFilter.h"
+#include "segment/Attrs.h"
+#include "segment/IdBloomFilter.h"
+#include "segment/SegmentReader.h"
+#include "segment/SegmentWriter.h"
+#include "segment/UidIndex.h"
+#include "utils/CommonUtil.h"
 #include "utils/Exception.h"
 #include "utils/Status.h"
 
@@ -223,3 +230,264 @@ TEST(DBMiscTest, IDGENERATOR_TEST) {
 
     ASSERT_EQ(ids.size(), unique_ids.size());
 }
+
+TEST(DBMiscTest, UID_INDEX_TEST) {
+    std::vector<milvus::segment::doc_id_t> uids = {50, 10, 30, 10, 20, 40};
+    milvus::segment::UidIndex uid_index(uids);
+    ASSERT_EQ(uid_index.Count(), uids.size());
+
+    auto offsets = uid_index.Find(10);
+    std::vector<milvus::segment::offset_t> found(offsets.first, offsets.second);
+    ASSERT_EQ(found, std::vector<milvus::segment::offset_t>({1, 3}));
+
+    for (size_t i = 0; i < uids.size(); ++i) {
+        offsets = uid_index.Find(uids[i]);
+        ASSERT_NE(offsets.first, offsets.second);
+        ASSERT_EQ(uids[*offsets.first], uids[i]);
+    }
+
+    offsets = uid_index.Find(25);
+    ASSERT_EQ(offsets.first, offsets.second);
+    offsets = uid_index.Find(100);
+    ASSERT_EQ(offsets.first, offsets.second);
+
+    milvus::segment::DeletedDocs deleted_docs(std::vector<milvus::segment::offset_t>({3, 5}));
+    ASSERT_TRUE(deleted_docs.IsDeleted(3));
+    ASSERT_FALSE(deleted_docs.IsDeleted(1));
+    ASSERT_FALSE(deleted_docs.IsDeleted(100));
+
+    deleted_docs.AddDeletedDoc(1);
+    ASSERT_TRUE(deleted_docs.IsDeleted(1));
+    deleted_docs.GetMutableDeletedDocs().clear();
+    ASSERT_FALSE(deleted_docs.IsDeleted(3));
+}
+
+TEST(DBMiscTest, BLOOM_FILTER_TEST) {
+    const int64_t count = 100000;
+    std::vector<milvus::segment::doc_id_t> uids;
+    for (int64_t i = 0; i < count; ++i) {
+        uids.push_back(i * 7 + 3);
+    }
+
+    milvus::segment::IdBloomFilter bloom_filter(count);
+    bloom_filter.Add(uids);
+    for (auto uid : uids) {
+        ASSERT_TRUE(bloom_filter.Check(uid));
+    }
+
+    std::vector<milvus::segment::doc_id_t> absent_uids;
+    for (int64_t i = 0; i < count; ++i) {
+        absent_uids.push_back(i * 7 + 5);
+    }
+    std::vector<uint8_t> results(absent_uids.size());
+    bloom_filter.CheckMany(absent_uids.data(), absent_uids.size(), results.data());
+    int64_t false_positive = 0;
+    for (size_t i = 0; i < absent_uids.size(); ++i) {
+        ASSERT_EQ(results[i] != 0, bloom_filter.Check(absent_uids[i]));
+        false_positive += results[i];
+    }
+    ASSERT_LT(false_positive, count / 100);
+
+    // blocks survive a round trip through their words
+    auto blocks = bloom_filter.GetBlocks();
+    milvus::segment::IdBloomFilter loaded_filter(std::move(blocks));
+    bloom_filter.CheckMany(uids.data(), uids.size(), results.data());
+    for (size_t i = 0; i < uids.size(); ++i) {
+        ASSERT_TRUE(results[i]);
+        ASSERT_TRUE(loaded_filter.Check(uids[i]));
+    }
+}
+
+namespace {
+
+milvus::query::GeneralQueryPtr
+BuildRangeQuery(const std::string& field_name, milvus::query::CompareOperator op, const std::string& operand) {
+    auto range_query = std::make_shared<milvus::query::RangeQuery>();
+    range_query->field_name = field_name;
+    range_query->compare_expr.push_back({op, operand});
+    auto query = std::make_shared<milvus::query::GeneralQuery>();
+    query->leaf = std::make_shared<milvus::query::LeafQuery>();
+    query->leaf->range_query = range_query;
+    return query;
+}
+
+milvus::query::GeneralQueryPtr
+BuildBinaryQuery(const milvus::query::GeneralQueryPtr& left, const milvus::query::GeneralQueryPtr& right,
+                 milvus::query::QueryRelation relation) {
+    auto query = std::make_shared<milvus::query::GeneralQuery>();
+    query->bin->left_query = left;
+    query->bin->right_query = right;
+    query->bin->relation = relation;
+    return query;
+}
+
+}  // namespace
+
+TEST(DBMiscTest, ATTR_FILTER_TEST) {
+    const size_t row_count = 200;
+    std::vector<int32_t> ages(row_count);
+    std::vector<double> scores(row_count / 2);
+    for (size_t i = 0; i < row_count; ++i) {
+        ages[i] = static_cast<int32_t>(i);
+    }
+    for (size_t i = 0; i < scores.size(); ++i) {
+        scores[i] = i * 0.5;
+    }
+
+    // the score column is only given for the first half, the rest are nulls
+    std::unordered_map<std::string, milvus::engine::DataType> attr_types = {
+        {"age", milvus::engine::DataType::INT32}, {"score", milvus::engine::DataType::DOUBLE}};
+    std::unordered_map<std::string, std::vector<uint8_t>> attr_data;
+    attr_data["age"].resize(ages.size() * sizeof(int32_t));
+    memcpy(attr_data["age"].data(), ages.data(), attr_data["age"].size());
+    attr_data["score"].resize(scores.size() * sizeof(double));
+    memcpy(attr_data["score"].data(), scores.data(), attr_data["score"].size());
+
+    milvus::segment::Attrs attrs;
+    attrs.AddAttrs(0, attr_types, attr_data, 0, scores.size());
+    std::unordered_map<std::string, milvus::engine::DataType> age_type = {{"age", milvus::engine::DataType::INT32}};
+    attrs.AddAttrs(scores.size(), age_type, attr_data, scores.size(), row_count - scores.size());
+    attrs.Pad(row_count);
+
+    auto age_attr = attrs.GetAttr("age");
+    ASSERT_NE(age_attr, nullptr);
+    ASSERT_EQ(age_attr->GetZoneMap().int_min_, 0);
+    ASSERT_EQ(age_attr->GetZoneMap().int_max_, 199);
+    auto score_attr = attrs.GetAttr("score");
+    ASSERT_NE(score_attr, nullptr);
+    ASSERT_EQ(score_attr->GetCount(), row_count);
+    ASSERT_EQ(score_attr->GetNullCount(), row_count - scores.size());
+
+    using milvus::query::CompareOperator;
+    using milvus::query::ZoneMapResult;
+
+    // zone maps
+    auto out_of_zone = BuildRangeQuery("age", CompareOperator::GT, "1000");
+    ASSERT_EQ(milvus::query::CheckZoneMaps(out_of_zone, attrs, row_count), ZoneMapResult::NONE);
+    auto whole_zone = BuildRangeQuery("age", CompareOperator::GTE, "0");
+    ASSERT_EQ(milvus::query::CheckZoneMaps(whole_zone, attrs, row_count), ZoneMapResult::ALL);
+    auto absent_field = BuildRangeQuery("height", CompareOperator::GT, "0");
+    ASSERT_EQ(milvus::query::CheckZoneMaps(absent_field, attrs, row_count), ZoneMapResult::NONE);
+    auto age_range = BuildBinaryQuery(BuildRangeQuery("age", CompareOperator::GTE, "50"),
+                                      BuildRangeQuery("age", CompareOperator::LT, "150"),
+                                      milvus::query::QueryRelation::AND);
+    ASSERT_EQ(milvus::query::CheckZoneMaps(age_range, attrs, row_count), ZoneMapResult::SOME);
+
+    // the bits of the entities not matching are set
+    {
+        faiss::ConcurrentBitset bitset(row_count);
+        auto status = milvus::query::FilterAttrs(age_range, attrs, bitset);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(bitset.count(), row_count - 100);
+        for (size_t i = 0; i < row_count; ++i) {
+            ASSERT_EQ(bitset.test(i), i < 50 || i >= 150);
+        }
+    }
+
+    // nulls match no range
+    {
+        auto score_range = BuildRangeQuery("score", CompareOperator::GTE, "10.25");
+        faiss::ConcurrentBitset bitset(row_count);
+        auto status = milvus::query::FilterAttrs(score_range, attrs, bitset);
+        ASSERT_TRUE(status.ok());
+        for (size_t i = 0; i < row_count; ++i) {
+            ASSERT_EQ(bitset.test(i), i < 21 || i >= scores.size());
+        }
+    }
+
+    // term query, values are int64 for integer fields
+    {
+        std::vector<int64_t> values = {3, 7, 500};
+        auto term_query = std::make_shared<milvus::query::TermQuery>();
+        term_query->field_name = "age";
+        term_query->field_value.resize(values.size() * sizeof(int64_t));
+        memcpy(term_query->field_value.data(), values.data(), term_query->field_value.size());
+        auto query = std::make_shared<milvus::query::GeneralQuery>();
+        query->leaf = std::make_shared<milvus::query::LeafQuery>();
+        query->leaf->term_query = term_query;
+        ASSERT_TRUE(milvus::query::ValidateAttrQuery(query).ok());
+
+        faiss::ConcurrentBitset bitset(row_count);
+        auto status = milvus::query::FilterAttrs(query, attrs, bitset);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(bitset.count(), row_count - 2);
+        ASSERT_FALSE(bitset.test(3));
+        ASSERT_FALSE(bitset.test(7));
+    }
+
+    // R4: entities of the left query excluding the right
+    {
+        auto query = BuildBinaryQuery(age_range, BuildRangeQuery("age", CompareOperator::LT, "100"),
+                                      milvus::query::QueryRelation::R4);
+        faiss::ConcurrentBitset bitset(row_count);
+        auto status = milvus::query::FilterAttrs(query, attrs, bitset);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(bitset.count(), row_count - 50);
+        ASSERT_FALSE(bitset.test(100));
+        ASSERT_TRUE(bitset.test(99));
+    }
+
+    auto invalid_operand = BuildRangeQuery("age", CompareOperator::GT, "abc");
+    ASSERT_FALSE(milvus::query::ValidateAttrQuery(invalid_operand).ok());
+}
+
+TEST(DBMiscTest, ZONE_MAPS_CACHE_TEST) {
+    std::string segment_dir = "/tmp/milvus_test/zone_maps_cache";
+    boost::filesystem::remove_all(segment_dir);
+
+    const size_t row_count = 100;
+    const size_t dim = 4;
+    std::vector<int32_t> ages(row_count);
+    std::vector<milvus::segment::doc_id_t> uids(row_count);
+    for (size_t i = 0; i < row_count; ++i) {
+        ages[i] = static_cast<int32_t>(i);
+        uids[i] = static_cast<milvus::segment::doc_id_t>(i);
+    }
+    std::unordered_map<std::string, milvus::engine::DataType> attr_types = {{"age", milvus::engine::DataType::INT32}};
+    std::unordered_map<std::string, std::vector<uint8_t>> attr_data;
+    attr_data["age"].resize(ages.size() * sizeof(int32_t));
+    memcpy(attr_data["age"].data(), ages.data(), attr_data["age"].size());
+    std::vector<uint8_t> vector_data(row_count * dim * sizeof(float), 0);
+
+    milvus::segment::SegmentWriter segment_writer(segment_dir);
+    segment_writer.AddAttrs(attr_types, attr_data, 0, row_count);
+    segment_writer.AddVectors("zone_maps_cache", vector_data, uids);
+    ASSERT_TRUE(segment_writer.Serialize().ok());
+
+    milvus::segment::SegmentReader segment_reader(segment_dir);
+    milvus::segment::AttrsPtr zone_maps;
+    ASSERT_TRUE(segment_reader.LoadAttrsZoneMaps(zone_maps).ok());
+    auto age_attr = zone_maps->GetAttr("age");
+    ASSERT_NE(age_attr, nullptr);
+    ASSERT_EQ(age_attr->GetZoneMap().int_min_, 0);
+    ASSERT_EQ(age_attr->GetZoneMap().int_max_, 99);
+
+    // the next queries get the zone maps from cache, the files are not read again
+    boost::filesystem::remove_all(segment_dir);
+    milvus::segment::AttrsPtr cached_zone_maps;
+    ASSERT_TRUE(segment_reader.LoadAttrsZoneMaps(cached_zone_maps).ok());
+    ASSERT_EQ(cached_zone_maps, zone_maps);
+    boost::filesystem::remove_all(segment_dir);
+    ASSERT_TRUE(segment_writer.Serialize().ok());
+
+    // the columns loaded by a filtered query are cached too, and serve the zone maps from then on
+    milvus::segment::AttrsPtr columns;
+    ASSERT_TRUE(segment_reader.LoadAttrs(columns).ok());
+    ASSERT_NE(columns->GetAttr("age"), nullptr);
+    ASSERT_EQ(columns->GetAttr("age")->GetCount(), row_count);
+    boost::filesystem::remove_all(segment_dir);
+    milvus::segment::AttrsPtr cached_columns;
+    ASSERT_TRUE(segment_reader.LoadAttrs(cached_columns).ok());
+    ASSERT_EQ(cached_columns, columns);
+    ASSERT_TRUE(segment_reader.LoadAttrsZoneMaps(cached_zone_maps).ok());
+    ASSERT_EQ(cached_zone_maps, columns);
+
+    // the columns and zone maps leave the cache with the segment
+    milvus::server::CommonUtil::EraseFromCache(segment_dir + "/zone_maps_cache");
+    ASSERT_TRUE(segment_reader.LoadAttrsZoneMaps(cached_zone_maps).ok());
+    ASSERT_NE(cached_zone_maps, zone_maps);
+    ASSERT_NE(cached_zone_maps, columns);
+    ASSERT_EQ(cached_zone_maps->GetAttr("age"), nullptr);
+
+    boost::filesystem::remove_all(segment_dir);
+}
@@ -162,6 +162,42 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+void
+ReduceTaskResultsTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
+    ms::SearchTaskResultMap task_results;
+    ms::SearchTaskResult& result_1 = task_results[1];
+    ms::SearchTaskResult& result_2 = task_results[2];
+    BuildResult(result_1.ids_, result_1.distances_, topk_1, topk, nq, ascending);
+    BuildResult(result_2.ids_, result_2.distances_, topk_2, topk, nq, ascending);
+    result_1.k_ = topk_1;
+    result_1.ascending_ = ascending;
+    result_2.k_ = topk_2;
+    result_2.ascending_ = ascending;
+
+    ms::ResultIds result_ids;
+    ms::ResultDistances result_distances;
+    ms::SearchJob::ReduceTaskResults(task_results, nq, topk, result_ids, result_distances);
+    CheckTopkResult(result_1.ids_, result_1.distances_, topk_1, result_2.ids_, result_2.distances_, topk_2, topk, nq,
+                    ascending, result_ids, result_distances);
+}
+
+TEST(DBSearchTest, REDUCE_TASK_RESULTS_TEST) {
+    size_t NQ = 15;
+    size_t TOP_K = 64;
+
+    ReduceTaskResultsTest(TOP_K, 0, NQ, TOP_K, true);
+    ReduceTaskResultsTest(TOP_K, 0, NQ, TOP_K, false);
+
+    ReduceTaskResultsTest(TOP_K, TOP_K, NQ, TOP_K, true);
+    ReduceTaskResultsTest(TOP_K, TOP_K, NQ, TOP_K, false);
+
+    ReduceTaskResultsTest(TOP_K / 2, TOP_K, NQ, TOP_K, true);
+    ReduceTaskResultsTest(TOP_K / 2, TOP_K, NQ, TOP_K, false);
+
+    ReduceTaskResultsTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, true);
+    ReduceTaskResultsTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
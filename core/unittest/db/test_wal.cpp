@@ -11,10 +11,13 @@
 
 #include "db/wal/WalDefinations.h"
 #define private public
+#include <fiu-control.h>
+#include <fiu-local.h>
 #include <gtest/gtest.h>
 #include <stdlib.h>
 #include <time.h>
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <thread>
@@ -434,6 +437,46 @@ TEST(WalTest, BUFFER_TEST) {
 }
 
 
+TEST(WalTest, BUFFER_SYNC_FAILED_TEST) {
+    MakeEmptyTestPath();
+    fiu_init(0);
+
+    milvus::engine::wal::MXLogBuffer buffer(WAL_GTEST_PATH, 1);
+    buffer.Reset(0);
+
+    std::vector<milvus::engine::IDNumber> ids(10, 0x12);
+    milvus::engine::wal::MXLogRecord record[2];
+    for (auto& rcd : record) {
+        rcd.type = milvus::engine::wal::MXLogType::Delete;
+        rcd.collection_id = "collection";
+        rcd.length = ids.size();
+        rcd.ids = ids.data();
+        rcd.data_size = 0;
+        rcd.data = nullptr;
+    }
+
+    // the records of a failed sync are not taken as durable
+    ASSERT_EQ(buffer.Append(record[0]), milvus::WAL_SUCCESS);
+    uint64_t lsn = 0;
+    fiu_enable("MXLogBuffer.WriteBuffer.sync_failed", 1, nullptr, 0);
+    ASSERT_EQ(buffer.Sync(lsn), milvus::WAL_FILE_ERROR);
+    fiu_disable("MXLogBuffer.WriteBuffer.sync_failed");
+    ASSERT_EQ(lsn, 0u);
+    ASSERT_GT(buffer.UnsyncedSize(), 0u);
+
+    // they are written again at their offset and synced with the next records
+    ASSERT_EQ(buffer.Append(record[1]), milvus::WAL_SUCCESS);
+    ASSERT_EQ(buffer.Sync(lsn), milvus::WAL_SUCCESS);
+    ASSERT_EQ(lsn, record[1].lsn);
+    ASSERT_EQ(buffer.UnsyncedSize(), 0u);
+
+    milvus::engine::wal::MXLogFileHandler file_handler(WAL_GTEST_PATH);
+    file_handler.SetFileName("0.wal");
+    file_handler.SetFileOpenMode("r");
+    ASSERT_EQ(file_handler.GetFileSize(), uint32_t(lsn & 0xffffffff));
+    file_handler.CloseFile();
+}
+
 TEST(WalTest, MANAGER_INIT_TEST) {
     MakeEmptyTestPath();
 
@@ -506,12 +549,12 @@ TEST(WalTest, MANAGER_APPEND_FAILED) {
 
     std::vector<int64_t> ids(1, 0);
     std::vector<float> data_float(1024, 0);
-    ASSERT_FALSE(manager->Insert(schema.collection_id_, "", ids, data_float));
+    ASSERT_NE(manager->Insert(schema.collection_id_, "", ids, data_float), milvus::WAL_SUCCESS);
 
     ids.clear();
     data_float.clear();
-    ASSERT_FALSE(manager->Insert(schema.collection_id_, "", ids, data_float));
-    ASSERT_FALSE(manager->DeleteById(schema.collection_id_, "", ids));
+    ASSERT_NE(manager->Insert(schema.collection_id_, "", ids, data_float), milvus::WAL_SUCCESS);
+    ASSERT_NE(manager->DeleteById(schema.collection_id_, "", ids), milvus::WAL_SUCCESS);
 }
 
 TEST(WalTest, MANAGER_RECOVERY_TEST) {
@@ -537,7 +580,7 @@ TEST(WalTest, MANAGER_RECOVERY_TEST) {
     std::vector<int64_t> ids(1024, 0);
     std::vector<float> data_float(1024 * 512, 0);
     manager->CreateCollection(schema.collection_id_);
-    ASSERT_TRUE(manager->Insert(schema.collection_id_, "", ids, data_float));
+    ASSERT_EQ(manager->Insert(schema.collection_id_, "", ids, data_float), milvus::WAL_SUCCESS);
 
     // recovery
     manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
@@ -569,6 +612,85 @@ TEST(WalTest, MANAGER_RECOVERY_TEST) {
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.buf_offset, 0);
 }
 
+TEST(WalTest, MANAGER_RECOVERY_BATCH_TEST) {
+    MakeEmptyTestPath();
+
+    milvus::engine::DBMetaOptions opt = {WAL_GTEST_PATH};
+    milvus::engine::meta::MetaPtr meta = std::make_shared<milvus::engine::meta::TestWalMeta>(opt);
+
+    milvus::engine::wal::MXLogConfiguration wal_config;
+    wal_config.mxlog_path = WAL_GTEST_PATH;
+    wal_config.buffer_size = 64;
+    wal_config.recovery_error_ignore = false;
+
+    std::shared_ptr<milvus::engine::wal::WalManager> manager;
+    manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+
+    // adjest the buffer size for test, let the records spread over several wal files
+    manager->mxlog_config_.buffer_size = 16384;
+    manager->p_buffer_->mxlog_buffer_size_ = 16384;
+
+    std::vector<std::string> collection_ids = {"collection_0", "collection_1"};
+    for (auto& collection_id : collection_ids) {
+        milvus::engine::meta::CollectionSchema schema;
+        schema.collection_id_ = collection_id;
+        schema.flush_lsn_ = 0;
+        meta->CreateCollection(schema);
+        manager->CreateCollection(collection_id);
+    }
+
+    const int64_t insert_times = 200;
+    const int64_t nb = 10;
+    const int64_t dim = 16;
+    for (int64_t i = 0; i < insert_times; ++i) {
+        std::vector<int64_t> ids(nb);
+        std::vector<float> vectors(nb * dim);
+        for (int64_t k = 0; k < nb; ++k) {
+            ids[k] = i * nb + k;
+            for (int64_t d = 0; d < dim; ++d) {
+                vectors[k * dim + d] = ids[k] + d;
+            }
+        }
+        ASSERT_EQ(manager->Insert(collection_ids[i % 2], "", ids, vectors), milvus::WAL_SUCCESS);
+    }
+
+    // recovery
+    manager = std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+
+    std::vector<milvus::engine::wal::MXLogRecordBatch> batches;
+    while (1) {
+        milvus::engine::wal::MXLogRecordBatch batch;
+        ASSERT_EQ(manager->GetNextRecoveryBatch(batch), milvus::WAL_SUCCESS);
+        if (batch.records.empty()) {
+            break;
+        }
+        // a batch never crosses wal files
+        ASSERT_EQ(batch.records.front().lsn >> 32, batch.records.back().lsn >> 32);
+        batches.emplace_back(std::move(batch));
+    }
+    ASSERT_GT(batches.size(), 1u);
+
+    // records of the previous batches are still valid after the following wal files are loaded
+    int64_t count = 0;
+    for (auto& batch : batches) {
+        for (auto& record : batch.records) {
+            ASSERT_EQ(record.type, milvus::engine::wal::MXLogType::InsertVector);
+            auto vectors = static_cast<const float*>(record.data);
+            for (uint32_t k = 0; k < record.length; ++k) {
+                auto id = record.ids[k];
+                ASSERT_EQ(id, count++);
+                ASSERT_EQ(record.collection_id, collection_ids[(id / nb) % 2]);
+                for (int64_t d = 0; d < dim; ++d) {
+                    ASSERT_EQ(vectors[k * dim + d], static_cast<float>(id + d));
+                }
+            }
+        }
+    }
+    ASSERT_EQ(count, insert_times * nb);
+}
+
 TEST(WalTest, MANAGER_TEST) {
     MakeEmptyTestPath();
 
@@ -588,6 +710,7 @@ TEST(WalTest, MANAGER_TEST) {
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_reader_.buf_offset, 0);
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.file_no, 0);
     ASSERT_EQ(manager->p_buffer_->mxlog_buffer_writer_.buf_offset, 0);
+    ASSERT_EQ(manager->GetPendingSize(), 0);
 
     // adjest the buffer size for test
     manager->mxlog_config_.buffer_size = 8049;
@@ -600,20 +723,21 @@ TEST(WalTest, MANAGER_TEST) {
     // table1 create and insert
     std::string table_id_1 = "table1";
     manager->CreateCollection(table_id_1);
-    ASSERT_TRUE(manager->Insert(table_id_1, "", ids, data_float));
+    ASSERT_EQ(manager->Insert(table_id_1, "", ids, data_float), milvus::WAL_SUCCESS);
 
     // table2 create and insert
     std::string table_id_2 = "table2";
     manager->CreateCollection(table_id_2);
-    ASSERT_TRUE(manager->Insert(table_id_2, "", ids, data_byte));
+    ASSERT_EQ(manager->Insert(table_id_2, "", ids, data_byte), milvus::WAL_SUCCESS);
 
     // table1 delete
-    ASSERT_TRUE(manager->DeleteById(table_id_1, "", ids));
+    ASSERT_EQ(manager->DeleteById(table_id_1, "", ids), milvus::WAL_SUCCESS);
 
     // table3 create and insert
     std::string table_id_3 = "table3";
     manager->CreateCollection(table_id_3);
-    ASSERT_TRUE(manager->Insert(table_id_3, "", ids, data_float));
+    ASSERT_EQ(manager->Insert(table_id_3, "", ids, data_float), milvus::WAL_SUCCESS);
+    ASSERT_GT(manager->GetPendingSize(), 0);
 
     // flush table1
     auto flush_lsn = manager->Flush(table_id_1);
@@ -690,10 +814,10 @@ TEST(WalTest, MANAGER_SAME_NAME_COLLECTION) {
     manager->CreateCollection(table_id_2);
 
     // command
-    ASSERT_TRUE(manager->Insert(table_id_1, "", ids, data_byte));
-    ASSERT_TRUE(manager->Insert(table_id_2, "", ids, data_byte));
-    ASSERT_TRUE(manager->DeleteById(table_id_1, "", ids));
-    ASSERT_TRUE(manager->DeleteById(table_id_2, "", ids));
+    ASSERT_EQ(manager->Insert(table_id_1, "", ids, data_byte), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->Insert(table_id_2, "", ids, data_byte), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->DeleteById(table_id_1, "", ids), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->DeleteById(table_id_2, "", ids), milvus::WAL_SUCCESS);
 
     // re-create collection
     manager->DropCollection(table_id_1);
@@ -709,6 +833,126 @@ TEST(WalTest, MANAGER_SAME_NAME_COLLECTION) {
     }
 }
 
+TEST(WalTest, MANAGER_GROUP_COMMIT_TEST) {
+    MakeEmptyTestPath();
+
+    milvus::engine::DBMetaOptions opt = {WAL_GTEST_PATH};
+    milvus::engine::meta::MetaPtr meta = std::make_shared<milvus::engine::meta::TestWalMeta>(opt);
+
+    milvus::engine::wal::MXLogConfiguration wal_config;
+    wal_config.mxlog_path = WAL_GTEST_PATH;
+    wal_config.buffer_size = 64;
+    wal_config.recovery_error_ignore = false;
+    wal_config.sync_enable = true;
+    wal_config.sync_interval = 1;
+
+    std::shared_ptr<milvus::engine::wal::WalManager> manager =
+        std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+
+    // adjest the buffer size for test, let the writers switch wal files
+    manager->mxlog_config_.buffer_size = 16384;
+    manager->p_buffer_->mxlog_buffer_size_ = 16384;
+
+    std::string collection_id = "collection";
+    manager->CreateCollection(collection_id);
+
+    const int64_t thread_num = 8;
+    const int64_t insert_times = 100;
+    const int64_t nb = 10;
+    const int64_t dim = 16;
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < thread_num; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int64_t i = 0; i < insert_times; ++i) {
+                std::vector<int64_t> ids(nb);
+                std::vector<float> vectors(nb * dim);
+                for (int64_t k = 0; k < nb; ++k) {
+                    ids[k] = (t * insert_times + i) * nb + k;
+                    for (int64_t d = 0; d < dim; ++d) {
+                        vectors[k * dim + d] = ids[k] + d;
+                    }
+                }
+                ASSERT_EQ(manager->Insert(collection_id, "", ids, vectors), milvus::WAL_SUCCESS);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // every insert returns after its records are synced
+    ASSERT_GE(manager->synced_lsn_, manager->GetLastAppliedLsn());
+
+    // records of concurrent writers are complete and not interleaved
+    std::vector<bool> found(thread_num * insert_times * nb, false);
+    milvus::engine::wal::MXLogRecord record;
+    while (1) {
+        ASSERT_EQ(manager->GetNextRecord(record), milvus::WAL_SUCCESS);
+        if (record.type == milvus::engine::wal::MXLogType::None) {
+            break;
+        }
+        ASSERT_EQ(record.type, milvus::engine::wal::MXLogType::InsertVector);
+        auto vectors = static_cast<const float*>(record.data);
+        for (uint32_t k = 0; k < record.length; ++k) {
+            auto id = record.ids[k];
+            ASSERT_FALSE(found[id]);
+            found[id] = true;
+            for (int64_t d = 0; d < dim; ++d) {
+                ASSERT_EQ(vectors[k * dim + d], static_cast<float>(id + d));
+            }
+        }
+    }
+    ASSERT_EQ(std::count(found.begin(), found.end(), true), thread_num * insert_times * nb);
+}
+
+TEST(WalTest, MANAGER_SYNC_FAILED_TEST) {
+    MakeEmptyTestPath();
+    fiu_init(0);
+
+    milvus::engine::DBMetaOptions opt = {WAL_GTEST_PATH};
+    milvus::engine::meta::MetaPtr meta = std::make_shared<milvus::engine::meta::TestWalMeta>(opt);
+
+    milvus::engine::wal::MXLogConfiguration wal_config;
+    wal_config.mxlog_path = WAL_GTEST_PATH;
+    wal_config.buffer_size = 64;
+    wal_config.recovery_error_ignore = false;
+    wal_config.sync_enable = true;
+    wal_config.sync_interval = 1;
+
+    std::shared_ptr<milvus::engine::wal::WalManager> manager =
+        std::make_shared<milvus::engine::wal::WalManager>(wal_config);
+    ASSERT_EQ(manager->Init(meta), milvus::WAL_SUCCESS);
+
+    std::string collection_id = "collection";
+    manager->CreateCollection(collection_id);
+
+    std::vector<int64_t> ids(10, 0);
+    std::vector<float> vectors(10 * 16, 0);
+
+    // the records are written, they are only not confirmed on disk
+    fiu_enable("MXLogBuffer.Sync.write_failed", 1, nullptr, 0);
+    ASSERT_EQ(manager->Insert(collection_id, "", ids, vectors), milvus::WAL_SYNC_ERROR);
+    ASSERT_EQ(manager->DeleteById(collection_id, "", ids), milvus::WAL_SYNC_ERROR);
+    fiu_disable("MXLogBuffer.Sync.write_failed");
+
+    // a successful sync clears the error
+    ASSERT_EQ(manager->Insert(collection_id, "", ids, vectors), milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->sync_error_, milvus::WAL_SUCCESS);
+    ASSERT_EQ(manager->DeleteById(collection_id, "", ids), milvus::WAL_SUCCESS);
+
+    milvus::engine::wal::MXLogRecord record;
+    int64_t record_count = 0;
+    while (1) {
+        ASSERT_EQ(manager->GetNextRecord(record), milvus::WAL_SUCCESS);
+        if (record.type == milvus::engine::wal::MXLogType::None) {
+            break;
+        }
+        ++record_count;
+    }
+    ASSERT_EQ(record_count, 4);
+}
+
 #if 0
 TEST(WalTest, LargeScaleRecords) {
     std::string data_path = "/home/zilliz/workspace/data/";
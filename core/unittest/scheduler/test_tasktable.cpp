@@ -255,6 +255,58 @@ TEST_F(TaskTableBaseTest, PICK_TO_LOAD_CACHE) {
     ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
 }
 
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_MAX_LOADED) {
+    const size_t NUM_TASKS = 10;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        empty_table_.Put(task1_);
+    }
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADED;
+
+    // one loaded task blocks loading by default
+    auto indexes = empty_table_.PickToLoad(3);
+    ASSERT_TRUE(indexes.empty());
+
+    // allow more loaded tasks for multiple executors
+    indexes = empty_table_.PickToLoad(3, 2);
+    ASSERT_EQ(indexes.size(), 3);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    indexes = empty_table_.PickToLoad(3, 2);
+    ASSERT_TRUE(indexes.empty());
+}
+
+TEST_F(TaskTableBaseTest, PICK_TO_LOAD_MAX_LOADED_BYTES) {
+    auto file = std::make_shared<milvus::engine::meta::SegmentSchema>();
+    file->file_size_ = 100;
+    const size_t NUM_TASKS = 10;
+    for (size_t i = 0; i < NUM_TASKS; ++i) {
+        auto task = std::make_shared<milvus::scheduler::TestTask>(
+            std::make_shared<milvus::server::Context>("dummy_request_id"), file, nullptr);
+        empty_table_.Put(task);
+    }
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::LOADING;
+
+    // loading tasks count as prefetched
+    auto indexes = empty_table_.PickToLoad(3, 1);
+    ASSERT_TRUE(indexes.empty());
+
+    indexes = empty_table_.PickToLoad(3, 4, 250);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 1);
+
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::LOADED;
+    indexes = empty_table_.PickToLoad(3, 4, 250);
+    ASSERT_TRUE(indexes.empty());
+
+    // a task larger than the budget is picked when nothing is ahead
+    empty_table_[0]->state = milvus::scheduler::TaskTableItemState::EXECUTED;
+    empty_table_[1]->state = milvus::scheduler::TaskTableItemState::EXECUTED;
+    indexes = empty_table_.PickToLoad(3, 4, 50);
+    ASSERT_EQ(indexes.size(), 1);
+    ASSERT_EQ(indexes[0] % empty_table_.capacity(), 2);
+}
+
 TEST_F(TaskTableBaseTest, PICK_TO_EXECUTE) {
     const size_t NUM_TASKS = 10;
     for (size_t i = 0; i < NUM_TASKS; ++i) {
@@ -15,6 +15,7 @@
 
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
+#include "cache/LRU.h"
 #include "knowhere/index/vector_index/VecIndex.h"
 #include "utils/Error.h"
 
@@ -235,6 +236,96 @@ TEST(CacheTest, INVALID_TEST) {
     }
 }
 
+TEST(CacheTest, SEGMENTED_LRU_TEST) {
+    // each item is 1k byte, the cache holds 100 items
+    milvus::cache::Cache<milvus::cache::DataObjPtr> cache(100 * 1024, 1UL << 32);
+    auto new_item = []() -> milvus::cache::DataObjPtr { return std::make_shared<MockVecIndex>(256, 1); };
+
+    // hot items are hit after insertion, then promoted to protected segment
+    for (int i = 0; i < 10; i++) {
+        std::string key = "hot_" + std::to_string(i);
+        cache.insert(key, new_item());
+        ASSERT_NE(cache.get(key), nullptr);
+    }
+    cache.insert("pinned", new_item());
+    ASSERT_TRUE(cache.pin("pinned"));
+    ASSERT_FALSE(cache.pin("not_exist"));
+
+    // a scan only evicts the probation items
+    for (int i = 0; i < 1000; i++) {
+        cache.insert("cold_" + std::to_string(i), new_item());
+    }
+    ASSERT_LE(cache.usage(), cache.capacity());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(cache.exists("hot_" + std::to_string(i)));
+    }
+    ASSERT_TRUE(cache.exists("pinned"));
+    ASSERT_FALSE(cache.exists("cold_0"));
+
+    // pinned item is never evicted, even if it is not accessed
+    for (int i = 0; i < 1000; i++) {
+        std::string key = "warm_" + std::to_string(i);
+        cache.insert(key, new_item());
+        cache.get(key);
+    }
+    ASSERT_TRUE(cache.exists("pinned"));
+    ASSERT_TRUE(cache.unpin("pinned"));
+    ASSERT_FALSE(cache.unpin("pinned"));
+    cache.erase("pinned");
+    ASSERT_FALSE(cache.exists("pinned"));
+
+    ASSERT_EQ(cache.get("not_exist"), nullptr);
+    uint64_t hit_count = 0, miss_count = 0, eviction_count = 0, item_count = 0;
+    int64_t usage = 0;
+    auto statistics = cache.statistics();
+    ASSERT_EQ(statistics.size(), milvus::cache::DEFAULT_SHARD_NUM);
+    for (auto& shard_statistics : statistics) {
+        hit_count += shard_statistics.hit_count_;
+        miss_count += shard_statistics.miss_count_;
+        eviction_count += shard_statistics.eviction_count_;
+        item_count += shard_statistics.item_count_;
+        usage += shard_statistics.usage_;
+    }
+    ASSERT_EQ(hit_count, 1010);
+    ASSERT_EQ(miss_count, 1);
+    ASSERT_GT(eviction_count, 0);
+    ASSERT_EQ(item_count, cache.size());
+    ASSERT_EQ(usage, cache.usage());
+
+    // warm items are accessed twice, cold items once
+    auto hot_items = cache.hot_items();
+    ASSERT_EQ(hot_items.size(), cache.size());
+    ASSERT_EQ(hot_items.front().second, 2);
+    ASSERT_GE(hot_items.front().second, hot_items.back().second);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.usage(), 0);
+}
+
+TEST(CacheTest, PROTECTED_CAPACITY_TEST) {
+    // each item is 1k byte, the cache holds 100 items in more shards than items
+    milvus::cache::Cache<milvus::cache::DataObjPtr> cache(100 * 1024, 1UL << 32, "", 128);
+    auto new_item = []() -> milvus::cache::DataObjPtr { return std::make_shared<MockVecIndex>(256, 1); };
+
+    // most shards hold a single protected item, the protected segment is still bounded over all shards
+    for (int i = 0; i < 90; i++) {
+        std::string key = "hot_" + std::to_string(i);
+        cache.insert(key, new_item());
+        ASSERT_NE(cache.get(key), nullptr);
+        ASSERT_LE(cache.protected_usage(), 80 * 1024);
+    }
+    ASSERT_EQ(cache.protected_usage(), 80 * 1024);
+    ASSERT_EQ(cache.usage(), 90 * 1024);
+
+    // unpinned items go back to protected segment under the same bound
+    cache.insert("pinned", new_item());
+    ASSERT_TRUE(cache.pin("pinned"));
+    ASSERT_TRUE(cache.unpin("pinned"));
+    ASSERT_EQ(cache.protected_usage(), 80 * 1024);
+    ASSERT_NE(cache.get("pinned"), nullptr);
+}
+
 TEST(CacheTest, PARTIAL_LRU_TEST) {
     constexpr int MAX_SIZE = 5;
     milvus::cache::LRU<int, int> lru(MAX_SIZE);
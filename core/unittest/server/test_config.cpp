@@ -290,6 +290,16 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    bool cache_warmup_enable = false;
+    ASSERT_TRUE(config.SetCacheConfigWarmUpEnable(std::to_string(cache_warmup_enable)).ok());
+    ASSERT_TRUE(config.GetCacheConfigWarmUpEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == cache_warmup_enable);
+
+    int64_t cache_warmup_interval = 60;
+    ASSERT_TRUE(config.SetCacheConfigWarmUpInterval(std::to_string(cache_warmup_interval)).ok());
+    ASSERT_TRUE(config.GetCacheConfigWarmUpInterval(int64_val).ok());
+    ASSERT_TRUE(int64_val == cache_warmup_interval);
+
     {
         // #2564
         int64_t total_mem = 0, free_mem = 0;
@@ -417,6 +427,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetWalConfigWalPath(str_val).ok());
     ASSERT_TRUE(str_val == wal_path);
 
+    bool wal_sync_enable = false;
+    ASSERT_TRUE(config.SetWalConfigSyncEnable(std::to_string(wal_sync_enable)).ok());
+    ASSERT_TRUE(config.GetWalConfigSyncEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == wal_sync_enable);
+
+    int64_t wal_sync_interval = 10;
+    ASSERT_TRUE(config.SetWalConfigSyncInterval(std::to_string(wal_sync_interval)).ok());
+    ASSERT_TRUE(config.GetWalConfigSyncInterval(int64_val).ok());
+    ASSERT_TRUE(int64_val == wal_sync_interval);
+
+    int64_t wal_sync_batch_size = 4 * 1024 * 1024;
+    ASSERT_TRUE(config.SetWalConfigSyncBatchSize(std::to_string(wal_sync_batch_size)).ok());
+    ASSERT_TRUE(config.GetWalConfigSyncBatchSize(int64_val).ok());
+    ASSERT_TRUE(int64_val == wal_sync_batch_size);
+
     /* logs config */
     std::string logs_level = "debug";
     ASSERT_TRUE(config.SetLogsLevel(logs_level).ok());
@@ -752,6 +777,9 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("-1").ok());
 
     ASSERT_FALSE(config.SetCacheConfigCacheInsertData("N").ok());
+    ASSERT_FALSE(config.SetCacheConfigWarmUpEnable("N").ok());
+    ASSERT_FALSE(config.SetCacheConfigWarmUpInterval("0").ok());
+    ASSERT_FALSE(config.SetCacheConfigWarmUpInterval("-1").ok());
 
     /* engine config */
     ASSERT_FALSE(config.SetEngineConfigUseBlasThreshold("0xff").ok());
@@ -791,6 +819,10 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetWalConfigWalPath("").ok());
     ASSERT_FALSE(config.SetWalConfigBufferSize("-1").ok());
     ASSERT_FALSE(config.SetWalConfigBufferSize("a").ok());
+    ASSERT_FALSE(config.SetWalConfigSyncEnable("a").ok());
+    ASSERT_FALSE(config.SetWalConfigSyncInterval("-1").ok());
+    ASSERT_FALSE(config.SetWalConfigSyncInterval("1001").ok());
+    ASSERT_FALSE(config.SetWalConfigSyncBatchSize("0").ok());
 
     /* log config */
     ASSERT_FALSE(config.SetLogsLevel("invalid").ok());
@@ -13,6 +13,8 @@
 #include <opentracing/mocktracer/tracer.h>
 
 #include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include "config/Config.h"
@@ -174,6 +176,59 @@ BuildBinVectors(int64_t from, int64_t to, std::vector<std::vector<uint8_t>>& vec
     }
 }
 
+// feeds the chunks of a client stream to GrpcRequestHandler::InsertStream, counts the chunks read
+class FakeInsertStreamReader : public ::grpc::ServerReaderInterface<::milvus::grpc::PackedInsertParam> {
+ public:
+    explicit FakeInsertStreamReader(const std::vector<::milvus::grpc::PackedInsertParam>& chunks) : chunks_(chunks) {
+    }
+
+    void
+    SendInitialMetadata() override {
+    }
+
+    bool
+    NextMessageSize(uint32_t* sz) override {
+        if (read_count_ >= chunks_.size()) {
+            return false;
+        }
+        *sz = static_cast<uint32_t>(chunks_[read_count_].ByteSizeLong());
+        return true;
+    }
+
+    bool
+    Read(::milvus::grpc::PackedInsertParam* msg) override {
+        if (read_count_ >= chunks_.size()) {
+            return false;
+        }
+        *msg = chunks_[read_count_++];
+        return true;
+    }
+
+    size_t
+    read_count() const {
+        return read_count_;
+    }
+
+ private:
+    std::vector<::milvus::grpc::PackedInsertParam> chunks_;
+    size_t read_count_ = 0;
+};
+
+void
+BuildPackedChunk(int64_t from, int64_t to, ::milvus::grpc::PackedInsertParam& chunk) {
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(from, to, record_array);
+    std::string packed_data;
+    for (auto& record : record_array) {
+        packed_data.append(reinterpret_cast<const char*>(record.data()), record.size() * sizeof(float));
+    }
+
+    chunk.set_collection_name(COLLECTION_NAME);
+    chunk.set_data_type(::milvus::grpc::VECTOR_FLOAT);
+    chunk.set_dimension(COLLECTION_DIM);
+    chunk.set_vector_data(packed_data);
+}
+
 std::string
 CurrentTmDate(int64_t offset_day = 0) {
     time_t tt;
@@ -419,6 +474,152 @@ TEST_F(RpcHandlerTest, SEARCH_TEST) {
     ASSERT_EQ(response.ids_size(), 0UL);
 }
 
+TEST_F(RpcHandlerTest, PACKED_INSERT_SEARCH_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    // pack vectors into one row-major buffer
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    std::string packed_data;
+    for (auto& record : record_array) {
+        packed_data.append(reinterpret_cast<const char*>(record.data()), record.size() * sizeof(float));
+    }
+
+    ::milvus::grpc::PackedInsertParam insert_param;
+    insert_param.set_collection_name(COLLECTION_NAME);
+    insert_param.set_data_type(::milvus::grpc::VECTOR_FLOAT);
+    insert_param.set_dimension(COLLECTION_DIM);
+    insert_param.set_vector_data(packed_data);
+    ::milvus::grpc::VectorIds vector_ids;
+    handler->InsertPacked(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::SUCCESS) << vector_ids.status().reason();
+    ASSERT_EQ(vector_ids.vector_id_array_size(), VECTOR_COUNT);
+
+    // buffer size is not a multiple of row size
+    insert_param.set_vector_data(packed_data.substr(0, packed_data.size() - 1));
+    handler->InsertPacked(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    // invalid dimension
+    insert_param.set_vector_data(packed_data);
+    insert_param.set_dimension(0);
+    handler->InsertPacked(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_DIMENSION);
+
+    // dimension not match collection
+    insert_param.set_dimension(COLLECTION_DIM / 2);
+    handler->InsertPacked(&context, &insert_param, &vector_ids);
+    ASSERT_NE(vector_ids.status().error_code(), ::milvus::grpc::SUCCESS);
+
+    // flush
+    ::milvus::grpc::Status grpc_status;
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(COLLECTION_NAME);
+    handler->Flush(&context, &flush_param, &grpc_status);
+
+    // search with the first 10 vectors packed
+    ::milvus::grpc::PackedSearchParam search_param;
+    search_param.set_collection_name(COLLECTION_NAME);
+    search_param.set_topk(10);
+    milvus::grpc::KeyValuePair* kv = search_param.add_extra_params();
+    kv->set_key(milvus::server::grpc::EXTRA_PARAM_KEY);
+    kv->set_value("{ \"nprobe\": 32 }");
+    search_param.set_data_type(::milvus::grpc::VECTOR_FLOAT);
+    search_param.set_dimension(COLLECTION_DIM);
+    search_param.set_query_data(packed_data.substr(0, 10 * COLLECTION_DIM * sizeof(float)));
+    ::milvus::grpc::TopKQueryResult response;
+    handler->SearchPacked(&context, &search_param, &response);
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::SUCCESS) << response.status().reason();
+    ASSERT_EQ(response.row_num(), 10);
+
+    // empty query data
+    search_param.clear_query_data();
+    handler->SearchPacked(&context, &search_param, &response);
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+}
+
+TEST_F(RpcHandlerTest, INSERT_STREAM_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    const int64_t chunk_count = 4;
+    std::vector<::milvus::grpc::PackedInsertParam> chunks(chunk_count);
+    for (int64_t i = 0; i < chunk_count; ++i) {
+        BuildPackedChunk(i * VECTOR_COUNT, (i + 1) * VECTOR_COUNT, chunks[i]);
+    }
+
+    // all chunks are inserted in order, ids are returned as increasing ranges
+    {
+        FakeInsertStreamReader reader(chunks);
+        ::milvus::grpc::InsertStreamResult result;
+        handler->InsertStream(&context, &reader, &result);
+        ASSERT_EQ(result.status().error_code(), ::milvus::grpc::SUCCESS) << result.status().reason();
+        ASSERT_EQ(reader.read_count(), static_cast<size_t>(chunk_count));
+        ASSERT_EQ(result.row_count(), chunk_count * VECTOR_COUNT);
+
+        int64_t id_count = 0;
+        int64_t last_id = -1;
+        for (auto& range : result.id_ranges()) {
+            ASSERT_GT(range.count(), 0);
+            ASSERT_GT(range.first_id(), last_id);
+            last_id = range.first_id() + range.count() - 1;
+            id_count += range.count();
+        }
+        ASSERT_EQ(id_count, chunk_count * VECTOR_COUNT);
+    }
+
+    // the stream stops at a bad chunk, the chunks before it are reported
+    {
+        auto bad_chunks = chunks;
+        bad_chunks[2].set_dimension(0);
+        FakeInsertStreamReader reader(bad_chunks);
+        ::milvus::grpc::InsertStreamResult result;
+        handler->InsertStream(&context, &reader, &result);
+        ASSERT_EQ(result.status().error_code(), ::milvus::grpc::ILLEGAL_DIMENSION);
+        ASSERT_EQ(reader.read_count(), 3u);
+        ASSERT_EQ(result.row_count(), 2 * VECTOR_COUNT);
+    }
+
+    // the stream stops with a retryable error when the insert buffer stays full after the bounded wait
+    {
+        fiu_init(0);
+        fiu_enable("DBImpl.WaitInsertBuffer.buffer_full", 1, NULL, 0);
+        FakeInsertStreamReader reader(chunks);
+        ::milvus::grpc::InsertStreamResult result;
+        handler->InsertStream(&context, &reader, &result);
+        fiu_disable("DBImpl.WaitInsertBuffer.buffer_full");
+        ASSERT_EQ(result.status().error_code(), ::milvus::grpc::CACHE_FAILED);
+        ASSERT_EQ(reader.read_count(), 2u);
+        ASSERT_EQ(result.row_count(), 0);
+        ASSERT_EQ(result.id_ranges_size(), 0);
+    }
+
+    // the whole stream goes through once the buffer drains
+    {
+        FakeInsertStreamReader reader(chunks);
+        ::milvus::grpc::InsertStreamResult result;
+        handler->InsertStream(&context, &reader, &result);
+        ASSERT_EQ(result.status().error_code(), ::milvus::grpc::SUCCESS) << result.status().reason();
+        ASSERT_EQ(result.row_count(), chunk_count * VECTOR_COUNT);
+        ASSERT_GT(result.lsn(), 0);
+    }
+
+    ::milvus::grpc::Status grpc_status;
+    ::milvus::grpc::FlushParam flush_param;
+    flush_param.add_collection_name_array(COLLECTION_NAME);
+    handler->Flush(&context, &flush_param, &grpc_status);
+    ASSERT_EQ(grpc_status.error_code(), ::milvus::grpc::SUCCESS) << grpc_status.reason();
+
+    ::milvus::grpc::CollectionName collection_name;
+    collection_name.set_collection_name(COLLECTION_NAME);
+    ::milvus::grpc::CollectionRowCount count;
+    handler->CountCollection(&context, &collection_name, &count);
+    ASSERT_EQ(count.collection_row_count(), (2 * chunk_count + 2) * VECTOR_COUNT);
+}
+
 TEST_F(RpcHandlerTest, COMBINE_SEARCH_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -1215,6 +1416,64 @@ class DummyRequest : public milvus::server::BaseRequest {
     }
 };
 
+// records which requests are running and the order they started in
+struct DqlExecutionLog {
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<int64_t> started_;
+    int64_t running_ = 0;
+    int64_t max_running_ = 0;
+    // when set, the requests block until this many of them run at the same time, or a timeout
+    int64_t latch_ = 0;
+};
+
+class DqlDummyRequest : public milvus::server::BaseRequest {
+ public:
+    milvus::Status
+    OnExecute() override {
+        if (log_ != nullptr) {
+            std::unique_lock<std::mutex> lock(log_->mutex_);
+            log_->started_.push_back(seq_);
+            log_->max_running_ = std::max(log_->max_running_, ++log_->running_);
+            if (log_->running_ >= log_->latch_) {
+                log_->latch_ = 0;
+                log_->cv_.notify_all();
+            } else if (!log_->cv_.wait_for(lock, std::chrono::seconds(5), [&] { return log_->latch_ == 0; })) {
+                // serialized execution never opens the latch, open it so the rest do not wait too
+                log_->latch_ = 0;
+                log_->cv_.notify_all();
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (log_ != nullptr) {
+            std::lock_guard<std::mutex> lock(log_->mutex_);
+            --log_->running_;
+        }
+        return milvus::Status::OK();
+    }
+
+    const std::string&
+    CollectionName() const override {
+        return collection_name_;
+    }
+
+ public:
+    explicit DqlDummyRequest(const std::string& collection_name,
+                             milvus::server::BaseRequest::RequestType type =
+                                 milvus::server::BaseRequest::kPreloadCollection,
+                             std::shared_ptr<DqlExecutionLog> log = nullptr, int64_t seq = 0)
+        : BaseRequest(std::make_shared<milvus::server::Context>("dql_dummy_request_id"), type, true),
+          collection_name_(collection_name),
+          log_(log),
+          seq_(seq) {
+    }
+
+ private:
+    std::string collection_name_;
+    std::shared_ptr<DqlExecutionLog> log_;
+    int64_t seq_;
+};
+
 class RpcSchedulerTest : public testing::Test {
  protected:
     void
@@ -1300,6 +1559,74 @@ TEST_F(RpcSchedulerTest, BASE_TASK_TEST) {
     milvus::server::RequestScheduler::GetInstance().Stop();
 }
 
+TEST_F(RpcSchedulerTest, DQL_WORKER_TEST) {
+    milvus::server::Config::GetInstance().SetEngineConfigDqlWorkerNum("2");
+    milvus::server::RequestScheduler::GetInstance().Start();
+
+    std::vector<std::shared_ptr<DqlDummyRequest>> requests;
+    for (int64_t i = 0; i < 16; ++i) {
+        auto request = std::make_shared<DqlDummyRequest>("collection_" + std::to_string(i % 4));
+        requests.push_back(request);
+        auto base_ptr = std::static_pointer_cast<milvus::server::BaseRequest>(request);
+        milvus::server::RequestScheduler::ExecRequest(base_ptr);
+    }
+
+    for (auto& request : requests) {
+        ASSERT_TRUE(request->WaitToFinish().ok());
+    }
+
+    milvus::server::RequestScheduler::GetInstance().Stop();
+    milvus::server::Config::GetInstance().SetEngineConfigDqlWorkerNum(
+        milvus::server::CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT);
+}
+
+TEST_F(RpcSchedulerTest, DQL_WORKER_ORDER_TEST) {
+    milvus::server::Config::GetInstance().SetEngineConfigDqlWorkerNum("2");
+    milvus::server::RequestScheduler::GetInstance().Start();
+
+    // preload and release of one collection stay on its worker while the other worker is idle,
+    // they never overlap and run in the order they are put
+    auto preload_log = std::make_shared<DqlExecutionLog>();
+    std::vector<std::shared_ptr<DqlDummyRequest>> requests;
+    for (int64_t i = 0; i < 8; ++i) {
+        auto type = (i % 2 == 0) ? milvus::server::BaseRequest::kPreloadCollection
+                                 : milvus::server::BaseRequest::kReleaseCollection;
+        auto request = std::make_shared<DqlDummyRequest>("collection_order", type, preload_log, i);
+        requests.push_back(request);
+        auto base_ptr = std::static_pointer_cast<milvus::server::BaseRequest>(request);
+        milvus::server::RequestScheduler::ExecRequest(base_ptr);
+    }
+    for (auto& request : requests) {
+        ASSERT_TRUE(request->WaitToFinish().ok());
+    }
+    ASSERT_EQ(preload_log->max_running_, 1);
+    ASSERT_EQ(preload_log->started_.size(), 8);
+    for (int64_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(preload_log->started_[i], i);
+    }
+
+    // searches of the same collection move to the idle worker, so two of them run at the same time
+    auto search_log = std::make_shared<DqlExecutionLog>();
+    search_log->latch_ = 2;
+    requests.clear();
+    for (int64_t i = 0; i < 8; ++i) {
+        auto request = std::make_shared<DqlDummyRequest>("collection_order",
+                                                         milvus::server::BaseRequest::kSearchByID, search_log, i);
+        requests.push_back(request);
+        auto base_ptr = std::static_pointer_cast<milvus::server::BaseRequest>(request);
+        milvus::server::RequestScheduler::ExecRequest(base_ptr);
+    }
+    for (auto& request : requests) {
+        ASSERT_TRUE(request->WaitToFinish().ok());
+    }
+    ASSERT_EQ(search_log->started_.size(), 8);
+    ASSERT_GE(search_log->max_running_, 2);
+
+    milvus::server::RequestScheduler::GetInstance().Stop();
+    milvus::server::Config::GetInstance().SetEngineConfigDqlWorkerNum(
+        milvus::server::CONFIG_ENGINE_DQL_WORKER_NUM_DEFAULT);
+}
+
 TEST(RpcTest, RPC_SERVER_TEST) {
     using GrpcServer = milvus::server::grpc::GrpcServer;
     GrpcServer& server = GrpcServer::GetInstance();
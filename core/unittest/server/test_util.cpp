@@ -610,6 +610,66 @@ TEST(ValidationUtilTest, VALIDATE_INDEX_PARAMS_TEST) {
                                                             (int32_t)milvus::engine::EngineType::FAISS_PQ);
     ASSERT_FALSE(status.ok());
 
+    // rerank must be a json boolean
+    collection_schema.dimension_ = 64;
+    json_params = {{"nlist", 32}, {"m", 4}, {"rerank", true}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::FAISS_PQ_FASTSCAN);
+    ASSERT_TRUE(status.ok());
+
+    json_params = {{"nlist", 32}, {"m", 4}, {"rerank", 1}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::FAISS_PQ_FASTSCAN);
+    ASSERT_FALSE(status.ok());
+
+    json_params = {{"M", 16}, {"efConstruction", 64}, {"rerank", false}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::HNSW_SQ8);
+    ASSERT_TRUE(status.ok());
+
+    json_params = {{"M", 16}, {"efConstruction", 64}, {"rerank", "true"}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::HNSW_SQ8);
+    ASSERT_FALSE(status.ok());
+
+    // reorder must be a json boolean
+    json_params = {{"M", 16}, {"efConstruction", 64}, {"reorder", true}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::HNSW);
+    ASSERT_TRUE(status.ok());
+
+    json_params = {{"M", 16}, {"efConstruction", 64}, {"reorder", 1}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::HNSW);
+    ASSERT_FALSE(status.ok());
+
+    json_params = {{"M", 16}, {"efConstruction", 64}, {"reorder", "true"}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::HNSW_SQ8);
+    ASSERT_FALSE(status.ok());
+
+    json_params = {{"search_length", 50}, {"out_degree", 50}, {"candidate_pool_size", 100}, {"knng", 100},
+                   {"reorder", 1}};
+    status =
+        milvus::server::ValidationUtil::ValidateIndexParams(json_params,
+                                                            collection_schema,
+                                                            (int32_t)milvus::engine::EngineType::NSG_MIX);
+    ASSERT_FALSE(status.ok());
+
     collection_schema.dimension_ = 99;
     json_params = {{"nlist", 32}, {"m", 4}};
     status =
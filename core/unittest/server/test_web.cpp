@@ -292,6 +292,14 @@ class TestClient : public oatpp::web::client::ApiClient {
     API_CALL("PUT", "/collections/{collection_name}/vectors", vectorsOp,
              PATH(String, collection_name, "collection_name"), BODY_STRING(String, body))
 
+    API_CALL("POST", "/collections/{collection_name}/vectors", insertBinary,
+             PATH(String, collection_name, "collection_name"), HEADER(String, content_type, "Content-Type"),
+             BODY_STRING(String, body))
+
+    API_CALL("PUT", "/collections/{collection_name}/vectors", searchBinary,
+             PATH(String, collection_name, "collection_name"), HEADER(String, content_type, "Content-Type"),
+             HEADER(String, accept, "Accept"), QUERY(String, topk), QUERY(String, params), BODY_STRING(String, body))
+
     API_CALL("GET", "/system/{msg}", cmd, PATH(String, cmd_str, "msg"), QUERY(String, action), QUERY(String, target))
 
     API_CALL("PUT", "/system/{op}", op, PATH(String, cmd_str, "op"), BODY_STRING(String, body))
@@ -727,6 +735,53 @@ TEST_F(WebControllerTest, INSERT_IDS) {
     ASSERT_EQ(OStatus::CODE_204.code, response->getStatusCode());
 }
 
+TEST_F(WebControllerTest, INSERT_SEARCH_BINARY) {
+    auto collection_name = "test_insert_binary_collection_test" + OString(RandomName().c_str());
+    const int64_t dim = 16;
+    GenCollection(client_ptr, conncetion_ptr, collection_name, dim, 100, "L2");
+
+    std::default_random_engine e;
+    std::uniform_real_distribution<float> u(0, 1);
+    std::vector<float> data(20 * dim);
+    for (auto& value : data) {
+        value = u(e);
+    }
+    OString body((const char*)data.data(), data.size() * sizeof(float), true);
+
+    auto response = client_ptr->insertBinary(collection_name, "application/octet-stream", body, conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_201.code, response->getStatusCode()) << response->readBodyToString()->std_str();
+    auto result_dto = response->readBodyToDto<milvus::server::web::VectorIdsDto>(object_mapper.get());
+    ASSERT_EQ(20, result_dto->ids->count());
+    auto status = FlushCollection(client_ptr, conncetion_ptr, collection_name);
+    ASSERT_TRUE(status.ok()) << status.message();
+
+    // body size is not a multiple of vector size
+    OString bad_body((const char*)data.data(), dim * sizeof(float) + 1, true);
+    response = client_ptr->insertBinary(collection_name, "application/octet-stream", bad_body, conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_400.code, response->getStatusCode());
+
+    // search 2 vectors, results are returned as nq, topk, ids and distances
+    OString query_body((const char*)data.data(), 2 * dim * sizeof(float), true);
+    response = client_ptr->searchBinary(collection_name, "application/octet-stream", "application/octet-stream", "1",
+                                        "{\"nprobe\": 1}", query_body, conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode()) << response->readBodyToString()->std_str();
+    auto result = response->readBodyToString();
+    ASSERT_EQ(2 * sizeof(int64_t) + 2 * sizeof(int64_t) + 2 * sizeof(float), result->getSize());
+    auto header = reinterpret_cast<const int64_t*>(result->getData());
+    ASSERT_EQ(2, header[0]);
+    ASSERT_EQ(1, header[1]);
+
+    // json result
+    response = client_ptr->searchBinary(collection_name, "application/octet-stream", "application/json", "1",
+                                        "{\"nprobe\": 1}", query_body, conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_200.code, response->getStatusCode());
+    auto result_json = nlohmann::json::parse(response->readBodyToString()->std_str());
+    ASSERT_EQ(2, result_json["num"].get<int64_t>());
+
+    response = client_ptr->dropCollection(collection_name, conncetion_ptr);
+    ASSERT_EQ(OStatus::CODE_204.code, response->getStatusCode());
+}
+
 TEST_F(WebControllerTest, INDEX) {
     auto collection_name = "test_insert_collection_test" + OString(RandomName().c_str());
     GenCollection(client_ptr, conncetion_ptr, collection_name, 64, 100, "L2");
@@ -1581,3 +1636,31 @@ TEST_F(WebUtilTest, ParQueryStrQueryParamLoss) {
     ASSERT_STREQ(status.message().c_str(), msg.c_str());
 
 }
+
+TEST_F(WebUtilTest, ParseNpyHeader) {
+    std::string dict = "{'descr': '<f4', 'fortran_order': False, 'shape': (5, 8), }";
+    std::string npy = std::string("\x93NUMPY\x01\x00", 8);
+    npy.push_back(static_cast<char>(dict.size()));
+    npy.push_back(0);
+    npy += dict;
+    npy += std::string(5 * 8 * sizeof(float), '\0');
+
+    std::string descr;
+    std::vector<int64_t> shape;
+    size_t header_size = 0;
+    milvus::Status status =
+        milvus::server::web::ParseNpyHeader(npy.data(), npy.size(), descr, shape, header_size);
+    ASSERT_TRUE(status.ok()) << status.message();
+    ASSERT_EQ("<f4", descr);
+    ASSERT_EQ(std::vector<int64_t>({5, 8}), shape);
+    ASSERT_EQ(10 + dict.size(), header_size);
+
+    status = milvus::server::web::ParseNpyHeader(npy.data(), 12, descr, shape, header_size);
+    ASSERT_EQ(milvus::server::web::ILLEGAL_BODY, status.code());
+
+    status = milvus::server::web::ParseNpyHeader(dict.data(), dict.size(), descr, shape, header_size);
+    ASSERT_EQ(milvus::server::web::ILLEGAL_BODY, status.code());
+
+    ASSERT_TRUE(milvus::server::web::IsContentType("application/x-npy; charset=binary", "application/x-npy"));
+    ASSERT_FALSE(milvus::server::web::IsContentType("application/json", "application/x-npy"));
+}
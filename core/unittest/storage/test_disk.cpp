@@ -17,6 +17,7 @@
 #include "storage/disk/DiskIOReader.h"
 #include "storage/disk/DiskIOWriter.h"
 #include "storage/disk/DiskOperation.h"
+#include "storage/disk/MmapIOReader.h"
 #include "storage/utils.h"
 
 INITIALIZE_EASYLOGGINGPP
@@ -64,6 +65,58 @@ TEST_F(StorageTest, DISK_RW_TEST) {
     }
 }
 
+TEST_F(StorageTest, MMAP_READ_TEST) {
+    const std::string index_name = "/tmp/test_mmap_index";
+    const std::string content = "abcdefg";
+
+    {
+        milvus::storage::DiskIOWriter writer;
+        ASSERT_TRUE(writer.open(index_name));
+        size_t len = content.length();
+        writer.write(&len, sizeof(len));
+        writer.write((void*)(content.data()), len);
+        writer.close();
+    }
+
+    std::shared_ptr<uint8_t[]> shared_data;
+    {
+        milvus::storage::MmapIOReader reader;
+        ASSERT_FALSE(reader.open("/tmp/notexist"));
+        ASSERT_TRUE(reader.open(index_name));
+        ASSERT_EQ(reader.length(), content.length() + sizeof(size_t));
+
+        size_t len = 0;
+        reader.read(&len, sizeof(len));
+        ASSERT_EQ(len, content.length());
+
+        shared_data = reader.read_shared(len);
+        ASSERT_NE(shared_data, nullptr);
+
+        reader.seekg(sizeof(len));
+        std::string content_out(len, '\0');
+        reader.read(&content_out[0], len);
+        ASSERT_EQ(content, content_out);
+
+        // nothing left to read
+        ASSERT_ANY_THROW(reader.read(&len, sizeof(len)));
+        reader.close();
+    }
+
+    // the shared buffer outlives the reader
+    ASSERT_EQ(content, std::string(reinterpret_cast<char*>(shared_data.get()), content.length()));
+
+    {
+        milvus::storage::DiskIOWriter writer;
+        ASSERT_TRUE(writer.open(index_name));
+        writer.close();
+
+        milvus::storage::MmapIOReader reader;
+        ASSERT_TRUE(reader.open(index_name));
+        ASSERT_EQ(reader.length(), 0);
+        reader.close();
+    }
+}
+
 TEST_F(StorageTest, DISK_OPERATION_TEST) {
     auto disk_operation = milvus::storage::DiskOperation("/tmp/milvus_test/milvus_disk_operation_test");
 
@@ -96,6 +96,8 @@ Utils::IndexTypeName(const milvus::IndexType& index_type) {
         case milvus::IndexType::SPTAGBKT:return "SPTAGBKT";
         case milvus::IndexType::HNSW:return "HNSW";
         case milvus::IndexType::ANNOY:return "ANNOY";
+        case milvus::IndexType::HNSW_SQ8:return "HNSW_SQ8";
+        case milvus::IndexType::IVF_PQ_FASTSCAN:return "IVF_PQ_FASTSCAN";
         default:return "Unknown index type";
     }
 }
@@ -57,6 +57,21 @@ CopyRowRecord(::milvus::grpc::RowRecord* target, const Entity& src) {
     }
 }
 
+::milvus::grpc::VectorDataType
+PackedDataType(const PackedEntities& entities) {
+    return entities.binary_data.empty() ? ::milvus::grpc::VECTOR_FLOAT : ::milvus::grpc::VECTOR_BINARY;
+}
+
+const void*
+PackedData(const PackedEntities& entities, size_t& size) {
+    if (entities.binary_data.empty()) {
+        size = entities.float_data.size() * sizeof(float);
+        return entities.float_data.data();
+    }
+    size = entities.binary_data.size();
+    return entities.binary_data.data();
+}
+
 void
 ConstructTopkResult(const ::milvus::grpc::TopKQueryResult& grpc_result, TopKQueryResult& topk_query_result) {
     topk_query_result.reserve(grpc_result.row_num());
@@ -275,6 +290,98 @@ ClientProxy::Insert(const std::string& collection_name, const std::string& parti
     return status;
 }
 
+Status
+ClientProxy::InsertPacked(const std::string& collection_name, const std::string& partition_tag,
+                          const PackedEntities& entities, std::vector<int64_t>& id_array) {
+    Status status = Status::OK();
+    try {
+        ::milvus::grpc::PackedInsertParam insert_param;
+        insert_param.set_collection_name(collection_name);
+        insert_param.set_partition_tag(partition_tag);
+
+        // all vectors are copied into the request with one memcpy
+        size_t data_size = 0;
+        const void* data = PackedData(entities, data_size);
+        insert_param.set_data_type(PackedDataType(entities));
+        insert_param.set_dimension(entities.dimension);
+        insert_param.set_vector_data(data, data_size);
+
+        ::milvus::grpc::VectorIds vector_ids;
+        if (!id_array.empty()) {
+            /* set user's ids */
+            auto row_ids = insert_param.mutable_row_id_array();
+            row_ids->Resize(static_cast<int>(id_array.size()), -1);
+            memcpy(row_ids->mutable_data(), id_array.data(), id_array.size() * sizeof(int64_t));
+            status = client_ptr_->InsertPacked(insert_param, vector_ids);
+        } else {
+            status = client_ptr_->InsertPacked(insert_param, vector_ids);
+            /* return Milvus generated ids back to user */
+            id_array.insert(id_array.end(), vector_ids.vector_id_array().begin(), vector_ids.vector_id_array().end());
+        }
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to add packed entities: " + std::string(ex.what()));
+    }
+
+    return status;
+}
+
+Status
+ClientProxy::InsertStream(const std::string& collection_name, const std::string& partition_tag,
+                          const std::vector<PackedEntities>& chunks, std::vector<int64_t>& id_array, int64_t& lsn) {
+    Status status = Status::OK();
+    try {
+        // user's ids are split to chunks by row count
+        std::vector<::milvus::grpc::PackedInsertParam> insert_params(chunks.size());
+        size_t id_offset = 0;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            ::milvus::grpc::PackedInsertParam& insert_param = insert_params[i];
+            insert_param.set_collection_name(collection_name);
+            insert_param.set_partition_tag(partition_tag);
+
+            const PackedEntities& chunk = chunks[i];
+            size_t data_size = 0;
+            const void* data = PackedData(chunk, data_size);
+            insert_param.set_data_type(PackedDataType(chunk));
+            insert_param.set_dimension(chunk.dimension);
+            insert_param.set_vector_data(data, data_size);
+
+            if (!id_array.empty() && chunk.dimension > 0) {
+                size_t row_count = chunk.binary_data.empty() ? chunk.float_data.size() / chunk.dimension
+                                                             : chunk.binary_data.size() * 8 / chunk.dimension;
+                if (id_offset + row_count > id_array.size()) {
+                    return Status(StatusCode::InvalidAgument, "Id array size doesn't match entity count");
+                }
+                auto row_ids = insert_param.mutable_row_id_array();
+                row_ids->Resize(static_cast<int>(row_count), -1);
+                memcpy(row_ids->mutable_data(), id_array.data() + id_offset, row_count * sizeof(int64_t));
+                id_offset += row_count;
+            }
+        }
+        if (id_offset != id_array.size()) {
+            return Status(StatusCode::InvalidAgument, "Id array size doesn't match entity count");
+        }
+
+        ::milvus::grpc::InsertStreamResult result;
+        bool user_provide_ids = !id_array.empty();
+        status = client_ptr_->InsertStream(insert_params, result);
+        lsn = result.lsn();
+
+        if (!user_provide_ids) {
+            /* return Milvus generated ids back to user */
+            id_array.reserve(result.row_count());
+            for (auto& range : result.id_ranges()) {
+                for (int64_t k = 0; k < range.count(); ++k) {
+                    id_array.push_back(range.first_id() + k);
+                }
+            }
+        }
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to add entity stream: " + std::string(ex.what()));
+    }
+
+    return status;
+}
+
 Status
 ClientProxy::GetEntityByID(const std::string& collection_name, const std::string& partition_tag,
                            const std::vector<int64_t>& id_array, std::vector<Entity>& entities_data) {
@@ -371,6 +478,37 @@ ClientProxy::Search(const std::string& collection_name, const std::vector<std::s
     }
 }
 
+Status
+ClientProxy::SearchPacked(const std::string& collection_name, const std::vector<std::string>& partition_tag_array,
+                          const PackedEntities& entities, int64_t topk, const std::string& extra_params,
+                          TopKQueryResult& topk_query_result) {
+    try {
+        // step 1: convert vectors data
+        ::milvus::grpc::PackedSearchParam search_param;
+        ConstructSearchParam(collection_name, partition_tag_array, topk, extra_params, search_param);
+
+        size_t data_size = 0;
+        const void* data = PackedData(entities, data_size);
+        search_param.set_data_type(PackedDataType(entities));
+        search_param.set_dimension(entities.dimension);
+        search_param.set_query_data(data, data_size);
+
+        // step 2: search vectors
+        ::milvus::grpc::TopKQueryResult grpc_result;
+        Status status = client_ptr_->SearchPacked(search_param, grpc_result);
+        if (grpc_result.row_num() == 0) {
+            return status;
+        }
+
+        // step 3: convert result array
+        ConstructTopkResult(grpc_result, topk_query_result);
+
+        return status;
+    } catch (std::exception& ex) {
+        return Status(StatusCode::UnknownError, "Failed to search packed entities: " + std::string(ex.what()));
+    }
+}
+
 Status
 ClientProxy::GetCollectionInfo(const std::string& collection_name, CollectionParam& collection_param) {
     try {
@@ -66,6 +66,14 @@ class ClientProxy : public Connection {
     Insert(const std::string& collection_name, const std::string& partition_tag,
            const std::vector<Entity>& entity_array, std::vector<int64_t>& id_array) override;
 
+    Status
+    InsertPacked(const std::string& collection_name, const std::string& partition_tag, const PackedEntities& entities,
+                 std::vector<int64_t>& id_array) override;
+
+    Status
+    InsertStream(const std::string& collection_name, const std::string& partition_tag,
+                 const std::vector<PackedEntities>& chunks, std::vector<int64_t>& id_array, int64_t& lsn) override;
+
     Status
     GetEntityByID(const std::string& collection_name, const std::string& partition_tag,
                   const std::vector<int64_t>& id_array, std::vector<Entity>& entities_data) override;
@@ -79,6 +87,11 @@ class ClientProxy : public Connection {
            const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
            TopKQueryResult& topk_query_result) override;
 
+    Status
+    SearchPacked(const std::string& collection_name, const std::vector<std::string>& partition_tag_array,
+                 const PackedEntities& entities, int64_t topk, const std::string& extra_params,
+                 TopKQueryResult& topk_query_result) override;
+
     Status
     GetCollectionInfo(const std::string& collection_name, CollectionParam& collection_param) override;
 
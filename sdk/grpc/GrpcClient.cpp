@@ -124,6 +124,50 @@ GrpcClient::Insert(const ::milvus::grpc::InsertParam& insert_param, ::milvus::gr
     return Status::OK();
 }
 
+Status
+GrpcClient::InsertPacked(const ::milvus::grpc::PackedInsertParam& insert_param, ::milvus::grpc::VectorIds& vector_ids) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->InsertPacked(&context, insert_param, &vector_ids);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "InsertPacked rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (vector_ids.status().error_code() != grpc::SUCCESS) {
+        std::cerr << vector_ids.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, vector_ids.status().reason());
+    }
+
+    return Status::OK();
+}
+
+Status
+GrpcClient::InsertStream(const std::vector<::milvus::grpc::PackedInsertParam>& insert_params,
+                         ::milvus::grpc::InsertStreamResult& result) {
+    ClientContext context;
+    std::unique_ptr<::grpc::ClientWriter<::milvus::grpc::PackedInsertParam>> writer(
+        stub_->InsertStream(&context, &result));
+    for (auto& insert_param : insert_params) {
+        if (!writer->Write(insert_param)) {
+            // server closed the stream, the reason is returned by Finish()
+            break;
+        }
+    }
+    writer->WritesDone();
+    ::grpc::Status grpc_status = writer->Finish();
+
+    if (!grpc_status.ok()) {
+        std::cerr << "InsertStream rpc failed!" << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (result.status().error_code() != grpc::SUCCESS) {
+        std::cerr << result.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, result.status().reason());
+    }
+
+    return Status::OK();
+}
+
 Status
 GrpcClient::GetEntityByID(const grpc::VectorsIdentity& vectors_identity, ::milvus::grpc::VectorsData& vectors_data) {
     ClientContext context;
@@ -178,6 +222,25 @@ GrpcClient::Search(const ::milvus::grpc::SearchParam& search_param,
     return Status::OK();
 }
 
+Status
+GrpcClient::SearchPacked(const ::milvus::grpc::PackedSearchParam& search_param,
+                         ::milvus::grpc::TopKQueryResult& topk_query_result) {
+    ClientContext context;
+    ::grpc::Status grpc_status = stub_->SearchPacked(&context, search_param, &topk_query_result);
+
+    if (!grpc_status.ok()) {
+        std::cerr << "SearchPacked rpc failed!" << std::endl;
+        std::cerr << grpc_status.error_message() << std::endl;
+        return Status(StatusCode::RPCFailed, grpc_status.error_message());
+    }
+    if (topk_query_result.status().error_code() != grpc::SUCCESS) {
+        std::cerr << topk_query_result.status().reason() << std::endl;
+        return Status(StatusCode::ServerFailed, topk_query_result.status().reason());
+    }
+
+    return Status::OK();
+}
+
 Status
 GrpcClient::GetCollectionInfo(const std::string& collection_name, ::milvus::grpc::CollectionSchema& grpc_schema) {
     ClientContext context;
@@ -50,6 +50,12 @@ class GrpcClient {
     Status
     Insert(const grpc::InsertParam& insert_param, grpc::VectorIds& vector_ids);
 
+    Status
+    InsertPacked(const grpc::PackedInsertParam& insert_param, grpc::VectorIds& vector_ids);
+
+    Status
+    InsertStream(const std::vector<grpc::PackedInsertParam>& insert_params, grpc::InsertStreamResult& result);
+
     Status
     GetEntityByID(const grpc::VectorsIdentity& vectors_identity, ::milvus::grpc::VectorsData& vectors_data);
 
@@ -59,6 +65,9 @@ class GrpcClient {
     Status
     Search(const grpc::SearchParam& search_param, ::milvus::grpc::TopKQueryResult& topk_query_result);
 
+    Status
+    SearchPacked(const grpc::PackedSearchParam& search_param, ::milvus::grpc::TopKQueryResult& topk_query_result);
+
     Status
     GetCollectionInfo(const std::string& collection_name, grpc::CollectionSchema& grpc_schema);
 
@@ -30,6 +30,15 @@ struct Entity {
     std::vector<uint8_t> binary_data;  ///< Vector raw binary data
 };
 
+/**
+ * @brief Entities packed into one contiguous row-major buffer
+ */
+struct PackedEntities {
+    int64_t dimension = 0;             ///< Vector dimension, binary vector dimension is in bits
+    std::vector<float> float_data;     ///< Raw float data of all vectors, size = count * dimension
+    std::vector<uint8_t> binary_data;  ///< Raw binary data of all vectors, size = count * dimension / 8
+};
+
 /**
  * @brief Index Type
  */
@@ -45,6 +54,8 @@ enum class IndexType {
     SPTAGBKT = 8,
     HNSW = 11,
     ANNOY = 12,
+    HNSW_SQ8 = 13,
+    IVF_PQ_FASTSCAN = 14,
 };
 
 enum class MetricType {
@@ -102,6 +113,15 @@ using TopKQueryResult = std::vector<QueryResult>;  ///< Topk query result
  *       HNSW  {M: 16, efConstruction:300}
  *           ///< M range:[5, 48]
  *           ///< efConstruction range:[100, 500]
+ *       HNSW_SQ8  {M: 16, efConstruction:300, rerank:true}
+ *           ///< same ranges as HNSW, vectors are stored as 8-bit codes
+ *           ///< rerank keeps the raw vectors in memory to re-rank the results by exact distances
+ *       IVF_PQ_FASTSCAN  {nlist: 16384, m: 32, rerank:true}
+ *           ///< nlist range:[1, 65536]
+ *           ///< dim must be divisible by m, the codes are 4-bit and scanned on CPU only
+ *           ///< rerank keeps the raw vectors in memory to re-rank the results by exact distances
+ *       NSG/HNSW/HNSW_SQ8 also accept {reorder: true}
+ *           ///< renumber the graph nodes after build so that neighbors are close in memory
  */
 struct IndexParam {
     std::string collection_name;  ///< Collection name for create index
@@ -318,6 +338,48 @@ class Connection {
     Insert(const std::string& collection_name, const std::string& partition_tag,
            const std::vector<Entity>& entity_array, std::vector<int64_t>& id_array) = 0;
 
+    /**
+     * @brief Insert packed entities to collection
+     *
+     * This method is used to insert vectors packed in one buffer to collection.
+     * The buffer is sent as one bytes field, avoiding per-vector message overhead.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param entities, packed entities to be inserted.
+     * @param id_array,
+     *  specify id for each entity,
+     *  if this array is empty, milvus will generate unique id for each entity,
+     *  and return all ids by this parameter.
+     *
+     * @return Indicate if entities are inserted successfully
+     */
+    virtual Status
+    InsertPacked(const std::string& collection_name, const std::string& partition_tag, const PackedEntities& entities,
+                 std::vector<int64_t>& id_array) = 0;
+
+    /**
+     * @brief Insert a stream of packed entity chunks to collection
+     *
+     * This method is used to insert chunks of packed vectors to collection through one streaming rpc.
+     * The server inserts a chunk while receiving the next one,
+     * and slows the stream down when its insert buffer is full.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag, target partition's tag, keep empty if no partition specified.
+     * @param chunks, packed entity chunks to be inserted in order.
+     * @param id_array,
+     *  specify id for each entity of all chunks in order,
+     *  if this array is empty, milvus will generate unique id for each entity,
+     *  and return all ids by this parameter.
+     * @param lsn, returned wal position covering the inserted entities.
+     *
+     * @return Indicate if entities are inserted successfully
+     */
+    virtual Status
+    InsertStream(const std::string& collection_name, const std::string& partition_tag,
+                 const std::vector<PackedEntities>& chunks, std::vector<int64_t>& id_array, int64_t& lsn) = 0;
+
     /**
      * @brief Get entity data by id
      *
@@ -367,8 +429,10 @@ class Connection {
      *           ///< nprobe range:[1,999999]
      *       NSG:  {search_length:100}
      *           ///< search_length range:[10, 300]
-     *       HNSW  {ef: 64}
+     *       HNSW/HNSW_SQ8  {ef: 64}
      *           ///< ef range:[topk, 4096]
+     *       IVF_PQ_FASTSCAN  {nprobe: 32, k_factor: 4}
+     *           ///< k_factor range:[1, 64], topk * k_factor candidates are re-ranked when built with rerank
      * @param topk_query_result, result array.
      *
      * @return Indicate if query is successful.
@@ -378,6 +442,25 @@ class Connection {
            const std::vector<Entity>& entity_array, int64_t topk, const std::string& extra_params,
            TopKQueryResult& topk_query_result) = 0;
 
+    /**
+     * @brief Search packed entities in a collection
+     *
+     * This method is used to query entity in collection with query vectors packed in one buffer.
+     *
+     * @param collection_name, target collection's name.
+     * @param partition_tag_array, target partitions, keep empty if no partition specified.
+     * @param entities, packed vectors to be queried.
+     * @param topk, how many similarity entities will be returned.
+     * @param extra_params, extra search parameters according to different index type, must be json format.
+     * @param topk_query_result, result array.
+     *
+     * @return Indicate if query is successful.
+     */
+    virtual Status
+    SearchPacked(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                 const PackedEntities& entities, int64_t topk, const std::string& extra_params,
+                 TopKQueryResult& topk_query_result) = 0;
+
     /**
      * @brief Get collection information
      *
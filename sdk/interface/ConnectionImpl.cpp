@@ -102,6 +102,18 @@ ConnectionImpl::Insert(const std::string& collection_name, const std::string& pa
     return client_proxy_->Insert(collection_name, partition_tag, entity_array, id_array);
 }
 
+Status
+ConnectionImpl::InsertPacked(const std::string& collection_name, const std::string& partition_tag,
+                             const PackedEntities& entities, std::vector<int64_t>& id_array) {
+    return client_proxy_->InsertPacked(collection_name, partition_tag, entities, id_array);
+}
+
+Status
+ConnectionImpl::InsertStream(const std::string& collection_name, const std::string& partition_tag,
+                             const std::vector<PackedEntities>& chunks, std::vector<int64_t>& id_array, int64_t& lsn) {
+    return client_proxy_->InsertStream(collection_name, partition_tag, chunks, id_array, lsn);
+}
+
 Status
 ConnectionImpl::GetEntityByID(const std::string& collection_name, const std::string& partition_tag,
                               const std::vector<int64_t>& id_array, std::vector<Entity>& entities_data) {
@@ -122,6 +134,14 @@ ConnectionImpl::Search(const std::string& collection_name, const PartitionTagLis
                                  topk_query_result);
 }
 
+Status
+ConnectionImpl::SearchPacked(const std::string& collection_name, const PartitionTagList& partition_tag_array,
+                             const PackedEntities& entities, int64_t topk, const std::string& extra_params,
+                             TopKQueryResult& topk_query_result) {
+    return client_proxy_->SearchPacked(collection_name, partition_tag_array, entities, topk, extra_params,
+                                       topk_query_result);
+}
+
 Status
 ConnectionImpl::GetCollectionInfo(const std::string& collection_name, CollectionParam& collection_schema) {
     return client_proxy_->GetCollectionInfo(collection_name, collection_schema);